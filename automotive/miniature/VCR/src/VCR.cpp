@@ -21,7 +21,6 @@
 
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
 #include "opendavinci/odcore/data/Container.h"
-#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
 
 #include "opendavinci/GeneratedHeaders_OpenDaVINCI.h"
 
@@ -37,7 +36,7 @@ namespace automotive {
 
         VCR::VCR(const int32_t &argc, char **argv) : TimeTriggeredConferenceClientModule(argc, argv, "VCR"),
 	        m_hasAttachedToSharedImageMemory(false),
-            m_sharedImageMemory(),
+            m_sharedImageChannel(),
 	        m_image(NULL),
             m_debug(false),
             m_writer(NULL) {}
@@ -76,42 +75,31 @@ namespace automotive {
 
 		        // Check if we have already attached to the shared memory.
 		        if (!m_hasAttachedToSharedImageMemory) {
-			        m_sharedImageMemory
-					        = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(
-							        si.getName());
+			        m_sharedImageChannel
+					        = std::shared_ptr<SharedImageChannel>(new SharedImageChannel(si));
+			        m_hasAttachedToSharedImageMemory = m_sharedImageChannel->isValid();
 		        }
 
 		        // Check if we could successfully attach to the shared memory.
-		        if (m_sharedImageMemory->isValid()) {
+		        if (m_sharedImageChannel->isValid()) {
 			        //cerr << "Got image: LOG 0.2 " << si.toString() << endl;
 
-			        // Lock the memory region to gain exclusive access. REMEMBER!!! DO NOT FAIL WITHIN lock() / unlock(), otherwise, the image producing process would fail.
-			        m_sharedImageMemory->lock();
-			        {
-				        // Here, do something with the image. For example, we simply show the image.
-
-				        const uint32_t numberOfChannels = 3;
-				        // For example, simply show the image.
-				        if (m_image == NULL) {
-					        m_image = cvCreateImage(cvSize(si.getWidth(),
-							        si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
-				        }
-
-				        // Copying the image data is very expensive...
-				        if (m_image != NULL) {
-					        memcpy(m_image->imageData,
-							        m_sharedImageMemory->getSharedMemory(),
-							        si.getWidth() * si.getHeight() * numberOfChannels);
-				        }
+			        // Here, do something with the image. For example, we simply show the image.
+			        const uint32_t numberOfChannels = 3;
+			        if (m_image == NULL) {
+				        m_image = cvCreateImage(cvSize(si.getWidth(),
+						        si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
 			        }
 
-			        // Release the memory region so that the image produce (i.e. the camera for example) can provide the next raw image data.
-			        m_sharedImageMemory->unlock();
+			        // Copying the image data is very expensive; the image producer (i.e. the camera for example)
+			        // can provide the next raw image data meanwhile.
+			        if ( (m_image != NULL) &&
+			             m_sharedImageChannel->read(m_image->imageData, si.getWidth() * si.getHeight() * numberOfChannels) ) {
+				        // Mirror the image.
+				        cvFlip(m_image, 0, -1);
 
-			        // Mirror the image.
-			        cvFlip(m_image, 0, -1);
-
-			        retVal = true;
+				        retVal = true;
+			        }
 		        }
 	        }
 	        return retVal;
@@ -24,7 +24,7 @@
 
 #include <memory>
 #include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
-#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/data/image/SharedImageChannel.h"
 
 namespace automotive {
     namespace miniature {
@@ -79,7 +79,7 @@ namespace automotive {
 
             private:
 	            bool m_hasAttachedToSharedImageMemory;
-	            std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedImageMemory;
+	            std::shared_ptr<odcore::data::image::SharedImageChannel> m_sharedImageChannel;
 	            IplImage *m_image;
                 bool m_debug;
 
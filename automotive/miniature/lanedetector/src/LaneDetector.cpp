@@ -24,9 +24,7 @@
 #include <opencv/highgui.h>
 
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
-#include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/data/Container.h"
-#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
 
 #include "opendavinci/odtools/player/Player.h"
 
@@ -49,7 +47,7 @@ namespace automotive {
         LaneDetector::LaneDetector(const int32_t &argc, char **argv) :
             TimeTriggeredConferenceClientModule(argc, argv, "LaneDetector"),
             m_hasAttachedToSharedImageMemory(false),
-            m_sharedImageMemory(),
+            m_sharedImageChannel(),
             m_image(NULL),
             m_debug(false) {}
 
@@ -84,27 +82,24 @@ namespace automotive {
 
 		        // Check if we have already attached to the shared memory containing the image from the virtual camera.
 		        if (!m_hasAttachedToSharedImageMemory) {
-			        m_sharedImageMemory = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
+			        m_sharedImageChannel = std::shared_ptr<SharedImageChannel>(new SharedImageChannel(si));
+			        m_hasAttachedToSharedImageMemory = m_sharedImageChannel->isValid();
 		        }
 
 		        // Check if we could successfully attach to the shared memory.
-		        if (m_sharedImageMemory->isValid()) {
-			        // Lock the memory region to gain exclusive access using a scoped lock.
-                    Lock l(m_sharedImageMemory);
-
+		        if (m_sharedImageChannel->isValid()) {
 			        if (m_image == NULL) {
 				        m_image = cvCreateImage(cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, si.getBytesPerPixel());
 			        }
 
-			        // Example: Simply copy the image into our process space.
-			        if (m_image != NULL) {
-				        memcpy(m_image->imageData, m_sharedImageMemory->getSharedMemory(), si.getWidth() * si.getHeight() * si.getBytesPerPixel());
-			        }
-
-			        // Mirror the image.
-			        cvFlip(m_image, 0, -1);
+			        // Example: Simply copy the newest image into our process space.
+			        if ( (m_image != NULL) &&
+			             m_sharedImageChannel->read(m_image->imageData, si.getWidth() * si.getHeight() * si.getBytesPerPixel()) ) {
+				        // Mirror the image.
+				        cvFlip(m_image, 0, -1);
 
-			        retVal = true;
+				        retVal = true;
+			        }
 		        }
 	        }
 	        return retVal;
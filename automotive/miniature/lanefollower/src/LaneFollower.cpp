@@ -23,10 +23,8 @@
 #include <opencv/highgui.h>
 
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
-#include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/io/conference/ContainerConference.h"
-#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
 
 #include "automotivedata/GeneratedHeaders_AutomotiveData.h"
 #include "opendavinci/GeneratedHeaders_OpenDaVINCI.h"
@@ -45,7 +43,7 @@ namespace automotive {
 
         LaneFollower::LaneFollower(const int32_t &argc, char **argv) : TimeTriggeredConferenceClientModule(argc, argv, "lanefollower"),
             m_hasAttachedToSharedImageMemory(false),
-            m_sharedImageMemory(),
+            m_sharedImageChannel(),
             m_image(NULL),
             m_debug(false),
             m_font(),
@@ -84,32 +82,27 @@ namespace automotive {
 
 		        // Check if we have already attached to the shared memory.
 		        if (!m_hasAttachedToSharedImageMemory) {
-			        m_sharedImageMemory
-					        = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(
-							        si.getName());
+			        m_sharedImageChannel
+					        = std::shared_ptr<SharedImageChannel>(new SharedImageChannel(si));
+			        m_hasAttachedToSharedImageMemory = m_sharedImageChannel->isValid();
 		        }
 
 		        // Check if we could successfully attach to the shared memory.
-		        if (m_sharedImageMemory->isValid()) {
-			        // Lock the memory region to gain exclusive access using a scoped lock.
-                    Lock l(m_sharedImageMemory);
+		        if (m_sharedImageChannel->isValid()) {
 			        const uint32_t numberOfChannels = 3;
 			        // For example, simply show the image.
 			        if (m_image == NULL) {
 				        m_image = cvCreateImage(cvSize(si.getWidth(), si.getHeight()), IPL_DEPTH_8U, numberOfChannels);
 			        }
 
-			        // Copying the image data is very expensive...
-			        if (m_image != NULL) {
-				        memcpy(m_image->imageData,
-						       m_sharedImageMemory->getSharedMemory(),
-						       si.getWidth() * si.getHeight() * numberOfChannels);
-			        }
-
-			        // Mirror the image.
-			        cvFlip(m_image, 0, -1);
+			        // Copying the image data is very expensive but does not stall the camera.
+			        if ( (m_image != NULL) &&
+			             m_sharedImageChannel->read(m_image->imageData, si.getWidth() * si.getHeight() * numberOfChannels) ) {
+				        // Mirror the image.
+				        cvFlip(m_image, 0, -1);
 
-			        retVal = true;
+				        retVal = true;
+			        }
 		        }
 	        }
 	        return retVal;
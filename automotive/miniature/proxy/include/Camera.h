@@ -24,7 +24,7 @@
 #include <string>
 
 #include <memory>
-#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/data/image/SharedImageChannel.h"
 #include "opendavinci/GeneratedHeaders_OpenDaVINCI.h"
 
 namespace automotive {
@@ -78,7 +78,7 @@ namespace automotive {
             protected:
                 /**
                  * This method is responsible to copy the image from the
-                 * specific camera driver to the shared memory.
+                 * specific camera driver to the next slot of the shared memory.
                  *
                  * @param dest Pointer where to copy the data.
                  * @param size Number of bytes to copy.
@@ -104,7 +104,7 @@ namespace automotive {
 
             private:
                 odcore::data::image::SharedImage m_sharedImage;
-                std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedMemory;
+                std::shared_ptr<odcore::data::image::SharedImageChannel> m_sharedImageChannel;
                 
             protected:
                 string m_name;
@@ -22,7 +22,6 @@
 #include "opencv2/imgproc/imgproc.hpp"
 #include "opencv2/highgui/highgui.hpp"
 
-#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
 
 #include "Camera.h"
 
@@ -31,7 +30,7 @@ namespace automotive {
 
         Camera::Camera(const string &name, const uint32_t &id, const uint32_t &width, const uint32_t &height, const uint32_t &bpp) :
             m_sharedImage(),
-            m_sharedMemory(),
+            m_sharedImageChannel(),
             m_name(name),
             m_id(id),
             m_width(width),
@@ -39,8 +38,6 @@ namespace automotive {
             m_bpp(bpp),
             m_size(0) {
 
-            m_sharedMemory = odcore::wrapper::SharedMemoryFactory::createSharedMemory(name, width * height * bpp);
-
             m_sharedImage.setName(name);
             m_sharedImage.setWidth(width);
             m_sharedImage.setHeight(height);
@@ -48,6 +45,9 @@ namespace automotive {
 
             m_size = width * height * bpp;
             m_sharedImage.setSize(m_size);
+
+            // Consumers copy the newest frame while the camera captures the next ones.
+            m_sharedImageChannel = std::shared_ptr<odcore::data::image::SharedImageChannel>(new odcore::data::image::SharedImageChannel(m_sharedImage, odcore::data::image::SharedImageChannel::DEFAULT_NUMBER_OF_SLOTS));
         }
 
         Camera::~Camera() {}
@@ -79,10 +79,11 @@ namespace automotive {
         odcore::data::image::SharedImage Camera::capture() {
             if (isValid()) {
                 if (captureFrame()) {
-                    if (m_sharedMemory.get() && m_sharedMemory->isValid()) {
-                        m_sharedMemory->lock();
-                            copyImageTo((char*)m_sharedMemory->getSharedMemory(), m_size);
-                        m_sharedMemory->unlock();
+                    if (m_sharedImageChannel.get() && m_sharedImageChannel->isValid()) {
+                        // The frame is published only if it was copied completely.
+                        if (copyImageTo(m_sharedImageChannel->beginWrite(), m_size)) {
+                            m_sharedImage = m_sharedImageChannel->endWrite();
+                        }
                     }
                 }
             }
@@ -7,12 +7,18 @@
 // v1.04, May. 19, 2012: Forgot to set m_pFile ptr to NULL in cfile_stream::close(). Thanks to Owen Kaluza for reporting this bug.
 //                       Code tweaks to fix VS2008 static code analysis warnings (all looked harmless).
 //                       Code review revealed method load_block_16_8_8() (used for the non-default H2V1 sampling mode to downsample chroma) somehow didn't get the rounding factor fix from v1.02.
+// OpenDaVINCI: Added restart markers, independent compression of restart intervals (strips), and SSE2 RGB to YCbCr conversion.
 
 #include "jpge.h"
 
 #include <cstdlib>
 #include <cstring>
 
+#if defined(__SSE2__) || defined(_M_X64)
+# include <emmintrin.h>
+# define JPGE_USE_SSE2
+#endif
+
 #define JPGE_MAX(a,b) (((a)>(b))?(a):(b))
 #define JPGE_MIN(a,b) (((a)<(b))?(a):(b))
 
@@ -22,7 +28,7 @@ static inline void *jpge_malloc(size_t nSize) { return malloc(nSize); }
 static inline void jpge_free(void *p) { free(p); }
 
 // Various JPEG enums and tables.
-enum { M_SOF0 = 0xC0, M_DHT = 0xC4, M_SOI = 0xD8, M_EOI = 0xD9, M_SOS = 0xDA, M_DQT = 0xDB, M_APP0 = 0xE0 };
+enum { M_SOF0 = 0xC0, M_DHT = 0xC4, M_RST0 = 0xD0, M_SOI = 0xD8, M_EOI = 0xD9, M_SOS = 0xDA, M_DQT = 0xDB, M_DRI = 0xDD, M_APP0 = 0xE0 };
 enum { DC_LUM_CODES = 12, AC_LUM_CODES = 256, DC_CHROMA_CODES = 12, AC_CHROMA_CODES = 256, MAX_HUFF_SYMBOLS = 257, MAX_HUFF_CODESIZE = 32 };
 
 static uint8 s_zag[64] = { 0,1,8,16,9,2,3,10,17,24,32,25,18,11,4,5,12,19,26,33,40,48,41,34,27,20,13,6,7,14,21,28,35,42,49,56,57,50,43,36,29,22,15,23,30,37,44,51,58,59,52,45,38,31,39,46,53,60,61,54,47,55,62,63 };
@@ -59,8 +65,123 @@ template <class T> inline void clear_obj(T &obj) { memset(&obj, 0, sizeof(obj));
 const int YR = 19595, YG = 38470, YB = 7471, CB_R = -11059, CB_G = -21709, CB_B = 32768, CR_R = 32768, CR_G = -27439, CR_B = -5329;
 static inline uint8 clamp(int i) { if (static_cast<uint>(i) > 255U) { if (i < 0) i = 0; else if (i > 255) i = 255; } return static_cast<uint8>(i); }
 
+#ifdef JPGE_USE_SSE2
+// Splits 16 interleaved RGB pixels into three vectors with 16 R, G, and B values each.
+static inline void load_deinterleave_rgb(const uint8 *pSrc, __m128i &r, __m128i &g, __m128i &b)
+{
+  const __m128i t00 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc));
+  const __m128i t01 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + 16));
+  const __m128i t02 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + 32));
+
+  const __m128i t10 = _mm_unpacklo_epi8(t00, _mm_unpackhi_epi64(t01, t01));
+  const __m128i t11 = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t00, t00), t02);
+  const __m128i t12 = _mm_unpacklo_epi8(t01, _mm_unpackhi_epi64(t02, t02));
+
+  const __m128i t20 = _mm_unpacklo_epi8(t10, _mm_unpackhi_epi64(t11, t11));
+  const __m128i t21 = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t10, t10), t12);
+  const __m128i t22 = _mm_unpacklo_epi8(t11, _mm_unpackhi_epi64(t12, t12));
+
+  const __m128i t30 = _mm_unpacklo_epi8(t20, _mm_unpackhi_epi64(t21, t21));
+  const __m128i t31 = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t20, t20), t22);
+  const __m128i t32 = _mm_unpacklo_epi8(t21, _mm_unpackhi_epi64(t22, t22));
+
+  r = _mm_unpacklo_epi8(t30, _mm_unpackhi_epi64(t31, t31));
+  g = _mm_unpacklo_epi8(_mm_unpackhi_epi64(t30, t30), t32);
+  b = _mm_unpacklo_epi8(t31, _mm_unpackhi_epi64(t32, t32));
+}
+
+// Computes (x * c0 + y * c1 + z * c2 + 32768) >> 16 for eight pixels given as 16 bit values;
+// xy contains pairs of x and y, z0 pairs of z and 0. The coefficients must fit into 16 bits.
+static inline __m128i weighted_sum(const __m128i &xy, const __m128i &z0, const __m128i &c01, const __m128i &c2)
+{
+  const __m128i round = _mm_set1_epi32(32768);
+  return _mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(_mm_madd_epi16(xy, c01), _mm_madd_epi16(z0, c2)), round), 16);
+}
+
+// Converts eight pixels given as 16 bit values; the results are returned as 16 bit values.
+static inline void RGB_to_YCC_8(const __m128i &r, const __m128i &g, const __m128i &b, __m128i &y, __m128i &cb, __m128i &cr)
+{
+  // YG, CB_B, and CR_R do not fit into 16 bits; thus, the doubled values are multiplied with the halved coefficients.
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i g2 = _mm_add_epi16(g, g), b2 = _mm_add_epi16(b, b), r2 = _mm_add_epi16(r, r);
+  const __m128i offset = _mm_set1_epi16(128);
+
+  const __m128i c_y01 = _mm_setr_epi16(YR, YG / 2, YR, YG / 2, YR, YG / 2, YR, YG / 2), c_y2 = _mm_setr_epi16(YB, 0, YB, 0, YB, 0, YB, 0);
+  const __m128i c_cb01 = _mm_setr_epi16(CB_R, CB_G, CB_R, CB_G, CB_R, CB_G, CB_R, CB_G), c_cb2 = _mm_setr_epi16(CB_B / 2, 0, CB_B / 2, 0, CB_B / 2, 0, CB_B / 2, 0);
+  const __m128i c_cr01 = _mm_setr_epi16(CR_R / 2, CR_G, CR_R / 2, CR_G, CR_R / 2, CR_G, CR_R / 2, CR_G), c_cr2 = _mm_setr_epi16(CR_B, 0, CR_B, 0, CR_B, 0, CR_B, 0);
+
+  const __m128i rg2_lo = _mm_unpacklo_epi16(r, g2), rg2_hi = _mm_unpackhi_epi16(r, g2);
+  const __m128i rg_lo = _mm_unpacklo_epi16(r, g), rg_hi = _mm_unpackhi_epi16(r, g);
+  const __m128i r2g_lo = _mm_unpacklo_epi16(r2, g), r2g_hi = _mm_unpackhi_epi16(r2, g);
+  const __m128i b0_lo = _mm_unpacklo_epi16(b, zero), b0_hi = _mm_unpackhi_epi16(b, zero);
+  const __m128i b20_lo = _mm_unpacklo_epi16(b2, zero), b20_hi = _mm_unpackhi_epi16(b2, zero);
+
+  y = _mm_packs_epi32(weighted_sum(rg2_lo, b0_lo, c_y01, c_y2), weighted_sum(rg2_hi, b0_hi, c_y01, c_y2));
+  cb = _mm_add_epi16(offset, _mm_packs_epi32(weighted_sum(rg_lo, b20_lo, c_cb01, c_cb2), weighted_sum(rg_hi, b20_hi, c_cb01, c_cb2)));
+  cr = _mm_add_epi16(offset, _mm_packs_epi32(weighted_sum(r2g_lo, b0_lo, c_cr01, c_cr2), weighted_sum(r2g_hi, b0_hi, c_cr01, c_cr2)));
+}
+
+// Interleaves three vectors with 16 Y, Cb, and Cr values each and stores them as 16 pixels.
+static inline void store_interleave_ycc(uint8 *pDst, const __m128i &a, const __m128i &b, const __m128i &c)
+{
+  const __m128i z = _mm_setzero_si128();
+  const __m128i ab0 = _mm_unpacklo_epi8(a, b);
+  const __m128i ab1 = _mm_unpackhi_epi8(a, b);
+  const __m128i c0 = _mm_unpacklo_epi8(c, z);
+  const __m128i c1 = _mm_unpackhi_epi8(c, z);
+
+  const __m128i p00 = _mm_unpacklo_epi16(ab0, c0);
+  const __m128i p01 = _mm_unpackhi_epi16(ab0, c0);
+  const __m128i p02 = _mm_unpacklo_epi16(ab1, c1);
+  const __m128i p03 = _mm_unpackhi_epi16(ab1, c1);
+
+  const __m128i p10 = _mm_unpacklo_epi32(p00, p01);
+  const __m128i p11 = _mm_unpackhi_epi32(p00, p01);
+  const __m128i p12 = _mm_unpacklo_epi32(p02, p03);
+  const __m128i p13 = _mm_unpackhi_epi32(p02, p03);
+
+  __m128i p20 = _mm_unpacklo_epi64(p10, p11);
+  const __m128i p21 = _mm_unpackhi_epi64(p10, p11);
+  __m128i p22 = _mm_unpacklo_epi64(p12, p13);
+  const __m128i p23 = _mm_unpackhi_epi64(p12, p13);
+
+  p20 = _mm_slli_si128(p20, 1);
+  p22 = _mm_slli_si128(p22, 1);
+
+  const __m128i p30 = _mm_slli_epi64(_mm_unpacklo_epi32(p20, p21), 8);
+  const __m128i p31 = _mm_srli_epi64(_mm_unpackhi_epi32(p20, p21), 8);
+  const __m128i p32 = _mm_slli_epi64(_mm_unpacklo_epi32(p22, p23), 8);
+  const __m128i p33 = _mm_srli_epi64(_mm_unpackhi_epi32(p22, p23), 8);
+
+  const __m128i p40 = _mm_unpacklo_epi64(p30, p31);
+  const __m128i p41 = _mm_unpackhi_epi64(p30, p31);
+  const __m128i p42 = _mm_unpacklo_epi64(p32, p33);
+  const __m128i p43 = _mm_unpackhi_epi64(p32, p33);
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst), _mm_or_si128(_mm_srli_si128(p40, 2), _mm_slli_si128(p41, 10)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + 16), _mm_or_si128(_mm_srli_si128(p41, 6), _mm_slli_si128(p42, 6)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + 32), _mm_or_si128(_mm_srli_si128(p42, 10), _mm_slli_si128(p43, 2)));
+}
+#endif
+
 static void RGB_to_YCC(uint8* pDst, const uint8 *pSrc, int num_pixels)
 {
+#ifdef JPGE_USE_SSE2
+  // 16 pixels at a time; the results are identical to the scalar conversion below.
+  const __m128i zero = _mm_setzero_si128();
+  for ( ; num_pixels >= 16; pDst += 48, pSrc += 48, num_pixels -= 16)
+  {
+    __m128i r, g, b;
+    load_deinterleave_rgb(pSrc, r, g, b);
+
+    __m128i y_lo, cb_lo, cr_lo, y_hi, cb_hi, cr_hi;
+    RGB_to_YCC_8(_mm_unpacklo_epi8(r, zero), _mm_unpacklo_epi8(g, zero), _mm_unpacklo_epi8(b, zero), y_lo, cb_lo, cr_lo);
+    RGB_to_YCC_8(_mm_unpackhi_epi8(r, zero), _mm_unpackhi_epi8(g, zero), _mm_unpackhi_epi8(b, zero), y_hi, cb_hi, cr_hi);
+
+    // Saturation clamps to [0, 255].
+    store_interleave_ycc(pDst, _mm_packus_epi16(y_lo, y_hi), _mm_packus_epi16(cb_lo, cb_hi), _mm_packus_epi16(cr_lo, cr_hi));
+  }
+#endif
   for ( ; num_pixels; pDst += 3, pSrc += 3, num_pixels--)
   {
     const int r = pSrc[0], g = pSrc[1], b = pSrc[2];
@@ -351,6 +472,27 @@ void jpeg_encoder::emit_sos()
   emit_byte(0);
 }
 
+// Emit define restart interval marker
+void jpeg_encoder::emit_dri()
+{
+  emit_marker(M_DRI);
+  emit_word(4);
+  emit_word(m_params.m_restart_mcu_rows * m_mcus_per_row);
+}
+
+// Ends the current restart interval: pads the entropy coded data to a full byte, emits the next RSTn marker, and resets the DC predictions.
+void jpeg_encoder::emit_restart()
+{
+  memset(m_last_dc_val, 0, 3 * sizeof(m_last_dc_val[0]));
+  if (m_pass_num == 2)
+  {
+    put_bits(0x7F, 7);
+    m_bit_buffer = 0; m_bits_in = 0;
+    flush_output_buffer();
+    emit_marker(M_RST0 + (((m_mcu_row / m_params.m_restart_mcu_rows) - 1) & 7));
+  }
+}
+
 // Emit all markers at beginning of image file.
 void jpeg_encoder::emit_markers()
 {
@@ -359,6 +501,8 @@ void jpeg_encoder::emit_markers()
   emit_dqt();
   emit_sof();
   emit_dhts();
+  if (m_params.m_restart_mcu_rows)
+    emit_dri();
   emit_sos();
 }
 
@@ -417,6 +561,7 @@ void jpeg_encoder::first_pass_init()
   m_bit_buffer = 0; m_bits_in = 0;
   memset(m_last_dc_val, 0, 3 * sizeof(m_last_dc_val[0]));
   m_mcu_y_ofs = 0;
+  m_mcu_row = 0;
   m_pass_num = 1;
 }
 
@@ -430,7 +575,8 @@ bool jpeg_encoder::second_pass_init()
     compute_huffman_table(&m_huff_codes[2+1][0], &m_huff_code_sizes[2+1][0], m_huff_bits[2+1], m_huff_val[2+1]);
   }
   first_pass_init();
-  emit_markers();
+  if (!m_strip_flag)
+    emit_markers();
   m_pass_num = 2;
   return true;
 }
@@ -481,6 +627,9 @@ bool jpeg_encoder::jpg_open(int p_x_res, int p_y_res, int src_channels)
   m_image_bpl_mcu  = m_image_x_mcu * m_num_components;
   m_mcus_per_row   = m_image_x_mcu / m_mcu_x;
 
+  // The restart interval is stored with 16 bits.
+  if ((m_params.m_restart_mcu_rows * m_mcus_per_row) > 0xFFFF) return false;
+
   if ((m_mcu_lines[0] = static_cast<uint8*>(jpge_malloc(m_image_bpl_mcu * m_mcu_y))) == NULL) return false;
   for (int i = 1; i < m_mcu_y; i++)
     m_mcu_lines[i] = m_mcu_lines[i-1] + m_image_bpl_mcu;
@@ -729,6 +878,11 @@ void jpeg_encoder::code_block(int component_num)
 
 void jpeg_encoder::process_mcu_row()
 {
+  // Strips are compressed as exactly one restart interval.
+  if ((m_params.m_restart_mcu_rows > 0) && (!m_strip_flag) && (m_mcu_row > 0) && ((m_mcu_row % m_params.m_restart_mcu_rows) == 0))
+    emit_restart();
+  m_mcu_row++;
+
   if (m_num_components == 1)
   {
     for (int i = 0; i < m_mcus_per_row; i++)
@@ -776,7 +930,8 @@ bool jpeg_encoder::terminate_pass_two()
 {
   put_bits(0x7F, 7);
   flush_output_buffer();
-  emit_marker(M_EOI);
+  if (!m_strip_flag)
+    emit_marker(M_EOI);
   m_pass_num++; // purposely bump up m_pass_num, for debugging
   return true;
 }
@@ -850,6 +1005,8 @@ void jpeg_encoder::clear()
   m_mcu_lines[0] = NULL;
   m_pass_num = 0;
   m_all_stream_writes_succeeded = true;
+  m_strip_flag = false;
+  m_mcu_row = 0;
 }
 
 jpeg_encoder::jpeg_encoder()
@@ -871,6 +1028,17 @@ bool jpeg_encoder::init(output_stream *pStream, int width, int height, int src_c
   return jpg_open(width, height, src_channels);
 }
 
+bool jpeg_encoder::init_strip(output_stream *pStream, int width, int height, int src_channels, const params &comp_params)
+{
+  deinit();
+  if ((comp_params.m_restart_mcu_rows < 1) || (comp_params.m_two_pass_flag)) return false;
+  if (((!pStream) || (width < 1) || (height < 1)) || ((src_channels != 1) && (src_channels != 3) && (src_channels != 4)) || (!comp_params.check())) return false;
+  m_pStream = pStream;
+  m_params = comp_params;
+  m_strip_flag = true;
+  return jpg_open(width, height, src_channels);
+}
+
 void jpeg_encoder::deinit()
 {
   jpge_free(m_mcu_lines[0]);
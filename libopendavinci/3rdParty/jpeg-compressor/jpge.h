@@ -19,12 +19,13 @@ namespace jpge
   // JPEG compression parameters structure.
   struct params
   {
-    inline params() : m_quality(85), m_subsampling(H2V2), m_no_chroma_discrim_flag(false), m_two_pass_flag(false) { }
+    inline params() : m_quality(85), m_subsampling(H2V2), m_no_chroma_discrim_flag(false), m_two_pass_flag(false), m_restart_mcu_rows(0) { }
 
     inline bool check() const
     {
       if ((m_quality < 1) || (m_quality > 100)) return false;
       if ((uint)m_subsampling > (uint)H2V2) return false;
+      if (m_restart_mcu_rows < 0) return false;
       return true;
     }
 
@@ -43,6 +44,10 @@ namespace jpge
     bool m_no_chroma_discrim_flag;
 
     bool m_two_pass_flag;
+
+    // Number of MCU rows between two restart markers (0 = no restart markers).
+    // The entropy coded data between two restart markers is independent of the rest of the image.
+    int m_restart_mcu_rows;
   };
   
   // Writes JPEG image to a file. 
@@ -78,6 +83,12 @@ namespace jpge
     // channels - May be 1, or 3. 1 indicates grayscale, 3 indicates RGB source data.
     // Returns false on out of memory or if a stream write fails.
     bool init(output_stream *pStream, int width, int height, int src_channels, const params &comp_params = params());
+
+    // Initializes the compressor for one strip of comp_params.m_restart_mcu_rows MCU rows (restart interval).
+    // Only the strip's entropy coded data padded to a full byte is written; neither markers nor headers are emitted.
+    // Thus, the strips of an image can be compressed independently and joined with RSTn markers. Requires one pass.
+    // Pass the strip's scanlines to process_scanline() followed by NULL.
+    bool init_strip(output_stream *pStream, int width, int height, int src_channels, const params &comp_params);
     
     const params &get_params() const { return m_params; }
     
@@ -127,6 +138,8 @@ namespace jpge
     uint m_bits_in;
     uint8 m_pass_num;
     bool m_all_stream_writes_succeeded;
+    bool m_strip_flag;
+    int m_mcu_row;
         
     void optimize_huffman_table(int table_num, int table_len);
     void emit_byte(uint8 i);
@@ -138,6 +151,8 @@ namespace jpge
     void emit_dht(uint8 *bits, uint8 *val, int index, bool ac_flag);
     void emit_dhts();
     void emit_sos();
+    void emit_dri();
+    void emit_restart();
     void emit_markers();
     void compute_huffman_table(uint *codes, uint8 *code_sizes, uint8 *bits, uint8 *val);
     void compute_quant_table(int32 *dst, int16 *src);
@@ -20,10 +20,13 @@
 #ifndef CONTEXT_BASE_BLOCKABLECONTAINERRECEIVER_H_
 #define CONTEXT_BASE_BLOCKABLECONTAINERRECEIVER_H_
 
+#include <vector>
+
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcontext/base/BlockableContainerListener.h"
 
-namespace odcore { namespace data { class Container; } }
 namespace odcore { namespace io { namespace conference { class ContainerListener; } } }
 
 namespace odcontext {
@@ -68,9 +71,43 @@ namespace odcontext {
                 // This method is called by ControlledContainerConference to send c from an app to all SystemParts.
                 virtual void nextContainer(odcore::data::Container &c);
 
+                /**
+                 * This method defers the distribution of containers sent
+                 * by the system under test until deliverDeferredContainers()
+                 * is called. Disabling the deferral delivers all pending
+                 * containers.
+                 *
+                 * @param deferred true to defer the distribution of containers.
+                 */
+                void setDeliveryDeferred(const bool &deferred);
+
+                /**
+                 * This method distributes all deferred containers in the
+                 * order they were sent.
+                 */
+                void deliverDeferredContainers();
+
+                /**
+                 * This method enables the output for every sent container.
+                 *
+                 * @param verbose true to print every sent container.
+                 */
+                void setVerbose(const bool &verbose);
+
+                /**
+                 * @return true if every sent container is to be printed.
+                 */
+                bool isVerbose() const;
+
             private:
                 // This ContainerListener receives the containers sent from the System Under Test to which this BlockableContainerReceiver belongs to all SystemParts and all other Systems Under Test.
                 odcore::io::conference::ContainerListener &m_dispatcherForContainersSentFromSystemUnderTest;
+
+                odcore::base::Mutex m_deferredContainersMutex;
+                bool m_deliveryDeferred;
+                std::vector<odcore::data::Container> m_deferredContainers;
+
+                bool m_verbose;
         };
 
     }
@@ -82,6 +82,13 @@ class ContainerDeliverer;
                 // Furthermore, every container send from a System Under Test is also dispatched to all Systems Under Test using sendToSystemsUnderTest
                 virtual void nextContainer(odcore::data::Container &c);
 
+                /**
+                 * This method enables the output for every distributed container.
+                 *
+                 * @param verbose true to print every distributed container.
+                 */
+                void setVerbose(const bool &verbose);
+
             private:
                 /**
                  * This method sends the given container to all systems under test
@@ -109,6 +116,8 @@ class ContainerDeliverer;
 
                 odcore::base::Mutex m_listOfContainerDelivererFromSystemUnderTestMutex;
                 vector<BlockableContainerReceiver*> m_listOfContainerDelivererFromSystemUnderTest;
+
+                bool m_verbose;
         };
 
     }
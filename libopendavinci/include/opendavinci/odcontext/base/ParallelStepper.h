@@ -0,0 +1,96 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CONTEXT_BASE_PARALLELSTEPPER_H_
+#define CONTEXT_BASE_PARALLELSTEPPER_H_
+
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/WorkPool.h"
+
+namespace odcontext {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class executes the steps of one simulated tick on a pool
+         * of worker threads. The calling thread executes steps as well
+         * and execute() returns only after all steps have been executed
+         * (barrier); thus, the time can be advanced safely afterwards.
+         */
+        class OPENDAVINCI_API ParallelStepper : private odcore::base::WorkPool::Task {
+            public:
+                /**
+                 * Interface for one step to be executed.
+                 */
+                class OPENDAVINCI_API Step {
+                    public:
+                        virtual ~Step();
+
+                        virtual void step() = 0;
+                };
+
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                ParallelStepper(const ParallelStepper&);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                ParallelStepper& operator=(const ParallelStepper&);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param numberOfThreads Number of threads including the calling thread.
+                 */
+                ParallelStepper(const uint32_t &numberOfThreads);
+
+                virtual ~ParallelStepper();
+
+                /**
+                 * This method executes all steps and returns after all
+                 * of them have been executed. If steps throw exceptions,
+                 * the exception of the first of these steps is rethrown.
+                 *
+                 * @param steps Steps to be executed.
+                 */
+                void execute(const vector<Step*> &steps);
+
+            private:
+                virtual void process(const uint32_t &item);
+
+            private:
+                odcore::base::WorkPool m_workPool;
+                const vector<Step*> *m_steps;
+        };
+
+    }
+} // odcontext::base
+
+#endif /*CONTEXT_BASE_PARALLELSTEPPER_H_*/
@@ -21,7 +21,7 @@
 #define CONTEXT_BASE_RUNMODULEBREAKPOINT_H_
 
 #include "opendavinci/odcore/opendavinci.h"
-#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/Condition.h"
 #include "opendavinci/odcore/base/module/Breakpoint.h"
 
 namespace odcontext {
@@ -68,6 +68,15 @@ class BlockableContainerListener;
                  */
                 bool hasReached() const;
 
+                /**
+                 * This method waits until the breakpoint is reached
+                 * without polling.
+                 *
+                 * @param timeoutInMicroseconds Maximum time to wait.
+                 * @return true if the breakpoint was reached, false on timeout.
+                 */
+                bool waitForReaching(const uint32_t &timeoutInMicroseconds);
+
                 /**
                  * This method continues the application's execution.
                  */
@@ -80,22 +89,12 @@ class BlockableContainerListener;
                  */
                 void setFinallyReaching();
 
-            private:
-                /**
-                 * This method returns true if the application can continue
-                 * to execute.
-                 *
-                 * @return true if continue.
-                 */
-                bool hasContinue() const;
-
             private:
                 BlockableContainerListener &m_blockableContainerListener;
 
-                mutable odcore::base::Mutex m_reachedMutex;
+                // Both flags are protected by this condition which signals every change.
+                mutable odcore::base::Condition m_breakpointCondition;
                 bool m_reached;
-
-                mutable odcore::base::Mutex m_continueMutex;
                 bool m_continue;
         };
 
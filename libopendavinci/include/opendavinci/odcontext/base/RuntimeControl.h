@@ -64,6 +64,12 @@ class TimeTriggeredConferenceClientModuleRunner;
                     UNKNOWN_EXCEPTION_CAUGHT,
                 };
 
+                enum VERBOSITY {
+                    QUIET,          // No output per tick.
+                    TICKS,          // The time of every tick.
+                    ALL_COMPONENTS, // Additionally every executed component and distributed container.
+                };
+
             private:
                 /**
                  * "Forbidden" copy constructor. Goal: The compiler should warn
@@ -123,6 +129,31 @@ class TimeTriggeredConferenceClientModuleRunner;
                  */
                 void tearDown();
 
+                /**
+                 * This method sets the output printed for every tick
+                 * (default: ALL_COMPONENTS).
+                 *
+                 * @param verbosity Verbosity level.
+                 */
+                void setVerbosity(const enum VERBOSITY &verbosity);
+
+                /**
+                 * This method enables the parallel execution of all
+                 * components due at the same tick; therefore, these
+                 * components must not depend on each other within one
+                 * tick. At first, the SystemFeedbackComponents are
+                 * executed on a pool of threads, then all applications
+                 * are executed at once. The time is advanced after all of
+                 * them have finished. Containers sent by the components
+                 * are distributed after all components have finished in
+                 * the order of the components in the RuntimeEnvironment;
+                 * thus, the delivery order is deterministic. This method
+                 * must be called before run(...).
+                 *
+                 * @param numberOfThreads Number of threads for SystemFeedbackComponents (0 or 1 = sequential execution, default).
+                 */
+                void setParallelExecution(const uint32_t &numberOfThreads);
+
             protected:
                 /**
                  * This method actually runs the system's context for standalone system simulations.
@@ -227,6 +258,8 @@ class TimeTriggeredConferenceClientModuleRunner;
                 SuperComponent *m_superComponent;
                 ControlledContainerConferenceFactory *m_controlledContainerConferenceFactory;
                 ControlledTimeFactory *m_controlledTimeFactory;
+                enum VERBOSITY m_verbosity;
+                uint32_t m_numberOfThreads;
         };
 
     }
@@ -32,7 +32,7 @@ namespace odcore { namespace wrapper { class Time; } }
 namespace odcontext {
     namespace base {
 
-class BlockableContainerListener;
+class BlockableContainerReceiver;
 
         using namespace std;
 
@@ -76,6 +76,42 @@ class BlockableContainerListener;
                  */
                 virtual void step(const odcore::wrapper::Time &t);
 
+                /**
+                 * This method continues the module's execution for one
+                 * cycle without waiting for its breakpoint. Thus, several
+                 * modules can be executed in parallel.
+                 *
+                 * @param t Time.
+                 */
+                void beginStep(const odcore::wrapper::Time &t);
+
+                /**
+                 * This method waits until the module started by beginStep()
+                 * has reached its breakpoint.
+                 */
+                void finishStep();
+
+                /**
+                 * This method defers the distribution of containers sent
+                 * by the module until deliverDeferredContainers() is called.
+                 *
+                 * @param deferred true to defer the distribution of containers.
+                 */
+                void setDeliveryDeferred(const bool &deferred);
+
+                /**
+                 * This method distributes all containers sent by the module
+                 * since the last call in the order they were sent.
+                 */
+                void deliverDeferredContainers();
+
+                /**
+                 * This method enables the output for every step.
+                 *
+                 * @param verbose true to print every step.
+                 */
+                void setVerbose(const bool &verbose);
+
                 virtual bool hasFinished() const;
 
             protected:
@@ -93,8 +129,9 @@ class BlockableContainerListener;
                 bool m_timeTriggeredConferenceClientModuleFinished;
 
                 odcore::base::module::TimeTriggeredConferenceClientModule &m_timeTriggeredConferenceClientModule;
-                BlockableContainerListener &m_blockableContainerListener;
+                BlockableContainerReceiver &m_blockableContainerListener;
                 RunModuleBreakpoint m_runModuleBreakpoint;
+                bool m_verbose;
         };
 
     }
@@ -20,6 +20,8 @@
 #ifndef OPENDAVINCI_CORE_BASE_ABSTRACTDATASTORE_H_
 #define OPENDAVINCI_CORE_BASE_ABSTRACTDATASTORE_H_
 
+#include <atomic>
+
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Condition.h"
 
@@ -79,8 +81,15 @@ namespace odcore {
               */
               virtual void wait();
 
+                /**
+                 * This method wakes all waiting threads but avoids
+                 * locking the condition if no thread is waiting.
+                 */
+                void wakeWaitingThreads();
+
             private:
                 Condition m_condition;
+                std::atomic<uint32_t> m_numberOfWaitingThreads;
         };
 
     }
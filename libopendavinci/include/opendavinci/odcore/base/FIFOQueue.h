@@ -20,11 +20,13 @@
 #ifndef OPENDAVINCI_CORE_BASE_FIFOQUEUE_H_
 #define OPENDAVINCI_CORE_BASE_FIFOQUEUE_H_
 
+#include <atomic>
 #include <deque>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/AbstractDataStore.h"
 #include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/RingBuffer.h"
 #include "opendavinci/odcore/data/Container.h"
 
 namespace odcore {
@@ -34,6 +36,16 @@ namespace odcore {
 
         /**
          * This interface encapsulates all methods necessary for a FIFO.
+         *
+         * Containers entered by any thread are passed through a lock-free
+         * ring buffer from which leave() pops them directly. Only if the
+         * ring buffer is full, containers overflow into a locked queue;
+         * following containers are queued up behind them until leave()
+         * has consumed the overflow. getSize() and isEmpty() do not lock.
+         * Waiting threads are only woken up if there are any.
+         *
+         * leave(), clear(), and get(...) must be called from the same
+         * consuming thread.
          */
         class OPENDAVINCI_API FIFOQueue : public AbstractDataStore {
             private:
@@ -51,6 +63,11 @@ namespace odcore {
                  */
                 FIFOQueue& operator=(const FIFOQueue &);
 
+            private:
+                enum {
+                    CAPACITY_OF_ENTRY_RING = 256
+                };
+
             public:
                 FIFOQueue();
 
@@ -68,6 +85,12 @@ namespace odcore {
 
                 virtual bool isEmpty() const;
 
+                /**
+                 * This method spins shortly before falling asleep until
+                 * new data is available.
+                 */
+                virtual void waitForData();
+
             protected:
                 /**
                  * This method returns the element at the given index or an
@@ -80,7 +103,13 @@ namespace odcore {
 
             private:
                 mutable Mutex m_mutexQueue;
-                deque<data::Container> m_queue;
+                mutable RingBuffer<data::Container> m_entered;
+
+                // The queue holds the containers fetched from the ring by
+                // get(...) followed by the overflowed containers.
+                mutable deque<data::Container> m_queue;
+                mutable atomic<uint32_t> m_numberOfFetched;
+                atomic<uint32_t> m_numberOfOverflowed;
         };
 
     }
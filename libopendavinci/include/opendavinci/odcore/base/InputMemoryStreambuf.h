@@ -0,0 +1,100 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_INPUTMEMORYSTREAMBUF_H_
+#define OPENDAVINCI_CORE_BASE_INPUTMEMORYSTREAMBUF_H_
+
+#include <streambuf>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class provides a read-only stream buffer on top of an
+         * existing memory area. It allows the use of an istream on
+         * already received or mapped data without copying it into a
+         * stringstream first. The memory area must outlive this buffer.
+         * Memory areas larger than 4 GB (e.g. mapped recordings) are
+         * supported.
+         *
+         * @code
+         * InputMemoryStreambuf buffer(data, size);
+         * istream in(&buffer);
+         * in >> container;
+         * @endcode
+         */
+        class OPENDAVINCI_API InputMemoryStreambuf : public std::streambuf {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                InputMemoryStreambuf(const InputMemoryStreambuf &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                InputMemoryStreambuf& operator=(const InputMemoryStreambuf &);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param data Pointer to the beginning of the memory area.
+                 * @param size Size of the memory area in bytes.
+                 */
+                InputMemoryStreambuf(const char *data, const uint64_t &size);
+
+                virtual ~InputMemoryStreambuf();
+
+                /**
+                 * @return Pointer to the next byte to be read.
+                 */
+                const char* current() const;
+
+                /**
+                 * @return Number of bytes left to be read.
+                 */
+                uint64_t available() const;
+
+                /**
+                 * This method skips the given amount of bytes as if they
+                 * were read.
+                 *
+                 * @param length Number of bytes to skip.
+                 */
+                void consume(const uint64_t &length);
+
+            protected:
+                virtual pos_type seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode which);
+
+                virtual pos_type seekpos(pos_type pos, ios_base::openmode which);
+        };
+
+    }
+} // odcore::base
+
+#endif /*OPENDAVINCI_CORE_BASE_INPUTMEMORYSTREAMBUF_H_*/
@@ -20,8 +20,11 @@
 #ifndef OPENDAVINCI_CORE_BASE_KEYVALUEDATASTORE_H_
 #define OPENDAVINCI_CORE_BASE_KEYVALUEDATASTORE_H_
 
-#include "opendavinci/odcore/opendavinci.h"
+#include <atomic>
 #include <memory>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Mutex.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/exceptions/Exceptions.h"
 #include "opendavinci/odcore/wrapper/KeyValueDatabase.h"
@@ -42,6 +45,17 @@ namespace odcore {
          * Container c(TIMESTAMP, ts);
          * kv.put(key, c);
          * @endcode
+         *
+         * The latest value for every key is kept in a fixed-size
+         * open-addressing table; neither put(...) nor get(...) serialize
+         * the Container. Every slot has a few preallocated Container
+         * buffers: A writer fills a buffer that no reader is copying and
+         * publishes its index atomically. A reader announces itself at
+         * the current buffer with a counter and copies it; thus, readers
+         * never take a lock and never wait for a writer. Writers of the
+         * same key are serialized by the slot's mutex. Only if the table
+         * is exhausted, further keys are stored in the given key/value
+         * database.
          */
         class OPENDAVINCI_API KeyValueDataStore {
             private:
@@ -64,6 +78,33 @@ namespace odcore {
                  */
                 KeyValueDataStore& operator=(const KeyValueDataStore&);
 
+            public:
+                enum {
+                    CAPACITY = 512, // Number of keys kept in the table.
+                    BUFFERS = 4 // Number of Container buffers per key.
+                };
+
+            private:
+                /**
+                 * This class describes one entry of the table. A slot is
+                 * assigned to a key once and never released.
+                 */
+                class Slot {
+                    private:
+                        Slot(const Slot&);
+                        Slot& operator=(const Slot&);
+
+                    public:
+                        Slot();
+
+                    public:
+                        atomic<int32_t> m_key;
+                        atomic<uint32_t> m_current; // Index of the buffer holding the latest value.
+                        atomic<uint32_t> m_readers[BUFFERS]; // Number of readers copying the respective buffer.
+                        data::Container m_values[BUFFERS];
+                        Mutex m_writerMutex;
+                };
+
             public:
                 /**
                  * Constructor.
@@ -91,8 +132,19 @@ namespace odcore {
                  */
                 data::Container get(const int32_t &key) const;
 
+            private:
+                /**
+                 * This method returns the slot for the given key.
+                 * @param key The key.
+                 * @param claim If true, a free slot is assigned to the key if necessary.
+                 * @return Slot or NULL if the key has no slot.
+                 */
+                Slot* getSlot(const int32_t &key, const bool &claim) const;
+
             private:
                 std::shared_ptr<wrapper::KeyValueDatabase> m_keyValueDatabase;
+                unique_ptr<Slot[]> m_slots;
+                atomic<bool> m_overflow;
         };
 
     }
@@ -0,0 +1,88 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_OUTPUTSTRINGSTREAMBUF_H_
+#define OPENDAVINCI_CORE_BASE_OUTPUTSTRINGSTREAMBUF_H_
+
+#include <streambuf>
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class provides a write-only stream buffer that appends
+         * everything written to it at the end of an existing string.
+         * Thus, an ostream can be used to serialize data directly into
+         * a growable contiguous buffer without an intermediate copy.
+         * The string must outlive this buffer.
+         *
+         * @code
+         * string data;
+         * OutputStringStreambuf buffer(data);
+         * ostream out(&buffer);
+         * out << container;
+         * @endcode
+         */
+        class OPENDAVINCI_API OutputStringStreambuf : public std::streambuf {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                OutputStringStreambuf(const OutputStringStreambuf &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                OutputStringStreambuf& operator=(const OutputStringStreambuf &);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param buffer String to append the written data to.
+                 */
+                OutputStringStreambuf(string &buffer);
+
+                virtual ~OutputStringStreambuf();
+
+            protected:
+                virtual int_type overflow(int_type c);
+
+                virtual streamsize xsputn(const char *s, streamsize n);
+
+                virtual pos_type seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode which);
+
+            private:
+                string &m_buffer;
+                const string::size_type m_start;
+        };
+
+    }
+} // odcore::base
+
+#endif /*OPENDAVINCI_CORE_BASE_OUTPUTSTRINGSTREAMBUF_H_*/
@@ -0,0 +1,242 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_PACKEDENCODING_H_
+#define OPENDAVINCI_CORE_BASE_PACKEDENCODING_H_
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class encodes the elements of lists and maps of primitive
+         * types as used by the generated data structures. The elements
+         * are packed in binary form one after another:
+         *
+         * '0x00' 'VERSION' 'element 1' 'element 2' ... 'element n'
+         *
+         * Numbers are stored in little endian byte order using their
+         * fixed size, bools as one byte, and strings as their length
+         * (uint32_t) followed by their characters. A map is stored as
+         * key, value, key, value, ...
+         *
+         * Older versions stored one element (or key=value pair) per
+         * line as text. As such data never starts with the version
+         * header above, it is still decoded transparently.
+         */
+        class OPENDAVINCI_API PackedEncoding {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                PackedEncoding(const PackedEncoding &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                PackedEncoding& operator=(const PackedEncoding &);
+
+            public:
+                enum {
+                    VERSION = 1,
+                    HEADER_SIZE = 2
+                };
+
+                PackedEncoding();
+
+                virtual ~PackedEncoding();
+
+                /**
+                 * This method encodes the given list.
+                 *
+                 * @param list List to be encoded.
+                 * @param out String to write the encoded elements to.
+                 */
+                template<typename T>
+                static void encode(const vector<T> &list, string &out) {
+                    out.clear();
+                    out.reserve(HEADER_SIZE + list.size() * sizeof(T));
+                    appendHeader(out);
+                    for (typename vector<T>::const_iterator it = list.begin(); it != list.end(); ++it) {
+                        append(out, *it);
+                    }
+                }
+
+                /**
+                 * This method encodes the given map.
+                 *
+                 * @param m Map to be encoded.
+                 * @param out String to write the encoded elements to.
+                 */
+                template<typename K, typename V>
+                static void encode(const map<K, V> &m, string &out) {
+                    out.clear();
+                    out.reserve(HEADER_SIZE + m.size() * (sizeof(K) + sizeof(V)));
+                    appendHeader(out);
+                    for (typename map<K, V>::const_iterator it = m.begin(); it != m.end(); ++it) {
+                        append(out, it->first);
+                        append(out, it->second);
+                    }
+                }
+
+                /**
+                 * This method decodes the given elements and appends them
+                 * to the given list. Elements in the text encoding of
+                 * older versions are decoded as well.
+                 *
+                 * @param in Encoded elements.
+                 * @param numberOfElements Number of elements to decode.
+                 * @param list List to append the decoded elements to.
+                 */
+                template<typename T>
+                static void decode(const string &in, const uint32_t &numberOfElements, vector<T> &list) {
+                    if (isPacked(in)) {
+                        const char *pos = in.data() + HEADER_SIZE;
+                        const char *end = in.data() + in.length();
+
+                        // Do not trust numberOfElements beyond the available data.
+                        list.reserve(list.size() + min(static_cast<size_t>(numberOfElements), static_cast<size_t>(end - pos)));
+                        for (uint32_t i = 0; i < numberOfElements; i++) {
+                            T element = T();
+                            if (!extract(pos, end, element)) {
+                                break;
+                            }
+                            list.push_back(element);
+                        }
+                    }
+                    else {
+                        // One element per line.
+                        stringstream sstr(in);
+                        for (uint32_t i = 0; i < numberOfElements; i++) {
+                            T element = T();
+                            readText(sstr, element);
+                            list.push_back(element);
+                        }
+                    }
+                }
+
+                /**
+                 * This method decodes the given elements and adds them
+                 * to the given map. Elements in the text encoding of
+                 * older versions are decoded as well.
+                 *
+                 * @param in Encoded elements.
+                 * @param numberOfElements Number of key/value pairs to decode.
+                 * @param m Map to add the decoded elements to.
+                 */
+                template<typename K, typename V>
+                static void decode(const string &in, const uint32_t &numberOfElements, map<K, V> &m) {
+                    if (isPacked(in)) {
+                        const char *pos = in.data() + HEADER_SIZE;
+                        const char *end = in.data() + in.length();
+                        for (uint32_t i = 0; i < numberOfElements; i++) {
+                            K key = K();
+                            V value = V();
+                            if (!extract(pos, end, key) || !extract(pos, end, value)) {
+                                break;
+                            }
+                            m[key] = value;
+                        }
+                    }
+                    else {
+                        // One key=value pair per line.
+                        stringstream sstr(in);
+                        while (!sstr.eof()) {
+                            string line;
+                            getline(sstr, line);
+
+                            const size_t delimiter = line.find_first_of("=");
+                            if ( (delimiter == string::npos) || (delimiter == 0) || (delimiter + 1 == line.length()) ) {
+                                continue;
+                            }
+
+                            stringstream sstrKey(line.substr(0, delimiter));
+                            K key = K();
+                            readText(sstrKey, key);
+
+                            stringstream sstrValue(line.substr(delimiter + 1));
+                            V value = V();
+                            readText(sstrValue, value);
+
+                            m[key] = value;
+                        }
+                    }
+                }
+
+                /**
+                 * @param in Encoded elements.
+                 * @return true if the given elements are packed using this encoding.
+                 */
+                static bool isPacked(const string &in);
+
+            private:
+                static void appendHeader(string &out);
+
+                static void append(string &out, const bool &v);
+                static void append(string &out, const char &v);
+                static void append(string &out, const int8_t &v);
+                static void append(string &out, const uint8_t &v);
+                static void append(string &out, const int16_t &v);
+                static void append(string &out, const uint16_t &v);
+                static void append(string &out, const int32_t &v);
+                static void append(string &out, const uint32_t &v);
+                static void append(string &out, const int64_t &v);
+                static void append(string &out, const uint64_t &v);
+                static void append(string &out, const float &v);
+                static void append(string &out, const double &v);
+                static void append(string &out, const string &v);
+
+                static bool extract(const char *&pos, const char *end, bool &v);
+                static bool extract(const char *&pos, const char *end, char &v);
+                static bool extract(const char *&pos, const char *end, int8_t &v);
+                static bool extract(const char *&pos, const char *end, uint8_t &v);
+                static bool extract(const char *&pos, const char *end, int16_t &v);
+                static bool extract(const char *&pos, const char *end, uint16_t &v);
+                static bool extract(const char *&pos, const char *end, int32_t &v);
+                static bool extract(const char *&pos, const char *end, uint32_t &v);
+                static bool extract(const char *&pos, const char *end, int64_t &v);
+                static bool extract(const char *&pos, const char *end, uint64_t &v);
+                static bool extract(const char *&pos, const char *end, float &v);
+                static bool extract(const char *&pos, const char *end, double &v);
+                static bool extract(const char *&pos, const char *end, string &v);
+
+                template<typename T>
+                static void readText(istream &in, T &v) {
+                    in >> v;
+                }
+
+                static void readText(istream &in, string &v);
+        };
+
+    }
+} // odcore::base
+
+#endif /*OPENDAVINCI_CORE_BASE_PACKEDENCODING_H_*/
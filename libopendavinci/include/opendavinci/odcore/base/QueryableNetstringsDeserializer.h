@@ -20,6 +20,7 @@
 #ifndef OPENDAVINCI_CORE_BASE_QUERYABLENETSTRINGSDESERIALIZER_H_
 #define OPENDAVINCI_CORE_BASE_QUERYABLENETSTRINGSDESERIALIZER_H_
 
+#include <memory>
 #include <sstream>
 #include <string>
 
@@ -120,7 +121,8 @@ namespace odcore {
                 virtual void read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &longName, const string &shortName, void *data, const uint32_t &size);
 
             private:
-                QueryableNetstringsDeserializerAACF m_aacf;
+                // The deserializer for the legacy format is only created on demand.
+                unique_ptr<QueryableNetstringsDeserializerAACF> m_aacf;
                 QueryableNetstringsDeserializerABCF m_abcf;
                 Deserializer* m_deserializer;
         };
@@ -20,9 +20,9 @@
 #ifndef OPENDAVINCI_CORE_BASE_QUERYABLENETSTRINGSDESERIALIZERABCF_H_
 #define OPENDAVINCI_CORE_BASE_QUERYABLENETSTRINGSDESERIALIZERABCF_H_
 
-#include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Serializer.h"
@@ -81,8 +81,26 @@ namespace odcore {
 
                 virtual ~QueryableNetstringsDeserializerABCF();
 
+                /**
+                 * This method deserializes the data from the given stream.
+                 * If the stream is backed by an InputMemoryStreambuf, the
+                 * data is not copied but referenced directly.
+                 *
+                 * @param in Input stream to read from.
+                 */
                 virtual void deserializeDataFrom(istream &in);
 
+                /**
+                 * This method deserializes one frame from the given memory
+                 * area without copying it. Thus, the memory area must remain
+                 * valid as long as any read(...) method is called.
+                 *
+                 * @param data Pointer to the beginning of the frame.
+                 * @param size Number of bytes available at data.
+                 * @return Number of bytes consumed or 0 if the frame is incomplete.
+                 */
+                uint32_t deserializeDataFrom(const char *data, const uint32_t &size);
+
             public:
                 virtual void read(const uint32_t &id, Serializable &s);
                 virtual void read(const uint32_t &id, bool &b);
@@ -136,20 +154,70 @@ namespace odcore {
                  * @param value Destination variable to be written into.
                  * @return size Number of bytes read.
                  */
-                uint8_t decodeVarUInt(istream& in, uint64_t &value);
+                static uint8_t decodeVarUInt(istream& in, uint64_t &value);
+
+                /**
+                 * This method decodes an unsigned value from a given varint encoding.
+                 *
+                 * @param data Memory area to read from.
+                 * @param size Number of bytes available at data.
+                 * @param value Destination variable to be written into.
+                 * @return size Number of bytes read.
+                 */
+                static uint8_t decodeVarUInt(const char *data, const uint32_t &size, uint64_t &value);
 
                 /**
                  * This method decodes a signed value from a given varint encoding.
                  *
-                 * @param in Input stream used for reading from.
+                 * @param data Memory area to read from.
+                 * @param size Number of bytes available at data.
                  * @param value Destination variable to be written into.
                  * @return size Number of bytes read.
                  */
-                uint8_t decodeVarInt(istream& in, int64_t &value);
+                static uint8_t decodeVarInt(const char *data, const uint32_t &size, int64_t &value);
+
+                /**
+                 * This method decodes one frame from the given memory area.
+                 *
+                 * @param data Pointer to the beginning of the frame.
+                 * @param size Number of bytes available at data.
+                 * @param complete Set to true if the entire frame was available.
+                 * @return Number of bytes consumed.
+                 */
+                uint32_t decodeFrame(const char *data, const uint32_t &size, bool &complete);
+
+                /**
+                 * This method builds the index of all entries in the current payload.
+                 */
+                void indexPayload();
+
+                /**
+                 * This class describes the location of one entry's value in the payload.
+                 */
+                class Entry {
+                    public:
+                        Entry(const uint32_t &id, const uint32_t &offset, const uint32_t &length);
+
+                    public:
+                        uint32_t m_id;
+                        uint32_t m_offset;
+                        uint32_t m_length;
+                };
+
+                /**
+                 * This method returns the first entry having the given ID.
+                 *
+                 * @param fourByteID Four byte identifier.
+                 * @param oneByteID One byte identifier that is preferred if set.
+                 * @return Entry or NULL if not found.
+                 */
+                const Entry* find(const uint32_t &fourByteID, const uint8_t &oneByteID) const;
 
             private:
-                stringstream m_buffer;
-                map<uint32_t, streampos> m_values;
+                string m_buffer;
+                const char *m_data;
+                uint32_t m_size;
+                vector<Entry> m_values;
         };
 
     }
@@ -24,7 +24,6 @@
 #include <string>
 
 #include "opendavinci/odcore/opendavinci.h"
-#include "opendavinci/odcore/base/QueryableNetstringsSerializerAACF.h"
 #include "opendavinci/odcore/base/QueryableNetstringsSerializerABCF.h"
 #include "opendavinci/odcore/base/Serializer.h"
 
@@ -121,7 +120,6 @@ class Serializable;
 
             private:
                 ostream *m_out; // We have a pointer here that we derive from a reference parameter in our non-standard constructor; thus, the other class is responsible for the lifecycle of the variable to which we point to.
-                QueryableNetstringsSerializerAACF m_aacf;
                 QueryableNetstringsSerializerABCF m_abcf;
                 Serializer* m_serializer;
         };
@@ -107,23 +107,46 @@ class Serializable;
                 /**
                  * This method encodes a given unsigned value using the varint encoding.
                  *
-                 * @param out Output stream to be written to.
+                 * @param out Array of at least MAX_SIZE_VARINT bytes to be written to.
                  * @param value Value to be encoded.
                  * @return size Number of bytes written.
                  */
-                uint8_t encodeVarUInt(ostream &out, uint64_t value);
+                static uint8_t encodeVarUInt(char *out, uint64_t value);
 
                 /**
                  * This method encodes a given signed value using the varint encoding.
                  *
-                 * @param out Output stream to be written to.
+                 * @param out Array of at least MAX_SIZE_VARINT bytes to be written to.
                  * @param value Value to be encoded.
                  * @return size Number of bytes written.
                  */
-                uint8_t encodeVarInt(ostream &out, int64_t value);
+                static uint8_t encodeVarInt(char *out, int64_t value);
+
+                /**
+                 * This method appends a varint-encoded unsigned value to the buffer.
+                 *
+                 * @param value Value to be encoded.
+                 */
+                void appendVarUInt(const uint64_t &value);
+
+                /**
+                 * This method appends an entry consisting of ID, length,
+                 * and the given payload to the buffer.
+                 *
+                 * @param fourByteID Four byte identifier.
+                 * @param oneByteID One byte identifier that is preferred if set.
+                 * @param payload Payload to be appended.
+                 * @param size Length of the payload.
+                 */
+                void appendEntry(const uint32_t &fourByteID, const uint8_t &oneByteID, const char *payload, const uint32_t &size);
+
+            public:
+                enum {
+                    MAX_SIZE_VARINT = 10, // A uint64_t needs at most ten 7-bit groups.
+                };
 
             private:
-                stringstream m_buffer;
+                string m_buffer;
         };
 
     }
@@ -0,0 +1,417 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_BASE_RINGBUFFER_H_
+#define OPENDAVINCI_CORE_BASE_RINGBUFFER_H_
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/base/Lock.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class implements a bounded lock-free ring buffer to pass
+         * entries from one or several producers to exactly one consumer.
+         * Every slot carries a sequence number telling whether the slot
+         * is free or filled; thus, neither producers nor the consumer
+         * need a lock as long as the ring is neither full nor empty.
+         * Entries are moved into and out of the ring.
+         *
+         * The blocking methods push(...) and pop(...) spin for a short
+         * time before the calling thread is parked on a condition. Parked
+         * threads are only woken up if there are any.
+         *
+         * It can be used as follows:
+         *
+         * @code
+         * RingBuffer<string> ring(1024, RingBuffer<string>::SINGLE_PRODUCER);
+         *
+         * // Producer thread.
+         * string s = "Hello World";
+         * ring.push(std::move(s));
+         *
+         * // Consumer thread.
+         * string entry;
+         * while (ring.pop(entry)) {
+         *     // Process entry.
+         * }
+         *
+         * // Let pop(...) return false after the remaining entries were consumed.
+         * ring.close();
+         * @endcode
+         */
+        template<typename T>
+        class RingBuffer {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                RingBuffer(const RingBuffer &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                RingBuffer& operator=(const RingBuffer &);
+
+            public:
+                enum PRODUCERS {
+                    SINGLE_PRODUCER,
+                    MULTIPLE_PRODUCERS
+                };
+
+                enum {
+                    SPIN_ITERATIONS = 100,
+                    PARK_TIMEOUT = 100 // Maximum time in ms to park before checking again.
+                };
+
+                /**
+                 * Constructor.
+                 *
+                 * @param capacity Number of entries; rounded up to the next power of two.
+                 * @param producers SINGLE_PRODUCER if only one thread at a time calls push(...) or tryPush(...).
+                 */
+                RingBuffer(const uint32_t &capacity, const PRODUCERS &producers);
+
+                virtual ~RingBuffer();
+
+                /**
+                 * This method moves the given entry into the ring if there
+                 * is space left. Otherwise, the entry is left untouched.
+                 *
+                 * @param entry Entry to be moved into the ring.
+                 * @return true if the entry was added.
+                 */
+                bool tryPush(T &&entry);
+
+                /**
+                 * This method moves the given entry into the ring and
+                 * waits for free space if necessary.
+                 *
+                 * @param entry Entry to be moved into the ring.
+                 * @return false if the ring was closed while being full.
+                 */
+                bool push(T &&entry);
+
+                /**
+                 * This method moves the oldest entry out of the ring. It
+                 * must only be called from the consumer thread.
+                 *
+                 * @param entry Entry to move the oldest entry into.
+                 * @return true if an entry was available.
+                 */
+                bool tryPop(T &entry);
+
+                /**
+                 * This method moves the oldest entry out of the ring and
+                 * waits for new entries if necessary. It must only be
+                 * called from the consumer thread.
+                 *
+                 * @param entry Entry to move the oldest entry into.
+                 * @return false if the ring was closed and is empty.
+                 */
+                bool pop(T &entry);
+
+                /**
+                 * This method closes the ring: pop(...) returns false
+                 * once all remaining entries are consumed and push(...)
+                 * does not wait for free space anymore. All parked
+                 * threads are woken up.
+                 */
+                void close();
+
+                /**
+                 * @return true if the ring was closed.
+                 */
+                bool isClosed() const;
+
+                /**
+                 * @return Number of entries that can be stored.
+                 */
+                uint32_t getCapacity() const;
+
+                /**
+                 * @return Approximate number of entries currently stored.
+                 */
+                uint32_t getSize() const;
+
+                /**
+                 * @return true if the consumer would currently find no entry.
+                 */
+                bool isEmpty() const;
+
+            private:
+                /**
+                 * This class describes one slot of the ring. A slot at
+                 * position p is free for a producer if its sequence is p
+                 * and filled for the consumer if its sequence is p + 1.
+                 */
+                class Slot {
+                    public:
+                        Slot() :
+                            m_sequence(0),
+                            m_entry() {}
+
+                    public:
+                        atomic<uint32_t> m_sequence;
+                        T m_entry;
+                };
+
+                /**
+                 * @return true if a producer would currently find a free slot.
+                 */
+                bool hasSpace() const;
+
+                /**
+                 * This method parks the calling thread until the consumer
+                 * finds an entry (waitForEntry = true) or a producer finds
+                 * a free slot (waitForEntry = false), the ring is closed,
+                 * or PARK_TIMEOUT has passed.
+                 *
+                 * @param waitForEntry true if called from the consumer.
+                 */
+                void park(const bool &waitForEntry);
+
+                /**
+                 * This method wakes up all parked threads if there are any.
+                 */
+                void wakeParked();
+
+                static uint32_t roundUpToPowerOfTwo(const uint32_t &v);
+
+            private:
+                const uint32_t m_capacity;
+                const uint32_t m_mask;
+                const bool m_multipleProducers;
+                unique_ptr<Slot[]> m_slots;
+
+                // The consumer's and producers' positions are kept on separate cache lines.
+                char m_paddingBeforeHead[64];
+                atomic<uint32_t> m_head;
+                char m_paddingBeforeTail[64];
+                atomic<uint32_t> m_tail;
+                char m_paddingAfterTail[64];
+
+                atomic<bool> m_closed;
+                atomic<uint32_t> m_parked;
+                Condition m_parkingCondition;
+        };
+
+        template<typename T>
+        RingBuffer<T>::RingBuffer(const uint32_t &capacity, const PRODUCERS &producers) :
+            m_capacity(roundUpToPowerOfTwo(capacity)),
+            m_mask(m_capacity - 1),
+            m_multipleProducers(producers == MULTIPLE_PRODUCERS),
+            m_slots(new Slot[m_capacity]),
+            m_paddingBeforeHead(),
+            m_head(0),
+            m_paddingBeforeTail(),
+            m_tail(0),
+            m_paddingAfterTail(),
+            m_closed(false),
+            m_parked(0),
+            m_parkingCondition() {
+            for (uint32_t i = 0; i < m_capacity; i++) {
+                m_slots[i].m_sequence.store(i, memory_order_relaxed);
+            }
+        }
+
+        template<typename T>
+        RingBuffer<T>::~RingBuffer() {
+            close();
+        }
+
+        template<typename T>
+        bool RingBuffer<T>::tryPush(T &&entry) {
+            uint32_t position = m_tail.load(memory_order_relaxed);
+            while (true) {
+                const uint32_t sequence = m_slots[position & m_mask].m_sequence.load(memory_order_acquire);
+                const int32_t difference = static_cast<int32_t>(sequence - position);
+                if (difference == 0) {
+                    // Claim the slot.
+                    if (!m_multipleProducers) {
+                        m_tail.store(position + 1, memory_order_relaxed);
+                        break;
+                    }
+                    if (m_tail.compare_exchange_weak(position, position + 1, memory_order_relaxed)) {
+                        break;
+                    }
+                }
+                else if (difference < 0) {
+                    // The consumer has not yet released this slot.
+                    return false;
+                }
+                else {
+                    // Another producer claimed this slot in the meantime.
+                    position = m_tail.load(memory_order_relaxed);
+                }
+            }
+
+            Slot &slot = m_slots[position & m_mask];
+            slot.m_entry = std::move(entry);
+            slot.m_sequence.store(position + 1, memory_order_release);
+
+            wakeParked();
+            return true;
+        }
+
+        template<typename T>
+        bool RingBuffer<T>::push(T &&entry) {
+            uint32_t iterations = 0;
+            while (!tryPush(std::move(entry))) {
+                if (isClosed()) {
+                    return false;
+                }
+
+                if (iterations < SPIN_ITERATIONS) {
+                    iterations++;
+                    this_thread::yield();
+                }
+                else {
+                    park(false);
+                }
+            }
+            return true;
+        }
+
+        template<typename T>
+        bool RingBuffer<T>::tryPop(T &entry) {
+            const uint32_t position = m_head.load(memory_order_relaxed);
+            Slot &slot = m_slots[position & m_mask];
+            if (slot.m_sequence.load(memory_order_acquire) != (position + 1)) {
+                return false;
+            }
+
+            entry = std::move(slot.m_entry);
+            slot.m_sequence.store(position + m_capacity, memory_order_release);
+            m_head.store(position + 1, memory_order_relaxed);
+
+            wakeParked();
+            return true;
+        }
+
+        template<typename T>
+        bool RingBuffer<T>::pop(T &entry) {
+            uint32_t iterations = 0;
+            while (!tryPop(entry)) {
+                if (isClosed()) {
+                    // Entries might have been added right before closing.
+                    return tryPop(entry);
+                }
+
+                if (iterations < SPIN_ITERATIONS) {
+                    iterations++;
+                    this_thread::yield();
+                }
+                else {
+                    park(true);
+                }
+            }
+            return true;
+        }
+
+        template<typename T>
+        void RingBuffer<T>::close() {
+            m_closed.store(true);
+
+            Lock l(m_parkingCondition);
+            m_parkingCondition.wakeAll();
+        }
+
+        template<typename T>
+        bool RingBuffer<T>::isClosed() const {
+            return m_closed.load();
+        }
+
+        template<typename T>
+        uint32_t RingBuffer<T>::getCapacity() const {
+            return m_capacity;
+        }
+
+        template<typename T>
+        uint32_t RingBuffer<T>::getSize() const {
+            const uint32_t head = m_head.load(memory_order_relaxed);
+            const uint32_t tail = m_tail.load(memory_order_relaxed);
+            const int32_t size = static_cast<int32_t>(tail - head);
+            return (size > 0 ? static_cast<uint32_t>(size) : 0);
+        }
+
+        template<typename T>
+        bool RingBuffer<T>::isEmpty() const {
+            const uint32_t position = m_head.load(memory_order_relaxed);
+            return (m_slots[position & m_mask].m_sequence.load(memory_order_acquire) != (position + 1));
+        }
+
+        template<typename T>
+        bool RingBuffer<T>::hasSpace() const {
+            const uint32_t position = m_tail.load(memory_order_relaxed);
+            return (m_slots[position & m_mask].m_sequence.load(memory_order_acquire) == position);
+        }
+
+        template<typename T>
+        void RingBuffer<T>::park(const bool &waitForEntry) {
+            Lock l(m_parkingCondition);
+
+            // Announce ourselves before checking again so that the other
+            // side either sees us parked or we see its latest change.
+            m_parked.fetch_add(1);
+            atomic_thread_fence(memory_order_seq_cst);
+
+            const bool ready = (waitForEntry ? !isEmpty() : hasSpace());
+            if (!ready && !isClosed()) {
+                m_parkingCondition.waitOnSignalWithTimeout(PARK_TIMEOUT);
+            }
+
+            m_parked.fetch_sub(1);
+        }
+
+        template<typename T>
+        void RingBuffer<T>::wakeParked() {
+            atomic_thread_fence(memory_order_seq_cst);
+            if (m_parked.load(memory_order_relaxed) > 0) {
+                Lock l(m_parkingCondition);
+                m_parkingCondition.wakeAll();
+            }
+        }
+
+        template<typename T>
+        uint32_t RingBuffer<T>::roundUpToPowerOfTwo(const uint32_t &v) {
+            uint32_t capacity = 2;
+            while ( (capacity < v) && (capacity < 0x80000000u) ) {
+                capacity <<= 1;
+            }
+            return capacity;
+        }
+
+    }
+} // odcore::base
+
+#endif /*OPENDAVINCI_CORE_BASE_RINGBUFFER_H_*/
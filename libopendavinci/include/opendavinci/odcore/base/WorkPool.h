@@ -0,0 +1,183 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef OPENDAVINCI_CORE_BASE_WORKPOOL_H_
+#define OPENDAVINCI_CORE_BASE_WORKPOOL_H_
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/Service.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This class processes the items of one job on a pool of worker
+         * threads. The calling thread processes items as well and
+         * execute(...) returns only after all items have been processed
+         * (barrier). Every worker joins a job only once; items are
+         * handed out by an atomic counter.
+         *
+         * @code
+         * class Squares : public WorkPool::Task {
+         *     public:
+         *         vector<uint32_t> m_results;
+         *
+         *         virtual void process(const uint32_t &item) {
+         *             m_results[item] = item * item;
+         *         }
+         * };
+         *
+         * WorkPool pool(4);
+         * Squares squares;
+         * squares.m_results.resize(1000);
+         * pool.execute(squares, squares.m_results.size());
+         * @endcode
+         */
+        class OPENDAVINCI_API WorkPool {
+            public:
+                /**
+                 * Interface for the items of a job.
+                 */
+                class OPENDAVINCI_API Task {
+                    public:
+                        virtual ~Task();
+
+                        /**
+                         * This method is called exactly once for every
+                         * item of a job and concurrently for different
+                         * items.
+                         *
+                         * @param item Index of the item to be processed.
+                         */
+                        virtual void process(const uint32_t &item) = 0;
+                };
+
+            private:
+                /**
+                 * This class processes items of the current job.
+                 */
+                class Worker : public Service {
+                    private:
+                        /**
+                         * "Forbidden" copy constructor. Goal: The compiler should warn
+                         * already at compile time for unwanted bugs caused by any misuse
+                         * of the copy constructor.
+                         */
+                        Worker(const Worker &);
+
+                        /**
+                         * "Forbidden" assignment operator. Goal: The compiler should warn
+                         * already at compile time for unwanted bugs caused by any misuse
+                         * of the assignment operator.
+                         */
+                        Worker& operator=(const Worker &);
+
+                    public:
+                        Worker(WorkPool &pool);
+
+                        virtual ~Worker();
+
+                    private:
+                        virtual void beforeStop();
+
+                        virtual void run();
+
+                    private:
+                        WorkPool &m_pool;
+                };
+
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 */
+                WorkPool(const WorkPool &);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 */
+                WorkPool& operator=(const WorkPool &);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param numberOfThreads Number of threads including the calling thread (0 = number of cores).
+                 */
+                WorkPool(const uint32_t &numberOfThreads);
+
+                virtual ~WorkPool();
+
+                /**
+                 * @return Number of threads including the calling thread.
+                 */
+                uint32_t getNumberOfThreads() const;
+
+                /**
+                 * This method processes all items of a job and returns
+                 * after all of them have been processed. If items throw
+                 * exceptions, the exception of the first of these items
+                 * is rethrown. Concurrent calls are executed one after
+                 * another.
+                 *
+                 * @param task Task to process the items.
+                 * @param numberOfItems Number of items.
+                 */
+                void execute(Task &task, const uint32_t &numberOfItems);
+
+            private:
+                /**
+                 * This method processes items of the current job
+                 * until all items are taken.
+                 */
+                void processItems();
+
+            private:
+                vector<std::shared_ptr<Worker> > m_workers;
+                Mutex m_executeMutex;
+
+                Condition m_jobCondition;
+                uint32_t m_generation;
+                bool m_jobActive;
+                uint32_t m_busyWorkers;
+
+                // Current job.
+                Task *m_task;
+                uint32_t m_numberOfItems;
+                std::atomic<uint32_t> m_nextItem;
+                vector<std::exception_ptr> m_exceptions;
+        };
+
+    }
+} // odcore::base
+
+#endif /*OPENDAVINCI_CORE_BASE_WORKPOOL_H_*/
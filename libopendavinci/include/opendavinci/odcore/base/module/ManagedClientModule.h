@@ -20,6 +20,7 @@
 #ifndef OPENDAVINCI_BASE_MANAGEDCLIENTMODULE_H_
 #define OPENDAVINCI_BASE_MANAGEDCLIENTMODULE_H_
 
+#include <atomic>
 #include <string>
 
 #include "opendavinci/odcore/opendavinci.h"
@@ -90,6 +91,15 @@ namespace odcore {
                      */
                     const odcore::data::TimeStamp getStartOfLastCycle() const;
 
+                    /**
+                     * This method sets the number of containers that this
+                     * module had to drop so far; it is reported to
+                     * supercomponent in the RuntimeStatistic.
+                     *
+                     * @param numberOfDroppedContainers Number of dropped containers.
+                     */
+                    void setNumberOfDroppedContainers(const uint32_t &numberOfDroppedContainers);
+
                 protected:
                     /**
                      * This method is called right before the body is executed.
@@ -196,6 +206,7 @@ namespace odcore {
                     odcore::data::TimeStamp m_lastCycle;
                     long m_lastWaitTime;
                     int32_t m_cycleCounter;
+                    std::atomic<uint32_t> m_numberOfDroppedContainers;
                     ofstream *m_profilingFile;
 
                     bool m_firstCallToBreakpoint_ManagedLevel_Pulse;
@@ -20,6 +20,7 @@
 #ifndef OPENDAVINCI_BASE_TIMETRIGGEREDCONFERENCECLIENTMODULE_H_
 #define OPENDAVINCI_BASE_TIMETRIGGEREDCONFERENCECLIENTMODULE_H_
 
+#include <atomic>
 #include <map>
 #include <string>
 #include <vector>
@@ -140,10 +141,37 @@ namespace odcore {
                     virtual odcore::base::KeyValueDataStore& getKeyValueDataStore();
 
                 private:
-                    // Distribute input data using thread-safe data stores.
+                    /**
+                     * This class describes which data stores receive which
+                     * containers. A published table is never modified;
+                     * registering a data store publishes a modified copy.
+                     */
+                    class DispatchTable {
+                        public:
+                            DispatchTable();
+
+                        public:
+                            vector<odcore::base::AbstractDataStore*> m_listOfDataStores;
+                            map<int32_t, vector<odcore::base::AbstractDataStore*> > m_mapOfListOfDataStores;
+                    };
+
+                    /**
+                     * This method publishes the given table for the receiving
+                     * thread. The caller must hold m_dataStoresMutex.
+                     *
+                     * @param table New table.
+                     */
+                    void publish(DispatchTable *table);
+
+                private:
+                    // Distribute input data using thread-safe data stores. The
+                    // receiving thread reads the current table without locking;
+                    // replaced tables are kept until destruction as readers may
+                    // still use them. The destructor detaches this module from
+                    // the conference first to wait for a dispatch in progress.
                     odcore::base::Mutex m_dataStoresMutex;
-                    vector<odcore::base::AbstractDataStore*> m_listOfDataStores;
-                    map<int32_t, vector<odcore::base::AbstractDataStore*> > m_mapOfListOfDataStores;
+                    atomic<const DispatchTable*> m_dispatchTable;
+                    vector<std::shared_ptr<const DispatchTable> > m_dispatchTables;
 
                     // Store all received data using Container::DATATYPE as key.
                     std::shared_ptr<odcore::base::KeyValueDataStore> m_keyValueDataStore;
@@ -20,8 +20,10 @@
 #ifndef OPENDAVINCI_CORE_DATA_CONTAINER_H_
 #define OPENDAVINCI_CORE_DATA_CONTAINER_H_
 
+#include <memory>
 #include <sstream>
 #include <string>
+#include <typeinfo>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Serializable.h"
@@ -35,7 +37,11 @@ class SerializableData;
         using namespace std;
 
         /**
-         * Container for all interchangeable data.
+         * Container for all interchangeable data. The serialized payload
+         * is immutable and shared between copies of a container; thus,
+         * copying a container does not copy its payload. Furthermore,
+         * the object decoded by the last call to getData<T>() is kept so
+         * that further calls for the same type do not decode it again.
          */
         class OPENDAVINCI_API Container : public odcore::base::Serializable {
             public:
@@ -69,6 +75,13 @@ class SerializableData;
                  */
                 Container(const Container &obj);
 
+                /**
+                 * Move constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                Container(Container &&obj);
+
                 virtual ~Container();
 
                 /**
@@ -79,6 +92,14 @@ class SerializableData;
                  */
                 Container& operator=(const Container &obj);
 
+                /**
+                 * Move assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                Container& operator=(Container &&obj);
+
                 /**
                  * This method returns the data type inside this container.
                  *
@@ -86,6 +107,14 @@ class SerializableData;
                  */
                 int32_t getDataType() const;
 
+                /**
+                 * This method returns the size of the serialized
+                 * data inside this container.
+                 *
+                 * @return Number of bytes of the serialized data.
+                 */
+                uint32_t getSizeOfData() const;
+
                 virtual ostream& operator<<(ostream &out) const;
                 virtual istream& operator>>(istream &in);
 
@@ -98,15 +127,37 @@ class SerializableData;
                  * T t = c.getData<T>();
                  * @endcode
                  *
+                 * The payload is decoded on every call unless the object
+                 * was cached by getCachedData<T>() before.
+                 *
+                 * @return Usable object.
+                 */
+                template<class T>
+                T getData() {
+                    if (isCached(typeid(T))) {
+                        return *(static_cast<T*>(m_decodedData.get()));
+                    }
+                    T t;
+                    decodeData(t);
+                    return t;
+                }
+
+                /**
+                 * This method returns a usable object like getData<T>()
+                 * but keeps the decoded object for further calls to
+                 * getData<T>() and getCachedData<T>() until the payload
+                 * is replaced. Use it for containers that are decoded
+                 * several times; the cached object is shared by all
+                 * copies of this container.
+                 *
                  * @return Usable object.
                  */
                 template<class T>
-                inline T getData() {
-                    T containerData;
-                    // Read from beginning.
-                    m_serializedData.seekg(ios::beg);
-                    m_serializedData >> containerData;
-                    return containerData;
+                const T& getCachedData() {
+                    if (!isCached(typeid(T))) {
+                        cacheData(new T(), typeid(T));
+                    }
+                    return *(static_cast<T*>(m_decodedData.get()));
                 }
 
                 /**
@@ -148,9 +199,41 @@ class SerializableData;
                  */
                 const string toString() const;
 
+            private:
+                /**
+                 * @param type Type to be checked.
+                 * @return true if an object of the given type was cached.
+                 */
+                bool isCached(const std::type_info &type) const;
+
+                /**
+                 * This method fills the given object from the payload.
+                 *
+                 * @param s Object to be filled from the payload.
+                 */
+                void decodeData(odcore::base::Serializable &s) const;
+
+                /**
+                 * This method takes ownership of the given object, fills it
+                 * from the payload, and keeps it as decoded data.
+                 *
+                 * @param s Newly created object to be filled from the payload.
+                 * @param type Type of the given object.
+                 */
+                void cacheData(odcore::base::Serializable *s, const std::type_info &type);
+
+                /**
+                 * This method serializes the given data into a new payload.
+                 *
+                 * @param serializableData Data to be serialized.
+                 */
+                void setSerializedData(const SerializableData &serializableData);
+
             private:
                 int32_t m_dataType;
-                stringstream m_serializedData;
+                std::shared_ptr<const string> m_serializedData;
+                std::shared_ptr<odcore::base::Serializable> m_decodedData;
+                const std::type_info *m_decodedDataType;
 
                 TimeStamp m_sent;
                 TimeStamp m_received;
@@ -0,0 +1,217 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_DATA_IMAGE_SHAREDIMAGECHANNEL_H_
+#define OPENDAVINCI_CORE_DATA_IMAGE_SHAREDIMAGECHANNEL_H_
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/generated/odcore/data/image/SharedImage.h"
+
+namespace odcore { namespace wrapper { class SharedMemory; } }
+
+namespace odcore {
+    namespace data {
+        namespace image {
+
+            using namespace std;
+
+            /**
+             * This class publishes images from one producer to several
+             * consumers using a shared memory with several slots. The
+             * producer writes every frame to the next slot without
+             * waiting for any consumer and publishes it afterwards;
+             * consumers copy the newest complete frame without locking
+             * the shared memory. Every slot has a sequence number that
+             * is odd while the slot is being written; a consumer that
+             * finds the sequence number changed after copying retries
+             * with the newest frame. Thus, neither side stalls the
+             * other one and no torn frames are delivered.
+             *
+             * The SharedImage describing a published frame carries the
+             * frame's slot and sequence number. Consumers of SharedImages
+             * with sequence = 0 (for example from odplayer or older
+             * producers) are served from a shared memory containing
+             * just the image using the shared memory's lock as before.
+             *
+             * Producer:
+             *
+             * @code
+             * SharedImage si;
+             * si.setName("camera"); si.setWidth(640); ...
+             * SharedImageChannel channel(si, 3);
+             * ...
+             * char *frame = channel.beginWrite();
+             * // Fill frame.
+             * Container c(channel.endWrite());
+             * getConference().send(c);
+             * @endcode
+             *
+             * Consumer:
+             *
+             * @code
+             * SharedImageChannel channel(c.getData<SharedImage>());
+             * if (channel.read(buffer, size)) {
+             *     // Process buffer.
+             * }
+             * @endcode
+             */
+            class OPENDAVINCI_API SharedImageChannel {
+                public:
+                    enum {
+                        DEFAULT_NUMBER_OF_SLOTS = 3,
+                        MAGIC = 0x43494453, // 'SDIC'
+                        ALIGNMENT = 64,
+                        MAX_RETRIES = 16
+                    };
+
+                private:
+                    /**
+                     * This class describes the header at the beginning
+                     * of the shared memory.
+                     */
+                    class Header {
+                        public:
+                            Header(const uint32_t &numberOfSlots, const uint32_t &slotSize);
+
+                        public:
+                            uint32_t m_magic;
+                            uint32_t m_numberOfSlots;
+                            uint32_t m_slotSize;
+                            std::atomic<uint64_t> m_latest; // Sequence number of the newest complete frame.
+                    };
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     *
+                     * @param obj Reference to an object of this class.
+                     */
+                    SharedImageChannel(const SharedImageChannel &/*obj*/);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     *
+                     * @param obj Reference to an object of this class.
+                     * @return Reference to this instance.
+                     */
+                    SharedImageChannel& operator=(const SharedImageChannel &/*obj*/);
+
+                public:
+                    /**
+                     * Constructor for the producer creating the shared memory.
+                     *
+                     * @param si Description of the images (name, width, height, bytes per pixel).
+                     * @param numberOfSlots Number of slots (at least 2).
+                     */
+                    SharedImageChannel(const SharedImage &si, const uint32_t &numberOfSlots);
+
+                    /**
+                     * Constructor for a consumer attaching to the shared
+                     * memory described by a received SharedImage.
+                     *
+                     * @param si SharedImage received from the producer.
+                     */
+                    SharedImageChannel(const SharedImage &si);
+
+                    virtual ~SharedImageChannel();
+
+                    /**
+                     * @return true if the shared memory could be created or attached.
+                     */
+                    bool isValid() const;
+
+                    /**
+                     * @return Description of the images in this channel.
+                     */
+                    const SharedImage getSharedImage() const;
+
+                    /**
+                     * @return Number of slots or 0 for a shared memory containing just the image.
+                     */
+                    uint32_t getNumberOfSlots() const;
+
+                    /**
+                     * This method returns the slot for the next frame. The
+                     * producer must not keep the pointer after calling
+                     * endWrite().
+                     *
+                     * @return Pointer to the next slot or NULL.
+                     */
+                    char* beginWrite();
+
+                    /**
+                     * This method publishes the frame written to the slot
+                     * returned by beginWrite().
+                     *
+                     * @return SharedImage describing the published frame.
+                     */
+                    const SharedImage endWrite();
+
+                    /**
+                     * This method writes and publishes a frame.
+                     *
+                     * @param data Image data.
+                     * @param size Number of bytes to be copied.
+                     * @return SharedImage describing the published frame.
+                     */
+                    const SharedImage write(const char *data, const uint32_t &size);
+
+                    /**
+                     * This method copies the newest complete frame.
+                     *
+                     * @param buffer Buffer to copy the frame to.
+                     * @param size Size of the buffer.
+                     * @return true if a complete frame was copied.
+                     */
+                    bool read(char *buffer, const uint32_t &size);
+
+                    /**
+                     * @return Sequence number of the frame copied by the last successful read() or 0.
+                     */
+                    uint64_t getSequence() const;
+
+                private:
+                    std::atomic<uint64_t>& getVersion(const uint32_t &slot) const;
+
+                    char* getSlot(const uint32_t &slot) const;
+
+                    static uint32_t getAlignedSize(const uint32_t &size);
+
+                private:
+                    SharedImage m_sharedImage;
+                    std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedMemory;
+                    Header *m_header;
+                    uint32_t m_numberOfSlots;
+                    uint32_t m_slotSize;
+                    uint64_t m_sequence;
+            };
+
+        }
+    }
+} // odcore::data::image
+
+#endif /*OPENDAVINCI_CORE_DATA_IMAGE_SHAREDIMAGECHANNEL_H_*/
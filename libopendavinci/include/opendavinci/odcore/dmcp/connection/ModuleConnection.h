@@ -27,6 +27,7 @@
 #include "opendavinci/odcore/base/Condition.h"
 #include "opendavinci/odcore/base/Mutex.h"
 #include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
 #include "opendavinci/odcore/io/Connection.h"
 #include "opendavinci/odcore/io/ConnectionErrorListener.h"
 #include "opendavinci/odcore/io/conference/ContainerListener.h"
@@ -100,12 +101,55 @@ namespace odcore {
                      */
                     vector<odcore::data::Container> pulse_ack_containers(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout);
 
+                    /**
+                     * This method sends a pulse to the connected module
+                     * without waiting for its ACK confirmation. Thus,
+                     * several modules can process a pulse concurrently.
+                     *
+                     * @param pm Pulse to be sent.
+                     */
+                    void sendPulseAck(const odcore::data::dmcp::PulseMessage &pm);
+
+                    /**
+                     * This method waits for the ACK confirmation of the
+                     * pulse sent by sendPulseAck(...).
+                     *
+                     * @param deadline Point in time until which to wait at most.
+                     */
+                    void waitForPulseAck(const odcore::data::TimeStamp &deadline);
+
+                    /**
+                     * This method sends a pulse to the connected module
+                     * without waiting for its ACK confirmation and the
+                     * newly created containers.
+                     *
+                     * @param pm Pulse to be sent.
+                     */
+                    void sendPulseAckContainers(const odcore::data::dmcp::PulseMessage &pm);
+
+                    /**
+                     * This method waits for the ACK confirmation of the
+                     * pulse sent by sendPulseAckContainers(...).
+                     *
+                     * @param deadline Point in time until which to wait at most.
+                     * @return Containers to be transferred to supercomponent.
+                     */
+                    vector<odcore::data::Container> waitForPulseAckContainers(const odcore::data::TimeStamp &deadline);
+
                     const odcore::data::dmcp::ModuleDescriptor getModuleDescriptor() const;
 
                 protected:
                     virtual void nextContainer(odcore::data::Container &c);
                     virtual void handleConnectionError();
 
+                    bool isConnectionLost();
+
+                    /**
+                     * @param deadline Point in time.
+                     * @return Milliseconds until the deadline or 0 if it has passed.
+                     */
+                    static uint32_t getRemainingMilliseconds(const odcore::data::TimeStamp &deadline);
+
                     std::shared_ptr<odcore::io::Connection> m_connection;
                     ModuleConfigurationProvider& m_configurationProvider;
 
@@ -20,11 +20,13 @@
 #ifndef OPENDAVINCI_CORE_IO_STRINGPIPELINE_H_
 #define OPENDAVINCI_CORE_IO_STRINGPIPELINE_H_
 
-#include <queue>
+#include <atomic>
+#include <deque>
 #include <string>
 
-#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/RingBuffer.h"
 #include "opendavinci/odcore/base/Service.h"
 #include "opendavinci/odcore/io/StringListener.h"
 #include "opendavinci/odcore/io/StringObserver.h"
@@ -37,6 +39,13 @@ namespace odcore {
         /**
          * This class distributes strings using an asynchronous pipeline to decouple
          * the processing of the data when invoking a StringListener at higher levels.
+         *
+         * The strings are passed to the pipeline's thread using a lock-free
+         * ring buffer; thus, calls to nextString(...) must not happen
+         * concurrently. As nextString(...) is called from I/O threads, it
+         * never waits: If the ring buffer is full, the strings are queued
+         * in an unbounded overflow queue until the pipeline's thread has
+         * caught up. Strings received after stopping are counted and dropped.
          */
         class StringPipeline : public odcore::base::Service, public StringObserver, public StringListener {
             private:
@@ -54,6 +63,11 @@ namespace odcore {
                  */
                 StringPipeline& operator=(const StringPipeline &);
 
+            private:
+                enum {
+                    CAPACITY = 1024
+                };
+
             public:
                 StringPipeline();
 
@@ -63,20 +77,23 @@ namespace odcore {
 
                 virtual void nextString(const string &s);
 
+                /**
+                 * @return Number of strings that were dropped as they were received after stopping.
+                 */
+                uint32_t getNumberOfDroppedStrings() const;
+
             private:
                 virtual void beforeStop();
 
                 virtual void run();
 
-                /**
-                 * This method is processing the entries in the queue.
-                 */
-                void processQueue();
-
             private:
-                odcore::base::Condition m_queueCondition;
-                odcore::base::Mutex m_queueMutex;
-                queue<string> m_queue;
+                odcore::base::RingBuffer<string> m_queue;
+
+                odcore::base::Mutex m_overflowMutex;
+                deque<string> m_overflow;
+                atomic<uint32_t> m_numberOfOverflowed;
+                atomic<uint32_t> m_numberOfDropped;
 
                 odcore::base::Mutex m_stringListenerMutex;
                 StringListener *m_stringListener;
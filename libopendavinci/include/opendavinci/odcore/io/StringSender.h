@@ -39,6 +39,19 @@ namespace odcore {
                  * param data Data to be sent.
                  */
                 virtual void send(const string& data) = 0;
+
+                /**
+                 * This method sends a frame consisting of the given parts
+                 * back to back. Subclasses that can send several buffers at
+                 * once (scatter I/O) should override this method; the
+                 * default implementation concatenates the parts and calls
+                 * send(data).
+                 *
+                 * param header Data to be sent first.
+                 * param payload Data to be sent after the header.
+                 * param trailer Data to be sent after the payload.
+                 */
+                virtual void sendFramed(const string &header, const string &payload, const string &trailer);
         };
     }
 }
@@ -0,0 +1,172 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef OPENDAVINCI_CORE_IO_CONFERENCE_BRIDGEDCONTAINERCONFERENCE_H_
+#define OPENDAVINCI_CORE_IO_CONFERENCE_BRIDGEDCONTAINERCONFERENCE_H_
+
+#include <deque>
+#include <memory>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/io/conference/ContainerConference.h"
+#include "opendavinci/odcore/io/conference/ContainerListener.h"
+
+namespace odcore { namespace data { class Container; } }
+
+namespace odcore {
+    namespace io {
+        namespace conference {
+
+            using namespace std;
+
+            /**
+             * This class connects a SharedMemoryContainerConference used by
+             * the modules on supercomponent's host with the UDP multicast
+             * conference used by the modules on all other hosts of the same
+             * CID. Containers read from the shared memory are sent via UDP
+             * multicast and containers received via UDP multicast are
+             * written into the shared memory; thus, all modules of a CID
+             * see the same containers regardless of their transport.
+             *
+             * As both transports deliver containers to their senders as
+             * well, the bridge remembers the fingerprints of the containers
+             * it forwarded and does not forward them back. Only one
+             * participant per CID (i.e. odsupercomponent) must bridge.
+             *
+             * The listener of this conference receives every container
+             * exactly once from the shared memory.
+             */
+            class OPENDAVINCI_API BridgedContainerConference : public ContainerConference {
+                private:
+                    friend class ContainerConferenceFactory;
+
+                public:
+                    enum {
+                        MAX_PENDING_CONTAINERS = 1024
+                    };
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    BridgedContainerConference(const BridgedContainerConference &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    BridgedContainerConference& operator=(const BridgedContainerConference &);
+
+                private:
+                    /**
+                     * This class receives the containers from one of the
+                     * two bridged conferences.
+                     */
+                    class Endpoint : public ContainerListener {
+                        private:
+                            Endpoint(const Endpoint &);
+                            Endpoint& operator=(const Endpoint &);
+
+                        public:
+                            Endpoint(BridgedContainerConference &bridge, const bool &isSharedMemory);
+
+                            virtual ~Endpoint();
+
+                            virtual void nextContainer(odcore::data::Container &c);
+
+                        private:
+                            BridgedContainerConference &m_bridge;
+                            const bool m_isSharedMemory;
+                    };
+
+                    /**
+                     * This class keeps the fingerprints of the containers
+                     * that were forwarded but not yet seen again.
+                     */
+                    class PendingContainers {
+                        private:
+                            PendingContainers(const PendingContainers &);
+                            PendingContainers& operator=(const PendingContainers &);
+
+                        public:
+                            PendingContainers();
+
+                            void add(const size_t &fingerprint);
+
+                            /**
+                             * @param fingerprint Fingerprint to be removed.
+                             * @return true if the fingerprint was pending.
+                             */
+                            bool remove(const size_t &fingerprint);
+
+                        private:
+                            base::Mutex m_mutex;
+                            deque<size_t> m_fingerprints;
+                    };
+
+                protected:
+                    /**
+                     * Constructor.
+                     *
+                     * @param sharedMemory Conference used by the modules on this host.
+                     * @param udp Conference used by the modules on other hosts.
+                     */
+                    BridgedContainerConference(std::shared_ptr<ContainerConference> sharedMemory, std::shared_ptr<ContainerConference> udp);
+
+                public:
+                    virtual ~BridgedContainerConference();
+
+                    /**
+                     * This method sends the given container into the shared
+                     * memory; it is forwarded via UDP multicast from there.
+                     *
+                     * @param container Container to be sent.
+                     */
+                    virtual void send(odcore::data::Container &container) const;
+
+                private:
+                    void nextContainerFromSharedMemory(odcore::data::Container &c);
+
+                    void nextContainerFromUDP(odcore::data::Container &c);
+
+                    /**
+                     * @param c Container.
+                     * @return Fingerprint of the container's type and payload.
+                     */
+                    static size_t getFingerprint(const odcore::data::Container &c);
+
+                private:
+                    std::shared_ptr<ContainerConference> m_sharedMemory;
+                    std::shared_ptr<ContainerConference> m_udp;
+                    PendingContainers m_forwardedToUDP;
+                    PendingContainers m_forwardedToSharedMemory;
+                    Endpoint m_sharedMemoryEndpoint;
+                    Endpoint m_udpEndpoint;
+            };
+
+        }
+    }
+} // odcore::io::conference
+
+#endif /*OPENDAVINCI_CORE_IO_CONFERENCE_BRIDGEDCONTAINERCONFERENCE_H_*/
@@ -20,12 +20,15 @@
 #ifndef OPENDAVINCI_CORE_IO_CONFERENCE_CONTAINERCONFERENCEFACTORY_H_
 #define OPENDAVINCI_CORE_IO_CONFERENCE_CONTAINERCONFERENCEFACTORY_H_
 
+#include <map>
 #include <string>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include <memory>
 #include "opendavinci/odcore/base/Mutex.h"
 
+namespace odcore { namespace base { class KeyValueConfiguration; } }
+
 namespace odcore {
     namespace io {
         namespace conference {
@@ -35,12 +38,37 @@ class ContainerConference;
             using namespace std;
 
             /**
-             * This class provides ContainerConferences.
+             * This class provides ContainerConferences. By default, a
+             * UDPMultiCastContainerConference is returned; conferences
+             * between processes on the same host can be switched to a
+             * SharedMemoryContainerConference per address using
+             * setTransport(...) or the global configuration:
+             *
+             * global.conference.transport = sharedmemory
+             * global.conference.sharedmemory.size = 4194304
+             *
+             * UDP multicast conferences can be tuned in the same way:
+             *
+             * global.conference.udp.batchsize = 16
+             * global.conference.udp.receivebuffersize = 4194304
+             *
+             * Shared memory is only used by modules running on the same
+             * host as supercomponent; modules on other hosts keep using UDP
+             * multicast. supercomponent joins the conference using
+             * getBridgedContainerConference(...) to pass the containers
+             * between both transports. If the shared memory cannot be used,
+             * the UDP multicast conference is returned as fallback.
              */
             class OPENDAVINCI_API ContainerConferenceFactory {
                 public:
                     enum {
-                        MULTICAST_PORT = 12175 // Mariposa Rd, Victorville.
+                        MULTICAST_PORT = 12175, // Mariposa Rd, Victorville.
+                        SHARED_MEMORY_SIZE = 4 * 1024 * 1024
+                    };
+
+                    enum TRANSPORT {
+                        UDP_MULTICAST,
+                        SHARED_MEMORY
                     };
 
                 private:
@@ -84,6 +112,87 @@ class ContainerConference;
                      */
                     virtual std::shared_ptr<ContainerConference> getContainerConference(const string &address, const uint32_t &port = ContainerConferenceFactory::MULTICAST_PORT);
 
+                    /**
+                     * This method returns a new ContainerConference like
+                     * getContainerConference(...). If shared memory is
+                     * selected, the returned conference additionally passes
+                     * all containers between the shared memory and UDP
+                     * multicast for the modules on other hosts. Only one
+                     * participant per address (i.e. supercomponent) must
+                     * use this method.
+                     *
+                     * @param address Use address for joining.
+                     * @param port Use port for joining.  If omitted, MULTICAST_PORT will be used.
+                     * @return ContainerConference or NULL.
+                     */
+                    std::shared_ptr<ContainerConference> getBridgedContainerConference(const string &address, const uint32_t &port = ContainerConferenceFactory::MULTICAST_PORT);
+
+                    /**
+                     * This method selects the transport for all conferences
+                     * that are created for the given address afterwards.
+                     *
+                     * @param address Address of the conference.
+                     * @param transport Transport to be used.
+                     * @param size Size of the shared memory if it needs to be created.
+                     */
+                    void setTransport(const string &address, const TRANSPORT &transport, const uint32_t &size = ContainerConferenceFactory::SHARED_MEMORY_SIZE);
+
+                    /**
+                     * This method returns the transport selected for the given address.
+                     *
+                     * @param address Address of the conference.
+                     * @return Transport to be used.
+                     */
+                    TRANSPORT getTransport(const string &address) const;
+
+                    /**
+                     * This method sets the socket parameters for all UDP
+                     * multicast conferences that are created for the given
+                     * address afterwards.
+                     *
+                     * @param address Address of the conference.
+                     * @param batchSize Maximum number of packets fetched per system call.
+                     * @param receiveBufferSize Size of the socket's receive buffer in bytes.
+                     */
+                    void setUDPParameters(const string &address, const uint32_t &batchSize, const uint32_t &receiveBufferSize);
+
+                    /**
+                     * @param address Address of the conference.
+                     * @return Batch size for UDP multicast conferences.
+                     */
+                    uint32_t getUDPBatchSize(const string &address) const;
+
+                    /**
+                     * @param address Address of the conference.
+                     * @return Receive buffer size for UDP multicast conferences.
+                     */
+                    uint32_t getUDPReceiveBufferSize(const string &address) const;
+
+                    /**
+                     * This method selects the transport for the given address
+                     * according to the entries global.conference.transport,
+                     * global.conference.sharedmemory.size,
+                     * global.conference.udp.batchsize, and
+                     * global.conference.udp.receivebuffersize. Shared
+                     * memory is only selected if supercomponent is
+                     * running on the local host.
+                     *
+                     * @param address Address of the conference.
+                     * @param kvc Configuration to be evaluated.
+                     * @param serverIP IP address of supercomponent.
+                     * @return true if conferences for the given address need to be recreated.
+                     */
+                    bool configureTransport(const string &address, const odcore::base::KeyValueConfiguration &kvc, const string &serverIP);
+
+                    /**
+                     * This method checks whether the given IP address
+                     * belongs to one of the local network interfaces.
+                     *
+                     * @param ip IP address to be checked.
+                     * @return true if the IP address belongs to this host.
+                     */
+                    static bool isLocalAddress(const string &ip);
+
                 protected:
                     /**
                      * This method sets the singleton pointer.
@@ -95,6 +204,12 @@ class ContainerConference;
                 private:
                     static base::Mutex m_singletonMutex;
                     static ContainerConferenceFactory* m_singleton;
+
+                    mutable base::Mutex m_transportMutex;
+                    map<string, TRANSPORT> m_transports;
+                    map<string, uint32_t> m_sharedMemorySizes;
+                    map<string, uint32_t> m_udpBatchSizes;
+                    map<string, uint32_t> m_udpReceiveBufferSizes;
             };
 
         }
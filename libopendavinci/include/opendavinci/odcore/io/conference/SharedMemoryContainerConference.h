@@ -0,0 +1,199 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_IO_CONFERENCE_SHAREDMEMORYCONTAINERCONFERENCE_H_
+#define OPENDAVINCI_CORE_IO_CONFERENCE_SHAREDMEMORYCONTAINERCONFERENCE_H_
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Service.h"
+#include "opendavinci/odcore/exceptions/Exceptions.h"
+#include "opendavinci/odcore/io/conference/ContainerConference.h"
+
+namespace odcore { namespace data { class Container; } }
+namespace odcore { namespace wrapper { class SharedMemory; } }
+
+namespace odcore {
+    namespace io {
+        namespace conference {
+
+            using namespace std;
+
+            /**
+             * This class encapsulates a conference about containers between
+             * processes on the same host. All participants of a conference
+             * share one named memory segment that is used as a ring buffer:
+             *
+             * 'Header' 'length' 'type' 'PAYLOAD' 'length' 'type' 'PAYLOAD' ...
+             *
+             * Every record starts at an 8 byte boundary; its payload wraps
+             * around at the end of the ring.
+             *
+             * Senders append serialized containers one after another while
+             * holding the shared memory's lock; every participant reads the
+             * ring on its own using a private read position without any
+             * lock. Participants that fall behind by more than the ring's
+             * size lose the overwritten containers. Readers are woken up
+             * using a futex on Linux; other platforms poll the ring.
+             *
+             * The shared memory segment is created by the first participant
+             * (usually odsupercomponent) and removed once this participant
+             * leaves the conference.
+             */
+            class OPENDAVINCI_API SharedMemoryContainerConference : public ContainerConference, public odcore::base::Service {
+                private:
+                    friend class ContainerConferenceFactory;
+
+                private:
+                    enum {
+                        MAGIC = 0x0D5C0001,
+                        RECORD_HEADER_SIZE = 8,
+                        TYPE_CONTAINER = 1,
+                        ALIGNMENT = 64,
+                        WAIT_TIMEOUT = 100 // ms
+                    };
+
+                    /**
+                     * This class describes the beginning of the shared memory
+                     * segment; the ring's data follows this header.
+                     */
+                    class Header {
+                        public:
+                            Header(const uint32_t &capacity);
+
+                        public:
+                            uint32_t m_magic;
+                            uint32_t m_capacity;
+                            atomic<uint64_t> m_reserved; // End of the region that is currently written.
+                            atomic<uint64_t> m_written; // End of the last completely written record.
+                            atomic<uint32_t> m_notification; // Futex word that is incremented for every record.
+                            atomic<uint32_t> m_numberOfWaitingReaders;
+                    };
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    SharedMemoryContainerConference(const SharedMemoryContainerConference &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    SharedMemoryContainerConference& operator=(const SharedMemoryContainerConference &);
+
+                protected:
+                    /**
+                     * Constructor.
+                     *
+                     * @param address Address of the conference (i.e. the multicast group for this CID).
+                     * @param port Port of the conference.
+                     * @param size Size of the ring in bytes if the shared memory needs to be created.
+                     * @throws ConferenceException if the conference could not be created.
+                     */
+                    SharedMemoryContainerConference(const string &address, const uint32_t &port, const uint32_t &size) throw (exceptions::ConferenceException);
+
+                public:
+                    virtual ~SharedMemoryContainerConference();
+
+                    virtual void send(odcore::data::Container &container) const;
+
+                    /**
+                     * @return Number of bytes available for containers in the ring.
+                     */
+                    uint32_t getCapacity() const;
+
+                    /**
+                     * @return Number of containers that were lost because this participant fell behind.
+                     */
+                    uint32_t getNumberOfLostContainers() const;
+
+                    /**
+                     * This method returns the name of the shared memory
+                     * segment for the given conference.
+                     *
+                     * @param address Address of the conference.
+                     * @param port Port of the conference.
+                     * @return Name of the shared memory segment.
+                     */
+                    static string getSharedMemoryName(const string &address, const uint32_t &port);
+
+                private:
+                    virtual void beforeStop();
+
+                    virtual void run();
+
+                    /**
+                     * This method copies data from the ring.
+                     *
+                     * @param position Absolute position in the ring.
+                     * @param destination Memory to copy to.
+                     * @param length Number of bytes to copy.
+                     */
+                    void copyFromRing(const uint64_t &position, char *destination, const uint32_t &length) const;
+
+                    /**
+                     * This method copies data into the ring.
+                     *
+                     * @param position Absolute position in the ring.
+                     * @param source Memory to copy from.
+                     * @param length Number of bytes to copy.
+                     */
+                    void copyIntoRing(const uint64_t &position, const char *source, const uint32_t &length) const;
+
+                    /**
+                     * @param position Absolute position of a record in the ring.
+                     * @return true if the record at the given position might have been overwritten.
+                     */
+                    bool isOverwritten(const uint64_t &position) const;
+
+                    /**
+                     * This method waits until the given position was written
+                     * or WAIT_TIMEOUT has passed.
+                     *
+                     * @param position Absolute position to wait for.
+                     */
+                    void waitForData(const uint64_t &position);
+
+                    /**
+                     * This method wakes up all waiting participants.
+                     */
+                    void wakeReaders() const;
+
+                    static uint32_t getRecordSize(const uint32_t &length);
+
+                private:
+                    std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedMemory;
+                    Header *m_header;
+                    char *m_ring;
+                    uint64_t m_position; // Absolute position of the next record to be read by this participant.
+                    atomic<uint32_t> m_numberOfLostContainers;
+            };
+
+        }
+    }
+} // odcore::io::conference
+
+#endif /*OPENDAVINCI_CORE_IO_CONFERENCE_SHAREDMEMORYCONTAINERCONFERENCE_H_*/
@@ -20,10 +20,15 @@
 #ifndef OPENDAVINCI_CORE_IO_CONFERENCE_UDPMULTICASTCONTAINERCONFERENCE_H_
 #define OPENDAVINCI_CORE_IO_CONFERENCE_UDPMULTICASTCONTAINERCONFERENCE_H_
 
+#include <atomic>
+#include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include <memory>
+#include "opendavinci/odcore/data/TimeStamp.h"
 #include "opendavinci/odcore/exceptions/Exceptions.h"
 #include "opendavinci/odcore/io/StringListener.h"
 #include "opendavinci/odcore/io/conference/ContainerConference.h"
@@ -44,11 +49,52 @@ namespace odcore {
              * sending and receiving containers. Therefore, it implements
              * a StringListener for getting informed about new strings from
              * the UDPReceiver and informs any connected ContainerListener.
+             *
+             * Containers that do not fit into one UDP packet are split into
+             * sequenced fragments:
+             *
+             * 'MAGIC' 'index' 'number of fragments' 'reserved' 'sender' 'sequence' 'size' 'PAYLOAD'
+             *
+             * The receiving side reassembles a bounded number of containers
+             * at the same time; incomplete containers are dropped after
+             * REASSEMBLY_TIMEOUT or when newer containers need the space.
+             * Containers fitting into one packet are sent unchanged.
              */
             class OPENDAVINCI_API UDPMultiCastContainerConference : public ContainerConference, public odcore::io::StringListener {
                 private:
                     friend class ContainerConferenceFactory;
 
+                public:
+                    enum {
+                        MAX_PACKET_SIZE = 65000,
+                        FRAGMENT_HEADER_SIZE = 20,
+                        MAX_PENDING_CONTAINERS = 16,
+                        MAX_REASSEMBLY_BUFFER_SIZE = 64 * 1024 * 1024,
+                        REASSEMBLY_TIMEOUT = 1000, // ms
+                        BATCH_SIZE = 16,
+                        RECEIVE_BUFFER_SIZE = 4 * 1024 * 1024
+                    };
+
+                private:
+                    enum {
+                        FRAGMENT_MAGIC = 0xABF0
+                    };
+
+                    /**
+                     * This class collects the fragments of one container.
+                     */
+                    class FragmentedContainer {
+                        public:
+                            FragmentedContainer();
+
+                        public:
+                            uint32_t m_numberOfFragments;
+                            uint32_t m_numberOfReceivedFragments;
+                            vector<bool> m_receivedFragments;
+                            string m_data;
+                            odcore::data::TimeStamp m_firstFragmentReceived;
+                    };
+
                 private:
                     /**
                      * "Forbidden" copy constructor. Goal: The compiler should warn
@@ -70,9 +116,13 @@ namespace odcore {
                      *
                      * @param address Use address for joining.
                      * @param port Use port for joining.
+                     * @param batchSize Maximum number of packets fetched per system call.
+                     * @param receiveBufferSize Size of the socket's receive buffer in bytes.
                      * @throws ConferenceException if the conference could not be created.
                      */
-                    UDPMultiCastContainerConference(const string &address, const uint32_t &port) throw (exceptions::ConferenceException);
+                    UDPMultiCastContainerConference(const string &address, const uint32_t &port,
+                                                    const uint32_t &batchSize = UDPMultiCastContainerConference::BATCH_SIZE,
+                                                    const uint32_t &receiveBufferSize = UDPMultiCastContainerConference::RECEIVE_BUFFER_SIZE) throw (exceptions::ConferenceException);
 
                 public:
                     virtual ~UDPMultiCastContainerConference();
@@ -81,9 +131,63 @@ namespace odcore {
 
                     virtual void send(odcore::data::Container &container) const;
 
+                    /**
+                     * @return Number of fragmented containers that could not be reassembled.
+                     */
+                    uint32_t getNumberOfDroppedContainers() const;
+
+                    /**
+                     * This method splits the given data into fragments
+                     * fitting into one UDP packet each.
+                     *
+                     * @param data Data to be split.
+                     * @param sender Identifier of the sending conference.
+                     * @param sequenceNumber Sequence number of the data.
+                     * @return Fragments to be sent or empty list if the data is too large.
+                     */
+                    static vector<string> createFragments(const string &data, const uint32_t &sender, const uint32_t &sequenceNumber);
+
+                private:
+                    /**
+                     * This method adds a received fragment.
+                     *
+                     * @param fragment Received fragment.
+                     * @param data Reassembled data if this fragment completed its container.
+                     * @return true if the container is complete.
+                     */
+                    bool addFragment(const string &fragment, string &data);
+
+                    /**
+                     * This method drops all containers that were not
+                     * reassembled within REASSEMBLY_TIMEOUT.
+                     *
+                     * @param now Current time.
+                     */
+                    void dropExpiredContainers(const odcore::data::TimeStamp &now);
+
+                    /**
+                     * This method drops the oldest incomplete container.
+                     */
+                    void dropOldestContainer();
+
+                    static bool isFragment(const string &s);
+
+                    static void encodeUInt16(char *out, const uint16_t &v);
+                    static void encodeUInt32(char *out, const uint32_t &v);
+                    static uint16_t decodeUInt16(const char *in);
+                    static uint32_t decodeUInt32(const char *in);
+
                 private:
                     std::shared_ptr<odcore::io::udp::UDPSender> m_sender;
                     std::shared_ptr<odcore::io::udp::UDPReceiver> m_receiver;
+
+                    const uint32_t m_senderIdentifier;
+                    mutable atomic<uint32_t> m_sequenceNumber;
+
+                    // Only accessed from the receiving thread.
+                    map<pair<uint32_t, uint32_t>, FragmentedContainer> m_fragmentedContainers;
+                    uint32_t m_reassemblyBufferSize;
+                    atomic<uint32_t> m_numberOfDroppedContainers;
             };
 
         }
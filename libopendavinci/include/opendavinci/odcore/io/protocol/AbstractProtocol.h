@@ -78,6 +78,17 @@ namespace odcore {
                      */
                     void sendByStringSender(const string &data);
 
+                    /**
+                     * This method needs to be called by subclasses to send a
+                     * frame consisting of several parts without concatenating
+                     * them first.
+                     *
+                     * @param header Data to be sent first.
+                     * @param payload Data to be sent after the header.
+                     * @param trailer Data to be sent after the payload.
+                     */
+                    void sendFramedByStringSender(const string &header, const string &payload, const string &trailer);
+
                 private:
                     odcore::base::Mutex m_stringSenderMutex;
                     StringSender *m_stringSender;
@@ -20,7 +20,7 @@
 #ifndef OPENDAVINCI_CORE_IO_PROTOCOL_NETSTRINGSPROTOCOL_H_
 #define OPENDAVINCI_CORE_IO_PROTOCOL_NETSTRINGSPROTOCOL_H_
 
-#include <sstream>
+#include <atomic>
 #include <string>
 
 #include "opendavinci/odcore/opendavinci.h"
@@ -57,6 +57,19 @@ namespace odcore {
              * np.send(payload);
              *
              * @endcode
+             *
+             * Received data is decoded incrementally: All complete Netstrings
+             * contained in one call to nextString(...) are extracted in place
+             * and the buffer is only compacted when the consumed data makes up
+             * the larger part of it.
+             *
+             * Optionally, both peers can agree on a binary framing with a
+             * fixed 4-byte big-endian length header instead of the ASCII
+             * length, and no trailing ','. A peer calling enableBinaryFraming()
+             * announces that it understands binary frames by sending the empty
+             * Netstring "0:,", which is never sent otherwise and thus ignored
+             * by older peers. Binary frames are only sent once both peers have
+             * announced binary framing; until then, Netstrings are used.
              */
             class OPENDAVINCI_API NetstringsProtocol : public StringObserver, public AbstractProtocol {
                 private:
@@ -93,6 +106,19 @@ namespace odcore {
                      */
                     void send(const string& data);
 
+                    /**
+                     * This method announces to the peer that binary frames
+                     * can be decoded and requests binary framing for data
+                     * sent by this instance once the peer has announced
+                     * binary framing as well.
+                     */
+                    void enableBinaryFraming();
+
+                    /**
+                     * @return true if data is sent using binary frames.
+                     */
+                    bool isBinaryFramingActive() const;
+
                     /**
                      * This method sets the StringListener that will receive
                      * incoming data.
@@ -104,8 +130,29 @@ namespace odcore {
                     virtual void nextString(const string &s);
 
                 private:
+                    enum {
+                        BINARY_HEADER_SIZE = 4,
+                        MAX_LENGTH_DIGITS = 10,
+                        // The first byte of a binary frame must not be an ASCII digit.
+                        MAX_BINARY_PAYLOAD = 0x30000000
+                    };
+
                     void decodeNetstring();
 
+                    /**
+                     * This method decodes one frame starting at m_consumed.
+                     *
+                     * @param complete Set to false if more data is required.
+                     * @return false if the buffer contains corrupt data.
+                     */
+                    bool decodeFrame(bool &complete);
+
+                    /**
+                     * This method is called when the peer announced that
+                     * it understands binary frames.
+                     */
+                    void peerSupportsBinaryFraming();
+
                     /**
                      * This method is used to pass received data thread-safe
                      * to the registered StringListener.
@@ -116,7 +163,12 @@ namespace odcore {
                     StringListener *m_stringListener;
 
                     odcore::base::Mutex m_partialDataMutex;
-                    stringstream m_partialData;
+                    string m_partialData;
+                    uint32_t m_consumed;
+
+                    std::atomic<bool> m_binaryFramingRequested;
+                    std::atomic<bool> m_peerSupportsBinaryFraming;
+                    std::atomic<bool> m_binaryFramingActive;
             };
 
         }
@@ -20,7 +20,6 @@
 #ifndef OPENDAVINCI_CORE_IO_TCP_TCPCONNECTION_H_
 #define OPENDAVINCI_CORE_IO_TCP_TCPCONNECTION_H_
 
-#include <sstream>
 #include <string>
 
 #include "opendavinci/odcore/opendavinci.h"
@@ -119,6 +118,18 @@ namespace odcore {
                      */
                     virtual void sendImplementation(const string &data) = 0;
 
+                    /**
+                     * This method is called from within the send()-method.
+                     * Subclasses supporting scatter I/O can override it to
+                     * send the size information and the data without
+                     * concatenating them first; the default implementation
+                     * concatenates both and calls sendImplementation(data).
+                     *
+                     * param header Size information to be sent first.
+                     * param data Data to be sent.
+                     */
+                    virtual void sendWithHeaderImplementation(const string &header, const string &data);
+
                     /**
                      * This method is called be subclasses to invoke
                      * the connection listener.
@@ -126,8 +137,6 @@ namespace odcore {
                     void invokeConnectionListener();
 
                 private:
-                    bool hasCompleteData();
-
                     /**
                      * This method is used to pass received data thread-safe
                      * to the registered StringListener.
@@ -141,7 +150,8 @@ namespace odcore {
                     StringListener *m_stringListener;
 
                     odcore::base::Mutex m_partialDataMutex;
-                    stringstream m_partialData;
+                    string m_partialData;
+                    uint32_t m_consumed;
             };
 
         }
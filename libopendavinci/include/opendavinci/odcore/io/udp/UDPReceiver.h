@@ -120,6 +120,27 @@ namespace odcore {
 
                     virtual void setPacketListener(PacketListener *pl);
 
+                    /**
+                     * This method sets the size of the socket's receive
+                     * buffer in the operating system. A larger buffer
+                     * reduces the number of dropped packets during bursts.
+                     * Implementations not supporting this setting ignore it.
+                     *
+                     * @param size Size in bytes.
+                     */
+                    virtual void setReceiveBufferSize(const uint32_t &size);
+
+                    /**
+                     * This method sets the maximum number of packets to be
+                     * fetched from the operating system at once. The default
+                     * of 1 receives one packet per system call. This method
+                     * must be called before start(). Implementations not
+                     * supporting batched receiving ignore it.
+                     *
+                     * @param numberOfPackets Maximum number of packets per system call.
+                     */
+                    virtual void setBatchSize(const uint32_t &numberOfPackets);
+
                 protected:
                     /**
                      * This method is called from deriving classes to
@@ -21,6 +21,7 @@
 #define OPENDAVINCI_CORE_IO_UDP_UDPSENDER_H_
 
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 
@@ -67,6 +68,17 @@ namespace odcore {
                      * @param data Data to be sent.
                      */
                     virtual void send(const string &data) const = 0;
+
+                    /**
+                     * This method sends several packets using UDP. Each
+                     * entry is sent as one packet. Implementations may
+                     * pass all packets to the operating system at once;
+                     * the default implementation calls send(...) for
+                     * each entry.
+                     *
+                     * @param data Packets to be sent.
+                     */
+                    virtual void sendBatch(const vector<string> &data) const;
             };
 
         }
@@ -0,0 +1,75 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_MEMORYMAPPEDFILE_H_
+#define OPENDAVINCI_CORE_WRAPPER_MEMORYMAPPEDFILE_H_
+
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace wrapper {
+
+        using namespace std;
+
+        /**
+         * This interface encapsulates all methods necessary to
+         * read a file that is mapped into memory.
+         *
+         * @See MemoryMappedFileFactory
+         */
+        class MemoryMappedFile {
+            public:
+                virtual ~MemoryMappedFile();
+
+                /**
+                 * This method returns true if the file could be mapped.
+                 *
+                 * @return true if the file could be mapped.
+                 */
+                virtual bool isValid() const = 0;
+
+                /**
+                 * This method returns the name of the mapped file.
+                 *
+                 * @return name of the mapped file.
+                 */
+                virtual const string getName() const = 0;
+
+                /**
+                 * This method returns a pointer to the beginning of the
+                 * mapped file. The mapping is read-only.
+                 *
+                 * @return Pointer to the beginning of the mapped file or NULL for empty files.
+                 */
+                virtual const char* getData() const = 0;
+
+                /**
+                 * This method returns the size of the mapped file.
+                 *
+                 * @return Size of the mapped file.
+                 */
+                virtual uint64_t getSize() const = 0;
+        };
+
+    }
+} // odcore::wrapper
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_MEMORYMAPPEDFILE_H_*/
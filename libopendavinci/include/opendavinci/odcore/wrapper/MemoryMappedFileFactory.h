@@ -0,0 +1,51 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_MEMORYMAPPEDFILEFACTORY_H_
+#define OPENDAVINCI_CORE_WRAPPER_MEMORYMAPPEDFILEFACTORY_H_
+
+#include <memory>
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore {
+    namespace wrapper {
+
+class MemoryMappedFile;
+
+        using namespace std;
+
+        /**
+         * This class is the abstract factory for mapping files into
+         * memory.
+         */
+        struct OPENDAVINCI_API MemoryMappedFileFactory {
+            /**
+             * This method maps the given file read-only into memory.
+             *
+             * @param name Name of the file to be mapped.
+             * @return Mapped file; use isValid() to check if the file could be mapped.
+             */
+            static std::shared_ptr<MemoryMappedFile> mapFile(const string &name);
+        };
+    }
+} // odcore::wrapper
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_MEMORYMAPPEDFILEFACTORY_H_*/
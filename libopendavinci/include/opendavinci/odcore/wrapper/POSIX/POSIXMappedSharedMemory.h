@@ -0,0 +1,167 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXMAPPEDSHAREDMEMORY_H_
+#define OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXMAPPEDSHAREDMEMORY_H_
+
+#include <atomic>
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SystemLibraryProducts.h"
+
+namespace odcore { namespace wrapper { template <odcore::wrapper::SystemLibraryProducts product> class SharedMemoryFactoryWorker; } }
+
+namespace odcore {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+
+            /**
+             * This class implements a shared memory using shm_open and
+             * mmap. The segment is identified by its complete name and
+             * it begins with a header containing a magic word, the
+             * segment's size, and a futex-based lock that is shared
+             * between all processes:
+             *
+             * 'magic' 'size' 'lock' ... 'data'
+             *
+             * The owner writes the magic word only after the header is
+             * initialized completely and attaching processes wait for it.
+             *
+             * The data starts at a cache line boundary. Thus, attaching
+             * to a segment needs only one shm_open/mmap, locking needs
+             * a system call only under contention, and all pages are
+             * pre-faulted during mapping. Large segments are backed by
+             * transparent huge pages if the kernel supports them for
+             * shared memory.
+             *
+             * @See SharedMemory.
+             */
+            class POSIXMappedSharedMemory : public SharedMemory {
+                private:
+                    friend class SharedMemoryFactoryWorker<SystemLibraryPosix>;
+
+                    enum {
+                        HEADER_SIZE = 64,
+                        HUGE_PAGE_SIZE = 2 * 1024 * 1024,
+                        MAGIC = 0x4F44534D, // "ODSM"
+                        ATTACH_RETRIES = 100,
+                        ATTACH_RETRY_DELAY = 10000 // in microseconds.
+                    };
+
+                    /**
+                     * This class describes the header at the beginning
+                     * of the shared memory.
+                     */
+                    class Header {
+                        public:
+                            Header(const uint32_t &size);
+
+                        public:
+                            std::atomic<uint32_t> m_magic; // MAGIC as soon as the header is initialized.
+                            uint32_t m_size;
+                            std::atomic<int32_t> m_lock; // 0: unlocked, 1: locked, 2: locked with waiting processes.
+                    };
+
+                    /**
+                     * Constructor.
+                     *
+                     * @param name Name of the shared memory.
+                     * @param size Create a new shared memory with the given size.
+                     */
+                    POSIXMappedSharedMemory(const string &name, const uint32_t &size);
+
+                    /**
+                     * Constructor.
+                     *
+                     * @param name Attach to an already existing shared memory.
+                     */
+                    POSIXMappedSharedMemory(const string &name);
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    POSIXMappedSharedMemory(const POSIXMappedSharedMemory &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    POSIXMappedSharedMemory& operator=(const POSIXMappedSharedMemory &);
+
+                public:
+                    virtual ~POSIXMappedSharedMemory();
+
+                    virtual bool isValid() const;
+
+                    virtual const string getName() const;
+
+                    virtual void lock();
+
+                    virtual void unlock();
+
+                    virtual void* getSharedMemory() const;
+
+                    virtual uint32_t getSize() const;
+
+                    /**
+                     * This method returns the name used for shm_open.
+                     *
+                     * @param name Name of the shared memory.
+                     * @return Name in /dev/shm.
+                     */
+                    static string getInternalName(const string &name);
+
+                private:
+                    /**
+                     * This method maps the segment into memory.
+                     *
+                     * @param fd File descriptor from shm_open.
+                     * @param length Number of bytes to be mapped.
+                     * @return true if the segment could be mapped.
+                     */
+                    bool map(const int32_t &fd, const uint64_t &length);
+
+                    /**
+                     * @param size Number of bytes for the data.
+                     * @return Length of the complete segment.
+                     */
+                    static uint64_t getLength(const uint32_t &size);
+
+                private:
+                    string m_name;
+                    string m_internalName;
+                    bool m_releaseSharedMemory;
+                    void *m_mapping;
+                    uint64_t m_length;
+                    Header *m_header;
+            };
+
+        }
+    }
+} // odcore::wrapper::POSIX
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXMAPPEDSHAREDMEMORY_H_*/
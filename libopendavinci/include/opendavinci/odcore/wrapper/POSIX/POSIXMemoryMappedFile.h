@@ -0,0 +1,91 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXMEMORYMAPPEDFILE_H_
+#define OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXMEMORYMAPPEDFILE_H_
+
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/wrapper/MemoryMappedFile.h"
+#include "opendavinci/odcore/wrapper/SystemLibraryProducts.h"
+
+namespace odcore { namespace wrapper { template <odcore::wrapper::SystemLibraryProducts product> class MemoryMappedFileFactoryWorker; } }
+
+namespace odcore {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+
+            /**
+             * This class implements a read-only memory mapped file
+             * using mmap.
+             *
+             * @See MemoryMappedFile
+             */
+            class POSIXMemoryMappedFile : public MemoryMappedFile {
+                private:
+                    friend class MemoryMappedFileFactoryWorker<SystemLibraryPosix>;
+
+                    /**
+                     * Constructor.
+                     *
+                     * @param name Name of the file to be mapped.
+                     */
+                    POSIXMemoryMappedFile(const string &name);
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    POSIXMemoryMappedFile(const POSIXMemoryMappedFile &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    POSIXMemoryMappedFile& operator=(const POSIXMemoryMappedFile &);
+
+                public:
+                    virtual ~POSIXMemoryMappedFile();
+
+                    virtual bool isValid() const;
+
+                    virtual const string getName() const;
+
+                    virtual const char* getData() const;
+
+                    virtual uint64_t getSize() const;
+
+                private:
+                    string m_name;
+                    bool m_valid;
+                    void *m_data;
+                    uint64_t m_size;
+            };
+
+        }
+    }
+} // odcore::wrapper::POSIX
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXMEMORYMAPPEDFILE_H_*/
@@ -0,0 +1,295 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXREACTOR_H_
+#define OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXREACTOR_H_
+
+#include <pthread.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/wrapper/Runnable.h"
+
+namespace odcore { namespace wrapper { class Thread; } }
+
+namespace odcore {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+
+            /**
+             * This class waits for incoming data on all sockets of a
+             * process using epoll (Linux only) and dispatches to the
+             * registered handlers from a small, configurable number of
+             * threads. It is used by POSIXTCPConnection, POSIXTCPAcceptor,
+             * and POSIXUDPReceiver instead of one thread per socket:
+             *
+             * @code
+             * POSIXReactor::getInstance().add(fd, this);
+             * ...
+             * // Returns as soon as this handler is not running anymore.
+             * POSIXReactor::getInstance().remove(fd, this);
+             * @endcode
+             *
+             * A handler is never invoked concurrently for the same socket.
+             * The configured number of threads is started when the first
+             * socket is added. As handlers might block until data from
+             * another socket was received (e.g. a new module's description),
+             * one thread is always kept waiting for events: if all threads
+             * are busy in handlers, a spare thread is started, up to
+             * MAX_THREADS in total. A spare thread ends after it was idle
+             * for SPARE_THREAD_IDLE_TIME while another thread is waiting
+             * for events as well. The threads are stopped when the process
+             * exits; threads that are still blocked in a handler after
+             * EXIT_TIMEOUT are not joined and end with the process.
+             */
+            class OPENDAVINCI_API POSIXReactor {
+                public:
+                    enum {
+                        BUFFER_SIZE = 65535,
+                        MAX_THREADS = 64,
+                        SPARE_THREAD_IDLE_TIME = 1000, // in milliseconds
+                        EXIT_TIMEOUT = 1000 // in milliseconds
+                    };
+
+                    /**
+                     * Interface for classes to be informed about
+                     * incoming data on their socket.
+                     */
+                    class OPENDAVINCI_API Handler {
+                        public:
+                            virtual ~Handler();
+
+                            /**
+                             * This method is called when the socket can be
+                             * read without blocking.
+                             *
+                             * @param buffer Receive buffer of the calling thread.
+                             * @param size Size of the receive buffer.
+                             * @return false if the socket shall not be watched anymore.
+                             */
+                            virtual bool handleReadable(char *buffer, const uint32_t &size) = 0;
+                    };
+
+                private:
+                    /**
+                     * This class describes one thread dispatching to
+                     * the handlers.
+                     */
+                    class Worker : public Runnable {
+                        private:
+                            Worker(const Worker &);
+                            Worker& operator=(const Worker &);
+
+                        public:
+                            Worker(POSIXReactor &reactor, const bool &spare);
+
+                            virtual ~Worker();
+
+                            virtual bool isRunning();
+
+                            virtual void run();
+
+                        public:
+                            POSIXReactor &m_reactor;
+                            const bool m_spare;
+                            std::atomic<bool> m_finished;
+                            std::shared_ptr<Thread> m_thread;
+                    };
+
+                    /**
+                     * This class describes one registered socket.
+                     */
+                    class Registration {
+                        public:
+                            Registration();
+
+                        public:
+                            int32_t m_fileDescriptor;
+                            Handler *m_handler;
+                            bool m_busy;
+                            pthread_t m_thread;
+                    };
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    POSIXReactor(const POSIXReactor &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    POSIXReactor& operator=(const POSIXReactor &);
+
+                private:
+                    POSIXReactor();
+
+                public:
+                    virtual ~POSIXReactor();
+
+                    /**
+                     * @return Instance of the reactor for this process.
+                     */
+                    static POSIXReactor& getInstance();
+
+                    /**
+                     * @return true if the reactor is available on this platform.
+                     */
+                    static bool isSupported();
+
+                    /**
+                     * This method sets the number of threads dispatching
+                     * to the handlers that are started up front (default 1,
+                     * at most MAX_THREADS). Spare threads are only added
+                     * while all threads are blocked in handlers. Once the
+                     * reactor is running, the number of threads can only
+                     * be increased.
+                     *
+                     * @param numberOfThreads Number of threads.
+                     */
+                    void setNumberOfThreads(const uint32_t &numberOfThreads);
+
+                    /**
+                     * @return Number of running threads.
+                     */
+                    uint32_t getNumberOfThreads() const;
+
+                    /**
+                     * @return Number of registered sockets.
+                     */
+                    uint32_t getNumberOfHandlers() const;
+
+                    /**
+                     * This method starts watching the given socket.
+                     *
+                     * @param fileDescriptor Socket to be watched.
+                     * @param handler Handler to be called for incoming data.
+                     */
+                    void add(const int32_t &fileDescriptor, Handler *handler);
+
+                    /**
+                     * This method stops watching the given socket. If the
+                     * handler is currently running in a different thread,
+                     * this method waits until it has returned.
+                     *
+                     * @param fileDescriptor Socket to be removed.
+                     * @param handler Handler that was registered for this socket.
+                     */
+                    void remove(const int32_t &fileDescriptor, Handler *handler);
+
+                    /**
+                     * This method stops and joins all threads. They are
+                     * started again when the next socket is added. It
+                     * must not be called from a handler.
+                     */
+                    void stop();
+
+                    bool isRunning();
+
+                private:
+                    /**
+                     * This method is called in a child process after fork().
+                     */
+                    static void resetAfterFork();
+
+                    /**
+                     * This method is called when the process exits.
+                     */
+                    static void stopAtExit();
+
+                    /**
+                     * This method stops all threads.
+                     *
+                     * @param timeout Time in milliseconds to wait for threads blocked in handlers (0 = join all threads).
+                     */
+                    void stopThreads(const uint32_t &timeout);
+
+                    void startThreads();
+
+                    void startSpareThread();
+
+                    void startThread(const bool &spare);
+
+                    /**
+                     * This method ends the given idle spare thread if
+                     * another thread is waiting for events.
+                     *
+                     * @param worker Spare thread.
+                     * @return true if the thread shall end.
+                     */
+                    bool retire(Worker &worker);
+
+                    /**
+                     * This method is run by every thread.
+                     *
+                     * @param worker Calling thread.
+                     */
+                    void run(Worker &worker);
+
+                    void dispatch(const uint64_t &id, char *buffer);
+
+                    /**
+                     * This method (re-)arms the one-shot event for a socket.
+                     *
+                     * @param isNew true if the socket was not watched before.
+                     * @param fileDescriptor Socket to be watched.
+                     * @param id Registration to be dispatched to.
+                     * @return true if the socket is watched.
+                     */
+                    bool watch(const bool &isNew, const int32_t &fileDescriptor, const uint64_t &id);
+
+                    void unwatch(const int32_t &fileDescriptor);
+
+                private:
+                    static odcore::base::Mutex m_singletonMutex;
+                    static POSIXReactor *m_singleton;
+
+                    int32_t m_epollFileDescriptor;
+                    int32_t m_wakeupFileDescriptor;
+                    std::atomic<bool> m_running;
+
+                    mutable odcore::base::Mutex m_threadsMutex;
+                    uint32_t m_numberOfThreads;
+                    vector<std::shared_ptr<Worker> > m_workers;
+                    vector<std::shared_ptr<Worker> > m_retiredWorkers;
+                    std::atomic<uint32_t> m_idleThreads;
+
+                    mutable odcore::base::Condition m_registrationsCondition;
+                    uint64_t m_nextId;
+                    map<uint64_t, Registration> m_registrations;
+                    map<int32_t, uint64_t> m_fileDescriptors;
+            };
+
+        }
+    }
+} // odcore::wrapper::POSIX
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_POSIX_POSIXREACTOR_H_*/
@@ -23,6 +23,7 @@
 #include "opendavinci/odcore/opendavinci.h"
 
 #include "opendavinci/odcore/wrapper/SharedMemoryFactoryWorker.h"
+#include "opendavinci/odcore/wrapper/POSIX/POSIXMappedSharedMemory.h"
 #include "opendavinci/odcore/wrapper/POSIX/POSIXSharedMemory.h"
 
 namespace odcore {
@@ -30,14 +31,27 @@ namespace odcore {
 
         using namespace std;
 
+        /**
+         * On Linux, shared memory is created using shm_open and mmap
+         * with a futex-based lock; other POSIX systems use System V
+         * shared memory and a named semaphore.
+         */
         template <> class OPENDAVINCI_API SharedMemoryFactoryWorker<SystemLibraryPosix> {
             public:
                 static std::shared_ptr<SharedMemory> createSharedMemory(const string &name, const uint32_t &size) {
+#ifdef __linux__
+                    return std::shared_ptr<SharedMemory>(new POSIX::POSIXMappedSharedMemory(name, size));
+#else
                     return std::shared_ptr<SharedMemory>(new POSIX::POSIXSharedMemory(name, size));
+#endif
                 };
 
                 static std::shared_ptr<SharedMemory> attachToSharedMemory(const string &name) {
+#ifdef __linux__
+                    return std::shared_ptr<SharedMemory>(new POSIX::POSIXMappedSharedMemory(name));
+#else
                     return std::shared_ptr<SharedMemory>(new POSIX::POSIXSharedMemory(name));
+#endif
                 };
         };
 
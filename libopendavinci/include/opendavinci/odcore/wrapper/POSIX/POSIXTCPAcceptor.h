@@ -20,11 +20,13 @@
 #ifndef OPENDAVINCI_CORE_WRAPPER_POSIXTCPACCEPTOR_H_
 #define OPENDAVINCI_CORE_WRAPPER_POSIXTCPACCEPTOR_H_
 
+#include <atomic>
 #include <memory>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/io/tcp/TCPAcceptor.h"
 #include "opendavinci/odcore/wrapper/Runnable.h"
+#include "opendavinci/odcore/wrapper/POSIX/POSIXReactor.h"
 
 namespace odcore { namespace io { namespace tcp { class TCPAcceptorListener; } } }
 namespace odcore { namespace io { namespace tcp { class TCPConnection; } } }
@@ -37,7 +39,12 @@ namespace odcore {
 
             using namespace std;
 
-            class POSIXTCPAcceptor : public odcore::io::tcp::TCPAcceptor, public Runnable {
+            /**
+             * This class implements a TCP acceptor using POSIX. Incoming
+             * connections are accepted by the POSIXReactor if supported
+             * on this platform; otherwise, the acceptor uses its own thread.
+             */
+            class POSIXTCPAcceptor : public odcore::io::tcp::TCPAcceptor, public Runnable, public POSIXReactor::Handler {
                 private:
                     static const int32_t BACKLOG = 100;
 
@@ -68,9 +75,16 @@ namespace odcore {
                     virtual bool isRunning();
                     virtual void run();
 
+                    virtual bool handleReadable(char *buffer, const uint32_t &size);
+
                 protected:
                     void invokeAcceptorListener(std::shared_ptr<odcore::io::tcp::TCPConnection> connection);
 
+                    /**
+                     * This method accepts a pending connection.
+                     */
+                    void acceptConnection();
+
                     unique_ptr<Thread> m_thread;
 
                     unique_ptr<Mutex> m_listenerMutex;
@@ -78,6 +92,7 @@ namespace odcore {
 
                     int32_t m_fileDescriptor;
                     int32_t m_port;
+                    std::atomic<bool> m_isRunning;
             };
 
         }
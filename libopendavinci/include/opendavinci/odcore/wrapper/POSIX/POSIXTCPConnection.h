@@ -20,12 +20,14 @@
 #ifndef OPENDAVINCI_CORE_WRAPPER_POSIXTCPCONNECTION_H_
 #define OPENDAVINCI_CORE_WRAPPER_POSIXTCPCONNECTION_H_
 
+#include <atomic>
 #include <memory>
 #include <string>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/io/tcp/TCPConnection.h"
 #include "opendavinci/odcore/wrapper/Runnable.h"
+#include "opendavinci/odcore/wrapper/POSIX/POSIXReactor.h"
 
 namespace odcore { namespace wrapper { class Mutex; } }
 namespace odcore { namespace wrapper { class Thread; } }
@@ -36,7 +38,12 @@ namespace odcore {
 
             using namespace std;
 
-            class POSIXTCPConnection : public odcore::io::tcp::TCPConnection, public Runnable {
+            /**
+             * This class implements a TCP connection using POSIX. Incoming
+             * data is received by the POSIXReactor if supported on this
+             * platform; otherwise, every connection uses its own thread.
+             */
+            class POSIXTCPConnection : public odcore::io::tcp::TCPConnection, public Runnable, public POSIXReactor::Handler {
                 private:
                     /**
                      * "Forbidden" copy constructor. Goal: The compiler should warn
@@ -61,22 +68,33 @@ namespace odcore {
 
                     virtual void sendImplementation(const std::string& data);
 
+                    virtual void sendWithHeaderImplementation(const std::string &header, const std::string &data);
+
                     virtual void start();
                     virtual void stop();
 
                     virtual bool isRunning();
                     virtual void run();
 
+                    virtual bool handleReadable(char *buffer, const uint32_t &size);
+
                 protected:
                     void initialize();
 
+                    /**
+                     * This method receives data from the socket.
+                     *
+                     * @param buffer Receive buffer.
+                     * @param size Size of the receive buffer.
+                     * @return false if the connection was closed.
+                     */
+                    bool receive(char *buffer, const uint32_t &size);
+
                     unique_ptr<Thread> m_thread;
 
                     unique_ptr<Mutex> m_socketMutex;
                     int32_t m_fileDescriptor;
-
-                    enum {BUFFER_SIZE = 65535};
-                    char m_buffer[BUFFER_SIZE];
+                    std::atomic<bool> m_isRunning;
                     std::string m_ip;
                     uint32_t m_port;
             };
@@ -22,14 +22,19 @@
 
 #include <netinet/in.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 
+#include <atomic>
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/io/udp/UDPReceiver.h"
 #include "opendavinci/odcore/wrapper/NetworkLibraryProducts.h"
 #include "opendavinci/odcore/wrapper/Runnable.h"
+#include "opendavinci/odcore/wrapper/POSIX/POSIXReactor.h"
 
 namespace odcore { namespace wrapper { class Thread; } }
 namespace odcore { namespace wrapper { template <odcore::wrapper::NetworkLibraryProducts product> class UDPFactoryWorker; } }
@@ -42,10 +47,12 @@ namespace odcore {
 
             /**
              * This class implements a UDP receiver for receiving data using POSIX.
+             * Incoming packets are received by the POSIXReactor if supported
+             * on this platform; otherwise, the receiver uses its own thread.
              *
              * @See UDPReceiver
              */
-            class POSIXUDPReceiver : public Runnable, public odcore::io::udp::UDPReceiver {
+            class POSIXUDPReceiver : public Runnable, public odcore::io::udp::UDPReceiver, public POSIXReactor::Handler {
                 private:
                     friend class UDPFactoryWorker<NetworkLibraryPosix>;
 
@@ -60,7 +67,9 @@ namespace odcore {
 
                 private:
                     enum {
-                        BUFFER_SIZE = 65535
+                        BUFFER_SIZE = 65535,
+                        MAX_BATCH_SIZE = 64,
+                        MAX_CACHED_SENDER_ADDRESSES = 1024
                     };
 
                 private:
@@ -85,6 +94,19 @@ namespace odcore {
 
                     virtual void stop();
 
+                    virtual void setReceiveBufferSize(const uint32_t &size);
+
+                    /**
+                     * This method sets the maximum number of packets to be
+                     * fetched at once using recvmmsg (Linux only). The value
+                     * is limited to MAX_BATCH_SIZE.
+                     *
+                     * @param numberOfPackets Maximum number of packets per system call.
+                     */
+                    virtual void setBatchSize(const uint32_t &numberOfPackets);
+
+                    virtual bool handleReadable(char *buffer, const uint32_t &size);
+
                 private:
                     bool m_isMulticast;
                     struct sockaddr_in m_address;
@@ -92,9 +114,51 @@ namespace odcore {
                     int32_t m_fd;
                     char *m_buffer;
                     unique_ptr<Thread> m_thread;
+                    uint32_t m_batchSize;
+                    map<uint32_t, string> m_senderAddresses;
+                    std::atomic<bool> m_isRunning;
+
+#ifdef __linux__
+                    vector<struct mmsghdr> m_messages;
+#endif
+                    vector<char> m_batchBuffers;
+                    vector<struct iovec> m_iovecs;
+                    vector<struct sockaddr_in> m_remotes;
 
                     virtual void run();
 
+                    /**
+                     * This method receives the pending packets without blocking.
+                     *
+                     * @param buffer Receive buffer.
+                     * @param size Size of the receive buffer.
+                     */
+                    void receive(char *buffer, const uint32_t &size);
+
+                    /**
+                     * This method receives one packet per system call.
+                     *
+                     * @param buffer Receive buffer.
+                     * @param size Size of the receive buffer.
+                     */
+                    void receiveSingle(char *buffer, const uint32_t &size);
+
+                    /**
+                     * This method receives up to m_batchSize packets per
+                     * system call using recvmmsg.
+                     */
+                    void receiveBatched();
+
+                    /**
+                     * This method returns the textual representation of the
+                     * given sender address. As the set of senders is usually
+                     * small, the representations are cached.
+                     *
+                     * @param address IPv4 address in network byte order.
+                     * @return Textual representation of the address.
+                     */
+                    const string& getSenderAddress(const uint32_t &address);
+
                     virtual bool isRunning();
             };
 
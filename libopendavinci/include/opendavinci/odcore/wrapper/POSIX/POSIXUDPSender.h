@@ -25,6 +25,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/io/udp/UDPSender.h"
@@ -47,7 +48,8 @@ namespace odcore {
             class POSIXUDPSender : public odcore::io::udp::UDPSender {
                 private:
                     enum {
-                        MAX_UDP_PACKET_SIZE = 65507
+                        MAX_UDP_PACKET_SIZE = 65507,
+                        MAX_BATCH_SIZE = 64
                     };
 
                 private:
@@ -81,6 +83,15 @@ namespace odcore {
 
                     virtual void send(const string &data) const;
 
+                    /**
+                     * This method sends several packets using sendmmsg
+                     * (Linux only) in chunks of at most MAX_BATCH_SIZE
+                     * packets per system call.
+                     *
+                     * @param data Packets to be sent.
+                     */
+                    virtual void sendBatch(const vector<string> &data) const;
+
                 private:
                     struct sockaddr_in m_address;
                     int32_t m_fd;
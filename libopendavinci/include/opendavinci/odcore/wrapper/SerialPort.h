@@ -86,6 +86,17 @@ class Thread;
                  */
                 void send(const string &data);
 
+                /**
+                 * This method writes the given parts one after another
+                 * without concatenating them first. Frames sent from
+                 * different threads are not interleaved.
+                 *
+                 * param header Data to be sent first.
+                 * param payload Data to be sent after the header.
+                 * param trailer Data to be sent after the payload.
+                 */
+                virtual void sendFramed(const string &header, const string &payload, const string &trailer);
+
             protected:
                 virtual bool isRunning();
 
@@ -120,6 +131,8 @@ class Thread;
                 unique_ptr<Mutex> m_stringListenerMutex;
                 odcore::io::StringListener *m_stringListener;
 
+                unique_ptr<Mutex> m_sendMutex;
+
                 void *m_serial;
 
                 /**
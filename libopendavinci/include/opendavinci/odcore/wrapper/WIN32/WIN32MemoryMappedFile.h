@@ -0,0 +1,92 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_WIN32IMPL_WIN32MEMORYMAPPEDFILE_H_
+#define OPENDAVINCI_CORE_WRAPPER_WIN32IMPL_WIN32MEMORYMAPPEDFILE_H_
+
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+#include "opendavinci/odcore/wrapper/MemoryMappedFile.h"
+#include "opendavinci/odcore/wrapper/MemoryMappedFileFactoryWorker.h"
+
+namespace odcore {
+    namespace wrapper {
+        namespace WIN32Impl {
+
+            using namespace std;
+
+            /**
+             * This class implements a read-only memory mapped file
+             * using file mappings.
+             *
+             * @See MemoryMappedFile
+             */
+            class WIN32MemoryMappedFile : public MemoryMappedFile {
+                private:
+                    friend class MemoryMappedFileFactoryWorker<SystemLibraryWin32>;
+
+                    /**
+                     * Constructor.
+                     *
+                     * @param name Name of the file to be mapped.
+                     */
+                    WIN32MemoryMappedFile(const string &name);
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     */
+                    WIN32MemoryMappedFile(const WIN32MemoryMappedFile &);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     */
+                    WIN32MemoryMappedFile& operator=(const WIN32MemoryMappedFile &);
+
+                public:
+                    virtual ~WIN32MemoryMappedFile();
+
+                    virtual bool isValid() const;
+
+                    virtual const string getName() const;
+
+                    virtual const char* getData() const;
+
+                    virtual uint64_t getSize() const;
+
+                private:
+                    string m_name;
+                    bool m_valid;
+                    HANDLE m_file;
+                    HANDLE m_mapping;
+                    void *m_data;
+                    uint64_t m_size;
+            };
+
+        }
+    }
+} // odcore::wrapper::WIN32Impl
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_WIN32IMPL_WIN32MEMORYMAPPEDFILE_H_*/
@@ -81,6 +81,8 @@ namespace odcore {
 
                     virtual void stop();
 
+                    virtual void setReceiveBufferSize(const uint32_t &size);
+
                 private:
                     const char* inet_ntop(int af, const void* src, char* dst, int cnt);
 
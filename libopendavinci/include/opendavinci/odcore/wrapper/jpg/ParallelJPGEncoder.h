@@ -0,0 +1,145 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_CORE_WRAPPER_JPG_PARALLELJPGENCODER_H_
+#define OPENDAVINCI_CORE_WRAPPER_JPG_PARALLELJPGENCODER_H_
+
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/WorkPool.h"
+
+namespace odcore {
+    namespace wrapper {
+        namespace jpg {
+
+            using namespace std;
+
+            /**
+             * This class compresses raw image data to JPG using several
+             * threads. The image is split into horizontal strips of
+             * MCU_ROWS_PER_STRIP rows of MCUs each; every strip is one
+             * restart interval of the resulting JPG and thus, the strips
+             * are compressed independently and joined afterwards. The
+             * calling thread compresses strips as well. As the strips do
+             * not depend on the number of threads, the compressed data
+             * is the same for any number of threads.
+             *
+             * The buffers for the compressed strips are kept between
+             * calls to avoid allocating memory for every image.
+             *
+             * @code
+             * ParallelJPGEncoder encoder(4);
+             * int size = bufferSize;
+             * if (encoder.compress(buffer, size, 640, 480, 3, image, 85)) {
+             *     // buffer contains size bytes.
+             * }
+             * @endcode
+             */
+            class OPENDAVINCI_API ParallelJPGEncoder : private odcore::base::WorkPool::Task {
+                public:
+                    enum {
+                        MCU_ROWS_PER_STRIP = 4
+                    };
+
+                private:
+                    /**
+                     * "Forbidden" copy constructor. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the copy constructor.
+                     *
+                     * @param obj Reference to an object of this class.
+                     */
+                    ParallelJPGEncoder(const ParallelJPGEncoder &/*obj*/);
+
+                    /**
+                     * "Forbidden" assignment operator. Goal: The compiler should warn
+                     * already at compile time for unwanted bugs caused by any misuse
+                     * of the assignment operator.
+                     *
+                     * @param obj Reference to an object of this class.
+                     * @return Reference to this instance.
+                     */
+                    ParallelJPGEncoder& operator=(const ParallelJPGEncoder &/*obj*/);
+
+                public:
+                    /**
+                     * Constructor.
+                     *
+                     * @param numberOfThreads Number of threads including the calling thread (0 = number of cores).
+                     */
+                    ParallelJPGEncoder(const uint32_t &numberOfThreads);
+
+                    virtual ~ParallelJPGEncoder();
+
+                    /**
+                     * @return Number of threads including the calling thread.
+                     */
+                    uint32_t getNumberOfThreads() const;
+
+                    /**
+                     * This method compresses raw image data like JPG::compress
+                     * using restart intervals.
+                     *
+                     * @param dest Pointer to destination buffer to receive the compressed image data.
+                     * @param destSize Size of destination buffer that will be set to the actual amount of bytes used thereof.
+                     * @param width Raw image's width.
+                     * @param height Raw image's height.
+                     * @param bytesPerPixel Raw image's bytes per pixel (channels).
+                     * @param rawImageData Raw image data.
+                     * @param quality Compression rate (must be between 1 and 100).
+                     * @return true if the compression succeeded.
+                     */
+                    bool compress(void *dest, int &destSize, const uint32_t &width, const uint32_t &height, const uint32_t &bytesPerPixel, const uint8_t *rawImageData, const uint32_t &quality);
+
+                private:
+                    /**
+                     * This method compresses one strip of the current image.
+                     *
+                     * @param item Index of the strip.
+                     */
+                    virtual void process(const uint32_t &item);
+
+                    bool compressStrip(const uint32_t &strip);
+
+                    uint32_t getStripHeight() const;
+
+                private:
+                    odcore::base::WorkPool m_workPool;
+                    odcore::base::Mutex m_compressMutex;
+
+                    // Current image.
+                    uint32_t m_width;
+                    uint32_t m_height;
+                    uint32_t m_bytesPerPixel;
+                    const uint8_t *m_rawImageData;
+                    uint32_t m_quality;
+                    uint32_t m_numberOfStrips;
+
+                    vector<uint8_t> m_header;
+                    vector<vector<uint8_t> > m_strips;
+                    vector<uint8_t> m_stripCompressed;
+            };
+
+        }
+    }
+} // odcore::wrapper::jpg
+
+#endif /*OPENDAVINCI_CORE_WRAPPER_JPG_PARALLELJPGENCODER_H_*/
@@ -22,6 +22,8 @@
 
 #include <string>
 
+#include "opendavinci/odcore/opendavinci.h"
+
 namespace odcore {
     namespace wrapper {
         namespace zlib {
@@ -60,6 +62,28 @@ namespace odcore {
 
                     static string compress(const string &s);
                     static string decompress(const string &s);
+
+                    /**
+                     * This method compresses binary data of arbitrary size
+                     * favoring speed over compression ratio.
+                     *
+                     * @param data Data to be compressed.
+                     * @param length Length of the data.
+                     * @param out Compressed data.
+                     * @return true if the data could be compressed.
+                     */
+                    static bool compressBlock(const char *data, const uint32_t &length, string &out);
+
+                    /**
+                     * This method decompresses data created by compressBlock.
+                     *
+                     * @param data Compressed data.
+                     * @param length Length of the compressed data.
+                     * @param decompressedLength Length of the original data.
+                     * @param out Decompressed data.
+                     * @return true if the data could be decompressed.
+                     */
+                    static bool decompressBlock(const char *data, const uint32_t &length, const uint32_t &decompressedLength, string &out);
             };
 
         }
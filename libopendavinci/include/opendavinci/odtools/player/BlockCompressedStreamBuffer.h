@@ -0,0 +1,150 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_TOOLS_PLAYER_BLOCKCOMPRESSEDSTREAMBUFFER_H_
+#define OPENDAVINCI_TOOLS_PLAYER_BLOCKCOMPRESSEDSTREAMBUFFER_H_
+
+#include <streambuf>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/base/Service.h"
+
+namespace odtools {
+    namespace player {
+
+        using namespace std;
+
+        /**
+         * This class provides the uncompressed data of a mapped file
+         * written by odtools::recorder::BlockCompressedOutputStream as
+         * seekable stream buffer. While the current block is consumed,
+         * the next block is decompressed in background.
+         *
+         * Positions refer to the uncompressed data.
+         */
+        class BlockCompressedStreamBuffer : public streambuf, public odcore::base::Service {
+            private:
+                /**
+                 * This class describes one block in the file.
+                 */
+                class Block {
+                    public:
+                        Block();
+
+                    public:
+                        uint64_t m_offset; // Offset of the compressed data in the file.
+                        uint32_t m_compressedSize;
+                        uint32_t m_size;
+                        uint64_t m_position; // Position of the block in the uncompressed data.
+                };
+
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                BlockCompressedStreamBuffer(const BlockCompressedStreamBuffer &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                BlockCompressedStreamBuffer& operator=(const BlockCompressedStreamBuffer &/*obj*/);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param data Mapped file.
+                 * @param size Size of the mapped file.
+                 */
+                BlockCompressedStreamBuffer(const char *data, const uint64_t &size);
+
+                virtual ~BlockCompressedStreamBuffer();
+
+                /**
+                 * @return Size of the uncompressed data.
+                 */
+                uint64_t getSize() const;
+
+                /**
+                 * @return Number of complete blocks.
+                 */
+                uint32_t getNumberOfBlocks() const;
+
+                /**
+                 * @param data Mapped file.
+                 * @param size Size of the mapped file.
+                 * @return true if the data starts with the header of a block compressed file.
+                 */
+                static bool isBlockCompressed(const char *data, const uint64_t &size);
+
+            protected:
+                virtual int_type underflow();
+
+                virtual pos_type seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode which);
+
+                virtual pos_type seekpos(pos_type pos, ios_base::openmode which);
+
+            private:
+                virtual void beforeStop();
+
+                virtual void run();
+
+                /**
+                 * This method makes the given block the current one.
+                 *
+                 * @param block Index of the block.
+                 * @return true if the block could be decompressed.
+                 */
+                bool loadBlock(const uint32_t &block);
+
+                bool decompress(const uint32_t &block, string &out) const;
+
+                static uint32_t readUInt32(const char *buffer);
+
+            private:
+                const char *m_data;
+                vector<Block> m_blocks;
+                uint64_t m_size;
+
+                uint32_t m_currentBlock; // Equals the number of blocks at the end of the data.
+                string m_current;
+
+                odcore::base::Condition m_prefetchCondition;
+                uint32_t m_prefetchBlock;
+                bool m_prefetchRequested;
+                bool m_prefetchReady;
+                string m_prefetch;
+        };
+
+    } // player
+} // tools
+
+#endif /*OPENDAVINCI_TOOLS_PLAYER_BLOCKCOMPRESSEDSTREAMBUFFER_H_*/
@@ -28,13 +28,18 @@
 #include "opendavinci/odcore/opendavinci.h"
 #include <memory>
 #include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/exceptions/Exceptions.h"
 #include "opendavinci/odcore/io/URL.h"
 #include "opendavinci/odcore/wrapper/SharedMemory.h"
 
+namespace odtools { namespace recorder { class RecordingIndex; } }
+
 namespace odtools {
     namespace player {
 
 class PlayerCache;
+class RecordingReader;
 
         using namespace std;
 
@@ -96,6 +101,27 @@ class PlayerCache;
                  */
                 void rewind();
 
+                /**
+                 * This method continues the replay with the first container
+                 * that was received at or after the given time stamp. The
+                 * recording's index (.idx file) is loaded on first use; if
+                 * it is missing, it is created by reading the recording.
+                 *
+                 * @param ts Time stamp to seek to.
+                 * @return true if the recording contains data at or after the given time stamp.
+                 */
+                bool seekTo(const odcore::data::TimeStamp &ts);
+
+                /**
+                 * This method returns the time stamps of the first and the
+                 * last container in the recording using its index.
+                 *
+                 * @param begin Time stamp of the first container.
+                 * @param end Time stamp of the last container.
+                 * @return false if no index is available.
+                 */
+                bool getTimeRange(odcore::data::TimeStamp &begin, odcore::data::TimeStamp &end);
+
                 /**
                  * This method returns true if there is more data to replay.
                  *
@@ -104,14 +130,36 @@ class PlayerCache;
                 bool hasMoreData() const;
 
             private:
+                /**
+                 * This method loads or creates the recording's index.
+                 *
+                 * @return true if the index is available.
+                 */
+                bool loadIndex();
+
+                /**
+                 * This method returns a reader for the given URL. Regular
+                 * files are mapped into memory; other sources are read
+                 * using the StreamFactory.
+                 *
+                 * @param url URL to read from.
+                 * @return Reader for the given URL.
+                 * @throws InvalidArgumentException if the URL could not be opened.
+                 */
+                static std::shared_ptr<RecordingReader> getRecordingReader(const odcore::io::URL &url) throw (odcore::exceptions::InvalidArgumentException);
+
+            private:
+                odcore::io::URL m_url;
                 bool m_threading;
                 bool m_autoRewind;
 
-                std::shared_ptr<istream> m_inFile;
-                std::shared_ptr<istream> m_inSharedMemoryFile;
+                std::shared_ptr<RecordingReader> m_inFile;
+                std::shared_ptr<RecordingReader> m_inSharedMemoryFile;
 
                 unique_ptr<PlayerCache> m_playerCache;
 
+                unique_ptr<odtools::recorder::RecordingIndex> m_index;
+
                 // The "actual" container contains the data to be sent, ...
                 odcore::data::Container m_actual;
                 // ... whereas the "successor" container contains the data that follows the actual one.
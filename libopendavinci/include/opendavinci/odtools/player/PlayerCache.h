@@ -20,7 +20,7 @@
 #ifndef OPENDAVINCI_TOOLS_PLAYER_PLAYERCACHE_H_
 #define OPENDAVINCI_TOOLS_PLAYER_PLAYERCACHE_H_
 
-#include <iosfwd>
+#include <deque>
 #include <map>
 #include <string>
 
@@ -33,6 +33,7 @@
 #include "opendavinci/odcore/data/Container.h"
 
 namespace odcore { namespace wrapper { class SharedMemory; } }
+namespace odtools { namespace player { class RecordingReader; } }
 
 namespace odtools {
     namespace player {
@@ -70,10 +71,10 @@ namespace odtools {
                  * @param size Number of elements to be cached from file.
                  * @param sizeMemorySegments Number of elements to be cached from file.
                  * @oaram autoRewind True if restart filling the queue.
-                 * @param in Input stream to read data from.
-                 * @param inSharedMemoryFile Input stream to read data from the shared memory dump.
+                 * @param in Reader for the recording.
+                 * @param inSharedMemoryFile Reader for the shared memory dump.
                  */
-                PlayerCache(const uint32_t size, const uint32_t sizeMemorySegments, const bool &autoRewind, std::shared_ptr<istream> in, std::shared_ptr<istream> inSharedMemoryFile);
+                PlayerCache(const uint32_t size, const uint32_t sizeMemorySegments, const bool &autoRewind, std::shared_ptr<RecordingReader> in, std::shared_ptr<RecordingReader> inSharedMemoryFile);
 
                 virtual ~PlayerCache();
 
@@ -103,6 +104,15 @@ namespace odtools {
                  */
                 void clearQueueRewindInputStreams();
 
+                /**
+                 * This method clears the cache and continues reading
+                 * the input streams at the given positions.
+                 *
+                 * @param positionRec Position in the .rec file or -1 for its end.
+                 * @param positionMem Position in the .rec.mem file or -1 for its end.
+                 */
+                void clearQueueSeekInputStreams(const int64_t &positionRec, const int64_t &positionMem);
+
                 /**
                  * This method is called to put the next shared data or shared
                  * image element into the respective shared memory.
@@ -145,11 +155,21 @@ namespace odtools {
                  */
                 void putRawMemoryDataIntoBuffer(odcore::data::Container &c);
 
+                /**
+                 * @return true if raw memory data can be referred to in the mapped shared memory dump.
+                 */
+                bool hasMappedSharedMemoryFile() const;
+
+                /**
+                 * @return true if there is space to put further raw memory data into the output buffer.
+                 */
+                bool hasFreeMemorySegment();
+
             private:
                 uint32_t m_cacheSize;
                 const bool m_autoRewind;
-                std::shared_ptr<istream> m_in;
-                std::shared_ptr<istream> m_inSharedMemoryFile;
+                std::shared_ptr<RecordingReader> m_in;
+                std::shared_ptr<RecordingReader> m_inSharedMemoryFile;
 
                 odcore::base::FIFOQueue m_queue;
                 odcore::base::LIFOQueue m_recBuffer;
@@ -160,6 +180,10 @@ namespace odtools {
                 odcore::base::FIFOQueue m_bufferIn;
                 odcore::base::FIFOQueue m_bufferOut;
 
+                // Raw memory data referring into the mapped shared memory dump; used instead of m_bufferOut.
+                odcore::base::Mutex m_mappedBufferOutMutex;
+                deque<pair<const char*, uint32_t> > m_mappedBufferOut;
+
                 map<string, std::shared_ptr<odcore::wrapper::SharedMemory> > m_sharedPointers;
 
                 odcore::base::Mutex m_modifyCacheMutex;
@@ -0,0 +1,164 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_TOOLS_PLAYER_RECORDINGREADER_H_
+#define OPENDAVINCI_TOOLS_PLAYER_RECORDINGREADER_H_
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore { namespace base { class InputMemoryStreambuf; } }
+namespace odcore { namespace data { class Container; } }
+namespace odcore { namespace wrapper { class MemoryMappedFile; } }
+
+namespace odtools {
+    namespace player {
+
+        class BlockCompressedStreamBuffer;
+
+        using namespace std;
+
+        /**
+         * This class reads containers from a recording (.rec file) or
+         * shared memory dumps from a .rec.mem file. The file is mapped
+         * into memory and the containers are decoded directly from the
+         * mapped region; the raw data following the containers in a
+         * .rec.mem file is handed out as pointer into the mapping.
+         *
+         * If the file cannot be mapped (for example /dev/stdin), the
+         * data is read from a regular input stream instead.
+         *
+         * Block compressed files written with the recorder's compression
+         * option are decompressed transparently; positions refer to the
+         * uncompressed data in this case. Compressed files can only be
+         * read if they can be mapped.
+         */
+        class OPENDAVINCI_API RecordingReader {
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                RecordingReader(const RecordingReader &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                RecordingReader& operator=(const RecordingReader &/*obj*/);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param fileName File to read from.
+                 */
+                RecordingReader(const string &fileName);
+
+                /**
+                 * Constructor for reading from a stream that cannot be mapped.
+                 *
+                 * @param in Stream to read from.
+                 */
+                RecordingReader(std::shared_ptr<istream> in);
+
+                virtual ~RecordingReader();
+
+                /**
+                 * @return true if the file could be opened.
+                 */
+                bool isValid() const;
+
+                /**
+                 * @return true if the file is mapped into memory and the data can be used in place.
+                 */
+                bool isMemoryMapped() const;
+
+                /**
+                 * @return true if the file is block compressed.
+                 */
+                bool isCompressed() const;
+
+                /**
+                 * @return Size of the (uncompressed) data or 0 if unknown.
+                 */
+                uint64_t getSize() const;
+
+                /**
+                 * @return Current position in the file or -1 if unknown.
+                 */
+                int64_t getPosition();
+
+                /**
+                 * This method moves the read position.
+                 *
+                 * @param position New position in the file or -1 for its end.
+                 */
+                void seek(const int64_t &position);
+
+                /**
+                 * This method reads the next container.
+                 *
+                 * @param c Container to read into.
+                 * @return true if a container was read.
+                 */
+                bool read(odcore::data::Container &c);
+
+                /**
+                 * This method reads the raw data following a container in
+                 * a .rec.mem file. If the file is mapped, the returned
+                 * pointer refers into the mapping and stays valid as long
+                 * as this reader exists; otherwise, the data is copied to
+                 * the given buffer.
+                 *
+                 * @param size Number of bytes to read.
+                 * @param buffer Buffer of at least size bytes; only used if the file is not mapped.
+                 * @return Pointer to the data or NULL if not enough data is available.
+                 */
+                const char* readPayload(const uint32_t &size, char *buffer);
+
+                /**
+                 * This method skips the raw data following a container in
+                 * a .rec.mem file.
+                 *
+                 * @param size Number of bytes to skip.
+                 */
+                void skipPayload(const uint32_t &size);
+
+            private:
+                std::shared_ptr<odcore::wrapper::MemoryMappedFile> m_file;
+                unique_ptr<odcore::base::InputMemoryStreambuf> m_buffer;
+                unique_ptr<BlockCompressedStreamBuffer> m_compressedBuffer;
+                std::shared_ptr<istream> m_in;
+        };
+
+    } // player
+} // tools
+
+#endif /*OPENDAVINCI_TOOLS_PLAYER_RECORDINGREADER_H_*/
@@ -0,0 +1,131 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_TOOLS_RECORDER_BLOCKCOMPRESSEDOUTPUTSTREAM_H_
+#define OPENDAVINCI_TOOLS_RECORDER_BLOCKCOMPRESSEDOUTPUTSTREAM_H_
+
+#include <memory>
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odtools {
+
+    namespace recorder {
+
+        using namespace std;
+
+        /**
+         * This class compresses the data written to it in independent
+         * blocks using zlib before passing it to the underlying stream:
+         *
+         * 'MAGIC' 'VERSION' ('compressed size' 'size' 'compressed data')*
+         *
+         * All numbers are little-endian uint32. Blocks are completed when
+         * the stream is flushed after at least the block size was written;
+         * thus, containers written before a flush do not span two blocks.
+         *
+         * tellp() reports the position in the uncompressed data so that
+         * the offsets in a RecordingIndex are independent of compression.
+         * odtools::player::RecordingReader decompresses such files
+         * transparently.
+         */
+        class OPENDAVINCI_API BlockCompressedOutputStream : public ostream {
+            public:
+                enum {
+                    MAGIC = 0x5A52444F, // 'ODRZ'
+                    VERSION = 1,
+                    HEADER_SIZE = 8,
+                    BLOCK_HEADER_SIZE = 8,
+                    DEFAULT_BLOCK_SIZE = 4 * 1024 * 1024
+                };
+
+            private:
+                /**
+                 * This class collects the data for the next block.
+                 */
+                class BlockBuffer : public streambuf {
+                    public:
+                        BlockBuffer(std::shared_ptr<ostream> out, const uint32_t &blockSize);
+
+                        virtual ~BlockBuffer();
+
+                        /**
+                         * This method compresses and writes the current block.
+                         */
+                        void writeBlock();
+
+                    protected:
+                        virtual int_type overflow(int_type c);
+
+                        virtual streamsize xsputn(const char *s, streamsize n);
+
+                        virtual int sync();
+
+                        virtual pos_type seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode which);
+
+                    private:
+                        std::shared_ptr<ostream> m_out;
+                        uint32_t m_blockSize;
+                        string m_block;
+                        string m_compressed;
+                        uint64_t m_position; // Uncompressed size of all written blocks.
+                };
+
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                BlockCompressedOutputStream(const BlockCompressedOutputStream &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                BlockCompressedOutputStream& operator=(const BlockCompressedOutputStream &/*obj*/);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param compressedOut Output stream to write the compressed data to.
+                 * @param blockSize Minimum number of bytes per block.
+                 */
+                BlockCompressedOutputStream(std::shared_ptr<ostream> compressedOut, const uint32_t &blockSize = DEFAULT_BLOCK_SIZE);
+
+                virtual ~BlockCompressedOutputStream();
+
+            private:
+                BlockBuffer m_buffer;
+        };
+
+    } // recorder
+} // tools
+
+#endif /*OPENDAVINCI_TOOLS_RECORDER_BLOCKCOMPRESSEDOUTPUTSTREAM_H_*/
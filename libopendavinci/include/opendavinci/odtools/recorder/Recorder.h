@@ -26,12 +26,14 @@
 #include "opendavinci/odcore/opendavinci.h"
 #include <memory>
 #include "opendavinci/odcore/base/FIFOQueue.h"
+#include "opendavinci/odtools/recorder/RecordingWriter.h"
 
 namespace odcore { namespace data { class Container; } }
 
 namespace odtools {
     namespace recorder {
 
+class RecordingIndex;
 class SharedDataListener;
 
         using namespace std;
@@ -67,14 +69,16 @@ class SharedDataListener;
                  * @param url URL of the resource to be used for writing containers to.
                  * @param memorySegmentSize Size of a memory segment for storing shared memory data (like shared images).
                  * @param numberOfSegments Number of segments to be used.
-                 * @param threading If true recorder is using a background thread to dump shared memory data.
+                 * @param threading If true recorder is using background threads to write containers and to dump shared memory data.
                  *                  If set to true recorder can be used in real-time required scenarios where
                  *                  it is embedded in user supplied apps; however, there is a risk that if the
                  *                  queue size (numberOfSegments) is chosen too small or the low-level disk I/O
                  *                  containers of type SharedImage or SharedMemory are dropped.
                  * @param dumpSharedData If true, shared images and shared data will be stored as well.
+                 * @param highWaterMark Maximum number of bytes waiting to be written before containers are dropped.
+                 * @param compression If true, the .rec and .rec.mem files are written as independently compressed blocks.
                  */
-                Recorder(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &dumpSharedData);
+                Recorder(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &dumpSharedData, const uint32_t &highWaterMark = RecordingWriter::DEFAULT_HIGH_WATER_MARK, const bool &compression = false);
 
                 virtual ~Recorder();
 
@@ -101,6 +105,15 @@ class SharedDataListener;
                  */
                 SharedDataListener& getDataStoreForSharedData();
 
+                /**
+                 * This method returns the number of containers and shared
+                 * memory segments that were dropped because the disk could
+                 * not keep up.
+                 *
+                 * @return Number of dropped containers.
+                 */
+                uint32_t getNumberOfDroppedContainers() const;
+
                 /**
                  * This method stores the given container. Depending on the container
                  * data type, either the FIFO queue is used or the one to handle
@@ -115,6 +128,9 @@ class SharedDataListener;
                 unique_ptr<SharedDataListener> m_sharedDataListener;
                 std::shared_ptr<ostream> m_out;
                 std::shared_ptr<ostream> m_outSharedMemoryFile;
+                std::shared_ptr<RecordingIndex> m_index;
+                unique_ptr<RecordingWriter> m_writer;
+                bool m_threading;
                 bool m_dumpSharedData;
         };
 
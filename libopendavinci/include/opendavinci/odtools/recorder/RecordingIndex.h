@@ -0,0 +1,246 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_TOOLS_RECORDER_RECORDINGINDEX_H_
+#define OPENDAVINCI_TOOLS_RECORDER_RECORDINGINDEX_H_
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Mutex.h"
+
+namespace odcore { namespace data { class Container; } }
+namespace odcore { namespace data { class TimeStamp; } }
+namespace odtools { namespace player { class RecordingReader; } }
+
+namespace odtools {
+    namespace recorder {
+
+        using namespace std;
+
+        /**
+         * This class describes the index of a recording. For every
+         * container in a .rec file and every shared memory dump in the
+         * accompanying .rec.mem file, the index contains the container's
+         * received time stamp, its data type, and its offset in the file.
+         *
+         * The index is stored next to the recording in a file with the
+         * suffix .idx as a sequence of little-endian records:
+         *
+         * 'MAGIC' 'VERSION' 'source' 'data type' 'time stamp' 'offset' ...
+         *
+         * Entries are appended while recording; thus, an index of an
+         * aborted recording is still usable. Indices for existing
+         * recordings can be created using build().
+         */
+        class OPENDAVINCI_API RecordingIndex {
+            public:
+                enum SOURCE {
+                    REC = 0,
+                    MEM = 1
+                };
+
+                enum {
+                    MAGIC = 0x5844494F, // 'ODIX'
+                    VERSION = 1,
+                    HEADER_SIZE = 8,
+                    ENTRY_SIZE = 24
+                };
+
+                /**
+                 * This class describes one container in the recording.
+                 */
+                class Entry {
+                    public:
+                        Entry();
+
+                        Entry(const SOURCE &source, const int32_t &dataType, const int64_t &timeStamp, const uint64_t &offset);
+
+                    public:
+                        SOURCE m_source;
+                        int32_t m_dataType;
+                        int64_t m_timeStamp; // Received time stamp in microseconds.
+                        uint64_t m_offset; // Offset of the container in the .rec or .rec.mem file.
+                };
+
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                RecordingIndex(const RecordingIndex &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                RecordingIndex& operator=(const RecordingIndex &/*obj*/);
+
+            public:
+                /**
+                 * Constructor for an index that is only kept in memory.
+                 */
+                RecordingIndex();
+
+                /**
+                 * Constructor for an index that writes every added entry
+                 * to the given stream as well.
+                 *
+                 * @param out Output stream for the .idx file.
+                 */
+                RecordingIndex(std::shared_ptr<ostream> out);
+
+                virtual ~RecordingIndex();
+
+                /**
+                 * This method adds a container to the index. It is safe
+                 * to add entries from several threads.
+                 *
+                 * @param source File containing the container.
+                 * @param c Container to be added.
+                 * @param offset Offset of the container in the file.
+                 */
+                void add(const SOURCE &source, const odcore::data::Container &c, const uint64_t &offset);
+
+                /**
+                 * This method writes all entries that were added so far
+                 * to the underlying output stream.
+                 */
+                void flush();
+
+                /**
+                 * @param source File of interest.
+                 * @return All entries for the given file in their recorded order.
+                 */
+                vector<Entry> getEntries(const SOURCE &source) const;
+
+                /**
+                 * @param source File of interest.
+                 * @param dataType Data type of interest.
+                 * @return Offsets of all containers of the given data type.
+                 */
+                vector<uint64_t> getOffsets(const SOURCE &source, const int32_t &dataType) const;
+
+                /**
+                 * @return Total number of entries.
+                 */
+                uint32_t getNumberOfEntries() const;
+
+                /**
+                 * This method finds the first container in recorded order
+                 * that was received at or after the given time stamp. As
+                 * the recorder interleaves several sources, the received
+                 * time stamps are not necessarily monotonic.
+                 *
+                 * @param source File of interest.
+                 * @param ts Time stamp to seek to.
+                 * @param offset Offset of the container found.
+                 * @return true if such a container exists.
+                 */
+                bool find(const SOURCE &source, const odcore::data::TimeStamp &ts, uint64_t &offset) const;
+
+                /**
+                 * This method returns the time stamps of the first and the
+                 * last container in the recording.
+                 *
+                 * @param begin Time stamp of the first container.
+                 * @param end Time stamp of the last container.
+                 * @return false if the index is empty.
+                 */
+                bool getTimeRange(odcore::data::TimeStamp &begin, odcore::data::TimeStamp &end) const;
+
+                /**
+                 * This method reads an index previously written.
+                 *
+                 * @param in Input stream for the .idx file.
+                 * @return true if the index could be read.
+                 */
+                bool readFrom(istream &in);
+
+                /**
+                 * This method writes the complete index.
+                 *
+                 * @param out Output stream for the .idx file.
+                 */
+                void writeTo(ostream &out) const;
+
+                /**
+                 * @param recording File name of the .rec file.
+                 * @return File name of the corresponding index.
+                 */
+                static string getFileName(const string &recording);
+
+                /**
+                 * This method creates the index for an existing recording
+                 * by reading the .rec file and the .rec.mem file if
+                 * available.
+                 *
+                 * @param recording File name of the .rec file.
+                 * @param index Index to add the entries to.
+                 * @return true if the recording could be read.
+                 */
+                static bool build(const string &recording, RecordingIndex &index);
+
+                /**
+                 * @param c Container describing a shared memory segment.
+                 * @return Number of raw bytes following the container in a .rec.mem file.
+                 */
+                static uint32_t getSizeOfSharedMemoryDump(const odcore::data::Container &c);
+
+            private:
+                void writeEntry(ostream &out, const Entry &entry) const;
+
+                /**
+                 * This method appends the given entry. m_mutex must be locked.
+                 *
+                 * @param entry Entry to be appended.
+                 */
+                void append(const Entry &entry);
+
+                static void writeUInt32(ostream &out, const uint32_t &value);
+
+                static void writeUInt64(ostream &out, const uint64_t &value);
+
+                static uint32_t readUInt32(const char *buffer);
+
+                static uint64_t readUInt64(const char *buffer);
+
+                static void buildFrom(odtools::player::RecordingReader &reader, const SOURCE &source, RecordingIndex &index);
+
+            private:
+                mutable odcore::base::Mutex m_mutex;
+                std::shared_ptr<ostream> m_out;
+                vector<Entry> m_entries[2];
+                vector<int64_t> m_latestTimeStamps[2]; // Running maximum of the received time stamps.
+        };
+
+    } // recorder
+} // tools
+
+#endif /*OPENDAVINCI_TOOLS_RECORDER_RECORDINGINDEX_H_*/
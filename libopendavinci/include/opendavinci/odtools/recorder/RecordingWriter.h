@@ -0,0 +1,133 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef OPENDAVINCI_TOOLS_RECORDER_RECORDINGWRITER_H_
+#define OPENDAVINCI_TOOLS_RECORDER_RECORDINGWRITER_H_
+
+#include <iosfwd>
+#include <memory>
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/Service.h"
+
+namespace odcore { namespace data { class Container; } }
+
+namespace odtools {
+
+    namespace recorder {
+
+class RecordingIndex;
+
+        using namespace std;
+
+        /**
+         * This class writes containers to an outstream in batches.
+         * Containers are serialized into a pending buffer by the caller;
+         * the buffer is written as a whole either by the writer's own
+         * thread or by calling write(). Thus, the callers are not blocked
+         * by disk I/O.
+         *
+         * If the pending buffer exceeds the high-water mark because the
+         * disk cannot keep up, further containers are dropped and counted.
+         */
+        class RecordingWriter : public odcore::base::Service {
+            public:
+                enum {
+                    DEFAULT_HIGH_WATER_MARK = 64 * 1024 * 1024,
+                    BATCH_SIZE = 1024 * 1024,
+                    MAX_WAIT_MS = 10
+                };
+
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                RecordingWriter(const RecordingWriter &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                RecordingWriter& operator=(const RecordingWriter &/*obj*/);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param out Output stream to write to.
+                 * @param highWaterMark Maximum number of bytes waiting to be written.
+                 * @param index Index to add the written entries to (might be NULL).
+                 */
+                RecordingWriter(std::shared_ptr<ostream> out, const uint32_t &highWaterMark, std::shared_ptr<RecordingIndex> index = std::shared_ptr<RecordingIndex>());
+
+                virtual ~RecordingWriter();
+
+                /**
+                 * This method serializes the given container into the
+                 * pending buffer.
+                 *
+                 * @param c Container to be written.
+                 * @return false if the container was dropped.
+                 */
+                bool add(const odcore::data::Container &c);
+
+                /**
+                 * This method writes the pending buffer to the outstream.
+                 */
+                void write();
+
+                /**
+                 * @return Number of containers dropped because the high-water mark was exceeded.
+                 */
+                uint32_t getNumberOfDroppedContainers() const;
+
+            private:
+                virtual void beforeStop();
+
+                virtual void run();
+
+            private:
+                std::shared_ptr<ostream> m_out;
+                std::shared_ptr<RecordingIndex> m_index;
+                const uint32_t m_highWaterMark;
+
+                mutable odcore::base::Condition m_pendingCondition;
+                string m_pending;
+                uint64_t m_position; // Offset of m_pending in the outstream.
+                uint32_t m_droppedContainers;
+
+                odcore::base::Mutex m_writeMutex;
+                string m_writing;
+        };
+
+    } // recorder
+} // tools
+
+#endif /*OPENDAVINCI_TOOLS_RECORDER_RECORDINGWRITER_H_*/
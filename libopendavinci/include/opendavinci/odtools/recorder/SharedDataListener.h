@@ -33,11 +33,13 @@
 #include "opendavinci/generated/odcore/data/SharedPointCloud.h"
 
 namespace odcore { namespace data { class Container; } }
+namespace odcore { namespace data { namespace image { class SharedImageChannel; } } }
 namespace odcore { namespace wrapper { class SharedMemory; } }
 
 namespace odtools {
     namespace recorder {
 
+class RecordingIndex;
 class SharedDataWriter;
 
         using namespace std;
@@ -74,8 +76,9 @@ class SharedDataWriter;
                  * @param memorySegmentSize Size of one memory segment.
                  * @param numberOfMemorySegments Number of available memory segments.
                  * @param threading Cf. constructor of Recorder.
+                 * @param index Index to add the written shared memory dumps to (might be NULL).
                  */
-                SharedDataListener(std::shared_ptr<ostream> out, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading);
+                SharedDataListener(std::shared_ptr<ostream> out, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading, std::shared_ptr<RecordingIndex> index = std::shared_ptr<RecordingIndex>());
 
                 virtual ~SharedDataListener();
 
@@ -87,6 +90,11 @@ class SharedDataWriter;
 
                 virtual bool isEmpty() const;
 
+                /**
+                 * @return Number of shared memory segments that could not be buffered for recording.
+                 */
+                uint32_t getNumberOfDroppedSharedMemories() const;
+
             private:
                 /**
                  * This method copies the data pointed to by SharedData
@@ -98,6 +106,16 @@ class SharedDataWriter;
                  */
                 bool copySharedMemoryToMemorySegment(const string &name, const odcore::data::Container &header);
 
+                /**
+                 * This method copies the newest frame from a SharedImageChannel
+                 * to the next available MemorySegment.
+                 *
+                 * @param name Name of the SharedImageChannel to be used.
+                 * @param header Container that contains the meta-data for this frame which shall be used as header in the file.
+                 * @return true if the copy succeeded.
+                 */
+                bool copySharedImageChannelToMemorySegment(const string &name, const odcore::data::Container &header);
+
             private:
                 bool m_threading;
                 unique_ptr<SharedDataWriter> m_sharedDataWriter;
@@ -114,7 +132,11 @@ class SharedDataWriter;
 
                 map<string, std::shared_ptr<odcore::wrapper::SharedMemory> > m_sharedPointers;
 
+                map<string, std::shared_ptr<odcore::data::image::SharedImageChannel> > m_sharedImageChannels;
+
                 std::shared_ptr<ostream> m_out;
+
+                std::shared_ptr<RecordingIndex> m_index;
         };
 
     } // recorder
@@ -33,6 +33,8 @@ namespace odtools {
 
     namespace recorder {
 
+class RecordingIndex;
+
         using namespace std;
 
         /**
@@ -64,8 +66,9 @@ namespace odtools {
                  * Constructor.
                  *
                  * @param out Output stream to write to.
+                 * @param index Index to add the written entries to (might be NULL).
                  */
-                SharedDataWriter(std::shared_ptr<ostream> out, map<uint32_t, char*> &mapOfMemories, odcore::base::FIFOQueue &bufferIn, odcore::base::FIFOQueue &bufferOut);
+                SharedDataWriter(std::shared_ptr<ostream> out, map<uint32_t, char*> &mapOfMemories, odcore::base::FIFOQueue &bufferIn, odcore::base::FIFOQueue &bufferOut, std::shared_ptr<RecordingIndex> index = std::shared_ptr<RecordingIndex>());
 
                 virtual ~SharedDataWriter();
 
@@ -83,6 +86,8 @@ namespace odtools {
 
                 odcore::base::FIFOQueue &m_bufferIn;
                 odcore::base::FIFOQueue &m_bufferOut;
+
+                std::shared_ptr<RecordingIndex> m_index;
         };
 
     } // recorder
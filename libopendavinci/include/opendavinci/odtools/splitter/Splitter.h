@@ -64,8 +64,9 @@ namespace odtools {
                  * @param source Recording file to be recoded.
                  * @param destination Output file name.
                  * @param memorySegmentSize Size of one memory segment to be used in recorder and player.
+                 * @param compression If true, the output file is block compressed.
                  */
-                void process(const string &source, const string &destination, const uint32_t &memorySegmentSize);
+                void process(const string &source, const string &destination, const uint32_t &memorySegmentSize, const bool &compression = false);
 
                 /**
                  * This method processes the given source file and splits it between
@@ -75,8 +76,9 @@ namespace odtools {
                  * @param memorySegmentSize Size of one memory segment to be used in recorder and player.
                  * @param start Start container to be split.
                  * @param end End container (including) in the splitting.
+                 * @param compression If true, the output file is block compressed.
                  */
-                void process(const string &source, const uint32_t &memorySegmentSize, const uint32_t &start, const uint32_t &end);
+                void process(const string &source, const uint32_t &memorySegmentSize, const uint32_t &start, const uint32_t &end, const bool &compression = false);
 
                 /**
                  * This method processes the given source file and splits it between
@@ -87,8 +89,9 @@ namespace odtools {
                  * @param memorySegmentSize Size of one memory segment to be used in recorder and player.
                  * @param start Start container to be split.
                  * @param end End container (including) in the splitting.
+                 * @param compression If true, the output file is block compressed.
                  */
-                void process(const string &source, const string &destination, const uint32_t &memorySegmentSize, const uint32_t &start, const uint32_t &end);
+                void process(const string &source, const string &destination, const uint32_t &memorySegmentSize, const uint32_t &start, const uint32_t &end, const bool &compression = false);
         };
 
     } // splitter
@@ -18,6 +18,7 @@
  */
 
 #include "opendavinci/odcontext/base/BlockableContainerReceiver.h"
+#include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/data/TimeStamp.h"
@@ -31,7 +32,11 @@ namespace odcontext {
         using namespace odcore::data;
 
         BlockableContainerReceiver::BlockableContainerReceiver(odcore::io::conference::ContainerListener &cl) :
-            m_dispatcherForContainersSentFromSystemUnderTest(cl) {}
+            m_dispatcherForContainersSentFromSystemUnderTest(cl),
+            m_deferredContainersMutex(),
+            m_deliveryDeferred(false),
+            m_deferredContainers(),
+            m_verbose(true) {}
 
         BlockableContainerReceiver::~BlockableContainerReceiver() {
             // Break blocking.
@@ -46,9 +51,49 @@ namespace odcontext {
             // Set received TimeStamp.
             c.setReceivedTimeStamp(TimeStamp());
 
+            {
+                Lock l(m_deferredContainersMutex);
+                if (m_deliveryDeferred) {
+                    m_deferredContainers.push_back(c);
+                    return;
+                }
+            }
+
             // Delegate Containter to dispatcher.
             m_dispatcherForContainersSentFromSystemUnderTest.nextContainer(c);
         }
 
+        void BlockableContainerReceiver::setDeliveryDeferred(const bool &deferred) {
+            {
+                Lock l(m_deferredContainersMutex);
+                m_deliveryDeferred = deferred;
+            }
+
+            if (!deferred) {
+                deliverDeferredContainers();
+            }
+        }
+
+        void BlockableContainerReceiver::deliverDeferredContainers() {
+            vector<Container> containers;
+            {
+                Lock l(m_deferredContainersMutex);
+                containers.swap(m_deferredContainers);
+            }
+
+            vector<Container>::iterator it = containers.begin();
+            while (it != containers.end()) {
+                m_dispatcherForContainersSentFromSystemUnderTest.nextContainer(*it++);
+            }
+        }
+
+        void BlockableContainerReceiver::setVerbose(const bool &verbose) {
+            m_verbose = verbose;
+        }
+
+        bool BlockableContainerReceiver::isVerbose() const {
+            return m_verbose;
+        }
+
     }
 } // odcontext::base
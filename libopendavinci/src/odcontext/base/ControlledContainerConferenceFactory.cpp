@@ -43,7 +43,8 @@ namespace odcontext {
             m_listOfContainerDelivererToSystemUnderTestMutex(),
             m_listOfContainerDelivererToSystemUnderTest(),
             m_listOfContainerDelivererFromSystemUnderTestMutex(),
-            m_listOfContainerDelivererFromSystemUnderTest() {
+            m_listOfContainerDelivererFromSystemUnderTest(),
+            m_verbose(true) {
             ContainerConferenceFactory::setSingleton(this);
         }
 
@@ -74,7 +75,9 @@ namespace odcontext {
         void ControlledContainerConferenceFactory::sendToSUD(odcore::data::Container &c) {
             Lock l(m_listOfContainerDelivererToSystemUnderTestMutex);
 
-            clog << "Distributing '" << c.toString() << "' in ControlledContainerConferenceFactory to all ContainerConferences from Systems Under Test." << endl;
+            if (m_verbose) {
+                clog << "Distributing '" << c.toString() << "' in ControlledContainerConferenceFactory to all ContainerConferences from Systems Under Test." << endl;
+            }
 
             // Set sent time.
             c.setSentTimeStamp(TimeStamp());
@@ -91,7 +94,9 @@ namespace odcontext {
         void ControlledContainerConferenceFactory::sendToSCC(odcore::data::Container &c) {
             Lock l(m_listOfContainerListenersToReceiveContainersFromSystemsUnderTestMutex);
 
-            clog << "Distributing '" << c.toString() << "' in ControlledContainerConferenceFactory to all SystemParts." << endl;
+            if (m_verbose) {
+                clog << "Distributing '" << c.toString() << "' in ControlledContainerConferenceFactory to all SystemParts." << endl;
+            }
 
             vector<ContainerListener*>::iterator it = m_listOfContainerListenersToReceiveContainersFromSystemsUnderTest.begin();
             while (it != m_listOfContainerListenersToReceiveContainersFromSystemsUnderTest.end()) {
@@ -122,6 +127,10 @@ namespace odcontext {
             sendToSCC(c);
         }
 
+        void ControlledContainerConferenceFactory::setVerbose(const bool &verbose) {
+            m_verbose = verbose;
+        }
+
         std::shared_ptr<ContainerConference> ControlledContainerConferenceFactory::getContainerConference(const string &address, const uint32_t &port) {
             // Create a ControlledContainerConference specific synchronous ContainerDeliverer which delivers containers sent TO the system under test.
             ContainerDeliverer *containerDelivererToSystemUnderTest = new ContainerDeliverer();
@@ -51,7 +51,9 @@ namespace odcontext {
             // Set sending time stamp.
             container.setSentTimeStamp(TimeStamp());
 
-            clog << "Sending '" << container.toString() << "' in ControlledContainerConferenceForSystemUnderTest." << endl;
+            if (m_sendToListener.isVerbose()) {
+                clog << "Sending '" << container.toString() << "' in ControlledContainerConferenceForSystemUnderTest." << endl;
+            }
 
             m_sendToListener.nextContainer(container);
         }
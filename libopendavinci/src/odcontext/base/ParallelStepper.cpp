@@ -0,0 +1,51 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <algorithm>
+
+#include "opendavinci/odcontext/base/ParallelStepper.h"
+
+namespace odcontext {
+    namespace base {
+
+        using namespace std;
+
+        ParallelStepper::Step::~Step() {}
+
+        ParallelStepper::ParallelStepper(const uint32_t &numberOfThreads) :
+            m_workPool(max(numberOfThreads, 1u)),
+            m_steps(NULL) {}
+
+        ParallelStepper::~ParallelStepper() {}
+
+        void ParallelStepper::execute(const vector<Step*> &steps) {
+            m_steps = &steps;
+            m_workPool.execute(*this, steps.size());
+            m_steps = NULL;
+        }
+
+        void ParallelStepper::process(const uint32_t &item) {
+            Step *s = m_steps->at(item);
+            if (s != NULL) {
+                s->step();
+            }
+        }
+
+    }
+} // odcontext::base
@@ -20,7 +20,6 @@
 #include "opendavinci/odcontext/base/BlockableContainerListener.h"
 #include "opendavinci/odcontext/base/RunModuleBreakpoint.h"
 #include "opendavinci/odcore/base/Lock.h"
-#include "opendavinci/odcore/base/Thread.h"
 
 namespace odcontext {
     namespace base {
@@ -30,9 +29,8 @@ namespace odcontext {
 
         RunModuleBreakpoint::RunModuleBreakpoint(BlockableContainerListener &bcl) :
             m_blockableContainerListener(bcl),
-            m_reachedMutex(),
+            m_breakpointCondition(),
             m_reached(false),
-            m_continueMutex(),
             m_continue(false) {}
 
         RunModuleBreakpoint::~RunModuleBreakpoint() {}
@@ -41,62 +39,61 @@ namespace odcontext {
             // Disable sending BEFORE reaching the breakpoint (since RuntimeControl would increment time after reaching the breakpoint).
             m_blockableContainerListener.setNextContainerAllowed(false);
 
-            // Indicate the outer thread that the inner thread has reached its breakpoint.
             {
-                Lock l1(m_reachedMutex);
+                Lock l(m_breakpointCondition);
+
+                // Indicate the outer thread that the inner thread has reached its breakpoint.
                 m_reached = true;
-            }
+                m_breakpointCondition.wakeAll();
+
+                // Wait for continue.
+                while (!m_continue) {
+                    m_breakpointCondition.waitOnSignal();
+                }
 
-            // Wait for continue.
-            while (!hasContinue()) {
-                Thread::usleepFor(1000);
+                // Consume continue.
+                m_continue = false;
             }
 
             // Enable sending.
             m_blockableContainerListener.setNextContainerAllowed(true);
-
-            // Consume continue.
-            {
-                Lock l3(m_continueMutex);
-                m_continue = false;
-            }
         }
 
         void RunModuleBreakpoint::setFinallyReaching() {
-            Lock l1(m_reachedMutex);
+            Lock l(m_breakpointCondition);
             m_reached = true;
+            m_breakpointCondition.wakeAll();
         }
 
         bool RunModuleBreakpoint::hasReached() const {
             bool retVal = false;
             {
-                Lock l(m_reachedMutex);
+                Lock l(m_breakpointCondition);
                 retVal = m_reached;
             }
             return retVal;
         }
 
-        bool RunModuleBreakpoint::hasContinue() const {
-            bool retVal = false;
-            {
-                Lock l1(m_continueMutex);
-                retVal = m_continue;
+        bool RunModuleBreakpoint::waitForReaching(const uint32_t &timeoutInMicroseconds) {
+            // TimeStamps are controlled by RuntimeControl and thus, the timeout is given to the condition directly.
+            bool timedOut = false;
+
+            Lock l(m_breakpointCondition);
+            while (!m_reached && !timedOut) {
+                timedOut = !m_breakpointCondition.waitOnSignalWithTimeout((timeoutInMicroseconds + 999) / 1000);
             }
-            return retVal;
+            return m_reached;
         }
 
         void RunModuleBreakpoint::continueExecution() {
+            Lock l(m_breakpointCondition);
+
             // Prepare reached for next execution.
-            {
-                Lock l1(m_reachedMutex);
-                m_reached = false;
-            }
+            m_reached = false;
 
             // Continue execution.
-            {
-                Lock l2(m_continueMutex);
-                m_continue = true;
-            }
+            m_continue = true;
+            m_breakpointCondition.wakeAll();
         }
 
     }
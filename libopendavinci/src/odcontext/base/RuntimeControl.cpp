@@ -25,14 +25,17 @@
 #include "opendavinci/odcontext/base/ControlledContainerConferenceFactory.h"
 #include "opendavinci/odcontext/base/ControlledTime.h"
 #include "opendavinci/odcontext/base/ControlledTimeFactory.h"
+#include "opendavinci/odcontext/base/ParallelStepper.h"
 #include "opendavinci/odcontext/base/RuntimeControl.h"
 #include "opendavinci/odcontext/base/RuntimeControlInterface.h"
 #include "opendavinci/odcontext/base/RuntimeEnvironment.h"
+#include "opendavinci/odcontext/base/SendContainerToSystemsUnderTest.h"
 #include "opendavinci/odcontext/base/SuperComponent.h"
 #include "opendavinci/odcontext/base/SystemFeedbackComponent.h"
 #include "opendavinci/odcontext/base/SystemReportingComponent.h"
 #include "opendavinci/odcontext/base/TimeTriggeredConferenceClientModuleRunner.h"
 #include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/data/TimeStamp.h"
 #include "opendavinci/odcore/exceptions/Exceptions.h"
 #include "opendavinci/odcore/io/conference/ContainerConferenceFactory.h"
@@ -52,6 +55,50 @@ namespace odcontext {
         using namespace odcore::io;
         using namespace odcore::io::conference;
 
+        /**
+         * This class executes one SystemFeedbackComponent on a
+         * ParallelStepper and holds back the containers sent by
+         * the component until all components of the tick have finished.
+         */
+        class SystemFeedbackComponentStep : public ParallelStepper::Step, public SendContainerToSystemsUnderTest {
+            private:
+                SystemFeedbackComponentStep(const SystemFeedbackComponentStep&);
+                SystemFeedbackComponentStep& operator=(const SystemFeedbackComponentStep&);
+
+            public:
+                SystemFeedbackComponentStep(SystemFeedbackComponent &sfc) :
+                    m_systemFeedbackComponent(sfc),
+                    m_time(),
+                    m_containers() {}
+
+                virtual ~SystemFeedbackComponentStep() {}
+
+                void setTime(const ControlledTime &t) {
+                    m_time = t;
+                }
+
+                virtual void step() {
+                    m_systemFeedbackComponent.step(m_time, *this);
+                }
+
+                virtual void sendToSystemsUnderTest(odcore::data::Container &c) {
+                    m_containers.push_back(c);
+                }
+
+                void deliverContainers(SendContainerToSystemsUnderTest &sender) {
+                    vector<odcore::data::Container>::iterator it = m_containers.begin();
+                    while (it != m_containers.end()) {
+                        sender.sendToSystemsUnderTest(*it++);
+                    }
+                    m_containers.clear();
+                }
+
+            private:
+                SystemFeedbackComponent &m_systemFeedbackComponent;
+                ControlledTime m_time;
+                vector<odcore::data::Container> m_containers;
+        };
+
         RuntimeControl::RuntimeControl(const RuntimeControlInterface &sci) :
             m_controlMutex(),
             m_control(RuntimeControl::UNSPECIFIED),
@@ -59,7 +106,9 @@ namespace odcontext {
             m_runtimeControlInterface(sci),
             m_superComponent(NULL),
             m_controlledContainerConferenceFactory(NULL),
-            m_controlledTimeFactory(NULL) {
+            m_controlledTimeFactory(NULL),
+            m_verbosity(RuntimeControl::ALL_COMPONENTS),
+            m_numberOfThreads(1) {
             // Initialize TimeFactory to avoid SEGFAULT.
             odcore::data::TimeStamp ts;
             if (ts.getSeconds() > 0) {};
@@ -113,6 +162,14 @@ namespace odcontext {
             }
         }
 
+        void RuntimeControl::setVerbosity(const enum VERBOSITY &verbosity) {
+            m_verbosity = verbosity;
+        }
+
+        void RuntimeControl::setParallelExecution(const uint32_t &numberOfThreads) {
+            m_numberOfThreads = numberOfThreads;
+        }
+
         void RuntimeControl::removeExistingContainerConferenceFactory() {
             // Destroy any existing ContainerConferenceFactory.
             ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
@@ -256,7 +313,9 @@ namespace odcontext {
                 while (mt != listOfSystemReportingComponents.end()) {
                     SystemReportingComponent *src = (*mt++);
                     if (src != NULL) {
-                        clog << "[SRC] at " << time.getSeconds() << "." << time.getPartialMicroseconds() << endl;
+                        if (m_verbosity >= RuntimeControl::ALL_COMPONENTS) {
+                            clog << "[SRC] at " << time.getSeconds() << "." << time.getPartialMicroseconds() << endl;
+                        }
 
                         src->report(time);
                     }
@@ -303,6 +362,32 @@ namespace odcontext {
                         assert(listOfWrappedTimeTriggeredConferenceClientModules.size() > 0);
                         ////////////////////////////////////////////////////////
 
+                        // Components due at the same tick are executed in parallel if requested.
+                        const bool PARALLEL_EXECUTION = (m_numberOfThreads > 1);
+                        std::shared_ptr<ParallelStepper> parallelStepper;
+                        vector<std::shared_ptr<SystemFeedbackComponentStep> > listOfSystemFeedbackComponentSteps;
+                        if (PARALLEL_EXECUTION) {
+                            parallelStepper = std::shared_ptr<ParallelStepper>(new ParallelStepper(m_numberOfThreads));
+
+                            vector<SystemFeedbackComponent*>::iterator it = listOfSystemFeedbackComponents.begin();
+                            while (it != listOfSystemFeedbackComponents.end()) {
+                                SystemFeedbackComponent *sfc = (*it++);
+                                listOfSystemFeedbackComponentSteps.push_back(std::shared_ptr<SystemFeedbackComponentStep>((sfc != NULL) ? new SystemFeedbackComponentStep(*sfc) : NULL));
+                            }
+                        }
+
+                        vector<std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> >::iterator lt = listOfWrappedTimeTriggeredConferenceClientModules.begin();
+                        while (lt != listOfWrappedTimeTriggeredConferenceClientModules.end()) {
+                            std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> runner = (*lt++);
+                            if (runner.get()) {
+                                runner->setVerbose(m_verbosity >= RuntimeControl::ALL_COMPONENTS);
+
+                                // Hold back containers sent by applications executed in parallel until all applications of a tick have finished.
+                                runner->setDeliveryDeferred(PARALLEL_EXECUTION);
+                            }
+                        }
+                        m_controlledContainerConferenceFactory->setVerbose(m_verbosity >= RuntimeControl::ALL_COMPONENTS);
+
                         // Ladies and Gentlemen: The time.
                         Clock time;
 
@@ -314,50 +399,111 @@ namespace odcontext {
                         // Perform system's context simulation.
                         setModuleState(odcore::data::dmcp::ModuleStateMessage::RUNNING);
                         while ( (moreModulesSchedulable) && (static_cast<uint32_t>(time.now().getSeconds()) < maxRunningTimeInSeconds) && (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) ) {
-                            clog << "------------------------------------------------------------------------------" << endl;
-                            clog << "Time " << time.now().getSeconds() << "." << time.now().getPartialMicroseconds() << endl;
-
-                            // Execute SystemFeedbackComponents.
-                            vector<SystemFeedbackComponent*>::iterator jt = listOfSystemFeedbackComponents.begin();
-                            while (jt != listOfSystemFeedbackComponents.end()) {
-                                SystemFeedbackComponent *sfc = (*jt++);
-
-                                bool hasExecutedSystemComponent = false;
-                                if ( (sfc != NULL) && (sfc->needsExecution(time.now())) ) {
-                                    clog << "[SFC] at " << time.now().getSeconds() << "." << time.now().getPartialMicroseconds() << endl;
-
-                                    sfc->step(time.now(), *m_controlledContainerConferenceFactory);
+                            if (m_verbosity >= RuntimeControl::TICKS) {
+                                clog << "------------------------------------------------------------------------------" << endl;
+                                clog << "Time " << time.now().getSeconds() << "." << time.now().getPartialMicroseconds() << endl;
+                            }
 
-                                    hasExecutedSystemComponent = true;
+                            if (PARALLEL_EXECUTION) {
+                                // Execute SystemFeedbackComponents due at this tick in parallel.
+                                vector<ParallelStepper::Step*> steps;
+                                vector<std::shared_ptr<SystemFeedbackComponentStep> > executedSteps;
+                                for (uint32_t i = 0; i < listOfSystemFeedbackComponents.size(); i++) {
+                                    SystemFeedbackComponent *sfc = listOfSystemFeedbackComponents.at(i);
+                                    if ( (sfc != NULL) && (sfc->needsExecution(time.now())) ) {
+                                        if (m_verbosity >= RuntimeControl::ALL_COMPONENTS) {
+                                            clog << "[SFC] at " << time.now().getSeconds() << "." << time.now().getPartialMicroseconds() << endl;
+                                        }
+
+                                        std::shared_ptr<SystemFeedbackComponentStep> sfcs = listOfSystemFeedbackComponentSteps.at(i);
+                                        sfcs->setTime(time.now());
+                                        steps.push_back(sfcs.get());
+                                        executedSteps.push_back(sfcs);
+                                    }
                                 }
+                                parallelStepper->execute(steps);
 
-                                // When the SystemContextComponent was executed, call all reporters.
-                                if (hasExecutedSystemComponent) {
+                                // Distribute the sent containers in the order of the components and call all reporters.
+                                vector<std::shared_ptr<SystemFeedbackComponentStep> >::iterator jt = executedSteps.begin();
+                                while (jt != executedSteps.end()) {
+                                    (*jt++)->deliverContainers(*m_controlledContainerConferenceFactory);
                                     doReporting(rte, time.now());
                                 }
-                            }
 
-                            // Execute wrapped ConferenceClientModules.
-                            vector<std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> >::iterator kt = listOfWrappedTimeTriggeredConferenceClientModules.begin();
-                            while (kt != listOfWrappedTimeTriggeredConferenceClientModules.end()) {
-                                std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> runner = (*kt++);
+                                // Execute all wrapped ConferenceClientModules due at this tick at once.
+                                vector<std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> > executedRunners;
+                                vector<std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> >::iterator kt = listOfWrappedTimeTriggeredConferenceClientModules.begin();
+                                while (kt != listOfWrappedTimeTriggeredConferenceClientModules.end()) {
+                                    std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> runner = (*kt++);
+
+                                    // Check, if further cycles are necessary.
+                                    moreModulesSchedulable = false;
+                                    moreModulesSchedulable |= ( (runner.get()) && (!runner->hasFinished()) );
 
-                                // Check, if further cycles are necessary.
-                                moreModulesSchedulable = false;
-                                moreModulesSchedulable |= ( (runner.get()) && (!runner->hasFinished()) );
+                                    if ( runner.get() && (runner->needsExecution(time.now())) ) {
+                                        runner->beginStep(time.now());
+                                        executedRunners.push_back(runner);
+                                    }
+                                }
 
-                                // Check if the application needs to be executed.
-                                bool hasExecutedApplication = false;
-                                if ( runner.get() && (runner->needsExecution(time.now())) ) {
-                                    runner->step(time.now());
-                                    hasExecutedApplication = true;
+                                // Barrier: Wait for all applications to reach their breakpoints.
+                                kt = executedRunners.begin();
+                                while (kt != executedRunners.end()) {
+                                    (*kt++)->finishStep();
                                 }
 
-                                // When the application was executed, call all reporters.
-                                if (hasExecutedApplication) {
+                                // Distribute the sent containers in the order of the applications and call all reporters.
+                                kt = executedRunners.begin();
+                                while (kt != executedRunners.end()) {
+                                    (*kt++)->deliverDeferredContainers();
                                     doReporting(rte, time.now());
                                 }
                             }
+                            else {
+                                // Execute SystemFeedbackComponents.
+                                vector<SystemFeedbackComponent*>::iterator jt = listOfSystemFeedbackComponents.begin();
+                                while (jt != listOfSystemFeedbackComponents.end()) {
+                                    SystemFeedbackComponent *sfc = (*jt++);
+
+                                    bool hasExecutedSystemComponent = false;
+                                    if ( (sfc != NULL) && (sfc->needsExecution(time.now())) ) {
+                                        if (m_verbosity >= RuntimeControl::ALL_COMPONENTS) {
+                                            clog << "[SFC] at " << time.now().getSeconds() << "." << time.now().getPartialMicroseconds() << endl;
+                                        }
+
+                                        sfc->step(time.now(), *m_controlledContainerConferenceFactory);
+
+                                        hasExecutedSystemComponent = true;
+                                    }
+
+                                    // When the SystemContextComponent was executed, call all reporters.
+                                    if (hasExecutedSystemComponent) {
+                                        doReporting(rte, time.now());
+                                    }
+                                }
+
+                                // Execute wrapped ConferenceClientModules.
+                                vector<std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> >::iterator kt = listOfWrappedTimeTriggeredConferenceClientModules.begin();
+                                while (kt != listOfWrappedTimeTriggeredConferenceClientModules.end()) {
+                                    std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> runner = (*kt++);
+
+                                    // Check, if further cycles are necessary.
+                                    moreModulesSchedulable = false;
+                                    moreModulesSchedulable |= ( (runner.get()) && (!runner->hasFinished()) );
+
+                                    // Check if the application needs to be executed.
+                                    bool hasExecutedApplication = false;
+                                    if ( runner.get() && (runner->needsExecution(time.now())) ) {
+                                        runner->step(time.now());
+                                        hasExecutedApplication = true;
+                                    }
+
+                                    // When the application was executed, call all reporters.
+                                    if (hasExecutedApplication) {
+                                        doReporting(rte, time.now());
+                                    }
+                                }
+                            }
 
                             // Increment the time using the computed greatest common divisor.
                             time.increment(SLEEPING_TIME);
@@ -371,6 +517,8 @@ namespace odcontext {
                         while (kt != listOfWrappedTimeTriggeredConferenceClientModules.end()) {
                             std::shared_ptr<TimeTriggeredConferenceClientModuleRunner> runner = (*kt++);
                             if (runner.get()) {
+                                // Containers sent while stopping are distributed immediately.
+                                runner->setDeliveryDeferred(false);
                                 runner->stop();
                             }
                         }
@@ -21,13 +21,11 @@
 #include <iostream>
 #include <string>
 
-#include "opendavinci/odcontext/base/BlockableContainerListener.h"
 #include "opendavinci/odcontext/base/BlockableContainerReceiver.h"
 #include "opendavinci/odcontext/base/ControlledContainerConferenceForSystemUnderTest.h"
 #include "opendavinci/odcontext/base/TimeConstants.h"
 #include "opendavinci/odcontext/base/TimeTriggeredConferenceClientModuleRunner.h"
 #include "opendavinci/odcore/base/Lock.h"
-#include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
 #include "opendavinci/odcore/exceptions/Exceptions.h"
 #include "opendavinci/odcore/io/conference/ContainerConference.h"
@@ -51,7 +49,8 @@ namespace odcontext {
             m_timeTriggeredConferenceClientModuleFinished(false),
             m_timeTriggeredConferenceClientModule(ttccm),
             m_blockableContainerListener(dynamic_cast<ControlledContainerConferenceForSystemUnderTest&>(ttccm.getConference()).getBlockableContainerReceiver()),
-            m_runModuleBreakpoint(dynamic_cast<ControlledContainerConferenceForSystemUnderTest&>(ttccm.getConference()).getBlockableContainerReceiver()) {
+            m_runModuleBreakpoint(dynamic_cast<ControlledContainerConferenceForSystemUnderTest&>(ttccm.getConference()).getBlockableContainerReceiver()),
+            m_verbose(true) {
             ttccm.setBreakpoint(&m_runModuleBreakpoint);
         }
 
@@ -66,36 +65,52 @@ namespace odcontext {
 
         void TimeTriggeredConferenceClientModuleRunner::step(const odcore::wrapper::Time &t) {
             if (needsExecution(t)) {
+                beginStep(t);
+                finishStep();
+            }
+        }
+
+        void TimeTriggeredConferenceClientModuleRunner::beginStep(const odcore::wrapper::Time &t) {
+            if (m_verbose) {
                 clog << "[APP] at " << t.getSeconds() << "." << t.getPartialMicroseconds() << endl;
+            }
+
+            // Start application as independent thread at first call.
+            if (!m_timeTriggeredConferenceClientModuleStarted) {
+                start();
+                m_timeTriggeredConferenceClientModuleStarted = true;
+            }
+            else {
+                // OTHERWISE!!!! continue held execution.
+                m_runModuleBreakpoint.continueExecution();
+            }
+        }
+
+        void TimeTriggeredConferenceClientModuleRunner::finishStep() {
+            // Waiting for breakpoint; the module's thread signals reaching it.
+            if (!m_runModuleBreakpoint.waitForReaching(TimeConstants::MAX_WAIT_FOR_REACHING_BREAKPOINT_PER_CYCLE)) {
+                stringstream reason;
+                reason << m_timeTriggeredConferenceClientModule.getName() << " is not responding after " << (TimeConstants::MAX_WAIT_FOR_REACHING_BREAKPOINT_PER_CYCLE / TimeConstants::ONE_SECOND_IN_MICROSECONDS) << "s." << endl;
 
-                // Start application as independent thread at first call.
-                if (!m_timeTriggeredConferenceClientModuleStarted) {
-                    start();
-                    m_timeTriggeredConferenceClientModuleStarted = true;
-                }
-                else {
-                    // OTHERWISE!!!! continue held execution.
-                    m_runModuleBreakpoint.continueExecution();
-                }
-
-                // Waiting for breakpoint.
-                uint32_t waitingForReachingBreakpoint = 0;
-                while (!m_runModuleBreakpoint.hasReached()) {
-                    Thread::usleepFor(TimeConstants::ONE_MILLISECOND_IN_MICROSECONDS);
-                    waitingForReachingBreakpoint += TimeConstants::ONE_MILLISECOND_IN_MICROSECONDS;
-
-                    if (waitingForReachingBreakpoint > TimeConstants::MAX_WAIT_FOR_REACHING_BREAKPOINT_PER_CYCLE) {
-                        stringstream reason;
-                        reason << m_timeTriggeredConferenceClientModule.getName() << " is not responding after " << (TimeConstants::MAX_WAIT_FOR_REACHING_BREAKPOINT_PER_CYCLE / TimeConstants::ONE_SECOND_IN_MICROSECONDS) << "s." << endl;
-
-                        // Throw exception to kill ourselves.
-                        errno = 0;
-                        OPENDAVINCI_CORE_THROW_EXCEPTION(ModulesNotRespondingException, reason.str());
-                    }
-                }
+                // Throw exception to kill ourselves.
+                errno = 0;
+                OPENDAVINCI_CORE_THROW_EXCEPTION(ModulesNotRespondingException, reason.str());
             }
         }
 
+        void TimeTriggeredConferenceClientModuleRunner::setDeliveryDeferred(const bool &deferred) {
+            m_blockableContainerListener.setDeliveryDeferred(deferred);
+        }
+
+        void TimeTriggeredConferenceClientModuleRunner::deliverDeferredContainers() {
+            m_blockableContainerListener.deliverDeferredContainers();
+        }
+
+        void TimeTriggeredConferenceClientModuleRunner::setVerbose(const bool &verbose) {
+            m_verbose = verbose;
+            m_blockableContainerListener.setVerbose(verbose);
+        }
+
         void TimeTriggeredConferenceClientModuleRunner::beforeStop() {
             // Stop module.
             m_timeTriggeredConferenceClientModule.setModuleState(odcore::data::dmcp::ModuleStateMessage::NOT_RUNNING);
@@ -24,20 +24,31 @@ namespace odcore {
     namespace base {
 
         AbstractDataStore::AbstractDataStore() :
-            m_condition() {}
+            m_condition(),
+            m_numberOfWaitingThreads(0) {}
 
         AbstractDataStore::~AbstractDataStore() {}
 
         void AbstractDataStore::waitForData() {
             Lock l(m_condition);
+
+            // Announce ourselves before checking so that wakeWaitingThreads()
+            // either sees us waiting or we see the newly added data.
+            m_numberOfWaitingThreads.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
             if (isEmpty()) {
                 m_condition.waitOnSignal();
             }
+
+            m_numberOfWaitingThreads.fetch_sub(1);
         }
 
         void AbstractDataStore::wait() {
           Lock l(m_condition);
+          m_numberOfWaitingThreads.fetch_add(1);
           m_condition.waitOnSignal();
+          m_numberOfWaitingThreads.fetch_sub(1);
         }
 
         void AbstractDataStore::wakeAll() {
@@ -45,6 +56,13 @@ namespace odcore {
             m_condition.wakeAll();
         }
 
+        void AbstractDataStore::wakeWaitingThreads() {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_numberOfWaitingThreads.load(std::memory_order_relaxed) > 0) {
+                wakeAll();
+            }
+        }
+
 
     }
 } // odcore::base
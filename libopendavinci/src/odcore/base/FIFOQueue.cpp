@@ -17,6 +17,10 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <deque>
+#include <thread>
+#include <utility>
+
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/FIFOQueue.h"
 
@@ -27,7 +31,10 @@ namespace odcore {
 
         FIFOQueue::FIFOQueue() :
                 m_mutexQueue(),
-                m_queue() {}
+                m_entered(CAPACITY_OF_ENTRY_RING, RingBuffer<Container>::MULTIPLE_PRODUCERS),
+                m_queue(),
+                m_numberOfFetched(0),
+                m_numberOfOverflowed(0) {}
 
         FIFOQueue::~FIFOQueue() {
             wakeAll();
@@ -35,28 +42,60 @@ namespace odcore {
 
         void FIFOQueue::clear() {
             {
+                Container container;
+                while (m_entered.tryPop(container)) {}
+
                 Lock l(m_mutexQueue);
                 m_queue.clear();
+                m_numberOfFetched.store(0);
+                m_numberOfOverflowed.store(0);
             }
             wakeAll();
         }
 
         void FIFOQueue::enter(const Container &container) {
-            {
+            Container entry(container);
+
+            // Once containers have overflowed, the following ones must queue up behind them.
+            if ( (m_numberOfOverflowed.load() > 0) || !m_entered.tryPush(std::move(entry)) ) {
                 Lock l(m_mutexQueue);
-                m_queue.push_back(container);
+                m_queue.push_back(std::move(entry));
+                m_numberOfOverflowed.fetch_add(1);
             }
-            wakeAll();
+            wakeWaitingThreads();
+        }
+
+        void FIFOQueue::waitForData() {
+            for (uint32_t i = 0; i < RingBuffer<Container>::SPIN_ITERATIONS; i++) {
+                if (!isEmpty()) {
+                    return;
+                }
+                std::this_thread::yield();
+            }
+
+            AbstractDataStore::waitForData();
         }
 
         const Container FIFOQueue::leave() {
             waitForData();
 
             Container container;
-            if (!isEmpty()) {
-                Lock l(m_mutexQueue);
-                container = m_queue.front();
+
+            // Containers fetched by get(...) are older than those in the ring.
+            if ( (m_numberOfFetched.load() == 0) && m_entered.tryPop(container) ) {
+                return container;
+            }
+
+            Lock l(m_mutexQueue);
+            if (m_numberOfFetched.load() > 0) {
+                container = std::move(m_queue.front());
                 m_queue.pop_front();
+                m_numberOfFetched.fetch_sub(1);
+            }
+            else if (!m_entered.tryPop(container) && !m_queue.empty()) {
+                container = std::move(m_queue.front());
+                m_queue.pop_front();
+                m_numberOfOverflowed.fetch_sub(1);
             }
 
             return container;
@@ -65,11 +104,18 @@ namespace odcore {
         const Container FIFOQueue::get(const uint32_t &index) const {
             Container container;
 
-            if (!isEmpty()) {
-                if (index < getSize()) {
-                    Lock l(m_mutexQueue);
-                    container = m_queue[index];
-                }
+            Lock l(m_mutexQueue);
+
+            // Move the ring's containers in front of the overflowed ones to access them by index.
+            deque<Container>::iterator position = m_queue.begin() + m_numberOfFetched.load();
+            while (m_entered.tryPop(container)) {
+                position = m_queue.insert(position, std::move(container)) + 1;
+                m_numberOfFetched.fetch_add(1);
+            }
+
+            container = Container();
+            if (index < m_queue.size()) {
+                container = m_queue[index];
             }
 
             return container;
@@ -80,13 +126,11 @@ namespace odcore {
         }
 
         uint32_t FIFOQueue::getSize() const {
-            Lock l(m_mutexQueue);
-            return static_cast<uint32_t>(m_queue.size());
+            return m_entered.getSize() + m_numberOfFetched.load() + m_numberOfOverflowed.load();
         }
 
         bool FIFOQueue::isEmpty() const {
-            Lock l(m_mutexQueue);
-            return m_queue.empty();
+            return m_entered.isEmpty() && (m_numberOfFetched.load() == 0) && (m_numberOfOverflowed.load() == 0);
         }
     }
 } // odcore::base
@@ -0,0 +1,76 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "opendavinci/odcore/base/InputMemoryStreambuf.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+
+        InputMemoryStreambuf::InputMemoryStreambuf(const char *data, const uint64_t &size) :
+            std::streambuf() {
+            // The get area is never written to; the cast is only needed to satisfy the streambuf interface.
+            char *begin = const_cast<char*>(data);
+            setg(begin, begin, begin + size);
+        }
+
+        InputMemoryStreambuf::~InputMemoryStreambuf() {}
+
+        const char* InputMemoryStreambuf::current() const {
+            return gptr();
+        }
+
+        uint64_t InputMemoryStreambuf::available() const {
+            return static_cast<uint64_t>(egptr() - gptr());
+        }
+
+        void InputMemoryStreambuf::consume(const uint64_t &length) {
+            const uint64_t toSkip = (length < available()) ? length : available();
+            setg(eback(), gptr() + toSkip, egptr());
+        }
+
+        InputMemoryStreambuf::pos_type InputMemoryStreambuf::seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode which) {
+            if ((which & ios_base::in) == 0) {
+                return pos_type(off_type(-1));
+            }
+
+            char *base = eback();
+            if (dir == ios_base::cur) {
+                base = gptr();
+            }
+            else if (dir == ios_base::end) {
+                base = egptr();
+            }
+
+            char *position = base + off;
+            if ( (position < eback()) || (position > egptr()) ) {
+                return pos_type(off_type(-1));
+            }
+
+            setg(eback(), position, egptr());
+            return pos_type(off_type(position - eback()));
+        }
+
+        InputMemoryStreambuf::pos_type InputMemoryStreambuf::seekpos(pos_type pos, ios_base::openmode which) {
+            return seekoff(off_type(pos), ios_base::beg, which);
+        }
+
+    }
+} // odcore::base
@@ -18,10 +18,13 @@
  */
 
 #include <iosfwd>
+#include <limits>
 #include <string>
 
 #include "opendavinci/odcore/base/KeyValueDataStore.h"
+#include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/Serializable.h"
+#include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/opendavinci.h"
 
 namespace odcore {
@@ -30,8 +33,24 @@ namespace odcore {
         using namespace data;
         using namespace exceptions;
 
+        // Keys of unused slots; this key itself is always stored in the database.
+        static const int32_t EMPTY_KEY = numeric_limits<int32_t>::min();
+
+        KeyValueDataStore::Slot::Slot() :
+                m_key(EMPTY_KEY),
+                m_current(0),
+                m_readers(),
+                m_values(),
+                m_writerMutex() {
+            for (uint32_t i = 0; i < BUFFERS; i++) {
+                m_readers[i].store(0);
+            }
+        }
+
         KeyValueDataStore::KeyValueDataStore(std::shared_ptr<wrapper::KeyValueDatabase> keyValueDatabase) throw (NoDatabaseAvailableException) :
-                m_keyValueDatabase(keyValueDatabase) {
+                m_keyValueDatabase(keyValueDatabase),
+                m_slots(new Slot[CAPACITY]),
+                m_overflow(false) {
             if (!m_keyValueDatabase.get()) {
                 OPENDAVINCI_CORE_THROW_EXCEPTION(NoDatabaseAvailableException, "Given database is NULL.");
             }
@@ -39,7 +58,60 @@ namespace odcore {
 
         KeyValueDataStore::~KeyValueDataStore() {}
 
+        KeyValueDataStore::Slot* KeyValueDataStore::getSlot(const int32_t &key, const bool &claim) const {
+            if (key == EMPTY_KEY) {
+                return NULL;
+            }
+
+            // Linear probing starting at the key's hash.
+            const uint32_t start = (static_cast<uint32_t>(key) * 2654435761u) % CAPACITY;
+            for (uint32_t i = 0; i < CAPACITY; i++) {
+                Slot &slot = m_slots[(start + i) % CAPACITY];
+                int32_t current = slot.m_key.load(memory_order_acquire);
+                if (current == key) {
+                    return &slot;
+                }
+                if (current == EMPTY_KEY) {
+                    if (!claim) {
+                        return NULL;
+                    }
+                    if (slot.m_key.compare_exchange_strong(current, key, memory_order_acq_rel)) {
+                        return &slot;
+                    }
+                    // Another writer claimed the slot; check whether it was for the same key.
+                    if (current == key) {
+                        return &slot;
+                    }
+                }
+            }
+            return NULL;
+        }
+
         void KeyValueDataStore::put(const int32_t &key, const Container &value) {
+            Slot *slot = getSlot(key, true);
+            if (slot != NULL) {
+                Lock l(slot->m_writerMutex);
+
+                // Find a buffer that is neither published nor copied by a reader.
+                const uint32_t current = slot->m_current.load();
+                uint32_t next = (current + 1) % BUFFERS;
+                while ( (next == current) || (slot->m_readers[next].load() != 0) ) {
+                    next = (next + 1) % BUFFERS;
+                    if (next == current) {
+                        // All other buffers are being copied right now.
+                        Thread::usleepFor(1);
+                    }
+                }
+
+                // The copy shares the payload with value; a reader that
+                // announces itself at this buffer now finds that it is not
+                // current and retries.
+                slot->m_values[next] = value;
+                slot->m_current.store(next);
+                return;
+            }
+            m_overflow.store(true, memory_order_release);
+
             // Transform the given Container to a plain string...
             stringstream stringStreamValue;
             stringStreamValue << value;
@@ -52,6 +124,25 @@ namespace odcore {
         Container KeyValueDataStore::get(const int32_t &key) const {
             Container value;
 
+            Slot *slot = getSlot(key, false);
+            if (slot != NULL) {
+                while (true) {
+                    // Announce the reader at the current buffer and check that it
+                    // is still current; a writer does not reuse it afterwards.
+                    const uint32_t current = slot->m_current.load();
+                    slot->m_readers[current].fetch_add(1);
+                    if (slot->m_current.load() == current) {
+                        value = slot->m_values[current];
+                        slot->m_readers[current].fetch_sub(1);
+                        return value;
+                    }
+                    slot->m_readers[current].fetch_sub(1);
+                }
+            }
+            if (!m_overflow.load(memory_order_acquire)) {
+                return value;
+            }
+
             // Try to get the value from the database backend and try to parse a Container.
             string stringValue(m_keyValueDatabase->get(key));
             if (stringValue != "") {
@@ -0,0 +1,55 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include "opendavinci/odcore/base/OutputStringStreambuf.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+
+        OutputStringStreambuf::OutputStringStreambuf(string &buffer) :
+            std::streambuf(),
+            m_buffer(buffer),
+            m_start(buffer.size()) {}
+
+        OutputStringStreambuf::~OutputStringStreambuf() {}
+
+        OutputStringStreambuf::int_type OutputStringStreambuf::overflow(int_type c) {
+            if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                m_buffer.push_back(traits_type::to_char_type(c));
+            }
+            return traits_type::not_eof(c);
+        }
+
+        streamsize OutputStringStreambuf::xsputn(const char *s, streamsize n) {
+            m_buffer.append(s, static_cast<string::size_type>(n));
+            return n;
+        }
+
+        OutputStringStreambuf::pos_type OutputStringStreambuf::seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode which) {
+            // Only reporting the current write position (i.e. tellp()) is supported.
+            if ( (off == 0) && (dir != ios_base::beg) && ((which & ios_base::out) != 0) ) {
+                return pos_type(off_type(m_buffer.size() - m_start));
+            }
+            return pos_type(off_type(-1));
+        }
+
+    }
+} // odcore::base
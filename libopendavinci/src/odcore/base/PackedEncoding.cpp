@@ -0,0 +1,224 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <cstring>
+
+#include "opendavinci/odcore/base/PackedEncoding.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+
+        /**
+         * This method appends the lower size bytes of value in little endian byte order.
+         */
+        static void appendLittleEndian(string &out, uint64_t value, const uint32_t &size) {
+            char buffer[sizeof(uint64_t)];
+            for (uint32_t i = 0; i < size; i++) {
+                buffer[i] = static_cast<char>(value & 0xFF);
+                value >>= 8;
+            }
+            out.append(buffer, size);
+        }
+
+        /**
+         * This method reads size bytes in little endian byte order.
+         */
+        static bool extractLittleEndian(const char *&pos, const char *end, uint64_t &value, const uint32_t &size) {
+            if (static_cast<uint32_t>(end - pos) < size) {
+                return false;
+            }
+            value = 0;
+            for (uint32_t i = size; i > 0; i--) {
+                value = (value << 8) | static_cast<uint8_t>(pos[i - 1]);
+            }
+            pos += size;
+            return true;
+        }
+
+        PackedEncoding::PackedEncoding() {}
+
+        PackedEncoding::~PackedEncoding() {}
+
+        bool PackedEncoding::isPacked(const string &in) {
+            return (in.length() >= HEADER_SIZE) && (in.at(0) == '\0') && (in.at(1) == static_cast<char>(VERSION));
+        }
+
+        void PackedEncoding::appendHeader(string &out) {
+            out.push_back('\0');
+            out.push_back(static_cast<char>(VERSION));
+        }
+
+        void PackedEncoding::append(string &out, const bool &v) {
+            out.push_back(v ? 1 : 0);
+        }
+
+        void PackedEncoding::append(string &out, const char &v) {
+            out.push_back(v);
+        }
+
+        void PackedEncoding::append(string &out, const int8_t &v) {
+            out.push_back(static_cast<char>(v));
+        }
+
+        void PackedEncoding::append(string &out, const uint8_t &v) {
+            out.push_back(static_cast<char>(v));
+        }
+
+        void PackedEncoding::append(string &out, const int16_t &v) {
+            appendLittleEndian(out, static_cast<uint16_t>(v), sizeof(v));
+        }
+
+        void PackedEncoding::append(string &out, const uint16_t &v) {
+            appendLittleEndian(out, v, sizeof(v));
+        }
+
+        void PackedEncoding::append(string &out, const int32_t &v) {
+            appendLittleEndian(out, static_cast<uint32_t>(v), sizeof(v));
+        }
+
+        void PackedEncoding::append(string &out, const uint32_t &v) {
+            appendLittleEndian(out, v, sizeof(v));
+        }
+
+        void PackedEncoding::append(string &out, const int64_t &v) {
+            appendLittleEndian(out, static_cast<uint64_t>(v), sizeof(v));
+        }
+
+        void PackedEncoding::append(string &out, const uint64_t &v) {
+            appendLittleEndian(out, v, sizeof(v));
+        }
+
+        void PackedEncoding::append(string &out, const float &v) {
+            uint32_t bits = 0;
+            memcpy(&bits, &v, sizeof(v));
+            appendLittleEndian(out, bits, sizeof(v));
+        }
+
+        void PackedEncoding::append(string &out, const double &v) {
+            uint64_t bits = 0;
+            memcpy(&bits, &v, sizeof(v));
+            appendLittleEndian(out, bits, sizeof(v));
+        }
+
+        void PackedEncoding::append(string &out, const string &v) {
+            appendLittleEndian(out, static_cast<uint32_t>(v.length()), sizeof(uint32_t));
+            out.append(v);
+        }
+
+        bool PackedEncoding::extract(const char *&pos, const char *end, bool &v) {
+            uint64_t value = 0;
+            const bool retVal = extractLittleEndian(pos, end, value, 1);
+            v = (value != 0);
+            return retVal;
+        }
+
+        bool PackedEncoding::extract(const char *&pos, const char *end, char &v) {
+            uint64_t value = 0;
+            const bool retVal = extractLittleEndian(pos, end, value, sizeof(v));
+            v = static_cast<char>(value);
+            return retVal;
+        }
+
+        bool PackedEncoding::extract(const char *&pos, const char *end, int8_t &v) {
+            uint64_t value = 0;
+            const bool retVal = extractLittleEndian(pos, end, value, sizeof(v));
+            v = static_cast<int8_t>(value);
+            return retVal;
+        }
+
+        bool PackedEncoding::extract(const char *&pos, const char *end, uint8_t &v) {
+            uint64_t value = 0;
+            const bool retVal = extractLittleEndian(pos, end, value, sizeof(v));
+            v = static_cast<uint8_t>(value);
+            return retVal;
+        }
+
+        bool PackedEncoding::extract(const char *&pos, const char *end, int16_t &v) {
+            uint64_t value = 0;
+            const bool retVal = extractLittleEndian(pos, end, value, sizeof(v));
+            v = static_cast<int16_t>(value);
+            return retVal;
+        }
+
+        bool PackedEncoding::extract(const char *&pos, const char *end, uint16_t &v) {
+            uint64_t value = 0;
+            const bool retVal = extractLittleEndian(pos, end, value, sizeof(v));
+            v = static_cast<uint16_t>(value);
+            return retVal;
+        }
+
+        bool PackedEncoding::extract(const char *&pos, const char *end, int32_t &v) {
+            uint64_t value = 0;
+            const bool retVal = extractLittleEndian(pos, end, value, sizeof(v));
+            v = static_cast<int32_t>(value);
+            return retVal;
+        }
+
+        bool PackedEncoding::extract(const char *&pos, const char *end, uint32_t &v) {
+            uint64_t value = 0;
+            const bool retVal = extractLittleEndian(pos, end, value, sizeof(v));
+            v = static_cast<uint32_t>(value);
+            return retVal;
+        }
+
+        bool PackedEncoding::extract(const char *&pos, const char *end, int64_t &v) {
+            uint64_t value = 0;
+            const bool retVal = extractLittleEndian(pos, end, value, sizeof(v));
+            v = static_cast<int64_t>(value);
+            return retVal;
+        }
+
+        bool PackedEncoding::extract(const char *&pos, const char *end, uint64_t &v) {
+            return extractLittleEndian(pos, end, v, sizeof(v));
+        }
+
+        bool PackedEncoding::extract(const char *&pos, const char *end, float &v) {
+            uint64_t value = 0;
+            const bool retVal = extractLittleEndian(pos, end, value, sizeof(v));
+            const uint32_t bits = static_cast<uint32_t>(value);
+            memcpy(&v, &bits, sizeof(v));
+            return retVal;
+        }
+
+        bool PackedEncoding::extract(const char *&pos, const char *end, double &v) {
+            uint64_t bits = 0;
+            const bool retVal = extractLittleEndian(pos, end, bits, sizeof(v));
+            memcpy(&v, &bits, sizeof(v));
+            return retVal;
+        }
+
+        bool PackedEncoding::extract(const char *&pos, const char *end, string &v) {
+            uint64_t length = 0;
+            if ( !extractLittleEndian(pos, end, length, sizeof(uint32_t)) ||
+                 (static_cast<uint64_t>(end - pos) < length) ) {
+                return false;
+            }
+            v.assign(pos, static_cast<size_t>(length));
+            pos += length;
+            return true;
+        }
+
+        void PackedEncoding::readText(istream &in, string &v) {
+            getline(in, v);
+        }
+
+    }
+} // odcore::base
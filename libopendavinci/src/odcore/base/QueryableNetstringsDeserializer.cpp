@@ -60,7 +60,10 @@ class Serializable;
                 in.seekg(currentPosition);
 
                 // Instantiate AACF deserializer.
-                m_deserializer = &m_aacf;
+                if (m_aacf.get() == NULL) {
+                    m_aacf = unique_ptr<QueryableNetstringsDeserializerAACF>(new QueryableNetstringsDeserializerAACF());
+                }
+                m_deserializer = m_aacf.get();
                 m_deserializer->deserializeDataFrom(in);
             }
             else if (magicNumber == 0xABCF) {
@@ -17,8 +17,11 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 
+#include "opendavinci/odcore/base/InputMemoryStreambuf.h"
 #include "opendavinci/odcore/base/QueryableNetstringsDeserializerABCF.h"
 #include "opendavinci/odcore/base/Serializable.h"
 #include "opendavinci/odcore/base/module/AbstractCIDModule.h"
@@ -29,21 +32,46 @@ namespace odcore {
 
         using namespace std;
 
+        QueryableNetstringsDeserializerABCF::Entry::Entry(const uint32_t &id, const uint32_t &offset, const uint32_t &length) :
+            m_id(id),
+            m_offset(offset),
+            m_length(length) {}
+
         QueryableNetstringsDeserializerABCF::QueryableNetstringsDeserializerABCF() :
             m_buffer(),
+            m_data(NULL),
+            m_size(0),
             m_values() {}
 
         QueryableNetstringsDeserializerABCF::QueryableNetstringsDeserializerABCF(istream &in) :
             m_buffer(),
+            m_data(NULL),
+            m_size(0),
             m_values() {
             deserializeDataFrom(in);
         }
 
-        uint8_t QueryableNetstringsDeserializerABCF::decodeVarInt(istream &in, int64_t &value) {
+        QueryableNetstringsDeserializerABCF::~QueryableNetstringsDeserializerABCF() {}
+
+        uint8_t QueryableNetstringsDeserializerABCF::decodeVarInt(const char *data, const uint32_t &size, int64_t &value) {
             uint64_t uvalue = 0;
-            uint8_t size = decodeVarUInt(in, uvalue);
+            uint8_t sizeOfValue = decodeVarUInt(data, size, uvalue);
             value = static_cast<int64_t>( uvalue & 1 ? ~(uvalue >> 1) : (uvalue >> 1) );
-            return size;
+            return sizeOfValue;
+        }
+
+        uint8_t QueryableNetstringsDeserializerABCF::decodeVarUInt(const char *data, const uint32_t &size, uint64_t &value) {
+            value = 0;
+            uint8_t sizeOfValue = 0;
+            while (sizeOfValue < size) {
+                const char c = data[sizeOfValue];
+                value |= static_cast<uint64_t>(c & 0x7f) << (0x7 * sizeOfValue++);
+                if ( !(c & 0x80) ) break;
+            }
+            // Decode as little endian like in Protobuf's case.
+            value = le64toh(value);
+
+            return sizeOfValue;
         }
 
         uint8_t QueryableNetstringsDeserializerABCF::decodeVarUInt(istream &in, uint64_t &value) {
@@ -52,7 +80,7 @@ namespace odcore {
             while (in.good()) {
                 char c = 0;
                 in.read(&c, sizeof(char));
-                value |= static_cast<unsigned int>( (c & 0x7f) << (0x7 * size++) );
+                value |= static_cast<uint64_t>(c & 0x7f) << (0x7 * size++);
                 if ( !(c & 0x80) ) break;
             }
             // Decode as little endian like in Protobuf's case.
@@ -62,14 +90,26 @@ namespace odcore {
         }
 
         void QueryableNetstringsDeserializerABCF::deserializeDataFrom(istream &in) {
-            // Reset any existing data in our hashmap.
+            // Reset any existing data in our index.
             m_values.clear();
             m_buffer.clear();
-            m_buffer.str("");
-
-            // Initialize the stringstream for getting valid positions when calling tellp().
-            // This MUST be a blank (Win32 has a *special* implementation...)!
-            m_buffer << " ";
+            m_data = NULL;
+            m_size = 0;
+
+            // If the stream is backed by a memory area, we can decode the data in-place.
+            InputMemoryStreambuf *memory = dynamic_cast<InputMemoryStreambuf*>(in.rdbuf());
+            if (memory != NULL) {
+                if (in.good()) {
+                    bool complete = false;
+                    // A single frame is smaller than 4 GB, even if the memory area (e.g. a mapped recording) is not.
+                    const uint32_t size = static_cast<uint32_t>(min(memory->available(), static_cast<uint64_t>(0xFFFFFFFF)));
+                    memory->consume(decodeFrame(memory->current(), size, complete));
+                    if (!complete) {
+                        in.setstate(ios_base::eofbit | ios_base::failbit);
+                    }
+                }
+                return;
+            }
 
             // Stream contents:
             // Header:
@@ -101,46 +141,115 @@ namespace odcore {
                 uint64_t length = 0;
                 decodeVarUInt(in, length);
 
-                // Decode payload consisting of: *(ID SIZE PAYLOAD).
-                char c = 0;
-                uint64_t tokenIdentifier = 0;
-                uint64_t lengthOfPayload = 0;
-
-                // Buffer to store payload "en bloc"; length is identical to UDP payload.
-                const uint32_t MAX_SIZE_PAYLOAD = 65535;
-                char buffer[MAX_SIZE_PAYLOAD];
+                // Read the payload "en bloc"; chunks avoid huge allocations for corrupt length information.
+                const uint64_t MAX_SIZE_CHUNK = 65535;
+                while (in.good() && (m_buffer.length() < length)) {
+                    const string::size_type alreadyRead = m_buffer.length();
+                    const uint64_t chunk = ((length - alreadyRead) < MAX_SIZE_CHUNK) ? (length - alreadyRead) : MAX_SIZE_CHUNK;
+                    m_buffer.resize(alreadyRead + chunk);
+                    in.read(&m_buffer[alreadyRead], chunk);
+                    m_buffer.resize(alreadyRead + in.gcount());
+                }
 
-                while (in.good() && (length > 0)) {
-                    // Start of next token by reading ID.
-                    length -= decodeVarUInt(in, tokenIdentifier);
+                m_data = m_buffer.data();
+                m_size = static_cast<uint32_t>(m_buffer.length());
+                indexPayload();
 
-                    // Read length of payload and adjust loop.
-                    lengthOfPayload = 0;
-                    length -= decodeVarUInt(in, lengthOfPayload);
+                // Check for trailing ','
+                char c = 0;
+                in.read(&c, sizeof(char));
+                if (c != ',') {
+                    CLOG2 << "Stream corrupt: trailing ',' missing,  found: '" << c << "'" << endl;
+                }
+            }
+        }
 
-                    // Create new (tokenIdentifier, m_buffer) hashmap entry.
-                    m_values.insert(make_pair(tokenIdentifier, m_buffer.tellp()));
+        uint32_t QueryableNetstringsDeserializerABCF::deserializeDataFrom(const char *data, const uint32_t &size) {
+            // Reset any existing data in our index.
+            m_values.clear();
+            m_buffer.clear();
+            m_data = NULL;
+            m_size = 0;
 
-                    // Decode payload.
-                    if (lengthOfPayload > 0) {
-                        // Read data "en bloc".
-                        in.read(buffer, lengthOfPayload);
-                        m_buffer.write(buffer, lengthOfPayload);
+            bool complete = false;
+            const uint32_t consumed = decodeFrame(data, size, complete);
+            return (complete ? consumed : 0);
+        }
 
-                        // Update amount of processed data.
-                        length -= lengthOfPayload;
-                    }
-                }
+        uint32_t QueryableNetstringsDeserializerABCF::decodeFrame(const char *data, const uint32_t &size, bool &complete) {
+            complete = false;
 
-                // Check for trailing ','
-                in.read(&c, sizeof(char));
+            // Checking for magic number.
+            uint16_t magicNumber = 0;
+            if (size < sizeof(uint16_t)) {
+                return size;
+            }
+            memcpy(&magicNumber, data, sizeof(uint16_t));
+            magicNumber = ntohs(magicNumber);
+            if (magicNumber != 0xABCF) {
+                CLOG2 << "Stream corrupt: magic number not found." << endl;
+                complete = true;
+                return sizeof(uint16_t);
+            }
+            uint32_t position = sizeof(uint16_t);
+
+            // Decoding length of the payload written as varint.
+            uint64_t length = 0;
+            position += decodeVarUInt(data + position, size - position, length);
+
+            // The payload is used in-place.
+            const uint32_t available = size - position;
+            m_data = data + position;
+            m_size = (length < available) ? static_cast<uint32_t>(length) : available;
+            indexPayload();
+            position += m_size;
+
+            // Check for trailing ','
+            if (position < size) {
+                const char c = data[position++];
                 if (c != ',') {
                     CLOG2 << "Stream corrupt: trailing ',' missing,  found: '" << c << "'" << endl;
                 }
+                complete = true;
             }
+
+            return position;
         }
 
-        QueryableNetstringsDeserializerABCF::~QueryableNetstringsDeserializerABCF() {}
+        void QueryableNetstringsDeserializerABCF::indexPayload() {
+            // Decode payload consisting of: *(ID SIZE PAYLOAD).
+            uint32_t position = 0;
+            while (position < m_size) {
+                // Start of next token by reading ID.
+                uint64_t tokenIdentifier = 0;
+                position += decodeVarUInt(m_data + position, m_size - position, tokenIdentifier);
+
+                // Read length of payload.
+                uint64_t lengthOfPayload = 0;
+                position += decodeVarUInt(m_data + position, m_size - position, lengthOfPayload);
+
+                // Truncated data is only available up to the end of the payload.
+                const uint32_t available = m_size - position;
+                const uint32_t length = (lengthOfPayload < available) ? static_cast<uint32_t>(lengthOfPayload) : available;
+
+                m_values.push_back(Entry(static_cast<uint32_t>(tokenIdentifier), position, length));
+
+                position += length;
+            }
+        }
+
+        const QueryableNetstringsDeserializerABCF::Entry* QueryableNetstringsDeserializerABCF::find(const uint32_t &fourByteID, const uint8_t &oneByteID) const {
+            const uint32_t id = (oneByteID > 0 ? oneByteID : fourByteID);
+
+            // Messages have only a few entries; thus, a linear search is faster than any tree or hash.
+            // In the case of duplicate IDs, the first entry is returned.
+            for (vector<Entry>::const_iterator it = m_values.begin(); it != m_values.end(); ++it) {
+                if (it->m_id == id) {
+                    return &(*it);
+                }
+            }
+            return NULL;
+        }
 
         uint32_t QueryableNetstringsDeserializerABCF::fillBuffer(istream& in, stringstream& buffer) {
             char _c = 0;
@@ -172,7 +281,7 @@ namespace odcore {
                     while (buffer.good()) {
                         char c = 0;
                         buffer.read(&c, sizeof(char));
-                        value |= static_cast<unsigned int>( (c & 0x7f) << (0x7 * size++) );
+                        value |= static_cast<uint64_t>(c & 0x7f) << (0x7 * size++);
                         if ( !(c & 0x80) ) break;
                     }
                     // Decode as little endian like in Protobuf's case.
@@ -266,182 +375,161 @@ namespace odcore {
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, Serializable &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
+            const Entry *e = find(fourByteID, oneByteID);
 
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                m_buffer >> v;
+            if (e != NULL) {
+                // Decode the nested Serializable directly from our payload.
+                InputMemoryStreambuf buffer(m_data + e->m_offset, e->m_length);
+                istream in(&buffer);
+                in >> v;
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, bool &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
+            const Entry *e = find(fourByteID, oneByteID);
 
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
+            if (e != NULL) {
                 uint64_t tmp = 0;
-                decodeVarUInt(m_buffer, tmp);
+                decodeVarUInt(m_data + e->m_offset, e->m_length, tmp);
                 v = static_cast<bool>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, char &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
+            const Entry *e = find(fourByteID, oneByteID);
 
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
+            if (e != NULL) {
                 int64_t tmp = 0;
-                decodeVarInt(m_buffer, tmp);
+                decodeVarInt(m_data + e->m_offset, e->m_length, tmp);
                 v = static_cast<char>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, unsigned char &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
+            const Entry *e = find(fourByteID, oneByteID);
 
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
+            if (e != NULL) {
                 uint64_t tmp = 0;
-                decodeVarUInt(m_buffer, tmp);
+                decodeVarUInt(m_data + e->m_offset, e->m_length, tmp);
                 v = static_cast<unsigned char>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, int8_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
+            const Entry *e = find(fourByteID, oneByteID);
 
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
+            if (e != NULL) {
                 int64_t tmp = 0;
-                decodeVarInt(m_buffer, tmp);
+                decodeVarInt(m_data + e->m_offset, e->m_length, tmp);
                 v = static_cast<int8_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, int16_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
+            const Entry *e = find(fourByteID, oneByteID);
 
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
+            if (e != NULL) {
                 int64_t tmp = 0;
-                decodeVarInt(m_buffer, tmp);
+                decodeVarInt(m_data + e->m_offset, e->m_length, tmp);
                 v = static_cast<int16_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, uint16_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
+            const Entry *e = find(fourByteID, oneByteID);
 
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
+            if (e != NULL) {
                 uint64_t tmp = 0;
-                decodeVarUInt(m_buffer, tmp);
+                decodeVarUInt(m_data + e->m_offset, e->m_length, tmp);
                 v = static_cast<uint16_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, int32_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
+            const Entry *e = find(fourByteID, oneByteID);
 
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
+            if (e != NULL) {
                 int64_t tmp = 0;
-                decodeVarInt(m_buffer, tmp);
+                decodeVarInt(m_data + e->m_offset, e->m_length, tmp);
                 v = static_cast<int32_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, uint32_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
+            const Entry *e = find(fourByteID, oneByteID);
 
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
+            if (e != NULL) {
                 uint64_t tmp = 0;
-                decodeVarUInt(m_buffer, tmp);
+                decodeVarUInt(m_data + e->m_offset, e->m_length, tmp);
                 v = static_cast<uint32_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, int64_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
+            const Entry *e = find(fourByteID, oneByteID);
 
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
+            if (e != NULL) {
                 int64_t tmp = 0;
-                decodeVarInt(m_buffer, tmp);
+                decodeVarInt(m_data + e->m_offset, e->m_length, tmp);
                 v = static_cast<int64_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, uint64_t &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
+            const Entry *e = find(fourByteID, oneByteID);
 
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
+            if (e != NULL) {
                 uint64_t tmp = 0;
-                decodeVarUInt(m_buffer, tmp);
+                decodeVarUInt(m_data + e->m_offset, e->m_length, tmp);
                 v = static_cast<uint64_t>(tmp);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, float &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
+            const Entry *e = find(fourByteID, oneByteID);
 
+            if (e != NULL) {
+                // Truncated data is read as far as available like from a stream.
+                const uint32_t available = m_size - e->m_offset;
                 float _f = 0;
-                m_buffer.read(reinterpret_cast<char *>(&_f), sizeof(float));
+                memcpy(&_f, m_data + e->m_offset, (available < sizeof(float)) ? available : sizeof(float));
                 _f = Deserializer::ntohf(_f);
                 v = _f;
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, double &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
+            const Entry *e = find(fourByteID, oneByteID);
 
+            if (e != NULL) {
+                // Truncated data is read as far as available like from a stream.
+                const uint32_t available = m_size - e->m_offset;
                 double _d = 0;
-                m_buffer.read(reinterpret_cast<char *>(&_d), sizeof(double));
+                memcpy(&_d, m_data + e->m_offset, (available < sizeof(double)) ? available : sizeof(double));
                 _d = Deserializer::ntohd(_d);
                 v = _d;
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, string &v) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
-
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
+            const Entry *e = find(fourByteID, oneByteID);
 
+            if (e != NULL) {
                 uint64_t stringLength = 0;
-                decodeVarUInt(m_buffer, stringLength);
+                const uint8_t sizeOfStringLength = decodeVarUInt(m_data + e->m_offset, e->m_length, stringLength);
 
-#ifdef WIN32
-                char *str = new char[stringLength+1];
-                m_buffer.read(str, stringLength);
-                str[stringLength] = '\0';
                 // It is absolutely necessary to specify the size of the serialized string, otherwise, s contains only data until the first '\0' is read.
-                v = string(str, stringLength);
-                OPENDAVINCI_CORE_DELETE_ARRAY(str);
-#else
-                string data(stringLength, '\0');
-                char* begin = &(*data.begin());
-                m_buffer.read(begin, stringLength);
-
-                v = data;
-#endif
+                const uint32_t available = e->m_length - sizeOfStringLength;
+                v.assign(m_data + e->m_offset + sizeOfStringLength, (stringLength < available) ? static_cast<uint32_t>(stringLength) : available);
             }
         }
 
         void QueryableNetstringsDeserializerABCF::read(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, void *data, const uint32_t &size) {
-            map<uint32_t, streampos>::iterator it = m_values.find( (oneByteID > 0 ? oneByteID : fourByteID) );
+            const Entry *e = find(fourByteID, oneByteID);
 
-            if (it != m_values.end()) {
-                m_buffer.seekg(it->second);
-                m_buffer.read(reinterpret_cast<char*>(data), size);
+            if (e != NULL) {
+                const uint32_t available = m_size - e->m_offset;
+                memcpy(data, m_data + e->m_offset, (size < available) ? size : available);
             }
         }
     }
@@ -29,13 +29,11 @@ class Serializable;
 
         QueryableNetstringsSerializer::QueryableNetstringsSerializer() :
             m_out(NULL),
-            m_aacf(),
             m_abcf(),
             m_serializer(&m_abcf) {}
 
         QueryableNetstringsSerializer::QueryableNetstringsSerializer(ostream &out) :
             m_out(&out),
-            m_aacf(),
             m_abcf(),
             m_serializer(&m_abcf) {}
 
@@ -17,6 +17,10 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <cstring>
+#include <ostream>
+
+#include "opendavinci/odcore/base/OutputStringStreambuf.h"
 #include "opendavinci/odcore/base/QueryableNetstringsSerializerABCF.h"
 #include "opendavinci/odcore/base/Serializable.h"
 
@@ -30,49 +34,62 @@ namespace odcore {
 
         QueryableNetstringsSerializerABCF::~QueryableNetstringsSerializerABCF() {}
 
-        uint8_t QueryableNetstringsSerializerABCF::encodeVarInt(ostream &out, int64_t value) {
+        uint8_t QueryableNetstringsSerializerABCF::encodeVarInt(char *out, int64_t value) {
             uint64_t uvalue = static_cast<uint64_t>( value < 0 ? ~(value << 1) : (value << 1) );
             return encodeVarUInt(out, uvalue);
         }
 
-        uint8_t QueryableNetstringsSerializerABCF::encodeVarUInt(ostream &out, uint64_t value) {
+        uint8_t QueryableNetstringsSerializerABCF::encodeVarUInt(char *out, uint64_t value) {
             // We will write at least one byte.
-            uint8_t size = 1;
+            uint8_t size = 0;
 
             value = htole64(value);
 
-            char byte = 0;
             while (value > 0x7f) {
                 // If the value to be written occupies more than 7 bits, we need to encode it using the MSB flag.
-                byte = (static_cast<uint8_t>(value & 0x7f)) | 0x80;
-                out.put(byte);
+                out[size++] = static_cast<char>((static_cast<uint8_t>(value & 0x7f)) | 0x80);
                 // Remove the seven bits that we have already written.
                 value >>= 7;
-                // Start next byte.
-                size++;
             }
             // Write final value.
-            byte = (static_cast<uint8_t>(value)) & 0x7f;
-            out.put(byte);
+            out[size++] = static_cast<char>((static_cast<uint8_t>(value)) & 0x7f);
             return size;
         }
 
+        void QueryableNetstringsSerializerABCF::appendVarUInt(const uint64_t &value) {
+            char tmp[MAX_SIZE_VARINT];
+            const uint8_t size = encodeVarUInt(tmp, value);
+            m_buffer.append(tmp, size);
+        }
+
+        void QueryableNetstringsSerializerABCF::appendEntry(const uint32_t &fourByteID, const uint8_t &oneByteID, const char *payload, const uint32_t &size) {
+            // ID and length are varints; thus, they can be encoded en bloc.
+            char tmp[2 * MAX_SIZE_VARINT];
+            uint8_t length = encodeVarUInt(tmp, (oneByteID > 0 ? oneByteID : fourByteID));
+            length += encodeVarUInt(tmp + length, size);
+
+            m_buffer.append(tmp, length);
+            m_buffer.append(payload, size);
+        }
+
         void QueryableNetstringsSerializerABCF::getSerializedData(ostream &o) {
-            // Write magic number.
+            // Header: Magic number followed by the varint-encoded length.
+            char header[sizeof(uint16_t) + MAX_SIZE_VARINT];
+
             uint16_t magicNumber = 0xABCF;
             magicNumber = htons(magicNumber);
-            o.write(reinterpret_cast<const char *>(&magicNumber), sizeof(uint16_t));
+            memcpy(header, &magicNumber, sizeof(uint16_t));
+
+            const uint64_t length = static_cast<uint32_t>(m_buffer.length());
+            const uint8_t sizeOfLength = encodeVarUInt(header + sizeof(uint16_t), length);
 
-            // Write length.
-            const string s = m_buffer.str();
-            uint64_t length = static_cast<uint32_t>(s.length());
-            encodeVarUInt(o, length);
+            o.write(header, sizeof(uint16_t) + sizeOfLength);
 
             // Write payload.
-            o << s;
+            o.write(m_buffer.data(), m_buffer.length());
 
             // Write End-Of-Data for checking corruptness.
-            o << ",";
+            o.put(',');
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &id, const Serializable &v) {
@@ -136,204 +153,117 @@ namespace odcore {
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const Serializable &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-
-            stringstream buffer;
-            buffer << v;
-
-            const string tmp = buffer.str();
-            uint64_t size = static_cast<uint32_t>(tmp.length());
-            encodeVarUInt(m_buffer, size);
+            appendVarUInt(oneByteID > 0 ? oneByteID : fourByteID);
+
+            // Serialize the nested Serializable directly at the end of our buffer.
+            const string::size_type start = m_buffer.length();
+            {
+                OutputStringStreambuf buffer(m_buffer);
+                ostream out(&buffer);
+                out << v;
+            }
 
-            m_buffer << tmp;
+            // Afterwards, its varint-encoded length needs to be placed in front of it.
+            char tmp[MAX_SIZE_VARINT];
+            const uint64_t size = static_cast<uint32_t>(m_buffer.length() - start);
+            const uint8_t sizeOfLength = encodeVarUInt(tmp, size);
+            m_buffer.insert(start, tmp, sizeOfLength);
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const bool &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-
-            // Get the varint-encoded length of the value and save the varint-encoded payload.
-            stringstream tmp;
-            uint32_t size = encodeVarUInt(tmp, v);
-
-            // Write the length of the payload.
-            encodeVarUInt(m_buffer, size);
-
-            // Write the payload.
-            m_buffer << tmp.str();
+            char tmp[MAX_SIZE_VARINT];
+            const uint8_t size = encodeVarUInt(tmp, v);
+            appendEntry(fourByteID, oneByteID, tmp, size);
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const char &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-
-            // Get the varint-encoded length of the value and save the varint-encoded payload.
-            stringstream tmp;
-            uint32_t size = encodeVarInt(tmp, v);
-
-            // Write the length of the payload.
-            encodeVarUInt(m_buffer, size);
-
-            // Write the payload.
-            m_buffer << tmp.str();
+            char tmp[MAX_SIZE_VARINT];
+            const uint8_t size = encodeVarInt(tmp, v);
+            appendEntry(fourByteID, oneByteID, tmp, size);
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const unsigned char &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-
-            // Get the varint-encoded length of the value and save the varint-encoded payload.
-            stringstream tmp;
-            uint32_t size = encodeVarUInt(tmp, v);
-
-            // Write the length of the payload.
-            encodeVarUInt(m_buffer, size);
-
-            // Write the payload.
-            m_buffer << tmp.str();
+            char tmp[MAX_SIZE_VARINT];
+            const uint8_t size = encodeVarUInt(tmp, v);
+            appendEntry(fourByteID, oneByteID, tmp, size);
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const int8_t &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-
-            // Get the varint-encoded length of the value and save the varint-encoded payload.
-            stringstream tmp;
-            uint32_t size = encodeVarInt(tmp, v);
-
-            // Write the length of the payload.
-            encodeVarUInt(m_buffer, size);
-
-            // Write the payload.
-            m_buffer << tmp.str();
+            char tmp[MAX_SIZE_VARINT];
+            const uint8_t size = encodeVarInt(tmp, v);
+            appendEntry(fourByteID, oneByteID, tmp, size);
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const int16_t &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-
-            // Get the varint-encoded length of the value and save the varint-encoded payload.
-            stringstream tmp;
-            uint32_t size = encodeVarInt(tmp, v);
-
-            // Write the length of the payload.
-            encodeVarUInt(m_buffer, size);
-
-            // Write the payload.
-            m_buffer << tmp.str();
+            char tmp[MAX_SIZE_VARINT];
+            const uint8_t size = encodeVarInt(tmp, v);
+            appendEntry(fourByteID, oneByteID, tmp, size);
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const uint16_t &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-
-            // Get the varint-encoded length of the value and save the varint-encoded payload.
-            stringstream tmp;
-            uint32_t size = encodeVarUInt(tmp, v);
-
-            // Write the length of the payload.
-            encodeVarUInt(m_buffer, size);
-
-            // Write the payload.
-            m_buffer << tmp.str();
+            char tmp[MAX_SIZE_VARINT];
+            const uint8_t size = encodeVarUInt(tmp, v);
+            appendEntry(fourByteID, oneByteID, tmp, size);
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const int32_t &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-
-            // Get the varint-encoded length of the value and save the varint-encoded payload.
-            stringstream tmp;
-            uint32_t size = encodeVarInt(tmp, v);
-
-            // Write the length of the payload.
-            encodeVarUInt(m_buffer, size);
-
-            // Write the payload.
-            m_buffer << tmp.str();
+            char tmp[MAX_SIZE_VARINT];
+            const uint8_t size = encodeVarInt(tmp, v);
+            appendEntry(fourByteID, oneByteID, tmp, size);
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const uint32_t &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-
-            // Get the varint-encoded length of the value and save the varint-encoded payload.
-            stringstream tmp;
-            uint32_t size = encodeVarUInt(tmp, v);
-
-            // Write the length of the payload.
-            encodeVarUInt(m_buffer, size);
-
-            // Write the payload.
-            m_buffer << tmp.str();
+            char tmp[MAX_SIZE_VARINT];
+            const uint8_t size = encodeVarUInt(tmp, v);
+            appendEntry(fourByteID, oneByteID, tmp, size);
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const int64_t &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-
-            // Get the varint-encoded length of the value and save the varint-encoded payload.
-            stringstream tmp;
-            uint32_t size = encodeVarInt(tmp, v);
-
-            // Write the length of the payload.
-            encodeVarUInt(m_buffer, size);
-
-            // Write the payload.
-            m_buffer << tmp.str();
+            char tmp[MAX_SIZE_VARINT];
+            const uint8_t size = encodeVarInt(tmp, v);
+            appendEntry(fourByteID, oneByteID, tmp, size);
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const uint64_t &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-
-            // Get the varint-encoded length of the value and save the varint-encoded payload.
-            stringstream tmp;
-            uint32_t size = encodeVarUInt(tmp, v);
-
-            // Write the length of the payload.
-            encodeVarUInt(m_buffer, size);
-
-            // Write the payload.
-            m_buffer << tmp.str();
+            char tmp[MAX_SIZE_VARINT];
+            const uint8_t size = encodeVarUInt(tmp, v);
+            appendEntry(fourByteID, oneByteID, tmp, size);
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const float &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-            encodeVarUInt(m_buffer, sizeof(float));
-
             float _f = v;
             _f = Serializer::htonf(_f);
-            m_buffer.write(reinterpret_cast<const char *>(&_f), sizeof(const float));
+            appendEntry(fourByteID, oneByteID, reinterpret_cast<const char *>(&_f), sizeof(const float));
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const double &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-            encodeVarUInt(m_buffer, sizeof(double));
-
             double _d = v;
             _d = Serializer::htond(_d);
-            m_buffer.write(reinterpret_cast<const char *>(&_d), sizeof(const double));
+            appendEntry(fourByteID, oneByteID, reinterpret_cast<const char *>(&_d), sizeof(const double));
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const string &v) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
+            appendVarUInt(oneByteID > 0 ? oneByteID : fourByteID);
 
             // Length of the raw string.
             const uint32_t stringLength = v.length();
 
             // Get the varint-encoded length of the string length that will be part of the payload.
-            stringstream tmp;
-            uint32_t size = encodeVarUInt(tmp, stringLength);
-
-            // Add the actual string length.
-            size += stringLength;
+            char tmp[MAX_SIZE_VARINT];
+            const uint8_t sizeOfStringLength = encodeVarUInt(tmp, stringLength);
 
             // Write the total length of the payload containing the varint-encoded string length + the raw string.
-            encodeVarUInt(m_buffer, size);
+            appendVarUInt(sizeOfStringLength + stringLength);
 
             // Write the string length (which is actually part of the payload).
-            m_buffer << tmp.str();
+            m_buffer.append(tmp, sizeOfStringLength);
 
             // Write the raw bytes from the string.
-            m_buffer.write(v.c_str(), stringLength);
+            m_buffer.append(v.data(), stringLength);
         }
 
         void QueryableNetstringsSerializerABCF::write(const uint32_t &fourByteID, const uint8_t &oneByteID, const string &/*longName*/, const string &/*shortName*/, const void *data, const uint32_t &size) {
-            encodeVarUInt(m_buffer, (oneByteID > 0 ? oneByteID : fourByteID));
-            encodeVarUInt(m_buffer, size);
-
-            m_buffer.write(reinterpret_cast<const char*>(data), size);
+            appendEntry(fourByteID, oneByteID, reinterpret_cast<const char*>(data), size);
         }
 
     }
@@ -0,0 +1,157 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <algorithm>
+#include <thread>
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/WorkPool.h"
+
+namespace odcore {
+    namespace base {
+
+        using namespace std;
+
+        WorkPool::Task::~Task() {}
+
+        WorkPool::Worker::Worker(WorkPool &pool) :
+            Service(),
+            m_pool(pool) {}
+
+        WorkPool::Worker::~Worker() {}
+
+        void WorkPool::Worker::beforeStop() {
+            Lock l(m_pool.m_jobCondition);
+            m_pool.m_jobCondition.wakeAll();
+        }
+
+        void WorkPool::Worker::run() {
+            serviceReady();
+
+            uint32_t generation = 0;
+            while (isRunning()) {
+                {
+                    // Join every job only once and only while it is being executed.
+                    Lock l(m_pool.m_jobCondition);
+                    while (isRunning() && (!m_pool.m_jobActive || (m_pool.m_generation == generation))) {
+                        m_pool.m_jobCondition.waitOnSignal();
+                    }
+                    if (!isRunning()) {
+                        break;
+                    }
+                    generation = m_pool.m_generation;
+                    m_pool.m_busyWorkers++;
+                }
+
+                m_pool.processItems();
+
+                Lock l(m_pool.m_jobCondition);
+                m_pool.m_busyWorkers--;
+                m_pool.m_jobCondition.wakeAll();
+            }
+        }
+
+        WorkPool::WorkPool(const uint32_t &numberOfThreads) :
+            m_workers(),
+            m_executeMutex(),
+            m_jobCondition(),
+            m_generation(0),
+            m_jobActive(false),
+            m_busyWorkers(0),
+            m_task(NULL),
+            m_numberOfItems(0),
+            m_nextItem(0),
+            m_exceptions() {
+            uint32_t threads = numberOfThreads;
+            if (threads == 0) {
+                threads = max(std::thread::hardware_concurrency(), 1u);
+            }
+
+            // The calling thread processes items as well.
+            for (uint32_t i = 1; i < threads; i++) {
+                std::shared_ptr<Worker> worker(new Worker(*this));
+                worker->start();
+                m_workers.push_back(worker);
+            }
+        }
+
+        WorkPool::~WorkPool() {
+            for (uint32_t i = 0; i < m_workers.size(); i++) {
+                m_workers.at(i)->stop();
+            }
+            m_workers.clear();
+        }
+
+        uint32_t WorkPool::getNumberOfThreads() const {
+            return m_workers.size() + 1;
+        }
+
+        void WorkPool::execute(Task &task, const uint32_t &numberOfItems) {
+            Lock l(m_executeMutex);
+
+            {
+                Lock ll(m_jobCondition);
+                m_task = &task;
+                m_numberOfItems = numberOfItems;
+                m_exceptions.assign(numberOfItems, std::exception_ptr());
+                m_nextItem = 0;
+
+                m_jobActive = true;
+                m_generation++;
+                m_jobCondition.wakeAll();
+            }
+
+            processItems();
+
+            {
+                // Barrier: All items are taken; wait for the workers still processing.
+                Lock ll(m_jobCondition);
+                while (m_busyWorkers > 0) {
+                    m_jobCondition.waitOnSignal();
+                }
+                m_jobActive = false;
+                m_task = NULL;
+            }
+
+            for (uint32_t i = 0; i < m_exceptions.size(); i++) {
+                if (m_exceptions.at(i)) {
+                    std::rethrow_exception(m_exceptions.at(i));
+                }
+            }
+        }
+
+        void WorkPool::processItems() {
+            while (true) {
+                const uint32_t item = m_nextItem.fetch_add(1);
+                if (item >= m_numberOfItems) {
+                    break;
+                }
+
+                try {
+                    m_task->process(item);
+                }
+                catch(...) {
+                    m_exceptions[item] = std::current_exception();
+                }
+            }
+        }
+
+    }
+} // odcore::base
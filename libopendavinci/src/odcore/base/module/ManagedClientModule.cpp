@@ -39,7 +39,11 @@
 #include "opendavinci/odcore/data/TimeStamp.h"
 #include "opendavinci/odcore/dmcp/connection/Client.h"
 #include "opendavinci/odcore/exceptions/Exceptions.h"
+#include "opendavinci/odcore/io/conference/ContainerConferenceFactory.h"
 #include "opendavinci/odcore/opendavinci.h"
+#ifndef WIN32
+    #include "opendavinci/odcore/wrapper/POSIX/POSIXReactor.h"
+#endif
 #include "opendavinci/generated/odcore/data/dmcp/ModuleStateMessage.h"
 #include "opendavinci/generated/odcore/data/dmcp/RuntimeStatistic.h"
 #include "opendavinci/generated/odcore/data/dmcp/ServerInformation.h"
@@ -65,6 +69,7 @@ namespace odcore {
                 m_lastCycle(),
                 m_lastWaitTime(0),
                 m_cycleCounter(0),
+                m_numberOfDroppedContainers(0),
                 m_profilingFile(NULL),
                 m_firstCallToBreakpoint_ManagedLevel_Pulse(true),
                 m_time(),
@@ -116,6 +121,10 @@ namespace odcore {
                 return m_startOfLastCycle;
             }
 
+            void ManagedClientModule::setNumberOfDroppedContainers(const uint32_t &numberOfDroppedContainers) {
+                m_numberOfDroppedContainers = numberOfDroppedContainers;
+            }
+
             void ManagedClientModule::wait() {
                 // Sanity check for realtime execution.
                 if (isRealtime() && getServerInformation().getManagedLevel() != odcore::data::dmcp::ServerInformation::ML_NONE) {
@@ -154,6 +163,30 @@ namespace odcore {
             }
 
             odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode ManagedClientModule::runModuleImplementation() {
+#ifndef WIN32
+                // Number of threads receiving data from all sockets of this module.
+                try {
+                    odcore::wrapper::POSIX::POSIXReactor::getInstance().setNumberOfThreads(getKeyValueConfiguration().getValue<uint32_t>("global.reactor.threads"));
+                }
+                catch(...) {
+                    // If "global.reactor.threads" is not specified, one thread is used.
+                }
+#endif
+
+                // The configuration from supercomponent might select a different transport or different socket parameters for our conference.
+                if (m_hasExternalContainerConference && m_containerConference.get()) {
+                    if (odcore::io::conference::ContainerConferenceFactory::getInstance().configureTransport(getMultiCastGroup(), getKeyValueConfiguration(), getServerInformation().getIP())) {
+                        std::shared_ptr<odcore::io::conference::ContainerConference> containerConference = odcore::io::conference::ContainerConferenceFactory::getInstance().getContainerConference(getMultiCastGroup());
+                        if (containerConference.get()) {
+                            containerConference->setContainerListener(m_containerConference->getContainerListener());
+                            m_containerConference->setContainerListener(NULL);
+                            m_containerConference = containerConference;
+
+                            CLOG2 << "Existing ContainerConference replaced according to the configured transport." << endl;
+                        }
+                    }
+                }
+
                 // Sanity check for realtime execution.
                 if (isRealtime() && getServerInformation().getManagedLevel() != odcore::data::dmcp::ServerInformation::ML_NONE) {
                     OPENDAVINCI_CORE_THROW_EXCEPTION(InvalidArgumentException,
@@ -357,6 +390,7 @@ namespace odcore {
                 if (sendStatistics && getDMCPClient().get()) {
                     odcore::data::dmcp::RuntimeStatistic rts;
                     rts.setSliceConsumption(static_cast<float>(TIME_CONSUMPTION_OF_CURRENT_SLICE)/static_cast<float>(NOMINAL_DURATION_OF_ONE_SLICE));
+                    rts.setNumberOfDroppedContainers(m_numberOfDroppedContainers.load());
                     getDMCPClient()->sendStatistics(rts);
                 }
 
@@ -38,48 +38,57 @@ namespace odcore {
             TimeTriggeredConferenceClientModule::TimeTriggeredConferenceClientModule(const int32_t &argc, char **argv, const string &name) throw (InvalidArgumentException, NoDatabaseAvailableException) :
                 AbstractConferenceClientModule(argc, argv, name),
                 m_dataStoresMutex(),
-                m_listOfDataStores(),
-                m_mapOfListOfDataStores(),
+                m_dispatchTable(NULL),
+                m_dispatchTables(),
                 m_keyValueDataStore() {
+                publish(new DispatchTable());
+
                 // Create an in-memory database.
                 m_keyValueDataStore = std::shared_ptr<KeyValueDataStore>(new KeyValueDataStore(wrapper::KeyValueDatabaseFactory::createKeyValueDatabase()));
             }
 
+            TimeTriggeredConferenceClientModule::DispatchTable::DispatchTable() :
+                m_listOfDataStores(),
+                m_mapOfListOfDataStores() {}
+
             TimeTriggeredConferenceClientModule::~TimeTriggeredConferenceClientModule() {
-                // Database will be cleaned up by std::shared_ptr.
-                {
-                    Lock l(m_dataStoresMutex);
-                    m_listOfDataStores.clear();
-
-                    map<int32_t, vector<AbstractDataStore*> >::iterator it = m_mapOfListOfDataStores.begin();
-                    while (it != m_mapOfListOfDataStores.end()) {
-                        vector<AbstractDataStore*> listOfDataStores = it->second;
-                        listOfDataStores.clear();
-                        ++it;
-                    }
-                    m_mapOfListOfDataStores.clear();
+                // Detach from the conference before the dispatch tables are
+                // released: This waits for a container that is dispatched right
+                // now and no further containers are delivered to this module.
+                if (getContainerConference().get()) {
+                    getContainerConference()->setContainerListener(NULL);
                 }
+
+                // Database and dispatch tables will be cleaned up by std::shared_ptr.
+                Lock l(m_dataStoresMutex);
+                m_dispatchTable.store(NULL, memory_order_release);
+            }
+
+            void TimeTriggeredConferenceClientModule::publish(DispatchTable *table) {
+                m_dispatchTables.push_back(std::shared_ptr<const DispatchTable>(table));
+                m_dispatchTable.store(table, memory_order_release);
             }
 
             void TimeTriggeredConferenceClientModule::nextContainer(Container &c) {
                 // Distribute data to datastores.
-                {
-                    Lock l(m_dataStoresMutex);
-
-                    vector<AbstractDataStore*>::iterator it = m_listOfDataStores.begin();
-                    while (it != m_listOfDataStores.end()) {
+                const DispatchTable *table = m_dispatchTable.load(memory_order_acquire);
+                if (table != NULL) {
+                    vector<AbstractDataStore*>::const_iterator it = table->m_listOfDataStores.begin();
+                    while (it != table->m_listOfDataStores.end()) {
                         AbstractDataStore *ads = (*it++);
                         if (ads != NULL) {
                             ads->add(c); // Currently waiting threads are awaken automagically.
                         }
                     }
 
-                    vector<AbstractDataStore*> listOfDataStores = m_mapOfListOfDataStores[c.getDataType()];
-                    vector<AbstractDataStore*>::iterator jt = listOfDataStores.begin();
-                    while (jt != listOfDataStores.end()) {
-                        AbstractDataStore *ads = (*jt++);
-                        if (ads != NULL) {
-                            ads->add(c); // Currently waiting threads are awaken automagically.
+                    map<int32_t, vector<AbstractDataStore*> >::const_iterator jt = table->m_mapOfListOfDataStores.find(c.getDataType());
+                    if (jt != table->m_mapOfListOfDataStores.end()) {
+                        vector<AbstractDataStore*>::const_iterator kt = jt->second.begin();
+                        while (kt != jt->second.end()) {
+                            AbstractDataStore *ads = (*kt++);
+                            if (ads != NULL) {
+                                ads->add(c); // Currently waiting threads are awaken automagically.
+                            }
                         }
                     }
                 }
@@ -93,15 +102,19 @@ namespace odcore {
             void TimeTriggeredConferenceClientModule::addDataStoreFor(AbstractDataStore &dataStore) {
                 Lock l(m_dataStoresMutex);
 
-                m_listOfDataStores.push_back(&dataStore);
+                // Copy on write.
+                DispatchTable *table = new DispatchTable(*m_dispatchTable.load(memory_order_acquire));
+                table->m_listOfDataStores.push_back(&dataStore);
+                publish(table);
             }
 
             void TimeTriggeredConferenceClientModule::addDataStoreFor(const int32_t &datatype, AbstractDataStore &dataStore) {
                 Lock l(m_dataStoresMutex);
 
-                vector<AbstractDataStore*> listOfDataStores = m_mapOfListOfDataStores[datatype];
-                listOfDataStores.push_back(&dataStore);
-                m_mapOfListOfDataStores[datatype] = listOfDataStores;
+                // Copy on write.
+                DispatchTable *table = new DispatchTable(*m_dispatchTable.load(memory_order_acquire));
+                table->m_mapOfListOfDataStores[datatype].push_back(&dataStore);
+                publish(table);
             }
 
             KeyValueDataStore& TimeTriggeredConferenceClientModule::getKeyValueDataStore() {
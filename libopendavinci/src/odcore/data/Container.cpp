@@ -18,10 +18,15 @@
  */
 
 #include <iosfwd>
+#include <istream>
+#include <ostream>
+#include <utility>
 
 #include <memory>
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/Hash.h"
+#include "opendavinci/odcore/base/InputMemoryStreambuf.h"
+#include "opendavinci/odcore/base/OutputStringStreambuf.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
 #include "opendavinci/odcore/data/Container.h"
@@ -36,39 +41,68 @@ namespace odcore {
         Container::Container() :
                 m_dataType(UNDEFINEDDATA),
                 m_serializedData(),
+                m_decodedData(),
+                m_decodedDataType(NULL),
                 m_sent(TimeStamp(0, 0)),
                 m_received(TimeStamp(0, 0)) {}
 
         Container::Container(const SerializableData &serializableData) :
                 m_dataType(serializableData.getID()),
                 m_serializedData(),
+                m_decodedData(),
+                m_decodedDataType(NULL),
                 m_sent(TimeStamp(0, 0)),
                 m_received(TimeStamp(0, 0)) {
             // Get data for container.
-            m_serializedData << serializableData;
+            setSerializedData(serializableData);
         }
 
         Container::Container(const SerializableData &serializableData, const int32_t &dataType) :
                 m_dataType(dataType),
                 m_serializedData(),
+                m_decodedData(),
+                m_decodedDataType(NULL),
                 m_sent(TimeStamp(0, 0)),
                 m_received(TimeStamp(0, 0)) {
             // Get data for container.
-            m_serializedData << serializableData;
+            setSerializedData(serializableData);
         }
 
         Container::Container(const Container &obj) :
                 Serializable(),
                 m_dataType(obj.getDataType()),
-                m_serializedData(),
+                m_serializedData(obj.m_serializedData),
+                m_decodedData(obj.m_decodedData),
+                m_decodedDataType(obj.m_decodedDataType),
                 m_sent(obj.m_sent),
-                m_received(obj.m_received) {
-            m_serializedData.str(obj.m_serializedData.str());
-        }
+                m_received(obj.m_received) {}
+
+        Container::Container(Container &&obj) :
+                Serializable(),
+                m_dataType(obj.getDataType()),
+                m_serializedData(std::move(obj.m_serializedData)),
+                m_decodedData(std::move(obj.m_decodedData)),
+                m_decodedDataType(obj.m_decodedDataType),
+                m_sent(obj.m_sent),
+                m_received(obj.m_received) {}
 
         Container& Container::operator=(const Container &obj) {
             m_dataType = obj.getDataType();
-            m_serializedData.str(obj.m_serializedData.str());
+            // The payload is immutable; thus, it can be shared with obj.
+            m_serializedData = obj.m_serializedData;
+            m_decodedData = obj.m_decodedData;
+            m_decodedDataType = obj.m_decodedDataType;
+            setSentTimeStamp(obj.getSentTimeStamp());
+            setReceivedTimeStamp(obj.getReceivedTimeStamp());
+
+            return (*this);
+        }
+
+        Container& Container::operator=(Container &&obj) {
+            m_dataType = obj.getDataType();
+            m_serializedData = std::move(obj.m_serializedData);
+            m_decodedData = std::move(obj.m_decodedData);
+            m_decodedDataType = obj.m_decodedDataType;
             setSentTimeStamp(obj.getSentTimeStamp());
             setReceivedTimeStamp(obj.getReceivedTimeStamp());
 
@@ -77,10 +111,49 @@ namespace odcore {
 
         Container::~Container() {}
 
+        bool Container::isCached(const std::type_info &type) const {
+            return ( (m_decodedData.get() != NULL) && (*m_decodedDataType == type) );
+        }
+
+        void Container::decodeData(Serializable &s) const {
+            if (m_serializedData.get() != NULL) {
+                // Read from the shared payload without copying it.
+                InputMemoryStreambuf buffer(m_serializedData->data(), m_serializedData->length());
+                istream in(&buffer);
+                in >> s;
+            }
+        }
+
+        void Container::cacheData(Serializable *s, const std::type_info &type) {
+            std::shared_ptr<Serializable> decodedData(s);
+            decodeData(*decodedData);
+            m_decodedData = decodedData;
+            m_decodedDataType = &type;
+        }
+
+        void Container::setSerializedData(const SerializableData &serializableData) {
+            // Serialize directly into the new payload; it is not modified afterwards.
+            std::shared_ptr<string> serializedData(new string());
+            {
+                OutputStringStreambuf buffer(*serializedData);
+                ostream out(&buffer);
+                out << serializableData;
+            }
+            m_serializedData = serializedData;
+
+            // Any previously decoded data does not belong to this payload.
+            m_decodedData.reset();
+            m_decodedDataType = NULL;
+        }
+
         int32_t Container::getDataType() const {
             return m_dataType;
         }
 
+        uint32_t Container::getSizeOfData() const {
+            return (m_serializedData.get() != NULL) ? static_cast<uint32_t>(m_serializedData->length()) : 0;
+        }
+
         const TimeStamp Container::getSentTimeStamp() const {
             return m_sent;
         }
@@ -109,9 +182,10 @@ namespace odcore {
                      dataType);
 
             // Write container data.
+            const string noData;
             s->write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('d', 'a', 't', 'a') >::RESULT,
                      2, "Container.data", "data",
-                     m_serializedData.str());
+                     (m_serializedData.get() != NULL) ? *m_serializedData : noData);
 
             // Write sent time stamp data.
             s->write(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('s', 'e', 'n', 't') >::RESULT,
@@ -141,7 +215,9 @@ namespace odcore {
             d->read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('d', 'a', 't', 'a') >::RESULT,
                     2, "Container.data", "data",
                     rawData);
-            m_serializedData.str(rawData);
+            m_serializedData = std::shared_ptr<const string>(new string(std::move(rawData)));
+            m_decodedData.reset();
+            m_decodedDataType = NULL;
 
             // Read sent time stamp data.
             d->read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('s', 'e', 'n', 't') >::RESULT,
@@ -0,0 +1,212 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/data/image/SharedImageChannel.h"
+#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+
+namespace odcore {
+    namespace data {
+        namespace image {
+
+            using namespace std;
+            using namespace odcore::base;
+
+            SharedImageChannel::Header::Header(const uint32_t &numberOfSlots, const uint32_t &slotSize) :
+                m_magic(MAGIC),
+                m_numberOfSlots(numberOfSlots),
+                m_slotSize(slotSize),
+                m_latest(0) {}
+
+            SharedImageChannel::SharedImageChannel(const SharedImage &si, const uint32_t &numberOfSlots) :
+                m_sharedImage(si),
+                m_sharedMemory(),
+                m_header(NULL),
+                m_numberOfSlots(max(numberOfSlots, static_cast<uint32_t>(2))),
+                m_slotSize(0),
+                m_sequence(0) {
+                m_slotSize = (si.getSize() > 0) ? si.getSize() : (si.getWidth() * si.getHeight() * si.getBytesPerPixel());
+                m_sharedImage.setSize(m_slotSize);
+                m_sharedImage.setSlot(0);
+                m_sharedImage.setSequence(0);
+
+                // Space to align the header, the header itself, and one cache line per slot for its sequence number.
+                const uint32_t overhead = (2 + m_numberOfSlots) * ALIGNMENT;
+                m_sharedMemory = odcore::wrapper::SharedMemoryFactory::createSharedMemory(si.getName(), overhead + m_numberOfSlots * getAlignedSize(m_slotSize));
+
+                if ( (m_sharedMemory.get() != NULL) && m_sharedMemory->isValid() ) {
+                    // Mappings start at page boundaries; thus, all participants find the header at the same offset.
+                    char *begin = static_cast<char*>(m_sharedMemory->getSharedMemory());
+                    const uintptr_t offset = (ALIGNMENT - (reinterpret_cast<uintptr_t>(begin) % ALIGNMENT)) % ALIGNMENT;
+
+                    // Publish the layout only after all sequence numbers are reset.
+                    m_header = reinterpret_cast<Header*>(begin + offset);
+                    m_header->m_magic = 0;
+                    for (uint32_t slot = 0; slot < m_numberOfSlots; slot++) {
+                        new (&getVersion(slot)) std::atomic<uint64_t>(0);
+                    }
+                    new (m_header) Header(m_numberOfSlots, m_slotSize);
+                }
+            }
+
+            SharedImageChannel::SharedImageChannel(const SharedImage &si) :
+                m_sharedImage(si),
+                m_sharedMemory(),
+                m_header(NULL),
+                m_numberOfSlots(0),
+                m_slotSize(0),
+                m_sequence(0) {
+                m_slotSize = (si.getSize() > 0) ? si.getSize() : (si.getWidth() * si.getHeight() * si.getBytesPerPixel());
+                m_sharedImage.setSize(m_slotSize);
+
+                m_sharedMemory = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
+
+                if ( (si.getSequence() > 0) && (m_sharedMemory.get() != NULL) && m_sharedMemory->isValid() ) {
+                    char *begin = static_cast<char*>(m_sharedMemory->getSharedMemory());
+                    const uintptr_t offset = (ALIGNMENT - (reinterpret_cast<uintptr_t>(begin) % ALIGNMENT)) % ALIGNMENT;
+                    Header *header = reinterpret_cast<Header*>(begin + offset);
+
+                    const uint64_t required = offset + static_cast<uint64_t>(1 + header->m_numberOfSlots) * ALIGNMENT +
+                                              static_cast<uint64_t>(header->m_numberOfSlots) * getAlignedSize(header->m_slotSize);
+                    if ( (header->m_magic == static_cast<uint32_t>(MAGIC)) &&
+                         (header->m_slotSize == m_slotSize) &&
+                         (required <= m_sharedMemory->getSize()) ) {
+                        m_header = header;
+                        m_numberOfSlots = header->m_numberOfSlots;
+                    }
+                    else {
+                        // The shared memory does not belong to a SharedImageChannel.
+                        m_sharedMemory.reset();
+                    }
+                }
+            }
+
+            SharedImageChannel::~SharedImageChannel() {}
+
+            bool SharedImageChannel::isValid() const {
+                return ( (m_sharedMemory.get() != NULL) && m_sharedMemory->isValid() &&
+                         ( (m_header != NULL) || (m_sharedImage.getSequence() == 0) ) );
+            }
+
+            const SharedImage SharedImageChannel::getSharedImage() const {
+                return m_sharedImage;
+            }
+
+            uint32_t SharedImageChannel::getNumberOfSlots() const {
+                return m_numberOfSlots;
+            }
+
+            uint32_t SharedImageChannel::getAlignedSize(const uint32_t &size) {
+                return ((size + ALIGNMENT - 1) / ALIGNMENT) * ALIGNMENT;
+            }
+
+            std::atomic<uint64_t>& SharedImageChannel::getVersion(const uint32_t &slot) const {
+                return *reinterpret_cast<std::atomic<uint64_t>*>(reinterpret_cast<char*>(m_header) + (1 + slot) * ALIGNMENT);
+            }
+
+            char* SharedImageChannel::getSlot(const uint32_t &slot) const {
+                return reinterpret_cast<char*>(m_header) + (1 + m_numberOfSlots) * ALIGNMENT + slot * getAlignedSize(m_slotSize);
+            }
+
+            char* SharedImageChannel::beginWrite() {
+                if (m_header == NULL) {
+                    return NULL;
+                }
+
+                // The sequence number is odd while the slot is being written.
+                const uint64_t next = m_header->m_latest.load(memory_order_relaxed) + 1;
+                const uint32_t slot = static_cast<uint32_t>(next % m_numberOfSlots);
+                getVersion(slot).store(2 * next - 1, memory_order_relaxed);
+                atomic_thread_fence(memory_order_release);
+
+                return getSlot(slot);
+            }
+
+            const SharedImage SharedImageChannel::endWrite() {
+                SharedImage si = m_sharedImage;
+                if (m_header != NULL) {
+                    const uint64_t next = m_header->m_latest.load(memory_order_relaxed) + 1;
+                    const uint32_t slot = static_cast<uint32_t>(next % m_numberOfSlots);
+                    getVersion(slot).store(2 * next, memory_order_release);
+                    m_header->m_latest.store(next, memory_order_release);
+
+                    si.setSlot(slot);
+                    si.setSequence(next);
+                }
+                return si;
+            }
+
+            const SharedImage SharedImageChannel::write(const char *data, const uint32_t &size) {
+                char *slot = beginWrite();
+                if (slot != NULL) {
+                    ::memcpy(slot, data, min(size, m_slotSize));
+                }
+                return endWrite();
+            }
+
+            bool SharedImageChannel::read(char *buffer, const uint32_t &size) {
+                if (!isValid()) {
+                    return false;
+                }
+
+                const uint32_t length = min(size, m_slotSize);
+
+                if (m_header == NULL) {
+                    // Shared memory containing just the image.
+                    Lock l(m_sharedMemory);
+                    ::memcpy(buffer, m_sharedMemory->getSharedMemory(), min(length, m_sharedMemory->getSize()));
+                    return true;
+                }
+
+                for (uint32_t retries = 0; retries < MAX_RETRIES; retries++) {
+                    const uint64_t latest = m_header->m_latest.load(memory_order_acquire);
+                    if (latest == 0) {
+                        return false;
+                    }
+
+                    const uint32_t slot = static_cast<uint32_t>(latest % m_numberOfSlots);
+                    const uint64_t before = getVersion(slot).load(memory_order_acquire);
+                    if (before != 2 * latest) {
+                        // The producer has already started to overwrite this slot.
+                        continue;
+                    }
+
+                    ::memcpy(buffer, getSlot(slot), length);
+
+                    atomic_thread_fence(memory_order_acquire);
+                    if (getVersion(slot).load(memory_order_relaxed) == before) {
+                        m_sequence = latest;
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            uint64_t SharedImageChannel::getSequence() const {
+                return m_sequence;
+            }
+
+        }
+    }
+} // odcore::data::image
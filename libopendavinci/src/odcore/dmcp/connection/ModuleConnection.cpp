@@ -88,72 +88,87 @@ namespace odcore {
             }
 
             void ModuleConnection::pulse_ack(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout) {
-                // Unfortunately, we cannot prevent code duplication here (cf. pulse_ack_containers)
+                sendPulseAck(pm);
+                waitForPulseAck(TimeStamp() + TimeStamp(static_cast<int32_t>(timeout / 1000), static_cast<int32_t>((timeout % 1000) * 1000)));
+            }
+
+            vector<odcore::data::Container> ModuleConnection::pulse_ack_containers(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout) {
+                sendPulseAckContainers(pm);
+                return waitForPulseAckContainers(TimeStamp() + TimeStamp(static_cast<int32_t>(timeout / 1000), static_cast<int32_t>((timeout % 1000) * 1000)));
+            }
+
+            void ModuleConnection::sendPulseAck(const odcore::data::dmcp::PulseMessage &pm) {
+                // Unfortunately, we cannot prevent code duplication here (cf. sendPulseAckContainers)
                 // as in this case, the dependent client module will NOT send its containers to using
                 // this TCP link but via the regular UDP multicast conference.
-                bool connectionLost = true;
-
                 {
-                    Lock l(m_connectionLostMutex);
-                    connectionLost = m_connectionLost;
+                    Lock l(m_pulseAckCondition);
+                    m_hasReceivedPulseAck = false;
                 }
 
-                // Only wait for a confirmation from dependent modules when they are still connected.
-                if (!connectionLost) {
-                    {
-                        Lock l(m_pulseAckCondition);
-                        m_hasReceivedPulseAck = false;
-                    }
-
+                // Only send to dependent modules when they are still connected.
+                if (!isConnectionLost()) {
                     Container c(pm);
                     m_connection->send(c);
+                }
+            }
 
-                    // Wait for the ACK message from client.
-                    {
-                        Lock l(m_pulseAckCondition);
-                        if (!m_hasReceivedPulseAck) {
-                            m_pulseAckCondition.waitOnSignalWithTimeout(timeout);
-                        }
+            void ModuleConnection::waitForPulseAck(const TimeStamp &deadline) {
+                // Wait for the ACK message from client.
+                Lock l(m_pulseAckCondition);
+                while (!m_hasReceivedPulseAck && !isConnectionLost()) {
+                    const uint32_t remaining = getRemainingMilliseconds(deadline);
+                    if (remaining == 0) {
+                        break;
                     }
+                    m_pulseAckCondition.waitOnSignalWithTimeout(remaining);
                 }
             }
 
-            vector<odcore::data::Container> ModuleConnection::pulse_ack_containers(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout) {
-                // Unfortunately, we cannot prevent code duplication here (cf. pulse_ack)
+            void ModuleConnection::sendPulseAckContainers(const odcore::data::dmcp::PulseMessage &pm) {
+                // Unfortunately, we cannot prevent code duplication here (cf. sendPulseAck)
                 // as in this case, the dependent client module will send all its containers
                 // via this TCP link and NOT via the regular UDP multicast conference.
-
-                // Assume that we don't receive any further containers.
-                m_containersToBeTransferredToSupercomponent.clear();
-
-                bool connectionLost = true;
                 {
-                    Lock l(m_connectionLostMutex);
-                    connectionLost = m_connectionLost;
-                }
+                    Lock l(m_pulseAckContainersCondition);
+                    m_hasReceivedPulseAckContainers = false;
 
-                // Only wait for a confirmation from dependent modules when they are still connected.
-                if (!connectionLost) {
-                    {
-                        Lock l(m_pulseAckContainersCondition);
-                        m_hasReceivedPulseAckContainers = false;
-                    }
+                    // Assume that we don't receive any further containers.
+                    m_containersToBeTransferredToSupercomponent.clear();
+                }
 
+                // Only send to dependent modules when they are still connected.
+                if (!isConnectionLost()) {
                     Container c(pm);
                     m_connection->send(c);
+                }
+            }
 
-                    // Wait for the ACK message from client.
-                    {
-                        Lock l(m_pulseAckContainersCondition);
-                        if (!m_hasReceivedPulseAckContainers) {
-                            m_pulseAckContainersCondition.waitOnSignalWithTimeout(timeout);
-                        }
+            vector<odcore::data::Container> ModuleConnection::waitForPulseAckContainers(const TimeStamp &deadline) {
+                // Wait for the ACK message from client.
+                Lock l(m_pulseAckContainersCondition);
+                while (!m_hasReceivedPulseAckContainers && !isConnectionLost()) {
+                    const uint32_t remaining = getRemainingMilliseconds(deadline);
+                    if (remaining == 0) {
+                        break;
                     }
+                    m_pulseAckContainersCondition.waitOnSignalWithTimeout(remaining);
                 }
 
                 return m_containersToBeTransferredToSupercomponent;
             }
 
+            bool ModuleConnection::isConnectionLost() {
+                Lock l(m_connectionLostMutex);
+                return m_connectionLost;
+            }
+
+            uint32_t ModuleConnection::getRemainingMilliseconds(const TimeStamp &deadline) {
+                const int64_t remaining = (deadline - TimeStamp()).toMicroseconds();
+                // Round up to not return before the deadline.
+                return (remaining > 0) ? static_cast<uint32_t>((remaining + 999) / 1000) : 0;
+            }
+
             void ModuleConnection::nextContainer(Container &container) {
                 if (container.getDataType() == Container::DMCP_CONFIGURATION_REQUEST) {
                     m_descriptor = container.getData<ModuleDescriptor>();
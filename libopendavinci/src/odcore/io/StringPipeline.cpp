@@ -17,6 +17,9 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <iostream>
+#include <utility>
+
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/io/StringPipeline.h"
 
@@ -30,15 +33,21 @@ namespace odcore {
             Service(),
             StringObserver(),
             StringListener(),
-            m_queueCondition(),
-            m_queueMutex(),
-            m_queue(),
+            m_queue(CAPACITY, odcore::base::RingBuffer<string>::SINGLE_PRODUCER),
+            m_overflowMutex(),
+            m_overflow(),
+            m_numberOfOverflowed(0),
+            m_numberOfDropped(0),
             m_stringListenerMutex(),
             m_stringListener(NULL) {}
 
         StringPipeline::~StringPipeline() {
             // Stop the queue.
             stop();
+
+            if (m_numberOfDropped.load() > 0) {
+                clog << "StringPipeline: Dropped " << m_numberOfDropped.load() << " string(s) received after stopping." << endl;
+            }
         }
 
         void StringPipeline::setStringListener(StringListener *sl) {
@@ -51,72 +60,78 @@ namespace odcore {
         }
 
         void StringPipeline::nextString(const string &s) {
-            Lock l(m_queueCondition);
+            // Nobody would process the entry anymore.
+            if (m_queue.isClosed()) {
+                m_numberOfDropped.fetch_add(1);
+                return;
+            }
 
-            // Enter new data.
-            {
-                Lock l2(m_queueMutex);
-                m_queue.push(s);
+            // Enter new data without blocking the calling thread; the pipeline's
+            // thread is only woken up if it is parked. Once entries have overflowed,
+            // the following ones must queue up behind them.
+            string entry(s);
+            if ( (m_numberOfOverflowed.load() == 0) && m_queue.tryPush(std::move(entry)) ) {
+                return;
             }
 
-            // Wake awaiting threads.
-            m_queueCondition.wakeAll();
+            Lock l(m_overflowMutex);
+            // The pipeline's thread might have taken all overflowed entries in the meantime.
+            if ( (m_numberOfOverflowed.load() == 0) && m_queue.tryPush(std::move(entry)) ) {
+                return;
+            }
+            m_overflow.push_back(std::move(entry));
+            m_numberOfOverflowed.fetch_add(1);
         }
 
-        void StringPipeline::processQueue() {
-            uint32_t numberOfEntries = 0;
+        uint32_t StringPipeline::getNumberOfDroppedStrings() const {
+            return m_numberOfDropped.load();
+        }
 
-            // Determine the amount of current entries.
-            {
-                Lock l(m_queueMutex);
-                numberOfEntries = static_cast<uint32_t>(m_queue.size());
-            }
+        void StringPipeline::beforeStop() {
+            // Let the pipeline's thread finish after processing the remaining entries.
+            m_queue.close();
+        }
+
+        void StringPipeline::run() {
+            serviceReady();
 
             string entry;
-            for (uint32_t i = 0; i < numberOfEntries; i++) {
-                // Acquire next entry.
-                {
-                    Lock l2(m_queueMutex);
-                    entry = m_queue.front();
+            deque<string> overflowed;
+            while (true) {
+                // Overflowed entries are newer than all entries in the ring
+                // and older than all entries entered after taking them.
+                if ( (m_numberOfOverflowed.load() > 0) && m_queue.isEmpty() ) {
+                    Lock l(m_overflowMutex);
+                    overflowed.swap(m_overflow);
+                    m_numberOfOverflowed.store(0);
                 }
 
-                // Read all entries and distribute using the stringListener.
-                {
+                if (!overflowed.empty()) {
                     Lock l(m_stringListenerMutex);
-                    if (m_stringListener != NULL) {
-                        // Distribute entry to connected listeners while NOT locking the queue.
-                        m_stringListener->nextString(entry);
+                    for (deque<string>::iterator it = overflowed.begin(); it != overflowed.end(); ++it) {
+                        if (m_stringListener != NULL) {
+                            m_stringListener->nextString(*it);
+                        }
                     }
+                    overflowed.clear();
+                    continue;
                 }
 
-                // Remove processed entry.
-                {
-                    Lock l2(m_queueMutex);
-                    m_queue.pop();
+                if (!m_queue.pop(entry)) {
+                    break;
                 }
-            }
-        }
 
-        void StringPipeline::beforeStop() {
-            // Wake awaiting threads.
-            Lock l(m_queueCondition);
-            m_queueCondition.wakeAll();
-        }
-
-        void StringPipeline::run() {
-            serviceReady();
-
-            while (isRunning()) {
-                Lock l(m_queueCondition);
-                m_queueCondition.waitOnSignal();
-
-                if (isRunning()) {
-                    processQueue();
+                // Distribute all currently available entries while holding the lock only once.
+                Lock l(m_stringListenerMutex);
+                uint32_t numberOfEntries = 0;
+                do {
+                    if (m_stringListener != NULL) {
+                        m_stringListener->nextString(entry);
+                    }
+                    numberOfEntries++;
                 }
+                while ( (numberOfEntries < CAPACITY) && m_queue.tryPop(entry) );
             }
-
-            // Procee the queue to release any further waiting entries before shutting down.
-            processQueue();
         }
 
     }
@@ -24,5 +24,12 @@ namespace odcore {
 
         StringSender::~StringSender() {}
 
+        void StringSender::sendFramed(const string &header, const string &payload, const string &trailer) {
+            string data;
+            data.reserve(header.length() + payload.length() + trailer.length());
+            data.append(header).append(payload).append(trailer);
+            send(data);
+        }
+
     }
 }
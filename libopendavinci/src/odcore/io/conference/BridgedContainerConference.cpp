@@ -0,0 +1,140 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <string>
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/io/conference/BridgedContainerConference.h"
+
+namespace odcore {
+    namespace io {
+        namespace conference {
+
+            using namespace std;
+            using namespace base;
+            using namespace data;
+
+            BridgedContainerConference::Endpoint::Endpoint(BridgedContainerConference &bridge, const bool &isSharedMemory) :
+                m_bridge(bridge),
+                m_isSharedMemory(isSharedMemory) {}
+
+            BridgedContainerConference::Endpoint::~Endpoint() {}
+
+            void BridgedContainerConference::Endpoint::nextContainer(Container &c) {
+                if (m_isSharedMemory) {
+                    m_bridge.nextContainerFromSharedMemory(c);
+                }
+                else {
+                    m_bridge.nextContainerFromUDP(c);
+                }
+            }
+
+            BridgedContainerConference::PendingContainers::PendingContainers() :
+                m_mutex(),
+                m_fingerprints() {}
+
+            void BridgedContainerConference::PendingContainers::add(const size_t &fingerprint) {
+                Lock l(m_mutex);
+                // Forget containers that were never seen again (e.g. lost UDP packets).
+                if (m_fingerprints.size() >= MAX_PENDING_CONTAINERS) {
+                    m_fingerprints.pop_front();
+                }
+                m_fingerprints.push_back(fingerprint);
+            }
+
+            bool BridgedContainerConference::PendingContainers::remove(const size_t &fingerprint) {
+                Lock l(m_mutex);
+                // Containers are usually seen again in the order they were forwarded.
+                deque<size_t>::iterator it = find(m_fingerprints.begin(), m_fingerprints.end(), fingerprint);
+                if (it != m_fingerprints.end()) {
+                    m_fingerprints.erase(it);
+                    return true;
+                }
+                return false;
+            }
+
+            BridgedContainerConference::BridgedContainerConference(std::shared_ptr<ContainerConference> sharedMemory, std::shared_ptr<ContainerConference> udp) :
+                ContainerConference(),
+                m_sharedMemory(sharedMemory),
+                m_udp(udp),
+                m_forwardedToUDP(),
+                m_forwardedToSharedMemory(),
+                m_sharedMemoryEndpoint(*this, true),
+                m_udpEndpoint(*this, false) {
+                m_sharedMemory->setContainerListener(&m_sharedMemoryEndpoint);
+                m_udp->setContainerListener(&m_udpEndpoint);
+            }
+
+            BridgedContainerConference::~BridgedContainerConference() {
+                m_udp->setContainerListener(NULL);
+                m_sharedMemory->setContainerListener(NULL);
+            }
+
+            size_t BridgedContainerConference::getFingerprint(const Container &c) {
+                // Both transports replace the time stamps; thus, only type and payload identify a container.
+                Container copy(c);
+                copy.setSentTimeStamp(TimeStamp(0, 0));
+                copy.setReceivedTimeStamp(TimeStamp(0, 0));
+
+                stringstream sstr;
+                sstr << copy;
+                return std::hash<string>()(sstr.str());
+            }
+
+            void BridgedContainerConference::send(Container &container) const {
+                m_sharedMemory->send(container);
+            }
+
+            void BridgedContainerConference::nextContainerFromSharedMemory(Container &c) {
+                const size_t fingerprint = getFingerprint(c);
+
+                // Pass containers from this host to the other hosts unless they came from there.
+                if (!m_forwardedToSharedMemory.remove(fingerprint)) {
+                    m_forwardedToUDP.add(fingerprint);
+                    Container forwarded(c);
+                    m_udp->send(forwarded);
+                }
+
+                // Use superclass to distribute any received containers.
+                receive(c);
+            }
+
+            void BridgedContainerConference::nextContainerFromUDP(Container &c) {
+                const size_t fingerprint = getFingerprint(c);
+
+                // Our own containers are looped back.
+                if (m_forwardedToUDP.remove(fingerprint)) {
+                    return;
+                }
+
+                // Pass containers from the other hosts to this host; our listener receives them from the shared memory.
+                m_forwardedToSharedMemory.add(fingerprint);
+                Container forwarded(c);
+                m_sharedMemory->send(forwarded);
+            }
+
+        }
+    }
+} // odcore::io::conference
@@ -17,9 +17,26 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#ifndef WIN32
+    #include <arpa/inet.h>
+    #include <ifaddrs.h>
+    #include <netinet/in.h>
+    #include <sys/socket.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <iostream>
+
+#include "opendavinci/odcore/base/KeyValueConfiguration.h"
 #include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/exceptions/Exceptions.h"
+#include "opendavinci/odcore/io/conference/BridgedContainerConference.h"
 #include "opendavinci/odcore/io/conference/ContainerConference.h"
 #include "opendavinci/odcore/io/conference/ContainerConferenceFactory.h"
+#include "opendavinci/odcore/io/conference/SharedMemoryContainerConference.h"
 #include "opendavinci/odcore/io/conference/UDPMultiCastContainerConference.h"
 
 namespace odcore {
@@ -28,12 +45,18 @@ namespace odcore {
 
             using namespace std;
             using namespace base;
+            using namespace exceptions;
 
             // Initialize singleton instance.
             Mutex ContainerConferenceFactory::m_singletonMutex;
             ContainerConferenceFactory* ContainerConferenceFactory::m_singleton = NULL;
 
-            ContainerConferenceFactory::ContainerConferenceFactory() {}
+            ContainerConferenceFactory::ContainerConferenceFactory() :
+                m_transportMutex(),
+                m_transports(),
+                m_sharedMemorySizes(),
+                m_udpBatchSizes(),
+                m_udpReceiveBufferSizes() {}
 
             ContainerConferenceFactory::~ContainerConferenceFactory() {
                 setSingleton(NULL);
@@ -55,7 +78,142 @@ namespace odcore {
             }
 
             std::shared_ptr<ContainerConference> ContainerConferenceFactory::getContainerConference(const string &address, const uint32_t &port) {
-                return std::shared_ptr<ContainerConference>(new UDPMultiCastContainerConference(address, port));
+                if (getTransport(address) == SHARED_MEMORY) {
+                    uint32_t size = SHARED_MEMORY_SIZE;
+                    {
+                        Lock l(m_transportMutex);
+                        size = m_sharedMemorySizes[address];
+                    }
+
+                    try {
+                        return std::shared_ptr<ContainerConference>(new SharedMemoryContainerConference(address, port, size));
+                    }
+                    catch (ConferenceException &ce) {
+                        // Fall back to UDP multicast.
+                        CLOG << ce.toString() << "; using UDP multicast instead." << endl;
+                    }
+                }
+
+                return std::shared_ptr<ContainerConference>(new UDPMultiCastContainerConference(address, port, getUDPBatchSize(address), getUDPReceiveBufferSize(address)));
+            }
+
+            std::shared_ptr<ContainerConference> ContainerConferenceFactory::getBridgedContainerConference(const string &address, const uint32_t &port) {
+                std::shared_ptr<ContainerConference> containerConference = getContainerConference(address, port);
+
+                // Modules on other hosts can only be reached via UDP multicast.
+                if (dynamic_cast<SharedMemoryContainerConference*>(containerConference.get()) != NULL) {
+                    std::shared_ptr<ContainerConference> udp(new UDPMultiCastContainerConference(address, port, getUDPBatchSize(address), getUDPReceiveBufferSize(address)));
+                    containerConference = std::shared_ptr<ContainerConference>(new BridgedContainerConference(containerConference, udp));
+                }
+
+                return containerConference;
+            }
+
+            void ContainerConferenceFactory::setTransport(const string &address, const TRANSPORT &transport, const uint32_t &size) {
+                Lock l(m_transportMutex);
+                m_transports[address] = transport;
+                m_sharedMemorySizes[address] = size;
+            }
+
+            ContainerConferenceFactory::TRANSPORT ContainerConferenceFactory::getTransport(const string &address) const {
+                Lock l(m_transportMutex);
+                map<string, TRANSPORT>::const_iterator it = m_transports.find(address);
+                return ((it != m_transports.end()) ? it->second : UDP_MULTICAST);
+            }
+
+            void ContainerConferenceFactory::setUDPParameters(const string &address, const uint32_t &batchSize, const uint32_t &receiveBufferSize) {
+                Lock l(m_transportMutex);
+                m_udpBatchSizes[address] = batchSize;
+                m_udpReceiveBufferSizes[address] = receiveBufferSize;
+            }
+
+            uint32_t ContainerConferenceFactory::getUDPBatchSize(const string &address) const {
+                Lock l(m_transportMutex);
+                map<string, uint32_t>::const_iterator it = m_udpBatchSizes.find(address);
+                return ((it != m_udpBatchSizes.end()) ? it->second : static_cast<uint32_t>(UDPMultiCastContainerConference::BATCH_SIZE));
+            }
+
+            uint32_t ContainerConferenceFactory::getUDPReceiveBufferSize(const string &address) const {
+                Lock l(m_transportMutex);
+                map<string, uint32_t>::const_iterator it = m_udpReceiveBufferSizes.find(address);
+                return ((it != m_udpReceiveBufferSizes.end()) ? it->second : static_cast<uint32_t>(UDPMultiCastContainerConference::RECEIVE_BUFFER_SIZE));
+            }
+
+            bool ContainerConferenceFactory::isLocalAddress(const string &ip) {
+                if ( (ip.compare(0, 4, "127.") == 0) || (ip == "localhost") ) {
+                    return true;
+                }
+
+                bool local = false;
+#ifndef WIN32
+                struct ifaddrs *interfaces = NULL;
+                if (getifaddrs(&interfaces) == 0) {
+                    for (struct ifaddrs *it = interfaces; (it != NULL) && !local; it = it->ifa_next) {
+                        if ( (it->ifa_addr != NULL) && (it->ifa_addr->sa_family == AF_INET) ) {
+                            char buffer[INET_ADDRSTRLEN];
+                            memset(buffer, 0, INET_ADDRSTRLEN);
+                            const struct sockaddr_in *address = reinterpret_cast<const struct sockaddr_in*>(it->ifa_addr);
+                            if (inet_ntop(AF_INET, &(address->sin_addr), buffer, INET_ADDRSTRLEN) != NULL) {
+                                local = (ip == buffer);
+                            }
+                        }
+                    }
+                    freeifaddrs(interfaces);
+                }
+#endif
+                return local;
+            }
+
+            bool ContainerConferenceFactory::configureTransport(const string &address, const KeyValueConfiguration &kvc, const string &serverIP) {
+                TRANSPORT transport = UDP_MULTICAST;
+                try {
+                    string value = kvc.getValue<string>("global.conference.transport");
+                    transform(value.begin(), value.end(), value.begin(), ::tolower);
+                    if (value == "sharedmemory") {
+                        // The shared memory is only visible to processes on supercomponent's host.
+                        if (isLocalAddress(serverIP)) {
+                            transport = SHARED_MEMORY;
+                        }
+                        else {
+                            CLOG1 << "supercomponent is running on " << serverIP << "; using UDP multicast instead of shared memory." << endl;
+                        }
+                    }
+                }
+                catch (ValueForKeyNotFoundException &) {
+                    // Keep UDP multicast.
+                }
+
+                uint32_t size = SHARED_MEMORY_SIZE;
+                try {
+                    size = kvc.getValue<uint32_t>("global.conference.sharedmemory.size");
+                }
+                catch (ValueForKeyNotFoundException &) {
+                    // Keep the default size.
+                }
+
+                uint32_t batchSize = UDPMultiCastContainerConference::BATCH_SIZE;
+                try {
+                    batchSize = kvc.getValue<uint32_t>("global.conference.udp.batchsize");
+                }
+                catch (ValueForKeyNotFoundException &) {
+                    // Keep the default batch size.
+                }
+
+                uint32_t receiveBufferSize = UDPMultiCastContainerConference::RECEIVE_BUFFER_SIZE;
+                try {
+                    receiveBufferSize = kvc.getValue<uint32_t>("global.conference.udp.receivebuffersize");
+                }
+                catch (ValueForKeyNotFoundException &) {
+                    // Keep the default receive buffer size.
+                }
+
+                // A UDP multicast conference needs to be recreated to apply new socket parameters.
+                const bool changed = (getTransport(address) != transport) ||
+                                     ( (transport == UDP_MULTICAST) &&
+                                       ( (getUDPBatchSize(address) != batchSize) || (getUDPReceiveBufferSize(address) != receiveBufferSize) ) );
+                setTransport(address, transport, size);
+                setUDPParameters(address, batchSize, receiveBufferSize);
+                return changed;
             }
 
         }
@@ -0,0 +1,315 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifdef __linux__
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+    #include <time.h>
+    #include <unistd.h>
+#endif
+
+#include <climits>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+#include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/io/conference/SharedMemoryContainerConference.h"
+#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+
+namespace odcore {
+    namespace io {
+        namespace conference {
+
+            using namespace std;
+            using namespace base;
+            using namespace data;
+            using namespace exceptions;
+
+            SharedMemoryContainerConference::Header::Header(const uint32_t &capacity) :
+                m_magic(MAGIC),
+                m_capacity(capacity),
+                m_reserved(0),
+                m_written(0),
+                m_notification(0),
+                m_numberOfWaitingReaders(0) {}
+
+            SharedMemoryContainerConference::SharedMemoryContainerConference(const string &address, const uint32_t &port, const uint32_t &size) throw (ConferenceException) :
+                ContainerConference(),
+                Service(),
+                m_sharedMemory(),
+                m_header(NULL),
+                m_ring(NULL),
+                m_position(0),
+                m_numberOfLostContainers(0) {
+                const string name = getSharedMemoryName(address, port);
+
+                // The ring's capacity is a multiple of the records' alignment.
+                const uint32_t capacity = (size / RECORD_HEADER_SIZE) * RECORD_HEADER_SIZE;
+                if (capacity < RECORD_HEADER_SIZE) {
+                    stringstream s;
+                    s << "[SharedMemoryContainerConference] Invalid size " << size << " for " << address << ":" << port << ".";
+                    OPENDAVINCI_CORE_THROW_EXCEPTION(ConferenceException, s.str());
+                }
+
+                // Space to align the header and to keep it on its own cache line.
+                const uint32_t overhead = 2 * ALIGNMENT;
+
+                // Join an existing conference or create a new one.
+                m_sharedMemory = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(name);
+                if ( (m_sharedMemory.get() == NULL) || !m_sharedMemory->isValid() || (m_sharedMemory->getSize() <= overhead) ) {
+                    m_sharedMemory = odcore::wrapper::SharedMemoryFactory::createSharedMemory(name, capacity + overhead);
+                }
+
+                if ( (m_sharedMemory.get() == NULL) || !m_sharedMemory->isValid() || (m_sharedMemory->getSize() <= overhead) ) {
+                    stringstream s;
+                    s << "[SharedMemoryContainerConference] Shared memory " << name << " for " << address << ":" << port << " could not be created.";
+                    OPENDAVINCI_CORE_THROW_EXCEPTION(ConferenceException, s.str());
+                }
+
+                // Mappings start at page boundaries; thus, all participants find the header at the same offset.
+                char *begin = static_cast<char*>(m_sharedMemory->getSharedMemory());
+                const uintptr_t offset = (ALIGNMENT - (reinterpret_cast<uintptr_t>(begin) % ALIGNMENT)) % ALIGNMENT;
+                m_header = reinterpret_cast<Header*>(begin + offset);
+                m_ring = begin + offset + ALIGNMENT;
+
+                m_sharedMemory->lock();
+                {
+                    if (m_header->m_magic != static_cast<uint32_t>(MAGIC)) {
+                        const uint32_t available = ((m_sharedMemory->getSize() - overhead) / RECORD_HEADER_SIZE) * RECORD_HEADER_SIZE;
+                        new (m_header) Header(available);
+                    }
+
+                    // Containers sent from now on are delivered to this participant.
+                    m_position = m_header->m_written.load(memory_order_acquire);
+                }
+                m_sharedMemory->unlock();
+
+                if ( (m_header->m_capacity < RECORD_HEADER_SIZE) || (m_header->m_capacity > (m_sharedMemory->getSize() - overhead)) ) {
+                    stringstream s;
+                    s << "[SharedMemoryContainerConference] Shared memory " << name << " for " << address << ":" << port << " is corrupt.";
+                    OPENDAVINCI_CORE_THROW_EXCEPTION(ConferenceException, s.str());
+                }
+
+                // Start receiving.
+                start();
+            }
+
+            SharedMemoryContainerConference::~SharedMemoryContainerConference() {
+                // Stop receiving.
+                stop();
+            }
+
+            string SharedMemoryContainerConference::getSharedMemoryName(const string &address, const uint32_t &port) {
+                stringstream conference;
+                conference << address << ":" << port;
+                const string s = conference.str();
+
+                // FNV-1a hash to keep the name short enough for all POSIX systems.
+                uint32_t hash = 2166136261u;
+                for (uint32_t i = 0; i < s.length(); i++) {
+                    hash ^= static_cast<uint8_t>(s.at(i));
+                    hash *= 16777619u;
+                }
+
+                stringstream name;
+                name << "odc" << hex << setw(8) << setfill('0') << hash;
+                return name.str();
+            }
+
+            uint32_t SharedMemoryContainerConference::getCapacity() const {
+                return m_header->m_capacity;
+            }
+
+            uint32_t SharedMemoryContainerConference::getNumberOfLostContainers() const {
+                return m_numberOfLostContainers.load();
+            }
+
+            uint32_t SharedMemoryContainerConference::getRecordSize(const uint32_t &length) {
+                return RECORD_HEADER_SIZE + ((length + RECORD_HEADER_SIZE - 1) / RECORD_HEADER_SIZE) * RECORD_HEADER_SIZE;
+            }
+
+            void SharedMemoryContainerConference::copyIntoRing(const uint64_t &position, const char *source, const uint32_t &length) const {
+                const uint32_t capacity = m_header->m_capacity;
+                const uint32_t index = static_cast<uint32_t>(position % capacity);
+                const uint32_t first = min(length, capacity - index);
+                memcpy(m_ring + index, source, first);
+                if (first < length) {
+                    memcpy(m_ring, source + first, length - first);
+                }
+            }
+
+            void SharedMemoryContainerConference::copyFromRing(const uint64_t &position, char *destination, const uint32_t &length) const {
+                const uint32_t capacity = m_header->m_capacity;
+                const uint32_t index = static_cast<uint32_t>(position % capacity);
+                const uint32_t first = min(length, capacity - index);
+                memcpy(destination, m_ring + index, first);
+                if (first < length) {
+                    memcpy(destination + first, m_ring, length - first);
+                }
+            }
+
+            bool SharedMemoryContainerConference::isOverwritten(const uint64_t &position) const {
+                // Any data read before must not be reordered after checking the writers' progress.
+                atomic_thread_fence(memory_order_acquire);
+                return (m_header->m_reserved.load(memory_order_relaxed) > (position + m_header->m_capacity));
+            }
+
+            void SharedMemoryContainerConference::send(Container &container) const {
+                // Set sending time stamp.
+                container.setSentTimeStamp(TimeStamp());
+
+                stringstream stringstreamValue;
+                stringstreamValue << container;
+
+                const string stringValue = stringstreamValue.str();
+                const uint32_t length = static_cast<uint32_t>(stringValue.length());
+                const uint32_t recordSize = getRecordSize(length);
+
+                if (recordSize > m_header->m_capacity) {
+                    CLOG << "[SharedMemoryContainerConference] Container with " << length << " bytes exceeds the shared memory's capacity of " << m_header->m_capacity << " bytes." << endl;
+                    return;
+                }
+
+                uint32_t recordHeader[2];
+                recordHeader[0] = length;
+                recordHeader[1] = TYPE_CONTAINER;
+
+                m_sharedMemory->lock();
+                {
+                    const uint64_t position = m_header->m_written.load(memory_order_relaxed);
+
+                    // Announce the region to be overwritten before touching it.
+                    m_header->m_reserved.store(position + recordSize, memory_order_relaxed);
+                    atomic_thread_fence(memory_order_release);
+
+                    copyIntoRing(position, reinterpret_cast<const char*>(recordHeader), RECORD_HEADER_SIZE);
+                    copyIntoRing(position + RECORD_HEADER_SIZE, stringValue.data(), length);
+
+                    m_header->m_written.store(position + recordSize, memory_order_release);
+                }
+                m_sharedMemory->unlock();
+
+                wakeReaders();
+            }
+
+            void SharedMemoryContainerConference::wakeReaders() const {
+                m_header->m_notification.fetch_add(1);
+                atomic_thread_fence(memory_order_seq_cst);
+
+                if (m_header->m_numberOfWaitingReaders.load(memory_order_relaxed) > 0) {
+#ifdef __linux__
+                    syscall(SYS_futex, static_cast<void*>(&m_header->m_notification), FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+                }
+            }
+
+            void SharedMemoryContainerConference::waitForData(const uint64_t &position) {
+#ifdef __linux__
+                // Announce ourselves before checking again so that the writer
+                // either sees us waiting or we see its latest record.
+                m_header->m_numberOfWaitingReaders.fetch_add(1);
+                const uint32_t notification = m_header->m_notification.load();
+                atomic_thread_fence(memory_order_seq_cst);
+
+                if ( (m_header->m_written.load(memory_order_acquire) == position) && isRunning() ) {
+                    struct timespec timeout;
+                    timeout.tv_sec = 0;
+                    timeout.tv_nsec = WAIT_TIMEOUT * 1000 * 1000;
+
+                    // The shared futex works across processes.
+                    syscall(SYS_futex, static_cast<void*>(&m_header->m_notification), FUTEX_WAIT, notification, &timeout, NULL, 0);
+                }
+
+                m_header->m_numberOfWaitingReaders.fetch_sub(1);
+#else
+                // Poll the ring on platforms without futexes.
+                if (m_header->m_written.load(memory_order_acquire) == position) {
+                    Thread::usleepFor(1000);
+                }
+#endif
+            }
+
+            void SharedMemoryContainerConference::beforeStop() {
+                // Wake up our thread; other participants simply check again.
+                wakeReaders();
+            }
+
+            void SharedMemoryContainerConference::run() {
+                serviceReady();
+
+                const uint32_t capacity = m_header->m_capacity;
+                string payload;
+
+                while (isRunning()) {
+                    const uint64_t written = m_header->m_written.load(memory_order_acquire);
+                    if (m_position == written) {
+                        waitForData(m_position);
+                        continue;
+                    }
+
+                    uint32_t recordHeader[2];
+                    copyFromRing(m_position, reinterpret_cast<char*>(recordHeader), RECORD_HEADER_SIZE);
+
+                    bool lost = ( ((written - m_position) > capacity) || isOverwritten(m_position) );
+                    const uint32_t length = recordHeader[0];
+                    const uint32_t recordSize = getRecordSize(length);
+                    if (!lost) {
+                        lost = ( (recordHeader[1] != static_cast<uint32_t>(TYPE_CONTAINER)) || (recordSize > (written - m_position)) );
+                    }
+
+                    if (!lost) {
+                        payload.resize(length);
+                        copyFromRing(m_position + RECORD_HEADER_SIZE, &payload[0], length);
+                        lost = isOverwritten(m_position);
+                    }
+
+                    if (lost) {
+                        // We fell behind the writers; continue with the latest record.
+                        m_numberOfLostContainers++;
+                        m_position = written;
+                        CLOG << "[SharedMemoryContainerConference] Containers were overwritten before being read." << endl;
+                        continue;
+                    }
+
+                    m_position += recordSize;
+
+                    if (hasContainerListener()) {
+                        Container container;
+
+                        stringstream stringstreamData(payload);
+                        stringstreamData >> container;
+
+                        container.setReceivedTimeStamp(TimeStamp());
+
+                        // Use superclass to distribute any received containers.
+                        receive(container);
+                    }
+                }
+            }
+
+        }
+    }
+} // odcore::io::conference
@@ -17,10 +17,12 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
-#include <iosfwd>
+#include <cstring>
+#include <iostream>
 #include <sstream>
 
 #include "opendavinci/odcore/base/Serializable.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/data/TimeStamp.h"
 #include "opendavinci/odcore/io/conference/UDPMultiCastContainerConference.h"
@@ -36,9 +38,21 @@ namespace odcore {
             using namespace data;
             using namespace exceptions;
 
-            UDPMultiCastContainerConference::UDPMultiCastContainerConference(const string &address, const uint32_t &port) throw (ConferenceException) :
+            UDPMultiCastContainerConference::FragmentedContainer::FragmentedContainer() :
+                m_numberOfFragments(0),
+                m_numberOfReceivedFragments(0),
+                m_receivedFragments(),
+                m_data(),
+                m_firstFragmentReceived() {}
+
+            UDPMultiCastContainerConference::UDPMultiCastContainerConference(const string &address, const uint32_t &port, const uint32_t &batchSize, const uint32_t &receiveBufferSize) throw (ConferenceException) :
                 m_sender(NULL),
-                m_receiver(NULL) {
+                m_receiver(NULL),
+                m_senderIdentifier(static_cast<uint32_t>(TimeStamp().toMicroseconds() ^ reinterpret_cast<uintptr_t>(this))),
+                m_sequenceNumber(0),
+                m_fragmentedContainers(),
+                m_reassemblyBufferSize(0),
+                m_numberOfDroppedContainers(0) {
                 try {
                     m_sender = odcore::io::udp::UDPFactory::createUDPSender(address, port);
                 }
@@ -56,6 +70,17 @@ namespace odcore {
                 // Register ourselves as string listeners.
                 m_receiver->setStringListener(this);
 
+                // Fetch bursts of containers with as few system calls as possible.
+                m_receiver->setBatchSize(batchSize);
+
+                // Fragments of large containers arrive in bursts exceeding the default socket buffer.
+                try {
+                    m_receiver->setReceiveBufferSize(receiveBufferSize);
+                }
+                catch (string &s) {
+                    CLOG << s << endl;
+                }
+
                 // Start receiving.
                 m_receiver->start();
             }
@@ -68,12 +93,27 @@ namespace odcore {
                 m_receiver->setStringListener(NULL);
             }
 
+            uint32_t UDPMultiCastContainerConference::getNumberOfDroppedContainers() const {
+                return m_numberOfDroppedContainers.load();
+            }
+
             void UDPMultiCastContainerConference::nextString(const string &s) {
                 if (hasContainerListener()) {
                     Container container;
 
-                    stringstream stringstreamData(s);
-                    stringstreamData >> container;
+                    if (isFragment(s)) {
+                        string data;
+                        if (!addFragment(s, data)) {
+                            return;
+                        }
+
+                        stringstream stringstreamData(data);
+                        stringstreamData >> container;
+                    }
+                    else {
+                        stringstream stringstreamData(s);
+                        stringstreamData >> container;
+                    }
 
                     container.setReceivedTimeStamp(TimeStamp());
 
@@ -91,8 +131,170 @@ namespace odcore {
 
                 string stringValue = stringstreamValue.str();
 
-                // Send data.
-                m_sender->send(stringValue);
+                if (stringValue.length() <= MAX_PACKET_SIZE) {
+                    // Send data.
+                    m_sender->send(stringValue);
+                }
+                else {
+                    // Send fragments.
+                    const vector<string> fragments = createFragments(stringValue, m_senderIdentifier, m_sequenceNumber++);
+                    if (fragments.empty()) {
+                        CLOG << "[UDPMultiCastContainerConference] Container with " << stringValue.length() << " bytes is too large to be sent." << endl;
+                        return;
+                    }
+                    m_sender->sendBatch(fragments);
+                }
+            }
+
+            vector<string> UDPMultiCastContainerConference::createFragments(const string &data, const uint32_t &sender, const uint32_t &sequenceNumber) {
+                vector<string> fragments;
+
+                const uint32_t payloadPerFragment = MAX_PACKET_SIZE - FRAGMENT_HEADER_SIZE;
+                const uint32_t numberOfFragments = static_cast<uint32_t>((data.length() + payloadPerFragment - 1) / payloadPerFragment);
+                if ( (data.length() > MAX_REASSEMBLY_BUFFER_SIZE) || (numberOfFragments > 0xFFFF) ) {
+                    return fragments;
+                }
+
+                fragments.reserve(numberOfFragments);
+                for (uint32_t i = 0; i < numberOfFragments; i++) {
+                    const uint32_t offset = i * payloadPerFragment;
+                    const uint32_t length = min(payloadPerFragment, static_cast<uint32_t>(data.length()) - offset);
+
+                    string fragment(FRAGMENT_HEADER_SIZE + length, '\0');
+                    char *header = &fragment[0];
+                    encodeUInt16(header, FRAGMENT_MAGIC);
+                    encodeUInt16(header + 2, static_cast<uint16_t>(i));
+                    encodeUInt16(header + 4, static_cast<uint16_t>(numberOfFragments));
+                    encodeUInt16(header + 6, 0);
+                    encodeUInt32(header + 8, sender);
+                    encodeUInt32(header + 12, sequenceNumber);
+                    encodeUInt32(header + 16, static_cast<uint32_t>(data.length()));
+                    memcpy(header + FRAGMENT_HEADER_SIZE, data.data() + offset, length);
+
+                    fragments.push_back(fragment);
+                }
+
+                return fragments;
+            }
+
+            bool UDPMultiCastContainerConference::isFragment(const string &s) {
+                return ( (s.length() > FRAGMENT_HEADER_SIZE) && (decodeUInt16(s.data()) == FRAGMENT_MAGIC) );
+            }
+
+            bool UDPMultiCastContainerConference::addFragment(const string &fragment, string &data) {
+                const TimeStamp now;
+                dropExpiredContainers(now);
+
+                const char *header = fragment.data();
+                const uint32_t index = decodeUInt16(header + 2);
+                const uint32_t numberOfFragments = decodeUInt16(header + 4);
+                const uint32_t sender = decodeUInt32(header + 8);
+                const uint32_t sequenceNumber = decodeUInt32(header + 12);
+                const uint32_t size = decodeUInt32(header + 16);
+
+                const uint32_t payloadPerFragment = MAX_PACKET_SIZE - FRAGMENT_HEADER_SIZE;
+                const uint32_t offset = index * payloadPerFragment;
+                const uint32_t length = static_cast<uint32_t>(fragment.length()) - FRAGMENT_HEADER_SIZE;
+
+                // Discard corrupt fragments: All fragments but the last one must be
+                // full-size and all fragments must fill exactly their part of the
+                // declared size; otherwise, a container could be completed with gaps.
+                if ( (index >= numberOfFragments) || (size > MAX_REASSEMBLY_BUFFER_SIZE)
+                  || (numberOfFragments != (size + payloadPerFragment - 1) / payloadPerFragment)
+                  || (offset >= size) || (length != min(payloadPerFragment, size - offset)) ) {
+                    CLOG << "[UDPMultiCastContainerConference] Corrupt fragment discarded." << endl;
+                    return false;
+                }
+
+                const pair<uint32_t, uint32_t> key = make_pair(sender, sequenceNumber);
+                map<pair<uint32_t, uint32_t>, FragmentedContainer>::iterator it = m_fragmentedContainers.find(key);
+                if (it == m_fragmentedContainers.end()) {
+                    // Make room for the new container.
+                    while ( !m_fragmentedContainers.empty()
+                         && ( (m_fragmentedContainers.size() >= MAX_PENDING_CONTAINERS) || (m_reassemblyBufferSize + size > MAX_REASSEMBLY_BUFFER_SIZE) ) ) {
+                        dropOldestContainer();
+                    }
+
+                    FragmentedContainer &fc = m_fragmentedContainers[key];
+                    fc.m_numberOfFragments = numberOfFragments;
+                    fc.m_receivedFragments.resize(numberOfFragments, false);
+                    fc.m_data.resize(size);
+                    fc.m_firstFragmentReceived = now;
+                    m_reassemblyBufferSize += size;
+
+                    it = m_fragmentedContainers.find(key);
+                }
+
+                FragmentedContainer &fc = it->second;
+                if ( (fc.m_numberOfFragments != numberOfFragments) || (fc.m_data.length() != size) ) {
+                    CLOG << "[UDPMultiCastContainerConference] Corrupt fragment discarded." << endl;
+                    return false;
+                }
+
+                if (!fc.m_receivedFragments[index]) {
+                    memcpy(&fc.m_data[offset], header + FRAGMENT_HEADER_SIZE, length);
+                    fc.m_receivedFragments[index] = true;
+                    fc.m_numberOfReceivedFragments++;
+                }
+
+                if (fc.m_numberOfReceivedFragments < fc.m_numberOfFragments) {
+                    return false;
+                }
+
+                data.swap(fc.m_data);
+                m_reassemblyBufferSize -= size;
+                m_fragmentedContainers.erase(it);
+                return true;
+            }
+
+            void UDPMultiCastContainerConference::dropExpiredContainers(const TimeStamp &now) {
+                map<pair<uint32_t, uint32_t>, FragmentedContainer>::iterator it = m_fragmentedContainers.begin();
+                while (it != m_fragmentedContainers.end()) {
+                    if ((now - it->second.m_firstFragmentReceived).toMicroseconds() > REASSEMBLY_TIMEOUT * 1000L) {
+                        CLOG << "[UDPMultiCastContainerConference] Incomplete container dropped after timeout (" << it->second.m_numberOfReceivedFragments << "/" << it->second.m_numberOfFragments << " fragments)." << endl;
+                        m_reassemblyBufferSize -= static_cast<uint32_t>(it->second.m_data.length());
+                        m_numberOfDroppedContainers++;
+                        m_fragmentedContainers.erase(it++);
+                    }
+                    else {
+                        ++it;
+                    }
+                }
+            }
+
+            void UDPMultiCastContainerConference::dropOldestContainer() {
+                map<pair<uint32_t, uint32_t>, FragmentedContainer>::iterator oldest = m_fragmentedContainers.begin();
+                for (map<pair<uint32_t, uint32_t>, FragmentedContainer>::iterator it = m_fragmentedContainers.begin(); it != m_fragmentedContainers.end(); ++it) {
+                    if (it->second.m_firstFragmentReceived < oldest->second.m_firstFragmentReceived) {
+                        oldest = it;
+                    }
+                }
+
+                if (oldest != m_fragmentedContainers.end()) {
+                    CLOG << "[UDPMultiCastContainerConference] Incomplete container dropped to reassemble newer containers." << endl;
+                    m_reassemblyBufferSize -= static_cast<uint32_t>(oldest->second.m_data.length());
+                    m_numberOfDroppedContainers++;
+                    m_fragmentedContainers.erase(oldest);
+                }
+            }
+
+            void UDPMultiCastContainerConference::encodeUInt16(char *out, const uint16_t &v) {
+                // Network byte order.
+                out[0] = static_cast<char>((v >> 8) & 0xFF);
+                out[1] = static_cast<char>(v & 0xFF);
+            }
+
+            void UDPMultiCastContainerConference::encodeUInt32(char *out, const uint32_t &v) {
+                encodeUInt16(out, static_cast<uint16_t>(v >> 16));
+                encodeUInt16(out + 2, static_cast<uint16_t>(v & 0xFFFF));
+            }
+
+            uint16_t UDPMultiCastContainerConference::decodeUInt16(const char *in) {
+                return static_cast<uint16_t>((static_cast<uint8_t>(in[0]) << 8) | static_cast<uint8_t>(in[1]));
+            }
+
+            uint32_t UDPMultiCastContainerConference::decodeUInt32(const char *in) {
+                return (static_cast<uint32_t>(decodeUInt16(in)) << 16) | decodeUInt16(in + 2);
             }
 
         }
@@ -49,6 +49,13 @@ namespace odcore {
                 }
             }
 
+            void AbstractProtocol::sendFramedByStringSender(const string &header, const string &payload, const string &trailer) {
+                Lock l(m_stringSenderMutex);
+                if (m_stringSender != NULL) {
+                    m_stringSender->sendFramed(header, payload, trailer);
+                }
+            }
+
         }
     }
 }
@@ -17,7 +17,7 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
-#include <cstdlib>
+#include <sstream>
 
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/io/StringListener.h"
@@ -34,7 +34,11 @@ namespace odcore {
                 m_stringListenerMutex(),
                 m_stringListener(NULL),
                 m_partialDataMutex(),
-                m_partialData() {}
+                m_partialData(),
+                m_consumed(0),
+                m_binaryFramingRequested(false),
+                m_peerSupportsBinaryFraming(false),
+                m_binaryFramingActive(false) {}
 
             NetstringsProtocol::~NetstringsProtocol() {
                 setStringListener(NULL);
@@ -47,85 +51,147 @@ namespace odcore {
 
             void NetstringsProtocol::send(const string& data) {
                 if (data.length() > 0) {
-                    stringstream netstring;
+                    if (m_binaryFramingActive && (data.length() < static_cast<uint32_t>(MAX_BINARY_PAYLOAD))) {
+                        const uint32_t length = static_cast<uint32_t>(data.length());
+                        char header[BINARY_HEADER_SIZE];
+                        header[0] = static_cast<char>((length >> 24) & 0xFF);
+                        header[1] = static_cast<char>((length >> 16) & 0xFF);
+                        header[2] = static_cast<char>((length >> 8) & 0xFF);
+                        header[3] = static_cast<char>(length & 0xFF);
+
+                        sendFramedByStringSender(string(header, BINARY_HEADER_SIZE), data, "");
+                    }
+                    else {
+                        stringstream header;
+                        header << static_cast<uint32_t>(data.length()) << ":";
+
+                        sendFramedByStringSender(header.str(), data, ",");
+                    }
+                }
+            }
+
+            void NetstringsProtocol::enableBinaryFraming() {
+                m_binaryFramingRequested = true;
 
-                    netstring << static_cast<uint32_t>(data.length()) << ":" << data << ",";
+                // Announce binary framing using the empty Netstring.
+                sendByStringSender("0:,");
 
-                    sendByStringSender(netstring.str());
+                if (m_peerSupportsBinaryFraming) {
+                    m_binaryFramingActive = true;
+                }
+            }
+
+            bool NetstringsProtocol::isBinaryFramingActive() const {
+                return m_binaryFramingActive;
+            }
+
+            void NetstringsProtocol::peerSupportsBinaryFraming() {
+                m_peerSupportsBinaryFraming = true;
+
+                if (m_binaryFramingRequested) {
+                    m_binaryFramingActive = true;
                 }
             }
 
             void NetstringsProtocol::nextString(const string &s) {
                 Lock l(m_partialDataMutex);
-                m_partialData.write(s.c_str(), s.length());
+                m_partialData.append(s);
                 decodeNetstring();
-
-                // After using str() to set the remaining string, the write pointer
-                // points to the beginning of the stream and further receivedString() calls
-                // would override existing data. So the write pointer has to point to the
-                // end of the stream.
-                m_partialData.seekp(0, ios_base::end);
             }
 
             void NetstringsProtocol::decodeNetstring(void) {
-                // Netstrings have the following format:
-                // ASCII Number representing the length of the payload + ':' + payload + ','
-
-                bool checkForMoreNetstrings = true;
-                while (checkForMoreNetstrings) {
-                    m_partialData.seekg(0, ios_base::end);
-                    uint32_t lengthOfBuffer = m_partialData.tellg();
-                    m_partialData.seekg(0, ios_base::beg);
-
-                    if (lengthOfBuffer >= 3) {
-                        // On WIN32, the .str() returns a temporary object that is destroyed after the expression.
-                        // The reference keeps its existence instead.
-                        const string &m_partialDataString = m_partialData.str();
-                        const char *receiveBuffer = m_partialDataString.c_str();
-                        char *colonSign = NULL;
-                        uint32_t lengthOfPayload = strtol(receiveBuffer, &colonSign, 10);
-                        if (lengthOfPayload == 0) {
-                            // Remove empty Netstring: "0:," (size is 3).
-                            m_partialData.str(m_partialData.str().substr(3));
-                            checkForMoreNetstrings = true;
-                            continue; // Try to decode next Netstring if any.
-                        }
-
-                        if (lengthOfPayload > lengthOfBuffer) {
-                            // Incomplete Netstring received. Wait for more data.
-                            checkForMoreNetstrings = false;
-                            continue;
-                        }
+                bool complete = true;
+                while (complete && (m_consumed < m_partialData.length())) {
+                    if (!decodeFrame(complete)) {
+                        // The received data is corrupted; reset buffer.
+                        m_partialData.clear();
+                        m_consumed = 0;
+                        return;
+                    }
+                }
 
-                        // Check for colon.
-                        if (*colonSign == ':') {
-                            // Found colon sign. Now, check if (receiveBuffer + 1 + lengthOfPayload) == ','.
-                            if ((colonSign[1 + lengthOfPayload]) == ',') {
-                                // Successfully found a complete Netstring.
-                                string receivedPayload = m_partialData.str().substr((colonSign + 1) - receiveBuffer, lengthOfPayload);
+                // Remove the decoded frames only if they make up the larger
+                // part of the buffer to keep the total effort linear.
+                if (m_consumed == m_partialData.length()) {
+                    m_partialData.clear();
+                    m_consumed = 0;
+                }
+                else if (m_consumed > (m_partialData.length() / 2)) {
+                    m_partialData.erase(0, m_consumed);
+                    m_consumed = 0;
+                }
+            }
 
-                                invokeStringListener(receivedPayload);
+            bool NetstringsProtocol::decodeFrame(bool &complete) {
+                const char *buffer = m_partialData.data() + m_consumed;
+                const uint32_t lengthOfBuffer = static_cast<uint32_t>(m_partialData.length() - m_consumed);
+
+                complete = false;
+                if ( (buffer[0] >= '0') && (buffer[0] <= '9') ) {
+                    // Netstrings have the following format:
+                    // ASCII Number representing the length of the payload + ':' + payload + ','
+                    uint64_t lengthOfPayload = 0;
+                    uint32_t i = 0;
+                    while ( (i < lengthOfBuffer) && (buffer[i] >= '0') && (buffer[i] <= '9') ) {
+                        if (i == MAX_LENGTH_DIGITS) {
+                            return false;
+                        }
+                        lengthOfPayload = lengthOfPayload * 10 + static_cast<uint32_t>(buffer[i] - '0');
+                        i++;
+                    }
 
-                                // Calculate size of decoded Netstring: "<lengthOfPayload> : <payload> ,"
-                                const uint32_t lengthOfNetstring = (colonSign + 1 + lengthOfPayload + 1) - receiveBuffer;
+                    if (i == lengthOfBuffer) {
+                        // Incomplete Netstring received. Wait for more data.
+                        return true;
+                    }
+                    if (buffer[i] != ':') {
+                        return false;
+                    }
 
-                                // Remove the decoded Netstring from the buffer.
-                                m_partialData.str(m_partialData.str().substr(lengthOfNetstring));
+                    // Size of the Netstring: "<lengthOfPayload> : <payload> ,"
+                    const uint64_t lengthOfNetstring = i + 1 + lengthOfPayload + 1;
+                    if (lengthOfNetstring > lengthOfBuffer) {
+                        return true;
+                    }
+                    if (buffer[lengthOfNetstring - 1] != ',') {
+                        return false;
+                    }
 
-                                checkForMoreNetstrings = true;
-                                continue;
-                            }
-                        }
+                    m_consumed += static_cast<uint32_t>(lengthOfNetstring);
+                    complete = true;
 
-                        // We should never get here as the received data might be corrupted; reset buffer.
-                        m_partialData.str("");
-                        checkForMoreNetstrings = false;
+                    if (lengthOfPayload == 0) {
+                        // The empty Netstring "0:," announces binary framing.
+                        peerSupportsBinaryFraming();
                     }
                     else {
-                        // We need to wait for more data.
-                        checkForMoreNetstrings = false;
+                        invokeStringListener(string(buffer + i + 1, static_cast<uint32_t>(lengthOfPayload)));
                     }
+                    return true;
+                }
+
+                // Binary frames have the following format:
+                // 4-byte big-endian length of the payload + payload
+                if (lengthOfBuffer < static_cast<uint32_t>(BINARY_HEADER_SIZE)) {
+                    return true;
+                }
+
+                const uint32_t lengthOfPayload = (static_cast<uint32_t>(static_cast<uint8_t>(buffer[0])) << 24) |
+                                                 (static_cast<uint32_t>(static_cast<uint8_t>(buffer[1])) << 16) |
+                                                 (static_cast<uint32_t>(static_cast<uint8_t>(buffer[2])) << 8) |
+                                                  static_cast<uint32_t>(static_cast<uint8_t>(buffer[3]));
+                if (lengthOfPayload >= static_cast<uint32_t>(MAX_BINARY_PAYLOAD)) {
+                    return false;
                 }
+                if (lengthOfPayload > (lengthOfBuffer - BINARY_HEADER_SIZE)) {
+                    return true;
+                }
+
+                m_consumed += BINARY_HEADER_SIZE + lengthOfPayload;
+                complete = true;
+
+                invokeStringListener(string(buffer + BINARY_HEADER_SIZE, lengthOfPayload));
+                return true;
             }
 
             void NetstringsProtocol::invokeStringListener(const string& data) {
@@ -138,4 +204,3 @@ namespace odcore {
         }
     }
 }
-
@@ -17,6 +17,8 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <cstring>
+
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/io/ConnectionListener.h"
 #include "opendavinci/odcore/io/StringListener.h"
@@ -34,7 +36,8 @@ namespace odcore {
                 m_stringListenerMutex(),
                 m_stringListener(NULL),
                 m_partialDataMutex(),
-                m_partialData() {}
+                m_partialData(),
+                m_consumed(0) {}
 
             TCPConnection::~TCPConnection() {
                 setStringListener(NULL);
@@ -67,60 +70,49 @@ namespace odcore {
 
             void TCPConnection::send(const string& data) {
                 const uint32_t dataSize = htonl(data.length());
-                stringstream dataStream;
-                dataStream.write(reinterpret_cast<const char*>(&dataSize), sizeof(uint32_t));
-                dataStream << data;
 
-                sendImplementation(dataStream.str());
+                sendWithHeaderImplementation(string(reinterpret_cast<const char*>(&dataSize), sizeof(uint32_t)), data);
             }
 
-            void TCPConnection::receivedString(const string &s) {
-                Lock l(m_partialDataMutex);
-
-                m_partialData.write(s.c_str(), s.length());
+            void TCPConnection::sendWithHeaderImplementation(const string &header, const string &data) {
+                string frame;
+                frame.reserve(header.length() + data.length());
+                frame.append(header).append(data);
 
-                if (hasCompleteData()) {
-                    m_partialData.seekg(0, ios_base::beg);
-
-                    uint32_t dataSize = 0;
-                    m_partialData.read(reinterpret_cast<char*>(&dataSize), sizeof(uint32_t));
-                    dataSize = ntohl(dataSize);
-                    const uint32_t bytesToIgnore = m_partialData.gcount();
-
-                    // Split the stringstreams's string into to pieces. The first
-                    // piece contains the data for the StringListener, the second
-                    // piece will remain in the stringstream.
-                    invokeStringListener(m_partialData.str().substr(bytesToIgnore, dataSize));
-                    m_partialData.str(m_partialData.str().substr(bytesToIgnore+dataSize));
-
-                    // After using str() to set the remaining string, the write pointer
-                    // points to the beginning of the stream and further receivedString() calls
-                    // would override existing data. So the write pointer as to point to the
-                    // end of the stream.
-                    m_partialData.seekp(0, ios_base::end);
-                }
+                sendImplementation(frame);
             }
 
-            bool TCPConnection::hasCompleteData() {
-                // Get size of stringstream
-                m_partialData.seekg(0, ios_base::end);
-                const uint32_t streamSize = m_partialData.tellg();
-                m_partialData.seekg(0, ios_base::beg);
+            void TCPConnection::receivedString(const string &s) {
+                Lock l(m_partialDataMutex);
+
+                m_partialData.append(s);
 
-                // Did we receive enough bytes?
-                if (streamSize > sizeof(uint32_t)) {
-                    // Read size of transfered data
+                // Pass all complete packets to the StringListener.
+                while ((m_partialData.length() - m_consumed) > sizeof(uint32_t)) {
                     uint32_t dataSize = 0;
-                    m_partialData.read(reinterpret_cast<char*>(&dataSize), sizeof(uint32_t));
+                    memcpy(&dataSize, m_partialData.data() + m_consumed, sizeof(uint32_t));
                     dataSize = ntohl(dataSize);
-                    const uint32_t bytesToIgnore = m_partialData.gcount();
 
-                    if (streamSize >= (dataSize + bytesToIgnore)) {
-                        return true;
+                    if ((m_partialData.length() - m_consumed - sizeof(uint32_t)) < dataSize) {
+                        // Wait for more data.
+                        break;
                     }
+
+                    const uint32_t offset = m_consumed + sizeof(uint32_t);
+                    m_consumed = offset + dataSize;
+                    invokeStringListener(m_partialData.substr(offset, dataSize));
                 }
 
-                return false;
+                // Remove the passed packets only if they make up the larger
+                // part of the buffer to keep the total effort linear.
+                if (m_consumed == m_partialData.length()) {
+                    m_partialData.clear();
+                    m_consumed = 0;
+                }
+                else if (m_consumed > (m_partialData.length() / 2)) {
+                    m_partialData.erase(0, m_consumed);
+                    m_consumed = 0;
+                }
             }
 
         }
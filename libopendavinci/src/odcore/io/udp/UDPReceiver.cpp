@@ -47,6 +47,10 @@ namespace odcore {
                 m_packetListener = pl;
             }
 
+            void UDPReceiver::setReceiveBufferSize(const uint32_t &/*size*/) {}
+
+            void UDPReceiver::setBatchSize(const uint32_t &/*numberOfPackets*/) {}
+
             void UDPReceiver::nextPacket(const Packet &p) {
                 Lock l(m_packetListenerMutex);
 
@@ -23,8 +23,16 @@ namespace odcore {
     namespace io {
         namespace udp {
 
+            using namespace std;
+
             UDPSender::~UDPSender() {}
 
+            void UDPSender::sendBatch(const vector<string> &data) const {
+                for (vector<string>::const_iterator it = data.begin(); it != data.end(); ++it) {
+                    send(*it);
+                }
+            }
+
         }
     }
 } // odcore::io::udp
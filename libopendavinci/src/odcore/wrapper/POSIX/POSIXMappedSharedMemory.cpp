@@ -0,0 +1,257 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifdef __linux__
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <iostream>
+#include <new>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/wrapper/POSIX/POSIXMappedSharedMemory.h"
+
+namespace odcore {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+
+            POSIXMappedSharedMemory::Header::Header(const uint32_t &size) :
+                m_magic(0),
+                m_size(size),
+                m_lock(0) {}
+
+            POSIXMappedSharedMemory::POSIXMappedSharedMemory(const string &name, const uint32_t &size) :
+                m_name(name),
+                m_internalName(getInternalName(name)),
+                m_releaseSharedMemory(true),
+                m_mapping(NULL),
+                m_length(0),
+                m_header(NULL) {
+
+                if (m_internalName.size() > 1) {
+                    bool created = true;
+                    int32_t fd = ::shm_open(m_internalName.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+                    if ( (fd < 0) && (errno == EEXIST) ) {
+                        // Reuse a segment left over by another process.
+                        created = false;
+                        fd = ::shm_open(m_internalName.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+                    }
+
+                    if (fd < 0) {
+                        CLOG3 << "[POSIXMappedSharedMemory] Shared memory " << m_name << " could not be created, errno: " << errno << "; " << ::strerror(errno) << endl;
+                        return;
+                    }
+
+                    // Grow the segment if necessary; processes already attached keep their mappings.
+                    struct stat info;
+                    const uint64_t length = getLength(size);
+                    if ( (::fstat(fd, &info) != 0) ||
+                         ( (static_cast<uint64_t>(info.st_size) < length) && (::ftruncate(fd, static_cast<off_t>(length)) != 0) ) ) {
+                        CLOG3 << "[POSIXMappedSharedMemory] Shared memory " << m_name << " could not be resized, errno: " << errno << "; " << ::strerror(errno) << endl;
+                        ::close(fd);
+                        if (created) {
+                            ::shm_unlink(m_internalName.c_str());
+                        }
+                        return;
+                    }
+
+                    if (map(fd, max(length, static_cast<uint64_t>(info.st_size)))) {
+                        uint32_t dataSize = size;
+                        if (!created) {
+                            // The previous owner might have crashed while holding the lock; thus, the header is reset.
+                            Header *previous = static_cast<Header*>(m_mapping);
+                            if (previous->m_magic.load(memory_order_acquire) == static_cast<uint32_t>(MAGIC)) {
+                                dataSize = max(previous->m_size, size);
+                            }
+                            previous->m_magic.store(0, memory_order_release);
+                        }
+
+                        m_header = new (m_mapping) Header(dataSize);
+                        m_header->m_magic.store(MAGIC, memory_order_release);
+                    }
+                    else if (created) {
+                        ::shm_unlink(m_internalName.c_str());
+                    }
+                    ::close(fd);
+                }
+            }
+
+            POSIXMappedSharedMemory::POSIXMappedSharedMemory(const string &name) :
+                m_name(name),
+                m_internalName(getInternalName(name)),
+                m_releaseSharedMemory(false),
+                m_mapping(NULL),
+                m_length(0),
+                m_header(NULL) {
+
+                if (m_internalName.size() > 1) {
+                    const int32_t fd = ::shm_open(m_internalName.c_str(), O_RDWR, S_IRUSR | S_IWUSR);
+                    if (fd < 0) {
+                        CLOG3 << "[POSIXMappedSharedMemory] Shared memory " << m_name << " could not be opened, errno: " << errno << "; " << ::strerror(errno) << endl;
+                        return;
+                    }
+
+                    // Wait until the owner has resized the segment.
+                    struct stat info;
+                    ::memset(&info, 0, sizeof(info));
+                    uint32_t retries = 0;
+                    while ( (::fstat(fd, &info) == 0) &&
+                            (static_cast<uint64_t>(info.st_size) <= static_cast<uint64_t>(HEADER_SIZE)) &&
+                            (retries++ < ATTACH_RETRIES) ) {
+                        odcore::base::Thread::usleepFor(ATTACH_RETRY_DELAY);
+                    }
+
+                    // The segment's length is known from the file descriptor; thus, only one mapping is needed.
+                    if ( (static_cast<uint64_t>(info.st_size) > static_cast<uint64_t>(HEADER_SIZE)) &&
+                         map(fd, static_cast<uint64_t>(info.st_size)) ) {
+                        // Wait until the owner has published the header.
+                        Header *header = static_cast<Header*>(m_mapping);
+                        while ( (header->m_magic.load(memory_order_acquire) != static_cast<uint32_t>(MAGIC)) &&
+                                (retries++ < ATTACH_RETRIES) ) {
+                            odcore::base::Thread::usleepFor(ATTACH_RETRY_DELAY);
+                        }
+
+                        if ( (header->m_magic.load(memory_order_acquire) == static_cast<uint32_t>(MAGIC)) &&
+                             (getLength(header->m_size) <= m_length) ) {
+                            m_header = header;
+                        }
+                        else {
+                            CLOG3 << "[POSIXMappedSharedMemory] Shared memory " << m_name << " is incomplete." << endl;
+                        }
+                    }
+                    ::close(fd);
+                }
+            }
+
+            POSIXMappedSharedMemory::~POSIXMappedSharedMemory() {
+                if (m_mapping != NULL) {
+                    ::munmap(m_mapping, static_cast<size_t>(m_length));
+                }
+
+                if (m_releaseSharedMemory && (m_header != NULL)) {
+                    // Attached processes keep their mappings until they detach.
+                    ::shm_unlink(m_internalName.c_str());
+                }
+            }
+
+            string POSIXMappedSharedMemory::getInternalName(const string &name) {
+                // The name must start with / and must not contain any further /'s.
+                string internalName = name;
+                replace(internalName.begin(), internalName.end(), '/', '_');
+                internalName.insert(0, "/");
+
+                // Truncating the name would let different segments collide.
+                if (internalName.length() > NAME_MAX) {
+                    CLOG3 << "[POSIXMappedSharedMemory] Name " << name << " is too long." << endl;
+                    internalName = "";
+                }
+                return internalName;
+            }
+
+            uint64_t POSIXMappedSharedMemory::getLength(const uint32_t &size) {
+                uint64_t length = static_cast<uint64_t>(HEADER_SIZE) + size;
+
+                // Cover large segments completely with huge pages.
+                if (length >= static_cast<uint64_t>(HUGE_PAGE_SIZE)) {
+                    length = ((length + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+                }
+                return length;
+            }
+
+            bool POSIXMappedSharedMemory::map(const int32_t &fd, const uint64_t &length) {
+                if (length != static_cast<uint64_t>(static_cast<size_t>(length))) {
+                    return false;
+                }
+
+                // Pre-fault all pages to avoid page faults while exchanging data.
+                void *mapping = ::mmap(NULL, static_cast<size_t>(length), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+                if (mapping == MAP_FAILED) {
+                    CLOG3 << "[POSIXMappedSharedMemory] Shared memory " << m_name << " could not be mapped, errno: " << errno << "; " << ::strerror(errno) << endl;
+                    return false;
+                }
+
+#ifdef MADV_HUGEPAGE
+                if (length >= static_cast<uint64_t>(HUGE_PAGE_SIZE)) {
+                    // Only a hint; it depends on /sys/kernel/mm/transparent_hugepage/shmem_enabled.
+                    ::madvise(mapping, static_cast<size_t>(length), MADV_HUGEPAGE);
+                }
+#endif
+
+                m_mapping = mapping;
+                m_length = length;
+                return true;
+            }
+
+            bool POSIXMappedSharedMemory::isValid() const {
+                return (m_header != NULL);
+            }
+
+            const string POSIXMappedSharedMemory::getName() const {
+                return m_name;
+            }
+
+            void POSIXMappedSharedMemory::lock() {
+                // Uncontended locking does not need any system call.
+                int32_t state = 0;
+                if (!m_header->m_lock.compare_exchange_strong(state, 1, memory_order_acquire)) {
+                    if (state != 2) {
+                        state = m_header->m_lock.exchange(2, memory_order_acquire);
+                    }
+                    while (state != 0) {
+                        // The futex is shared between processes; thus, FUTEX_PRIVATE_FLAG must not be used.
+                        syscall(SYS_futex, static_cast<void*>(&m_header->m_lock), FUTEX_WAIT, 2, NULL, NULL, 0);
+                        state = m_header->m_lock.exchange(2, memory_order_acquire);
+                    }
+                }
+            }
+
+            void POSIXMappedSharedMemory::unlock() {
+                if (m_header->m_lock.fetch_sub(1, memory_order_release) != 1) {
+                    // Other processes are waiting.
+                    m_header->m_lock.store(0, memory_order_release);
+                    syscall(SYS_futex, static_cast<void*>(&m_header->m_lock), FUTEX_WAKE, 1, NULL, NULL, 0);
+                }
+            }
+
+            void* POSIXMappedSharedMemory::getSharedMemory() const {
+                return static_cast<void*>(static_cast<char*>(m_mapping) + HEADER_SIZE);
+            }
+
+            uint32_t POSIXMappedSharedMemory::getSize() const {
+                return ((m_header != NULL) ? m_header->m_size : 0);
+            }
+
+        }
+    }
+} // odcore::wrapper::POSIX
+
+#endif
@@ -0,0 +1,102 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/wrapper/POSIX/POSIXMemoryMappedFile.h"
+
+namespace odcore {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+
+            POSIXMemoryMappedFile::POSIXMemoryMappedFile(const string &name) :
+                m_name(name),
+                m_valid(false),
+                m_data(NULL),
+                m_size(0) {
+                const int fd = ::open(m_name.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    CLOG3 << "[POSIXMemoryMappedFile] File " << m_name << " could not be opened, errno: " << errno << "; " << ::strerror(errno) << endl;
+                    return;
+                }
+
+                struct stat info;
+                if ( (::fstat(fd, &info) == 0) && S_ISREG(info.st_mode) ) {
+                    m_size = static_cast<uint64_t>(info.st_size);
+
+                    if (m_size == 0) {
+                        // Empty files cannot be mapped but are valid nonetheless.
+                        m_valid = true;
+                    }
+                    else if (m_size == static_cast<uint64_t>(static_cast<size_t>(m_size))) {
+                        m_data = ::mmap(NULL, static_cast<size_t>(m_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                        if (m_data == MAP_FAILED) {
+                            CLOG3 << "[POSIXMemoryMappedFile] File " << m_name << " could not be mapped, errno: " << errno << "; " << ::strerror(errno) << endl;
+                            m_data = NULL;
+                            m_size = 0;
+                        }
+                        else {
+                            // Recordings are mostly read front to back.
+                            ::madvise(m_data, static_cast<size_t>(m_size), MADV_SEQUENTIAL);
+                            m_valid = true;
+                        }
+                    }
+                }
+
+                // The mapping stays valid after closing the file descriptor.
+                ::close(fd);
+            }
+
+            POSIXMemoryMappedFile::~POSIXMemoryMappedFile() {
+                if (m_data != NULL) {
+                    ::munmap(m_data, static_cast<size_t>(m_size));
+                }
+                m_data = NULL;
+            }
+
+            bool POSIXMemoryMappedFile::isValid() const {
+                return m_valid;
+            }
+
+            const string POSIXMemoryMappedFile::getName() const {
+                return m_name;
+            }
+
+            const char* POSIXMemoryMappedFile::getData() const {
+                return static_cast<const char*>(m_data);
+            }
+
+            uint64_t POSIXMemoryMappedFile::getSize() const {
+                return m_size;
+            }
+
+        }
+    }
+} // odcore::wrapper::POSIX
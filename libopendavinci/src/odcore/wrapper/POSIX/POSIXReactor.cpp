@@ -0,0 +1,466 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifdef __linux__
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+#endif
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/wrapper/ConcurrencyFactory.h"
+#include "opendavinci/odcore/wrapper/POSIX/POSIXReactor.h"
+#include "opendavinci/odcore/wrapper/Thread.h"
+
+namespace odcore {
+    namespace wrapper {
+        namespace POSIX {
+
+            using namespace std;
+            using namespace odcore::base;
+
+            // Initialize singleton instance.
+            odcore::base::Mutex POSIXReactor::m_singletonMutex;
+            POSIXReactor* POSIXReactor::m_singleton = NULL;
+
+            POSIXReactor::Handler::~Handler() {}
+
+            POSIXReactor::Worker::Worker(POSIXReactor &reactor, const bool &spare) :
+                m_reactor(reactor),
+                m_spare(spare),
+                m_finished(false),
+                m_thread() {}
+
+            POSIXReactor::Worker::~Worker() {
+                // Joins the thread.
+                m_thread.reset();
+            }
+
+            bool POSIXReactor::Worker::isRunning() {
+                return m_reactor.isRunning();
+            }
+
+            void POSIXReactor::Worker::run() {
+                m_reactor.run(*this);
+                m_finished = true;
+            }
+
+            POSIXReactor::Registration::Registration() :
+                m_fileDescriptor(-1),
+                m_handler(NULL),
+                m_busy(false),
+                m_thread() {}
+
+            POSIXReactor::POSIXReactor() :
+                m_epollFileDescriptor(-1),
+                m_wakeupFileDescriptor(-1),
+                m_running(false),
+                m_threadsMutex(),
+                m_numberOfThreads(1),
+                m_workers(),
+                m_retiredWorkers(),
+                m_idleThreads(0),
+                m_registrationsCondition(),
+                m_nextId(1),
+                m_registrations(),
+                m_fileDescriptors() {
+#ifdef __linux__
+                m_epollFileDescriptor = epoll_create1(EPOLL_CLOEXEC);
+                if (m_epollFileDescriptor < 0) {
+                    stringstream s;
+                    s << "[core::wrapper::POSIXReactor] Error while creating epoll: " << strerror(errno);
+                    throw s.str();
+                }
+
+                m_wakeupFileDescriptor = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+                if (m_wakeupFileDescriptor < 0) {
+                    stringstream s;
+                    s << "[core::wrapper::POSIXReactor] Error while creating eventfd: " << strerror(errno);
+                    throw s.str();
+                }
+
+                // The id 0 denotes the wakeup event, which is level-triggered to wake all threads.
+                struct epoll_event event;
+                memset(&event, 0, sizeof(event));
+                event.events = EPOLLIN;
+                event.data.u64 = 0;
+                epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_ADD, m_wakeupFileDescriptor, &event);
+#endif
+            }
+
+            POSIXReactor::~POSIXReactor() {
+                stop();
+
+                if (m_wakeupFileDescriptor >= 0) {
+                    close(m_wakeupFileDescriptor);
+                }
+                if (m_epollFileDescriptor >= 0) {
+                    close(m_epollFileDescriptor);
+                }
+            }
+
+            POSIXReactor& POSIXReactor::getInstance() {
+                {
+                    Lock l(POSIXReactor::m_singletonMutex);
+                    if (POSIXReactor::m_singleton == NULL) {
+                        static bool registeredHandlers = false;
+                        if (!registeredHandlers) {
+                            pthread_atfork(NULL, NULL, &POSIXReactor::resetAfterFork);
+                            atexit(&POSIXReactor::stopAtExit);
+                            registeredHandlers = true;
+                        }
+                        POSIXReactor::m_singleton = new POSIXReactor();
+                    }
+                }
+
+                return (*POSIXReactor::m_singleton);
+            }
+
+            void POSIXReactor::resetAfterFork() {
+                // The threads are not running in a child process and the
+                // epoll instance would be shared with the parent; thus,
+                // the child creates its own reactor on demand.
+                if (POSIXReactor::m_singleton != NULL) {
+                    close(POSIXReactor::m_singleton->m_wakeupFileDescriptor);
+                    close(POSIXReactor::m_singleton->m_epollFileDescriptor);
+                    POSIXReactor::m_singleton = NULL;
+                }
+            }
+
+            void POSIXReactor::stopAtExit() {
+                POSIXReactor *reactor = NULL;
+                {
+                    Lock l(POSIXReactor::m_singletonMutex);
+                    reactor = POSIXReactor::m_singleton;
+                }
+
+                // Handlers might still call getInstance() while being joined;
+                // handlers that do not return must not prevent the exit.
+                if (reactor != NULL) {
+                    reactor->stopThreads(EXIT_TIMEOUT);
+                }
+            }
+
+            void POSIXReactor::stop() {
+                stopThreads(0);
+            }
+
+            void POSIXReactor::stopThreads(const uint32_t &timeout) {
+                vector<std::shared_ptr<Worker> > workers;
+                {
+                    Lock l(m_threadsMutex);
+                    m_running = false;
+
+                    // The threads are joined without holding the lock as they might try to start spare threads.
+                    workers.swap(m_workers);
+                    workers.insert(workers.end(), m_retiredWorkers.begin(), m_retiredWorkers.end());
+                    m_retiredWorkers.clear();
+                }
+
+                if (m_wakeupFileDescriptor >= 0) {
+                    const uint64_t value = 1;
+                    if (write(m_wakeupFileDescriptor, &value, sizeof(value)) < 0) {
+                        // Threads are blocked until the next event.
+                    }
+                }
+
+                if (timeout > 0) {
+                    // Wait for the threads to leave their handlers.
+                    for (uint32_t i = 0; i < workers.size(); i++) {
+                        for (uint32_t waited = 0; !workers.at(i)->m_finished && (waited < timeout); waited++) {
+                            usleep(1000);
+                        }
+                    }
+
+                    // Threads still blocked in a handler are not joined; they are
+                    // kept (and their Thread objects are not destroyed) as they
+                    // end with the process.
+                    vector<std::shared_ptr<Worker> > blocked;
+                    for (uint32_t i = 0; i < workers.size(); i++) {
+                        if (!workers.at(i)->m_finished) {
+                            blocked.push_back(workers.at(i));
+                        }
+                    }
+                    if (!blocked.empty()) {
+                        CLOG3 << "[core::wrapper::POSIXReactor] " << blocked.size() << " thread(s) still blocked in handlers are not joined." << endl;
+
+                        Lock l(m_threadsMutex);
+                        m_retiredWorkers.insert(m_retiredWorkers.end(), blocked.begin(), blocked.end());
+                        return;
+                    }
+                }
+
+                for (uint32_t i = 0; i < workers.size(); i++) {
+                    workers.at(i)->m_thread->stop();
+                }
+                workers.clear();
+
+                if (m_wakeupFileDescriptor >= 0) {
+                    // Reset the level-triggered wakeup event for threads started later.
+                    uint64_t value = 0;
+                    if (read(m_wakeupFileDescriptor, &value, sizeof(value)) < 0) {
+                        // No wakeup event was pending.
+                    }
+                }
+
+                Lock l(m_threadsMutex);
+                m_idleThreads = static_cast<uint32_t>(m_workers.size());
+            }
+
+            bool POSIXReactor::isSupported() {
+#ifdef __linux__
+                return true;
+#else
+                return false;
+#endif
+            }
+
+            void POSIXReactor::setNumberOfThreads(const uint32_t &numberOfThreads) {
+                Lock l(m_threadsMutex);
+                m_numberOfThreads = max(static_cast<uint32_t>(1), min(numberOfThreads, static_cast<uint32_t>(MAX_THREADS)));
+                if (m_running) {
+                    startThreads();
+                }
+            }
+
+            uint32_t POSIXReactor::getNumberOfThreads() const {
+                Lock l(m_threadsMutex);
+                return static_cast<uint32_t>(m_workers.size());
+            }
+
+            uint32_t POSIXReactor::getNumberOfHandlers() const {
+                Lock l(m_registrationsCondition);
+                return static_cast<uint32_t>(m_registrations.size());
+            }
+
+            void POSIXReactor::startThreads() {
+                // m_threadsMutex is held by the caller.
+                while (m_workers.size() < m_numberOfThreads) {
+                    startThread(false);
+                }
+            }
+
+            void POSIXReactor::startSpareThread() {
+                Lock l(m_threadsMutex);
+                if (m_running && (m_idleThreads == 0) && (m_workers.size() < MAX_THREADS)) {
+                    startThread(true);
+                }
+            }
+
+            void POSIXReactor::startThread(const bool &spare) {
+                // m_threadsMutex is held by the caller.
+                std::shared_ptr<Worker> worker(new Worker(*this, spare));
+                worker->m_thread = std::shared_ptr<Thread>(ConcurrencyFactory::createThread(*worker));
+                if (worker->m_thread.get() == NULL) {
+                    stringstream s;
+                    s << "[core::wrapper::POSIXReactor] Error creating thread: " << strerror(errno);
+                    throw s.str();
+                }
+                m_idleThreads++;
+                worker->m_thread->start();
+                m_workers.push_back(worker);
+            }
+
+            bool POSIXReactor::retire(Worker &worker) {
+                Lock l(m_threadsMutex);
+
+                // Keep at least one other thread waiting for events.
+                if (!m_running || (m_idleThreads < 2)) {
+                    return false;
+                }
+
+                // Join the threads that have retired before; they do not
+                // need this lock anymore to end.
+                m_retiredWorkers.clear();
+
+                for (vector<std::shared_ptr<Worker> >::iterator it = m_workers.begin(); it != m_workers.end(); ++it) {
+                    if (it->get() == &worker) {
+                        // The thread cannot join itself; it is joined by the next retiring thread or by stop().
+                        m_retiredWorkers.push_back(*it);
+                        m_workers.erase(it);
+                        m_idleThreads--;
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            bool POSIXReactor::watch(const bool &isNew, const int32_t &fileDescriptor, const uint64_t &id) {
+                bool retVal = false;
+#ifdef __linux__
+                // One-shot events guarantee that only one thread handles a socket at a time.
+                struct epoll_event event;
+                memset(&event, 0, sizeof(event));
+                event.events = EPOLLIN | EPOLLONESHOT;
+                event.data.u64 = id;
+                retVal = (epoll_ctl(m_epollFileDescriptor, (isNew ? EPOLL_CTL_ADD : EPOLL_CTL_MOD), fileDescriptor, &event) == 0);
+#else
+                (void)isNew;
+                (void)fileDescriptor;
+                (void)id;
+#endif
+                return retVal;
+            }
+
+            void POSIXReactor::unwatch(const int32_t &fileDescriptor) {
+#ifdef __linux__
+                epoll_ctl(m_epollFileDescriptor, EPOLL_CTL_DEL, fileDescriptor, NULL);
+#else
+                (void)fileDescriptor;
+#endif
+            }
+
+            void POSIXReactor::add(const int32_t &fileDescriptor, Handler *handler) {
+                if (!isSupported() || (handler == NULL)) {
+                    return;
+                }
+
+                {
+                    Lock l(m_threadsMutex);
+                    if (!m_running) {
+                        m_running = true;
+                        startThreads();
+                    }
+                }
+
+                Lock l(m_registrationsCondition);
+                if (m_fileDescriptors.count(fileDescriptor) > 0) {
+                    return;
+                }
+
+                const uint64_t id = m_nextId++;
+                Registration &registration = m_registrations[id];
+                registration.m_fileDescriptor = fileDescriptor;
+                registration.m_handler = handler;
+                m_fileDescriptors[fileDescriptor] = id;
+
+                if (!watch(true, fileDescriptor, id)) {
+                    m_fileDescriptors.erase(fileDescriptor);
+                    m_registrations.erase(id);
+
+                    stringstream s;
+                    s << "[core::wrapper::POSIXReactor] Error while watching socket: " << strerror(errno);
+                    throw s.str();
+                }
+            }
+
+            void POSIXReactor::remove(const int32_t &fileDescriptor, Handler *handler) {
+                Lock l(m_registrationsCondition);
+                map<int32_t, uint64_t>::iterator it = m_fileDescriptors.find(fileDescriptor);
+                if ( (it == m_fileDescriptors.end()) || (m_registrations[it->second].m_handler != handler) ) {
+                    return;
+                }
+
+                const uint64_t id = it->second;
+                m_fileDescriptors.erase(it);
+                unwatch(fileDescriptor);
+
+                // Wait for the handler unless it removes itself.
+                while (m_registrations[id].m_busy && !pthread_equal(m_registrations[id].m_thread, pthread_self())) {
+                    m_registrationsCondition.waitOnSignal();
+                }
+                m_registrations.erase(id);
+            }
+
+            void POSIXReactor::dispatch(const uint64_t &id, char *buffer) {
+                Handler *handler = NULL;
+                int32_t fileDescriptor = -1;
+                {
+                    Lock l(m_registrationsCondition);
+                    map<uint64_t, Registration>::iterator it = m_registrations.find(id);
+                    if (it == m_registrations.end()) {
+                        // The socket was removed in the meantime.
+                        return;
+                    }
+                    it->second.m_busy = true;
+                    it->second.m_thread = pthread_self();
+                    handler = it->second.m_handler;
+                    fileDescriptor = it->second.m_fileDescriptor;
+                }
+
+                const bool keepWatching = handler->handleReadable(buffer, BUFFER_SIZE);
+
+                Lock l(m_registrationsCondition);
+                map<uint64_t, Registration>::iterator it = m_registrations.find(id);
+                if (it != m_registrations.end()) {
+                    it->second.m_busy = false;
+
+                    map<int32_t, uint64_t>::iterator jt = m_fileDescriptors.find(fileDescriptor);
+                    const bool isRegistered = ( (jt != m_fileDescriptors.end()) && (jt->second == id) );
+
+                    // If the socket is not registered anymore, remove() is waiting for this handler.
+                    if (isRegistered && !(keepWatching && watch(false, fileDescriptor, id))) {
+                        m_fileDescriptors.erase(jt);
+                        unwatch(fileDescriptor);
+                        m_registrations.erase(it);
+                    }
+                }
+                m_registrationsCondition.wakeAll();
+            }
+
+            bool POSIXReactor::isRunning() {
+                return m_running;
+            }
+
+            void POSIXReactor::run(Worker &worker) {
+#ifdef __linux__
+                vector<char> buffer(BUFFER_SIZE);
+                struct epoll_event event;
+
+                // Spare threads wait only for a limited time before they retire.
+                const int timeout = (worker.m_spare ? static_cast<int>(SPARE_THREAD_IDLE_TIME) : -1);
+
+                while (isRunning()) {
+                    // Only one event is taken at a time so that a blocking
+                    // handler does not delay events already fetched.
+                    const int numberOfEvents = epoll_wait(m_epollFileDescriptor, &event, 1, timeout);
+                    if (numberOfEvents == 1) {
+                        m_idleThreads--;
+                        if ( (event.data.u64 != 0) && isRunning() ) {
+                            // Handlers might block until data from other sockets
+                            // is received; thus, keep one thread waiting for events.
+                            if (m_idleThreads == 0) {
+                                startSpareThread();
+                            }
+
+                            dispatch(event.data.u64, &buffer[0]);
+                        }
+                        m_idleThreads++;
+                    }
+                    else if ( (numberOfEvents == 0) && retire(worker) ) {
+                        break;
+                    }
+                }
+#else
+                (void)worker;
+#endif
+            }
+
+        }
+    }
+} // odcore::wrapper::POSIX
@@ -17,6 +17,7 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <fcntl.h>
 #include <netinet/in.h>
 #include <sys/select.h>
 #include <sys/socket.h>
@@ -46,12 +47,16 @@ namespace odcore {
                 m_listenerMutex(),
                 m_listener(NULL),
                 m_fileDescriptor(0),
-                m_port(port) {
-                m_thread = unique_ptr<Thread>(ConcurrencyFactory::createThread(*this));
-                if (m_thread.get() == NULL) {
-                    stringstream s;
-                    s << "[core::wrapper::POSIXTCPAcceptor] Error creating thread: " << strerror(errno);
-                    throw s.str();
+                m_port(port),
+                m_isRunning(false) {
+                // Without POSIXReactor, the acceptor needs its own thread.
+                if (!POSIXReactor::isSupported()) {
+                    m_thread = unique_ptr<Thread>(ConcurrencyFactory::createThread(*this));
+                    if (m_thread.get() == NULL) {
+                        stringstream s;
+                        s << "[core::wrapper::POSIXTCPAcceptor] Error creating thread: " << strerror(errno);
+                        throw s.str();
+                    }
                 }
 
                 m_listenerMutex = unique_ptr<Mutex>(MutexFactory::createMutex());
@@ -101,11 +106,14 @@ namespace odcore {
                     s << "[core::wrapper::POSIXTCPAcceptor] Listen failed: " << strerror(errno);
                     throw s.str();
                 }
+
+                // Do not block if a pending connection was reset before accepting it.
+                fcntl(m_fileDescriptor, F_SETFL, fcntl(m_fileDescriptor, F_GETFL, 0) | O_NONBLOCK);
             }
 
             POSIXTCPAcceptor::~POSIXTCPAcceptor() {
+                stop();
                 setAcceptorListener(NULL);
-                close(m_fileDescriptor);
             }
 
             void POSIXTCPAcceptor::setAcceptorListener(odcore::io::tcp::TCPAcceptorListener* listener) {
@@ -126,17 +134,61 @@ namespace odcore {
             }
 
             void POSIXTCPAcceptor::start() {
-                m_thread->start();
+                if (m_fileDescriptor < 0) {
+                    // A stopped acceptor cannot be restarted.
+                    return;
+                }
+
+                if (POSIXReactor::isSupported()) {
+                    m_isRunning = true;
+                    POSIXReactor::getInstance().add(m_fileDescriptor, this);
+                }
+                else {
+                    m_thread->start();
+                }
             }
 
             void POSIXTCPAcceptor::stop() {
-                m_thread->stop();
+                if (POSIXReactor::isSupported()) {
+                    POSIXReactor::getInstance().remove(m_fileDescriptor, this);
+                    m_isRunning = false;
+                }
+                else {
+                    m_thread->stop();
+                }
+
+                // Refuse further connections.
+                if (m_fileDescriptor >= 0) {
+                    close(m_fileDescriptor);
+                    m_fileDescriptor = -1;
+                }
             }
 
             bool POSIXTCPAcceptor::isRunning() {
+                if (POSIXReactor::isSupported()) {
+                    return m_isRunning;
+                }
                 return m_thread->isRunning();
             }
 
+            bool POSIXTCPAcceptor::handleReadable(char */*buffer*/, const uint32_t &/*size*/) {
+                acceptConnection();
+                return true;
+            }
+
+            void POSIXTCPAcceptor::acceptConnection() {
+                sockaddr clientsock;
+                socklen_t csize = sizeof(clientsock);
+
+                int32_t client = accept(m_fileDescriptor, &clientsock, &csize);
+                if (client >= 0) {
+                    // Some platforms pass O_NONBLOCK on to the accepted socket.
+                    fcntl(client, F_SETFL, fcntl(client, F_GETFL, 0) & ~O_NONBLOCK);
+
+                    invokeAcceptorListener(std::shared_ptr<odcore::io::tcp::TCPConnection>(new POSIXTCPConnection(client)));
+                }
+            }
+
             void POSIXTCPAcceptor::run() {
                 fd_set rfds;
                 struct timeval timeout;
@@ -151,16 +203,9 @@ namespace odcore {
                     select(m_fileDescriptor + 1, &rfds, NULL, NULL, &timeout);
 
                     if (FD_ISSET(m_fileDescriptor, &rfds)) {
-                        sockaddr clientsock;
-                        socklen_t csize = sizeof(clientsock);
-
-                        int32_t client = accept(m_fileDescriptor, &clientsock, &csize);
-                        if (client >= 0) {
-                            invokeAcceptorListener(std::shared_ptr<odcore::io::tcp::TCPConnection>(new POSIXTCPConnection(client)));
-                        }
+                        acceptConnection();
                     }
                 }
-                close(m_fileDescriptor);
             }
 
         }
@@ -20,9 +20,11 @@
 #include <netdb.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <cerrno>
 #include <cstring>
 #include <sstream>
+#include <vector>
 
 #include "opendavinci/odcore/wrapper/ConcurrencyFactory.h"
 #include "opendavinci/odcore/wrapper/Mutex.h"
@@ -40,7 +42,7 @@ namespace odcore {
                 m_thread(),
                 m_socketMutex(),
                 m_fileDescriptor(fileDescriptor),
-                m_buffer(),
+                m_isRunning(false),
                 m_ip(""),
                 m_port(0) {
                 initialize();
@@ -50,7 +52,7 @@ namespace odcore {
                 m_thread(),
                 m_socketMutex(),
                 m_fileDescriptor(-1),
-                m_buffer(),
+                m_isRunning(false),
                 m_ip(ip),
                 m_port(port) {
                 initialize();
@@ -99,18 +101,57 @@ namespace odcore {
             }
 
             void POSIXTCPConnection::start() {
-                m_thread->start();
+                if (POSIXReactor::isSupported()) {
+                    m_isRunning = true;
+                    POSIXReactor::getInstance().add(m_fileDescriptor, this);
+                }
+                else {
+                    m_thread->start();
+                }
             }
 
             void POSIXTCPConnection::stop() {
-                m_thread->stop();
+                if (POSIXReactor::isSupported()) {
+                    POSIXReactor::getInstance().remove(m_fileDescriptor, this);
+                    m_isRunning = false;
+                }
+                else {
+                    m_thread->stop();
+                }
             }
 
             bool POSIXTCPConnection::isRunning() {
+                if (POSIXReactor::isSupported()) {
+                    return m_isRunning;
+                }
                 return m_thread->isRunning();
             }
 
+            bool POSIXTCPConnection::handleReadable(char *buffer, const uint32_t &size) {
+                return receive(buffer, size);
+            }
+
+            bool POSIXTCPConnection::receive(char *buffer, const uint32_t &size) {
+                int32_t numBytes = recv(m_fileDescriptor, buffer, size, MSG_DONTWAIT);
+
+                if (numBytes > 0) {
+                    // Process data in higher layers.
+                    receivedString(string(buffer, numBytes));
+                    return true;
+                }
+
+                if ( (numBytes < 0) && ((errno == EAGAIN) || (errno == EINTR)) ) {
+                    // No data available yet.
+                    return true;
+                }
+
+                // Handle error: numBytes == 0 if peer shut down, numBytes < 0 in any case of error.
+                invokeConnectionListener();
+                return false;
+            }
+
             void POSIXTCPConnection::run() {
+                vector<char> buffer(POSIXReactor::BUFFER_SIZE);
                 fd_set rfds;
                 struct timeval timeout;
                 bool ready = true;
@@ -125,20 +166,7 @@ namespace odcore {
                     select(m_fileDescriptor + 1, &rfds, NULL, NULL, &timeout);
 
                     if (FD_ISSET(m_fileDescriptor, &rfds)) {
-                        int32_t numBytes = recv(m_fileDescriptor, m_buffer, BUFFER_SIZE, 0);
-
-                        if (numBytes > 0 ) {
-                            // Get data.
-                            string stringData(m_buffer, numBytes);
-
-                            // Process data in higher layers.
-                            receivedString(stringData);
-                        }
-                        else if (numBytes <= 0) {
-                            // Handle error: numBytes == 0 if peer shut down, numBytes < 0 in any case of error.
-                            invokeConnectionListener();
-                            ready = false;
-                        }
+                        ready = receive(&buffer[0], static_cast<uint32_t>(buffer.size()));
                     }
                 }
             }
@@ -154,13 +182,56 @@ namespace odcore {
                 m_socketMutex->unlock();
             }
 
+            void POSIXTCPConnection::sendWithHeaderImplementation(const std::string &header, const std::string &data) {
+                // Send size information and data with one system call.
+                iovec parts[2];
+                parts[0].iov_base = const_cast<char*>(header.data());
+                parts[0].iov_len = header.length();
+                parts[1].iov_base = const_cast<char*>(data.data());
+                parts[1].iov_len = data.length();
+
+                msghdr message;
+                memset(&message, 0, sizeof(message));
+                message.msg_iov = parts;
+                message.msg_iovlen = 2;
+
+                m_socketMutex->lock();
+                while ((parts[0].iov_len + parts[1].iov_len) > 0) {
+                    const ssize_t numBytes = ::sendmsg(m_fileDescriptor, &message, 0);
+
+                    if (numBytes == -1) {
+                        if (errno == EINTR) {
+                            continue;
+                        }
+
+                        // Handle error.
+                        invokeConnectionListener();
+                        break;
+                    }
+
+                    // Skip the parts that were sent completely.
+                    size_t sent = static_cast<size_t>(numBytes);
+                    for (uint32_t i = 0; i < 2; i++) {
+                        const size_t n = (sent < parts[i].iov_len) ? sent : parts[i].iov_len;
+                        parts[i].iov_base = static_cast<char*>(parts[i].iov_base) + n;
+                        parts[i].iov_len -= n;
+                        sent -= n;
+                    }
+                    message.msg_iov = (parts[0].iov_len > 0) ? parts : (parts + 1);
+                    message.msg_iovlen = (parts[0].iov_len > 0) ? 2 : 1;
+                }
+                m_socketMutex->unlock();
+            }
 
             void POSIXTCPConnection::initialize() {
-                m_thread = unique_ptr<Thread>(ConcurrencyFactory::createThread(*this));
-                if (m_thread.get() == NULL) {
-                    stringstream s;
-                    s << "[core::wrapper::POSIXTCPConnection] Error creating thread: " << strerror(errno);
-                    throw s.str();
+                // Without POSIXReactor, every connection needs its own thread.
+                if (!POSIXReactor::isSupported()) {
+                    m_thread = unique_ptr<Thread>(ConcurrencyFactory::createThread(*this));
+                    if (m_thread.get() == NULL) {
+                        stringstream s;
+                        s << "[core::wrapper::POSIXTCPConnection] Error creating thread: " << strerror(errno);
+                        throw s.str();
+                    }
                 }
 
                 m_socketMutex = unique_ptr<Mutex>(MutexFactory::createMutex());
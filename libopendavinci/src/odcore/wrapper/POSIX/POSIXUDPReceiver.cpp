@@ -17,13 +17,17 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <arpa/inet.h>
 #include <netinet/in.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <sstream>
+#include <vector>
 
 #include "opendavinci/odcore/io/Packet.h"
 #include "opendavinci/odcore/wrapper/ConcurrencyFactory.h"
@@ -42,7 +46,16 @@ namespace odcore {
                 m_mreq(),
                 m_fd(),
                 m_buffer(NULL),
-                m_thread() {
+                m_thread(),
+                m_batchSize(1),
+                m_senderAddresses(),
+                m_isRunning(false),
+#ifdef __linux__
+                m_messages(),
+#endif
+                m_batchBuffers(),
+                m_iovecs(),
+                m_remotes() {
                 m_buffer = new char[BUFFER_SIZE];
                 if (m_buffer == NULL) {
                     stringstream s;
@@ -91,12 +104,14 @@ namespace odcore {
                     }
                 }
 
-                // Create thread for encapsulating waiting for receiving data.
-                m_thread = unique_ptr<Thread>(ConcurrencyFactory::createThread(*this));
-                if (m_thread.get() == NULL) {
-                    stringstream s;
-                    s << "[POSIXUDPReceiver] Error creating thread: " << strerror(errno);
-                    throw s.str();
+                // Without POSIXReactor, create thread for encapsulating waiting for receiving data.
+                if (!POSIXReactor::isSupported()) {
+                    m_thread = unique_ptr<Thread>(ConcurrencyFactory::createThread(*this));
+                    if (m_thread.get() == NULL) {
+                        stringstream s;
+                        s << "[POSIXUDPReceiver] Error creating thread: " << strerror(errno);
+                        throw s.str();
+                    }
                 }
             }
 
@@ -113,12 +128,42 @@ namespace odcore {
                 m_buffer = NULL;
             }
 
+            void POSIXUDPReceiver::setReceiveBufferSize(const uint32_t &size) {
+                const int32_t bufferSize = static_cast<int32_t>(size);
+                if (setsockopt(m_fd, SOL_SOCKET, SO_RCVBUF, &bufferSize, sizeof(bufferSize)) < 0) {
+                    stringstream s;
+                    s << "[POSIXUDPReceiver] Error while setting receive buffer size: " << strerror(errno);
+                    throw s.str();
+                }
+            }
+
+            void POSIXUDPReceiver::setBatchSize(const uint32_t &numberOfPackets) {
+                m_batchSize = max(static_cast<uint32_t>(1), min(numberOfPackets, static_cast<uint32_t>(MAX_BATCH_SIZE)));
+            }
+
+            const string& POSIXUDPReceiver::getSenderAddress(const uint32_t &address) {
+                map<uint32_t, string>::const_iterator it = m_senderAddresses.find(address);
+                if (it != m_senderAddresses.end()) {
+                    return it->second;
+                }
+
+                if (m_senderAddresses.size() >= MAX_CACHED_SENDER_ADDRESSES) {
+                    m_senderAddresses.clear();
+                }
+
+                struct in_addr addr;
+                addr.s_addr = address;
+                char remoteAddr[INET_ADDRSTRLEN];
+                if (inet_ntop(AF_INET, &addr, remoteAddr, sizeof(remoteAddr)) == NULL) {
+                    remoteAddr[0] = '\0';
+                }
+
+                return (m_senderAddresses[address] = string(remoteAddr));
+            }
+
             void POSIXUDPReceiver::run() {
                 fd_set rfds;
                 struct timeval timeout;
-                int32_t nbytes = 0;
-
-                struct sockaddr_storage remote;
 
                 while (isRunning()) {
                     timeout.tv_sec = 1;
@@ -130,25 +175,84 @@ namespace odcore {
                     select(m_fd + 1, &rfds, NULL, NULL, &timeout);
 
                     if (FD_ISSET(m_fd, &rfds)) {
-                        // Get data and sender address.
-                        size_t addrLength = sizeof(remote);
-                        nbytes = recvfrom(m_fd, m_buffer, BUFFER_SIZE, 0, reinterpret_cast<struct sockaddr *>(&remote), reinterpret_cast<socklen_t*>(&addrLength));
-
-                        if (nbytes > 0) {
-                            // Get sender address.
-                            const uint32_t MAX_ADDR_SIZE = 1024;
-                            char remoteAddr[MAX_ADDR_SIZE];
-                            inet_ntop(remote.ss_family, &((reinterpret_cast<struct sockaddr_in*>(&remote))->sin_addr), remoteAddr, sizeof(remoteAddr));
-
-                            // ----------------------v (remote address)--v (data)
-                            nextPacket(odcore::io::Packet(string(remoteAddr), string(m_buffer, nbytes)));
-                        }
+                        receive(m_buffer, BUFFER_SIZE);
                     }
                 }
             }
 
+            bool POSIXUDPReceiver::handleReadable(char *buffer, const uint32_t &size) {
+                receive(buffer, size);
+                return true;
+            }
+
+            void POSIXUDPReceiver::receive(char *buffer, const uint32_t &size) {
+                if (m_batchSize > 1) {
+                    receiveBatched();
+                }
+                else {
+                    receiveSingle(buffer, size);
+                }
+            }
+
+            void POSIXUDPReceiver::receiveSingle(char *buffer, const uint32_t &size) {
+                struct sockaddr_in remote;
+
+                // Get data and sender address.
+                socklen_t addrLength = sizeof(remote);
+                const int32_t nbytes = recvfrom(m_fd, buffer, size, MSG_DONTWAIT, reinterpret_cast<struct sockaddr *>(&remote), &addrLength);
+
+                if (nbytes > 0) {
+                    // ----------------------v (remote address)--v (data)
+                    nextPacket(odcore::io::Packet(getSenderAddress(remote.sin_addr.s_addr), string(buffer, nbytes)));
+                }
+            }
+
+            void POSIXUDPReceiver::receiveBatched() {
+#ifdef __linux__
+                const uint32_t batchSize = m_batchSize;
+
+                // One buffer per packet to be received at once.
+                if (m_messages.size() != batchSize) {
+                    m_batchBuffers.resize(batchSize * BUFFER_SIZE);
+                    m_iovecs.resize(batchSize);
+                    m_remotes.resize(batchSize);
+                    m_messages.resize(batchSize);
+                }
+
+                for (uint32_t i = 0; i < batchSize; i++) {
+                    m_iovecs[i].iov_base = &m_batchBuffers[i * BUFFER_SIZE];
+                    m_iovecs[i].iov_len = BUFFER_SIZE;
+
+                    memset(&m_messages[i], 0, sizeof(struct mmsghdr));
+                    m_messages[i].msg_hdr.msg_name = &m_remotes[i];
+                    m_messages[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+                    m_messages[i].msg_hdr.msg_iov = &m_iovecs[i];
+                    m_messages[i].msg_hdr.msg_iovlen = 1;
+                }
+
+                // Fetch all packets that are available without waiting for further ones.
+                const int32_t received = recvmmsg(m_fd, &m_messages[0], batchSize, MSG_DONTWAIT, NULL);
+
+                for (int32_t i = 0; i < received; i++) {
+                    if (m_messages[i].msg_len > 0) {
+                        // ----------------------v (remote address)--v (data)
+                        nextPacket(odcore::io::Packet(getSenderAddress(m_remotes[i].sin_addr.s_addr), string(&m_batchBuffers[i * BUFFER_SIZE], m_messages[i].msg_len)));
+                    }
+                }
+#else
+                // recvmmsg is not available on this platform.
+                receiveSingle(m_buffer, BUFFER_SIZE);
+#endif
+            }
+
             void POSIXUDPReceiver::start() {
-                m_thread->start();
+                if (POSIXReactor::isSupported()) {
+                    m_isRunning = true;
+                    POSIXReactor::getInstance().add(m_fd, this);
+                }
+                else {
+                    m_thread->start();
+                }
             }
 
             void POSIXUDPReceiver::stop() {
@@ -157,13 +261,25 @@ namespace odcore {
                     setsockopt(m_fd, IPPROTO_IP, IP_DROP_MEMBERSHIP, &m_mreq, sizeof(m_mreq));
                 }
 
-                // Interrupt socket.
-                shutdown(m_fd, SHUT_RDWR);
+                if (POSIXReactor::isSupported()) {
+                    POSIXReactor::getInstance().remove(m_fd, this);
+                    m_isRunning = false;
+
+                    // Interrupt socket.
+                    shutdown(m_fd, SHUT_RDWR);
+                }
+                else {
+                    // Interrupt socket.
+                    shutdown(m_fd, SHUT_RDWR);
 
-                m_thread->stop();
+                    m_thread->stop();
+                }
             }
 
             bool POSIXUDPReceiver::isRunning() {
+                if (POSIXReactor::isSupported()) {
+                    return m_isRunning;
+                }
                 return m_thread->isRunning();
             }
         }
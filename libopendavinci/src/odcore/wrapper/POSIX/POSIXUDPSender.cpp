@@ -18,7 +18,9 @@
  */
 
 #include <sys/socket.h>
+#include <sys/uio.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <sstream>
@@ -81,6 +83,57 @@ namespace odcore {
                 m_socketMutex->unlock();
             }
 
+            void POSIXUDPSender::sendBatch(const vector<string> &data) const {
+                for (vector<string>::const_iterator it = data.begin(); it != data.end(); ++it) {
+                    if (it->length() > POSIXUDPSender::MAX_UDP_PACKET_SIZE) {
+                        stringstream s;
+                        s << "[core::wrapper::POSIXUDPSender] Data to be sent is too large (" << it->length() << " > " << POSIXUDPSender::MAX_UDP_PACKET_SIZE << ").";
+                        throw s.str();
+                    }
+                }
+
+#ifdef __linux__
+                const uint32_t size = static_cast<uint32_t>(data.size());
+                const uint32_t chunkSize = min(size, static_cast<uint32_t>(MAX_BATCH_SIZE));
+                if (chunkSize == 0) {
+                    return;
+                }
+
+                vector<struct iovec> iovecs(chunkSize);
+                vector<struct mmsghdr> messages(chunkSize);
+
+                m_socketMutex->lock();
+                {
+                    uint32_t sent = 0;
+                    while (sent < size) {
+                        const uint32_t count = min(size - sent, chunkSize);
+                        for (uint32_t i = 0; i < count; i++) {
+                            const string &packet = data[sent + i];
+                            iovecs[i].iov_base = const_cast<char*>(packet.data());
+                            iovecs[i].iov_len = packet.length();
+
+                            memset(&messages[i], 0, sizeof(struct mmsghdr));
+                            messages[i].msg_hdr.msg_name = const_cast<struct sockaddr_in*>(&m_address);
+                            messages[i].msg_hdr.msg_namelen = sizeof(m_address);
+                            messages[i].msg_hdr.msg_iov = &iovecs[i];
+                            messages[i].msg_hdr.msg_iovlen = 1;
+                        }
+
+                        const int32_t result = sendmmsg(m_fd, &messages[0], count, 0);
+                        if (result <= 0) {
+                            // Like send(...), give up silently on errors.
+                            break;
+                        }
+                        sent += static_cast<uint32_t>(result);
+                    }
+                }
+                m_socketMutex->unlock();
+#else
+                // sendmmsg is not available on this platform.
+                UDPSender::sendBatch(data);
+#endif
+            }
+
         }
     }
 } // odcore::wrapper::POSIX
@@ -50,6 +50,7 @@ namespace odcore {
             m_connectionListener(NULL),
             m_stringListenerMutex(),
             m_stringListener(NULL),
+            m_sendMutex(),
             m_serial(NULL) {
             m_connectionListenerMutex = unique_ptr<Mutex>(MutexFactory::createMutex());
             if (m_connectionListenerMutex.get() == NULL) {
@@ -61,6 +62,11 @@ namespace odcore {
                 throw std::string("[core::wrapper::SerialPort] Error creating mutex for string listener.");
             }
 
+            m_sendMutex = unique_ptr<Mutex>(MutexFactory::createMutex());
+            if (m_sendMutex.get() == NULL) {
+                throw std::string("[core::wrapper::SerialPort] Error creating mutex for sending.");
+            }
+
             m_thread = unique_ptr<Thread>(ConcurrencyFactory::createThread(*this));
             if (m_thread.get() == NULL) {
                 throw std::string("[core::wrapper::SerialPort] Error creating thread.");
@@ -129,12 +135,25 @@ namespace odcore {
         }
 
         void SerialPort::send(const string& data) {
-            if (data.size() > 0) {
+            sendFramed("", data, "");
+        }
+
+        void SerialPort::sendFramed(const string &header, const string &payload, const string &trailer) {
+            if ( (header.size() + payload.size() + trailer.size()) > 0) {
                 if (reinterpret_cast<serial::Serial*>(m_serial)->isOpen()) {
+                    m_sendMutex->lock();
                     try {
-                        reinterpret_cast<serial::Serial*>(m_serial)->write(data);
+                        const string* parts[] = { &header, &payload, &trailer };
+                        for (uint32_t i = 0; i < 3; i++) {
+                            if (parts[i]->size() > 0) {
+                                reinterpret_cast<serial::Serial*>(m_serial)->write(reinterpret_cast<const uint8_t*>(parts[i]->data()), parts[i]->size());
+                            }
+                        }
+                        m_sendMutex->unlock();
                     }
                     catch(...) {
+                        m_sendMutex->unlock();
+
                         // In the case of an exception, invoke the connection listener.
                         invokeConnectionListener();
                     }
@@ -0,0 +1,111 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <iostream>
+
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/wrapper/WIN32/WIN32MemoryMappedFile.h"
+
+namespace odcore {
+    namespace wrapper {
+        namespace WIN32Impl {
+
+            using namespace std;
+
+            WIN32MemoryMappedFile::WIN32MemoryMappedFile(const string &name) :
+                    m_name(name),
+                    m_valid(false),
+                    m_file(INVALID_HANDLE_VALUE),
+                    m_mapping(NULL),
+                    m_data(NULL),
+                    m_size(0) {
+
+                m_file = CreateFile(m_name.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+                if (m_file == INVALID_HANDLE_VALUE) {
+                    const int retcode = GetLastError();
+                    CLOG3 << "File could not be opened: " << retcode << endl;
+                    return;
+                }
+
+                LARGE_INTEGER size;
+                if (GetFileSizeEx(m_file, &size)) {
+                    m_size = static_cast<uint64_t>(size.QuadPart);
+
+                    if (m_size == 0) {
+                        // Empty files cannot be mapped but are valid nonetheless.
+                        m_valid = true;
+                    }
+                    else {
+                        m_mapping = CreateFileMapping(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+                        if (m_mapping == NULL) {
+                            const int retcode = GetLastError();
+                            CLOG3 << "File could not be mapped: " << retcode << endl;
+                            m_size = 0;
+                        }
+                        else {
+                            m_data = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+                            if (m_data == NULL) {
+                                const int retcode = GetLastError();
+                                CLOG3 << "Could not map view of file: " << retcode << endl;
+                                m_size = 0;
+                            }
+                            else {
+                                m_valid = true;
+                            }
+                        }
+                    }
+                }
+            }
+
+            WIN32MemoryMappedFile::~WIN32MemoryMappedFile() {
+                if (m_data != NULL) {
+                    UnmapViewOfFile(m_data);
+                }
+                m_data = NULL;
+
+                if (m_mapping != NULL) {
+                    CloseHandle(m_mapping);
+                }
+                m_mapping = NULL;
+
+                if (m_file != INVALID_HANDLE_VALUE) {
+                    CloseHandle(m_file);
+                }
+                m_file = INVALID_HANDLE_VALUE;
+            }
+
+            bool WIN32MemoryMappedFile::isValid() const {
+                return m_valid;
+            }
+
+            const string WIN32MemoryMappedFile::getName() const {
+                return m_name;
+            }
+
+            const char* WIN32MemoryMappedFile::getData() const {
+                return static_cast<const char*>(m_data);
+            }
+
+            uint64_t WIN32MemoryMappedFile::getSize() const {
+                return m_size;
+            }
+
+        }
+    }
+} // odcore::wrapper::WIN32Impl
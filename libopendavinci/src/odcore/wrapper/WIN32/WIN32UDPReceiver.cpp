@@ -195,6 +195,16 @@ namespace odcore {
                 }
             }
 
+            void WIN32UDPReceiver::setReceiveBufferSize(const uint32_t &size) {
+                const int bufferSize = static_cast<int>(size);
+                if (::setsockopt(m_fd, SOL_SOCKET, SO_RCVBUF, (char*)&bufferSize, sizeof(bufferSize)) < 0) {
+                    stringstream s;
+                    const int retcode = WSAGetLastError();
+                    s << "[core::wrapper::WIN32UDPReceiver] Error while setting receive buffer size: " << retcode;
+                    throw s.str();
+                }
+            }
+
             void WIN32UDPReceiver::start() {
                 m_thread->start();
             }
@@ -0,0 +1,197 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#ifndef WIN32
+# if !defined(__OpenBSD__) && !defined(__NetBSD__)
+#  pragma GCC diagnostic push
+# endif
+# pragma GCC diagnostic ignored "-Weffc++"
+#endif
+    #include "jpge.h"
+#ifndef WIN32
+# if !defined(__OpenBSD__) && !defined(__NetBSD__)
+#  pragma GCC diagnostic pop
+# endif
+#endif
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/wrapper/jpg/ParallelJPGEncoder.h"
+
+namespace odcore {
+    namespace wrapper {
+        namespace jpg {
+
+            using namespace std;
+            using namespace odcore::base;
+
+            /**
+             * This class appends the compressed data to a buffer.
+             */
+            class BufferOutputStream : public jpge::output_stream {
+                private:
+                    BufferOutputStream(const BufferOutputStream &/*obj*/);
+                    BufferOutputStream& operator=(const BufferOutputStream &/*obj*/);
+
+                public:
+                    BufferOutputStream(vector<uint8_t> &buffer) :
+                        m_buffer(buffer) {}
+
+                    virtual ~BufferOutputStream() {}
+
+                    virtual bool put_buf(const void* data, int length) {
+                        const uint8_t *begin = static_cast<const uint8_t*>(data);
+                        m_buffer.insert(m_buffer.end(), begin, begin + length);
+                        return true;
+                    }
+
+                private:
+                    vector<uint8_t> &m_buffer;
+            };
+
+            static jpge::params getParameters(const uint32_t &bytesPerPixel, const uint32_t &quality) {
+                jpge::params p;
+                p.m_quality = quality;
+                p.m_subsampling = (bytesPerPixel == 1) ? jpge::Y_ONLY : jpge::H2V2;
+                p.m_restart_mcu_rows = ParallelJPGEncoder::MCU_ROWS_PER_STRIP;
+                return p;
+            }
+
+            ParallelJPGEncoder::ParallelJPGEncoder(const uint32_t &numberOfThreads) :
+                m_workPool(numberOfThreads),
+                m_compressMutex(),
+                m_width(0),
+                m_height(0),
+                m_bytesPerPixel(0),
+                m_rawImageData(NULL),
+                m_quality(0),
+                m_numberOfStrips(0),
+                m_header(),
+                m_strips(),
+                m_stripCompressed() {}
+
+            ParallelJPGEncoder::~ParallelJPGEncoder() {}
+
+            uint32_t ParallelJPGEncoder::getNumberOfThreads() const {
+                return m_workPool.getNumberOfThreads();
+            }
+
+            uint32_t ParallelJPGEncoder::getStripHeight() const {
+                // Size of an MCU: 8x8 for grayscale and 16x16 for H2V2 subsampled color images.
+                return MCU_ROWS_PER_STRIP * ((m_bytesPerPixel == 1) ? 8 : 16);
+            }
+
+            bool ParallelJPGEncoder::compress(void *dest, int &destSize, const uint32_t &width, const uint32_t &height, const uint32_t &bytesPerPixel, const uint8_t *rawImageData, const uint32_t &quality) {
+                if ( (dest == NULL) ||
+                     (destSize <= 0) ||
+                     (width == 0) ||
+                     (height == 0) ||
+                     (bytesPerPixel == 0) ||
+                     (rawImageData == NULL) ||
+                     (quality < 1) ||
+                     (quality > 100) ) {
+                    return false;
+                }
+
+                Lock l(m_compressMutex);
+
+                // The headers are the same as for compressing the image at once.
+                m_header.clear();
+                {
+                    BufferOutputStream header(m_header);
+                    jpge::jpeg_encoder encoder;
+                    if (!encoder.init(&header, width, height, bytesPerPixel, getParameters(bytesPerPixel, quality))) {
+                        return false;
+                    }
+                }
+
+                m_width = width;
+                m_height = height;
+                m_bytesPerPixel = bytesPerPixel;
+                m_rawImageData = rawImageData;
+                m_quality = quality;
+                m_numberOfStrips = (height + getStripHeight() - 1) / getStripHeight();
+                if (m_strips.size() < m_numberOfStrips) {
+                    m_strips.resize(m_numberOfStrips);
+                }
+                m_stripCompressed.assign(m_numberOfStrips, 0);
+
+                m_workPool.execute(*this, m_numberOfStrips);
+
+                // Join the strips separated by RSTn markers.
+                uint64_t size = m_header.size() + 2 * m_numberOfStrips;
+                for (uint32_t strip = 0; strip < m_numberOfStrips; strip++) {
+                    if (m_stripCompressed.at(strip) == 0) {
+                        return false;
+                    }
+                    size += m_strips.at(strip).size();
+                }
+                if (size > static_cast<uint64_t>(destSize)) {
+                    return false;
+                }
+
+                uint8_t *out = static_cast<uint8_t*>(dest);
+                ::memcpy(out, &m_header[0], m_header.size());
+                out += m_header.size();
+                for (uint32_t strip = 0; strip < m_numberOfStrips; strip++) {
+                    const vector<uint8_t> &data = m_strips.at(strip);
+                    if (!data.empty()) {
+                        ::memcpy(out, &data[0], data.size());
+                        out += data.size();
+                    }
+
+                    // RSTn markers between the strips and EOI at the end.
+                    *out++ = 0xFF;
+                    *out++ = ((strip + 1) < m_numberOfStrips) ? static_cast<uint8_t>(0xD0 + (strip & 7)) : 0xD9;
+                }
+
+                destSize = static_cast<int>(size);
+                return true;
+            }
+
+            void ParallelJPGEncoder::process(const uint32_t &item) {
+                m_stripCompressed[item] = compressStrip(item) ? 1 : 0;
+            }
+
+            bool ParallelJPGEncoder::compressStrip(const uint32_t &strip) {
+                vector<uint8_t> &buffer = m_strips[strip];
+                buffer.clear();
+
+                BufferOutputStream out(buffer);
+                jpge::jpeg_encoder encoder;
+                if (!encoder.init_strip(&out, m_width, m_height, m_bytesPerPixel, getParameters(m_bytesPerPixel, m_quality))) {
+                    return false;
+                }
+
+                const uint32_t bytesPerLine = m_width * m_bytesPerPixel;
+                const uint32_t first = strip * getStripHeight();
+                const uint32_t last = min(first + getStripHeight(), m_height);
+                for (uint32_t line = first; line < last; line++) {
+                    if (!encoder.process_scanline(m_rawImageData + line * bytesPerLine)) {
+                        return false;
+                    }
+                }
+                return encoder.process_scanline(NULL);
+            }
+
+        }
+    }
+} // odcore::wrapper::jpg
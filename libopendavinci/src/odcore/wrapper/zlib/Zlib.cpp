@@ -95,6 +95,27 @@ namespace odcore {
                 return result;
             }
 
+            bool Zlib::compressBlock(const char *data, const uint32_t &length, string &out) {
+                uLongf compressedLength = compressBound(length);
+                out.resize(compressedLength);
+
+                const int ret = compress2(reinterpret_cast<Bytef*>(&out[0]), &compressedLength, reinterpret_cast<const Bytef*>(data), length, Z_BEST_SPEED);
+                out.resize((ret == Z_OK) ? compressedLength : 0);
+                return (ret == Z_OK);
+            }
+
+            bool Zlib::decompressBlock(const char *data, const uint32_t &length, const uint32_t &decompressedLength, string &out) {
+                uLongf actualLength = decompressedLength;
+                out.resize(decompressedLength);
+
+                const int ret = uncompress(reinterpret_cast<Bytef*>(&out[0]), &actualLength, reinterpret_cast<const Bytef*>(data), length);
+                const bool success = (ret == Z_OK) && (actualLength == decompressedLength);
+                if (!success) {
+                    out.clear();
+                }
+                return success;
+            }
+
         }
     }
 } // odcore::wrapper::zlib
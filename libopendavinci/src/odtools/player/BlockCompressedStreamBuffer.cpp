@@ -0,0 +1,258 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <iostream>
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/wrapper/zlib/Zlib.h"
+#include "opendavinci/odtools/player/BlockCompressedStreamBuffer.h"
+#include "opendavinci/odtools/recorder/BlockCompressedOutputStream.h"
+
+namespace odtools {
+    namespace player {
+
+        using namespace std;
+        using namespace odcore::base;
+        using namespace odtools::recorder;
+
+        BlockCompressedStreamBuffer::Block::Block() :
+            m_offset(0),
+            m_compressedSize(0),
+            m_size(0),
+            m_position(0) {}
+
+        BlockCompressedStreamBuffer::BlockCompressedStreamBuffer(const char *data, const uint64_t &size) :
+            streambuf(),
+            Service(),
+            m_data(data),
+            m_blocks(),
+            m_size(0),
+            m_currentBlock(0),
+            m_current(),
+            m_prefetchCondition(),
+            m_prefetchBlock(0),
+            m_prefetchRequested(false),
+            m_prefetchReady(false),
+            m_prefetch() {
+            // Collect the blocks; an incomplete last block from an aborted recording is skipped.
+            uint64_t offset = BlockCompressedOutputStream::HEADER_SIZE;
+            while ((offset + BlockCompressedOutputStream::BLOCK_HEADER_SIZE) <= size) {
+                Block block;
+                block.m_compressedSize = readUInt32(m_data + offset);
+                block.m_size = readUInt32(m_data + offset + 4);
+                block.m_offset = offset + BlockCompressedOutputStream::BLOCK_HEADER_SIZE;
+                block.m_position = m_size;
+
+                if ((block.m_offset + block.m_compressedSize) > size) {
+                    break;
+                }
+
+                m_blocks.push_back(block);
+                m_size += block.m_size;
+                offset = block.m_offset + block.m_compressedSize;
+            }
+
+            start();
+            loadBlock(0);
+        }
+
+        BlockCompressedStreamBuffer::~BlockCompressedStreamBuffer() {
+            stop();
+        }
+
+        uint64_t BlockCompressedStreamBuffer::getSize() const {
+            return m_size;
+        }
+
+        uint32_t BlockCompressedStreamBuffer::getNumberOfBlocks() const {
+            return m_blocks.size();
+        }
+
+        bool BlockCompressedStreamBuffer::isBlockCompressed(const char *data, const uint64_t &size) {
+            return ( (data != NULL) && (size >= BlockCompressedOutputStream::HEADER_SIZE) &&
+                     (readUInt32(data) == static_cast<uint32_t>(BlockCompressedOutputStream::MAGIC)) &&
+                     (readUInt32(data + 4) == static_cast<uint32_t>(BlockCompressedOutputStream::VERSION)) );
+        }
+
+        uint32_t BlockCompressedStreamBuffer::readUInt32(const char *buffer) {
+            uint32_t value = 0;
+            for (uint32_t i = 0; i < 4; i++) {
+                value |= (static_cast<uint32_t>(static_cast<uint8_t>(buffer[i])) << (8 * i));
+            }
+            return value;
+        }
+
+        bool BlockCompressedStreamBuffer::decompress(const uint32_t &block, string &out) const {
+            const Block &b = m_blocks.at(block);
+            return odcore::wrapper::zlib::Zlib::decompressBlock(m_data + b.m_offset, b.m_compressedSize, b.m_size, out);
+        }
+
+        bool BlockCompressedStreamBuffer::loadBlock(const uint32_t &block) {
+            if (block >= m_blocks.size()) {
+                // End of the data.
+                m_currentBlock = m_blocks.size();
+                m_current.clear();
+                setg(NULL, NULL, NULL);
+                return false;
+            }
+
+            bool loaded = false;
+            {
+                Lock l(m_prefetchCondition);
+                if (m_prefetchRequested && (m_prefetchBlock == block)) {
+                    // Wait for the block being decompressed in background.
+                    while (!m_prefetchReady) {
+                        m_prefetchCondition.waitOnSignal();
+                    }
+                    m_current.swap(m_prefetch);
+                    m_prefetchRequested = false;
+                    loaded = (m_current.size() == m_blocks.at(block).m_size);
+                }
+            }
+            if (!loaded) {
+                loaded = decompress(block, m_current);
+            }
+
+            m_currentBlock = block;
+            char *begin = &m_current[0];
+            setg(begin, begin, begin + m_current.size());
+
+            // Decompress the following block in background.
+            if (loaded && ((block + 1) < m_blocks.size())) {
+                Lock l(m_prefetchCondition);
+                m_prefetchBlock = block + 1;
+                m_prefetchRequested = true;
+                m_prefetchReady = false;
+                m_prefetchCondition.wakeAll();
+            }
+
+            if (!loaded) {
+                clog << "BlockCompressedStreamBuffer: Warning: Could not decompress block " << block << "." << endl;
+            }
+            return loaded;
+        }
+
+        BlockCompressedStreamBuffer::int_type BlockCompressedStreamBuffer::underflow() {
+            if (gptr() < egptr()) {
+                return traits_type::to_int_type(*gptr());
+            }
+
+            // Skip empty or damaged blocks.
+            uint32_t next = m_currentBlock + 1;
+            while ( (next < m_blocks.size()) && (!loadBlock(next) || (gptr() == egptr())) ) {
+                next++;
+            }
+            if (next >= m_blocks.size()) {
+                loadBlock(next);
+                return traits_type::eof();
+            }
+            return traits_type::to_int_type(*gptr());
+        }
+
+        BlockCompressedStreamBuffer::pos_type BlockCompressedStreamBuffer::seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode which) {
+            if ((which & ios_base::in) == 0) {
+                return pos_type(off_type(-1));
+            }
+
+            off_type base = 0;
+            if (dir == ios_base::cur) {
+                base = (m_currentBlock < m_blocks.size()) ? static_cast<off_type>(m_blocks.at(m_currentBlock).m_position + (gptr() - eback())) : static_cast<off_type>(m_size);
+            }
+            else if (dir == ios_base::end) {
+                base = static_cast<off_type>(m_size);
+            }
+
+            const off_type position = base + off;
+            if ( (position < 0) || (static_cast<uint64_t>(position) > m_size) ) {
+                return pos_type(off_type(-1));
+            }
+
+            if (static_cast<uint64_t>(position) == m_size) {
+                loadBlock(m_blocks.size());
+                return pos_type(position);
+            }
+
+            // Find the block containing the position.
+            uint32_t block = m_currentBlock;
+            if ( (block >= m_blocks.size()) ||
+                 (static_cast<uint64_t>(position) < m_blocks.at(block).m_position) ||
+                 (static_cast<uint64_t>(position) >= (m_blocks.at(block).m_position + m_blocks.at(block).m_size)) ) {
+                uint32_t first = 0;
+                uint32_t last = m_blocks.size();
+                while ((last - first) > 1) {
+                    const uint32_t middle = first + (last - first) / 2;
+                    if (m_blocks.at(middle).m_position <= static_cast<uint64_t>(position)) {
+                        first = middle;
+                    }
+                    else {
+                        last = middle;
+                    }
+                }
+                block = first;
+                if (!loadBlock(block)) {
+                    return pos_type(off_type(-1));
+                }
+            }
+
+            setg(eback(), eback() + (static_cast<uint64_t>(position) - m_blocks.at(block).m_position), egptr());
+            return pos_type(position);
+        }
+
+        BlockCompressedStreamBuffer::pos_type BlockCompressedStreamBuffer::seekpos(pos_type pos, ios_base::openmode which) {
+            return seekoff(off_type(pos), ios_base::beg, which);
+        }
+
+        void BlockCompressedStreamBuffer::beforeStop() {
+            Lock l(m_prefetchCondition);
+            m_prefetchCondition.wakeAll();
+        }
+
+        void BlockCompressedStreamBuffer::run() {
+            serviceReady();
+
+            string data;
+            while (isRunning()) {
+                uint32_t block = 0;
+                {
+                    Lock l(m_prefetchCondition);
+                    while (isRunning() && (!m_prefetchRequested || m_prefetchReady)) {
+                        m_prefetchCondition.waitOnSignal();
+                    }
+                    block = m_prefetchBlock;
+                }
+                if (!isRunning()) {
+                    break;
+                }
+
+                // Decompress without holding the lock.
+                if (!decompress(block, data)) {
+                    data.clear();
+                }
+
+                Lock l(m_prefetchCondition);
+                if (m_prefetchRequested && (m_prefetchBlock == block) && !m_prefetchReady) {
+                    m_prefetch.swap(data);
+                    m_prefetchReady = true;
+                    m_prefetchCondition.wakeAll();
+                }
+            }
+        }
+
+    } // player
+} // tools
@@ -19,6 +19,7 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <string>
 
@@ -37,6 +38,8 @@
 
 #include "opendavinci/odtools/player/Player.h"
 #include "opendavinci/odtools/player/PlayerCache.h"
+#include "opendavinci/odtools/player/RecordingReader.h"
+#include "opendavinci/odtools/recorder/RecordingIndex.h"
 
 namespace odtools {
     namespace player {
@@ -45,13 +48,16 @@ namespace odtools {
         using namespace odcore::base;
         using namespace odcore::data;
         using namespace odcore::io;
+        using namespace odtools::recorder;
 
         Player::Player(const URL &url, const bool &autoRewind, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading) :
+            m_url(url),
             m_threading(threading),
             m_autoRewind(autoRewind),
             m_inFile(NULL),
             m_inSharedMemoryFile(NULL),
             m_playerCache(),
+            m_index(),
             m_actual(),
             m_successor(),
             m_successorProcessed(true),
@@ -60,14 +66,14 @@ namespace odtools {
             m_delay(0),
             m_mapOfSharedMemoriesForCompressedImages() {
 
-            // Get the stream using the StreamFactory with the given URL.
-            m_inFile = StreamFactory::getInstance().getInputStream(url);
+            // Get the reader for the given URL.
+            m_inFile = getRecordingReader(url);
 
             // Try to load the data storage for data from the shared memory.
             if (url.getResource().compare("/dev/stdin") != 0) {
                 URL urlSharedMemoryFile("file://" + url.getResource() + ".mem");
                 try {
-                    m_inSharedMemoryFile = StreamFactory::getInstance().getInputStream(urlSharedMemoryFile);
+                    m_inSharedMemoryFile = getRecordingReader(urlSharedMemoryFile);
                     CLOG1 << "Player: Found shared memory dump file '" << urlSharedMemoryFile.toString() << "'" << endl;
                 }
                 catch (const odcore::exceptions::InvalidArgumentException &iae) {
@@ -88,6 +94,20 @@ namespace odtools {
             }
         }
 
+        std::shared_ptr<RecordingReader> Player::getRecordingReader(const URL &url) throw (odcore::exceptions::InvalidArgumentException) {
+            // Map regular files into memory to decode the containers without copying;
+            // block compressed files are decompressed from the mapping.
+            if ( (url.getProtocol() == URLProtocol::FILEPROTOCOL) && (url.getResource().compare("/dev/stdin") != 0) ) {
+                std::shared_ptr<RecordingReader> reader(new RecordingReader(url.getResource()));
+                if (reader->isMemoryMapped() || reader->isCompressed()) {
+                    return reader;
+                }
+            }
+
+            // Otherwise, read the data from a stream using the StreamFactory.
+            return std::shared_ptr<RecordingReader>(new RecordingReader(StreamFactory::getInstance().getInputStream(url)));
+        }
+
         Player::~Player() {
             if ( (m_playerCache.get() != NULL) && (m_threading) ) {
                 m_playerCache->stop();
@@ -240,6 +260,62 @@ namespace odtools {
             m_noMoreData = false;
         }
 
+        bool Player::loadIndex() {
+            if (m_index.get() != NULL) {
+                return true;
+            }
+
+            // The index is only available for files.
+            const string recording = m_url.getResource();
+            if ( (m_url.getProtocol() != URLProtocol::FILEPROTOCOL) || (recording.compare("/dev/stdin") == 0) ) {
+                return false;
+            }
+
+            unique_ptr<RecordingIndex> index(new RecordingIndex());
+
+            fstream fin(RecordingIndex::getFileName(recording).c_str(), ios::in | ios::binary);
+            if (!fin.good() || !index->readFrom(fin)) {
+                // Old recordings do not have an index; odrecintegrity can create it permanently.
+                clog << "Player: Warning: No index found for '" << recording << "', reading the recording to create it." << endl;
+                index = unique_ptr<RecordingIndex>(new RecordingIndex());
+                if (!RecordingIndex::build(recording, *index)) {
+                    return false;
+                }
+            }
+
+            m_index = std::move(index);
+            return true;
+        }
+
+        bool Player::seekTo(const TimeStamp &ts) {
+            if ( (m_playerCache.get() == NULL) || !loadIndex() ) {
+                return false;
+            }
+
+            uint64_t positionRec = 0;
+            uint64_t positionMem = 0;
+            const bool foundRec = m_index->find(RecordingIndex::REC, ts, positionRec);
+            const bool foundMem = m_index->find(RecordingIndex::MEM, ts, positionMem);
+            if (!foundRec && !foundMem) {
+                return false;
+            }
+
+            // A file without data at or after the given time stamp is continued at its end.
+            m_playerCache->clearQueueSeekInputStreams((foundRec ? static_cast<int64_t>(positionRec) : -1),
+                                                      (foundMem ? static_cast<int64_t>(positionMem) : -1));
+
+            // Read the "actual" container again from the new position.
+            m_seekToTheBeginning = true;
+            m_noMoreData = false;
+            m_delay = 0;
+
+            return true;
+        }
+
+        bool Player::getTimeRange(TimeStamp &begin, TimeStamp &end) {
+            return (loadIndex() && m_index->getTimeRange(begin, end));
+        }
+
         bool Player::hasMoreData() const {
             return !m_noMoreData;
         }
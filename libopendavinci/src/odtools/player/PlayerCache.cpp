@@ -34,6 +34,7 @@
 #include "opendavinci/generated/odcore/data/image/SharedImage.h"
 #include "opendavinci/generated/odcore/data/SharedPointCloud.h"
 #include "opendavinci/odtools/player/PlayerCache.h"
+#include "opendavinci/odtools/player/RecordingReader.h"
 
 namespace odtools {
     namespace player {
@@ -44,7 +45,7 @@ namespace odtools {
         using namespace odcore::data;
         using namespace odtools;
 
-        PlayerCache::PlayerCache(const uint32_t size, const uint32_t sizeMemorySegments, const bool &autoRewind, std::shared_ptr<istream> in, std::shared_ptr<istream> inSharedMemoryFile) :
+        PlayerCache::PlayerCache(const uint32_t size, const uint32_t sizeMemorySegments, const bool &autoRewind, std::shared_ptr<RecordingReader> in, std::shared_ptr<RecordingReader> inSharedMemoryFile) :
             m_cacheSize(size),
             m_autoRewind(autoRewind),
             m_in(in),
@@ -55,6 +56,8 @@ namespace odtools {
             m_mapOfMemories(),
             m_bufferIn(),
             m_bufferOut(),
+            m_mappedBufferOutMutex(),
+            m_mappedBufferOut(),
             m_sharedPointers(),
             m_modifyCacheMutex() {
             m_cacheSize = (m_cacheSize < 3) ? 3 : m_cacheSize;
@@ -64,7 +67,9 @@ namespace odtools {
             m_memBuffer.clear();
 
             CLOG1 << "PlayerCache: preparing buffer...";
-            for(uint16_t id = 0; id < m_cacheSize; id++) {
+            // Raw memory data from a mapped shared memory dump is not copied.
+            const uint32_t numberOfMemorySegments = (hasMappedSharedMemoryFile() ? 0 : m_cacheSize);
+            for(uint16_t id = 0; id < numberOfMemorySegments; id++) {
                 odcore::data::buffer::MemorySegment ms;
                 ms.setSize(sizeMemorySegments);
                 ms.setIdentifier(id);
@@ -112,16 +117,12 @@ namespace odtools {
         }
 
         void PlayerCache::rewindInputStreams() {
-            // Start from beginning.
-            m_in->clear();
-
             // Seek to the beginning of the input stream.
-            m_in->seekg(ios::beg);
+            m_in->seek(0);
 
             // If a memory dump file was found, reset it as well.
             if (m_inSharedMemoryFile.get()) {
-                m_inSharedMemoryFile->clear();
-                m_inSharedMemoryFile->seekg(ios::beg);
+                m_inSharedMemoryFile->seek(0);
             }
 
             // After rewinding, fill the cache again using the internal method.
@@ -138,10 +139,54 @@ namespace odtools {
                 Container c = m_bufferOut.leave();
                 m_bufferIn.enter(c);
             }
+            {
+                Lock l2(m_mappedBufferOutMutex);
+                m_mappedBufferOut.clear();
+            }
 
             rewindInputStreams();
         }
 
+        void PlayerCache::clearQueueSeekInputStreams(const int64_t &positionRec, const int64_t &positionMem) {
+            Lock l(m_modifyCacheMutex);
+
+            m_queue.clear();
+
+            // Entries delayed for multiplexing belong to the previous position.
+            m_recBuffer.clear();
+            m_memBuffer.clear();
+
+            // Put all memory segments from m_bufferOut back to m_bufferIn for re-use.
+            while (!m_bufferOut.isEmpty()) {
+                Container c = m_bufferOut.leave();
+                m_bufferIn.enter(c);
+            }
+            {
+                Lock l2(m_mappedBufferOutMutex);
+                m_mappedBufferOut.clear();
+            }
+
+            m_in->seek(positionRec);
+            if (m_inSharedMemoryFile.get()) {
+                m_inSharedMemoryFile->seek(positionMem);
+            }
+
+            // After seeking, fill the cache again using the internal method.
+            updateCacheInternal();
+        }
+
+        bool PlayerCache::hasMappedSharedMemoryFile() const {
+            return ( (m_inSharedMemoryFile.get() != NULL) && (m_inSharedMemoryFile->isMemoryMapped()) );
+        }
+
+        bool PlayerCache::hasFreeMemorySegment() {
+            if (hasMappedSharedMemoryFile()) {
+                Lock l(m_mappedBufferOutMutex);
+                return (m_mappedBufferOut.size() < m_cacheSize);
+            }
+            return (!m_bufferIn.isEmpty());
+        }
+
         void PlayerCache::updateCache() {
             // Do only fill cache if not in currently rewinding.
             Lock l(m_modifyCacheMutex);
@@ -152,7 +197,7 @@ namespace odtools {
         void PlayerCache::updateCacheInternal() {
             // Read further data ONLY IFF the cache has free slots AND the buffer for shared memory segments is not completely filled.
             const uint32_t numberOfEntries = m_queue.getSize();
-            while ( (numberOfEntries < m_cacheSize) && (!m_bufferIn.isEmpty()) ) {
+            while ( (numberOfEntries < m_cacheSize) && (hasFreeMemorySegment()) ) {
                 bool bufferFilled = fillCache();
                 if (!bufferFilled) {
                     if (m_autoRewind) {
@@ -192,12 +237,7 @@ namespace odtools {
             }
             else {
                 // Try to read directly from file.
-                if (m_in->good()) {
-                    (*m_in) >> fromRecFile;
-                    if (m_in->gcount() > 0) {
-                        readFromRecFile = true;
-                    }
-                }
+                readFromRecFile = m_in->read(fromRecFile);
             }
 
             // Get next datum from m_mem:
@@ -207,13 +247,9 @@ namespace odtools {
                 readFromMemFile = true;
             }
             else {
-                if ( (m_inSharedMemoryFile.get()) && (m_inSharedMemoryFile->good()) ) {
-                    *m_inSharedMemoryFile >> fromMemFile;
-
-                    if (m_inSharedMemoryFile->gcount() > 0) {
-                        putRawMemoryDataIntoBuffer(fromMemFile);
-                        readFromMemFile = true;
-                    }
+                if ( (m_inSharedMemoryFile.get()) && (m_inSharedMemoryFile->read(fromMemFile)) ) {
+                    putRawMemoryDataIntoBuffer(fromMemFile);
+                    readFromMemFile = true;
                 }
             }
 
@@ -246,7 +282,7 @@ namespace odtools {
         }
 
         void PlayerCache::putRawMemoryDataIntoBuffer(Container &header) {
-            if (!m_bufferIn.isEmpty()) {
+            if (hasFreeMemorySegment()) {
                 string nameOfSharedMemory = "";
                 uint32_t size = 0;
 
@@ -282,8 +318,15 @@ namespace odtools {
                     m_sharedPointers[nameOfSharedMemory] = sp;
                 }
 
-                // Get current position in stream.
-                int32_t curr = m_inSharedMemoryFile->tellg();
+                if (hasMappedSharedMemoryFile()) {
+                    // Refer to the data in the mapped file; it is copied only once into the shared memory.
+                    const char *data = m_inSharedMemoryFile->readPayload(size, NULL);
+                    if (data != NULL) {
+                        Lock l(m_mappedBufferOutMutex);
+                        m_mappedBufferOut.push_back(make_pair(data, size));
+                    }
+                    return;
+                }
 
                 // Get pointer to next available memory segment from the buffer.
                 Container c = m_bufferIn.leave();
@@ -295,11 +338,8 @@ namespace odtools {
                 // Get pointer to memory where to store the data.
                 char *ptrToMemory = m_mapOfMemories[ms.getIdentifier()];
 
-                // Seek to the current position in the stream.
-                m_inSharedMemoryFile->seekg(curr);
-
                 // Read the data into the buffer.
-                m_inSharedMemoryFile->read(ptrToMemory, size);
+                m_inSharedMemoryFile->readPayload(size, ptrToMemory);
 
                 // Store the consumed size of the MemorySegment.
                 ms.setConsumedSize(size);
@@ -314,7 +354,13 @@ namespace odtools {
 
         void PlayerCache::copyMemoryToSharedMemory(odcore::data::Container &container) {
             // The m_bufferOut should never run empty.
-            if (!m_bufferOut.isEmpty()) {
+            bool hasData = !m_bufferOut.isEmpty();
+            if (hasMappedSharedMemoryFile()) {
+                Lock l(m_mappedBufferOutMutex);
+                hasData = !m_mappedBufferOut.empty();
+            }
+
+            if (hasData) {
                 string nameOfSharedMemory = "";
 
                 if (container.getDataType() == odcore::data::image::SharedImage::ID()) {
@@ -332,7 +378,15 @@ namespace odtools {
 
                 // Check, if a shared memory exists for this container.
                 map<string, std::shared_ptr<odcore::wrapper::SharedMemory> >::iterator it = m_sharedPointers.find(nameOfSharedMemory);
-                if (it != m_sharedPointers.end()) {
+                if ( (it != m_sharedPointers.end()) && hasMappedSharedMemoryFile() ) {
+                    Lock l(m_mappedBufferOutMutex);
+                    if (!m_mappedBufferOut.empty()) {
+                        // memcpy directly from the mapped file to shared memory.
+                        ::memcpy(it->second->getSharedMemory(), m_mappedBufferOut.front().first, m_mappedBufferOut.front().second);
+                        m_mappedBufferOut.pop_front();
+                    }
+                }
+                else if (it != m_sharedPointers.end()) {
                     // Get next entry to process from output queue.
                     Container c = m_bufferOut.leave();
                     odcore::data::buffer::MemorySegment ms = c.getData<odcore::data::buffer::MemorySegment>();
@@ -0,0 +1,162 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <fstream>
+#include <iostream>
+
+#include "opendavinci/odcore/base/InputMemoryStreambuf.h"
+#include "opendavinci/odcore/base/Serializable.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/wrapper/MemoryMappedFile.h"
+#include "opendavinci/odcore/wrapper/MemoryMappedFileFactory.h"
+#include "opendavinci/odtools/player/BlockCompressedStreamBuffer.h"
+#include "opendavinci/odtools/player/RecordingReader.h"
+#include "opendavinci/odtools/recorder/BlockCompressedOutputStream.h"
+
+namespace odtools {
+    namespace player {
+
+        using namespace std;
+        using namespace odcore::data;
+
+        RecordingReader::RecordingReader(const string &fileName) :
+            m_file(),
+            m_buffer(),
+            m_compressedBuffer(),
+            m_in() {
+            m_file = odcore::wrapper::MemoryMappedFileFactory::mapFile(fileName);
+            if ( (m_file.get() != NULL) && m_file->isValid() ) {
+                if (BlockCompressedStreamBuffer::isBlockCompressed(m_file->getData(), m_file->getSize())) {
+                    m_compressedBuffer = unique_ptr<BlockCompressedStreamBuffer>(new BlockCompressedStreamBuffer(m_file->getData(), m_file->getSize()));
+                    m_in = std::shared_ptr<istream>(new istream(m_compressedBuffer.get()));
+                }
+                else {
+                    // Containers are decoded in place from the mapping (cf. QueryableNetstringsDeserializerABCF).
+                    m_buffer = unique_ptr<odcore::base::InputMemoryStreambuf>(new odcore::base::InputMemoryStreambuf(m_file->getData(), m_file->getSize()));
+                    m_in = std::shared_ptr<istream>(new istream(m_buffer.get()));
+                }
+            }
+            else {
+                m_file.reset();
+
+                // Fall back to reading the file sequentially.
+                fstream *fin = new fstream(fileName.c_str(), ios::in | ios::binary);
+                m_in = std::shared_ptr<istream>(fin);
+                if (!fin->good()) {
+                    m_in.reset();
+                }
+                else if (fin->seekg(0, ios::beg).good()) {
+                    char header[odtools::recorder::BlockCompressedOutputStream::HEADER_SIZE];
+                    fin->read(header, odtools::recorder::BlockCompressedOutputStream::HEADER_SIZE);
+                    const bool compressed = BlockCompressedStreamBuffer::isBlockCompressed(header, fin->gcount());
+                    fin->clear();
+                    fin->seekg(0, ios::beg);
+                    if (compressed) {
+                        clog << "RecordingReader: Warning: Block compressed file '" << fileName << "' cannot be mapped into memory." << endl;
+                        m_in.reset();
+                    }
+                }
+            }
+        }
+
+        RecordingReader::RecordingReader(std::shared_ptr<istream> in) :
+            m_file(),
+            m_buffer(),
+            m_compressedBuffer(),
+            m_in(in) {}
+
+        RecordingReader::~RecordingReader() {
+            // The stream must not outlive its buffer.
+            m_in.reset();
+        }
+
+        bool RecordingReader::isValid() const {
+            return (m_in.get() != NULL);
+        }
+
+        bool RecordingReader::isMemoryMapped() const {
+            return ( (m_file.get() != NULL) && !isCompressed() );
+        }
+
+        bool RecordingReader::isCompressed() const {
+            return (m_compressedBuffer.get() != NULL);
+        }
+
+        uint64_t RecordingReader::getSize() const {
+            if (isCompressed()) {
+                return m_compressedBuffer->getSize();
+            }
+            return (isMemoryMapped() ? m_file->getSize() : 0);
+        }
+
+        int64_t RecordingReader::getPosition() {
+            return (isValid() ? static_cast<int64_t>(m_in->tellg()) : -1);
+        }
+
+        void RecordingReader::seek(const int64_t &position) {
+            if (isValid()) {
+                m_in->clear();
+                if (position < 0) {
+                    m_in->seekg(0, ios::end);
+                }
+                else {
+                    m_in->seekg(position);
+                }
+            }
+        }
+
+        bool RecordingReader::read(Container &c) {
+            if (!isValid() || !m_in->good()) {
+                return false;
+            }
+
+            (*m_in) >> c;
+            return (m_in->gcount() > 0);
+        }
+
+        const char* RecordingReader::readPayload(const uint32_t &size, char *buffer) {
+            if (!isValid()) {
+                return NULL;
+            }
+
+            if (isMemoryMapped()) {
+                const int64_t position = m_in->tellg();
+                if ( (position < 0) || ((static_cast<uint64_t>(position) + size) > m_file->getSize()) ) {
+                    return NULL;
+                }
+                m_in->seekg(position + size);
+                return m_file->getData() + position;
+            }
+
+            if (buffer == NULL) {
+                return NULL;
+            }
+            m_in->read(buffer, size);
+            return ((static_cast<uint32_t>(m_in->gcount()) == size) ? buffer : NULL);
+        }
+
+        void RecordingReader::skipPayload(const uint32_t &size) {
+            if (isValid()) {
+                const int64_t position = m_in->tellg();
+                m_in->seekg(position + size);
+            }
+        }
+
+    } // player
+} // tools
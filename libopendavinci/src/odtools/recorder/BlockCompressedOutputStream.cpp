@@ -0,0 +1,113 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <iostream>
+
+#include "opendavinci/odcore/wrapper/zlib/Zlib.h"
+#include "opendavinci/odtools/recorder/BlockCompressedOutputStream.h"
+
+namespace odtools {
+    namespace recorder {
+
+        using namespace std;
+
+        static void writeUInt32(ostream &out, const uint32_t &value) {
+            char buffer[4];
+            for (uint32_t i = 0; i < 4; i++) {
+                buffer[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+            }
+            out.write(buffer, 4);
+        }
+
+        BlockCompressedOutputStream::BlockBuffer::BlockBuffer(std::shared_ptr<ostream> out, const uint32_t &blockSize) :
+            streambuf(),
+            m_out(out),
+            m_blockSize(blockSize),
+            m_block(),
+            m_compressed(),
+            m_position(0) {
+            m_block.reserve(m_blockSize);
+
+            writeUInt32(*m_out, MAGIC);
+            writeUInt32(*m_out, VERSION);
+        }
+
+        BlockCompressedOutputStream::BlockBuffer::~BlockBuffer() {}
+
+        void BlockCompressedOutputStream::BlockBuffer::writeBlock() {
+            if (!m_block.empty()) {
+                if (odcore::wrapper::zlib::Zlib::compressBlock(m_block.data(), m_block.size(), m_compressed)) {
+                    writeUInt32(*m_out, m_compressed.size());
+                    writeUInt32(*m_out, m_block.size());
+                    m_out->write(m_compressed.data(), m_compressed.size());
+                }
+                else {
+                    clog << "BlockCompressedOutputStream: Warning: Could not compress " << m_block.size() << " bytes." << endl;
+                }
+
+                m_position += m_block.size();
+                m_block.clear();
+            }
+            m_out->flush();
+        }
+
+        BlockCompressedOutputStream::BlockBuffer::int_type BlockCompressedOutputStream::BlockBuffer::overflow(int_type c) {
+            if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                const char ch = traits_type::to_char_type(c);
+                xsputn(&ch, 1);
+            }
+            return traits_type::not_eof(c);
+        }
+
+        streamsize BlockCompressedOutputStream::BlockBuffer::xsputn(const char *s, streamsize n) {
+            m_block.append(s, n);
+
+            // Writers that never flush still get bounded blocks.
+            if (m_block.size() >= 4 * static_cast<uint64_t>(m_blockSize)) {
+                writeBlock();
+            }
+            return n;
+        }
+
+        int BlockCompressedOutputStream::BlockBuffer::sync() {
+            if (m_block.size() >= m_blockSize) {
+                writeBlock();
+            }
+            return 0;
+        }
+
+        BlockCompressedOutputStream::BlockBuffer::pos_type BlockCompressedOutputStream::BlockBuffer::seekoff(off_type off, ios_base::seekdir dir, ios_base::openmode which) {
+            if ( (off == 0) && (dir == ios_base::cur) && ((which & ios_base::out) != 0) ) {
+                return pos_type(static_cast<off_type>(m_position + m_block.size()));
+            }
+            return pos_type(off_type(-1));
+        }
+
+        BlockCompressedOutputStream::BlockCompressedOutputStream(std::shared_ptr<ostream> compressedOut, const uint32_t &blockSize) :
+            ostream(NULL),
+            m_buffer(compressedOut, blockSize) {
+            rdbuf(&m_buffer);
+        }
+
+        BlockCompressedOutputStream::~BlockCompressedOutputStream() {
+            m_buffer.writeBlock();
+        }
+
+    } // recorder
+} // tools
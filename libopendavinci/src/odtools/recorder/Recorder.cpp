@@ -25,7 +25,9 @@
 #include "opendavinci/odcore/io/StreamFactory.h"
 #include "opendavinci/odcore/io/URL.h"
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odtools/recorder/BlockCompressedOutputStream.h"
 #include "opendavinci/odtools/recorder/Recorder.h"
+#include "opendavinci/odtools/recorder/RecordingIndex.h"
 #include "opendavinci/odtools/recorder/SharedDataListener.h"
 
 namespace odtools {
@@ -37,11 +39,14 @@ namespace odtools {
         using namespace odcore::data;
         using namespace odcore::io;
 
-        Recorder::Recorder(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &dumpSharedData) :
+        Recorder::Recorder(const string &url, const uint32_t &memorySegmentSize, const uint32_t &numberOfSegments, const bool &threading, const bool &dumpSharedData, const uint32_t &highWaterMark, const bool &compression) :
             m_fifo(),
             m_sharedDataListener(),
             m_out(NULL),
             m_outSharedMemoryFile(NULL),
+            m_index(),
+            m_writer(),
+            m_threading(threading),
             m_dumpSharedData(dumpSharedData) {
 
             // Get output file.
@@ -52,16 +57,41 @@ namespace odtools {
             URL urlSharedMemoryFile("file://" + _url.getResource() + ".mem");
             m_outSharedMemoryFile = StreamFactory::getInstance().getOutputStream(urlSharedMemoryFile);
 
+            // Offsets in the index refer to the uncompressed data.
+            if (compression) {
+                m_out = std::shared_ptr<ostream>(new BlockCompressedOutputStream(m_out));
+                m_outSharedMemoryFile = std::shared_ptr<ostream>(new BlockCompressedOutputStream(m_outSharedMemoryFile));
+            }
+
+            // Create the index for seeking in the recording.
+            try {
+                URL urlIndexFile("file://" + RecordingIndex::getFileName(_url.getResource()));
+                m_index = std::shared_ptr<RecordingIndex>(new RecordingIndex(StreamFactory::getInstance().getOutputStream(urlIndexFile)));
+            }
+            catch (const odcore::exceptions::InvalidArgumentException &iae) {
+                clog << "Recorder: Warning: No index created: " << iae.toString() << endl;
+            }
+
+            // Write containers in batches.
+            m_writer = unique_ptr<RecordingWriter>(new RecordingWriter(m_out, highWaterMark, m_index));
+            if (m_threading) {
+                m_writer->start();
+            }
+
             // Create data store for shared memory.
-            m_sharedDataListener = unique_ptr<SharedDataListener>(new SharedDataListener(m_outSharedMemoryFile, memorySegmentSize, numberOfSegments, threading));
+            m_sharedDataListener = unique_ptr<SharedDataListener>(new SharedDataListener(m_outSharedMemoryFile, memorySegmentSize, numberOfSegments, threading, m_index));
         }
 
         Recorder::~Recorder() {
             // Record remaining entries.
             CLOG1 << "Clearing queue... ";
                 recordQueueEntries();
-                if (m_out.get()) {
-                    m_out->flush();
+                if (m_threading) {
+                    m_writer->stop();
+                }
+                m_writer->write();
+                if (m_index.get()) {
+                    m_index->flush();
                 }
             CLOG1 << "done." << endl;
         }
@@ -74,6 +104,10 @@ namespace odtools {
             return *m_sharedDataListener;
         }
 
+        uint32_t Recorder::getNumberOfDroppedContainers() const {
+            return m_writer->getNumberOfDroppedContainers() + m_sharedDataListener->getNumberOfDroppedSharedMemories();
+        }
+
         void Recorder::store(odcore::data::Container c) {
             // Check if the container to be stored is a "regular" data type.
             if ( (c.getDataType() != Container::UNDEFINEDDATA) &&
@@ -106,14 +140,13 @@ namespace odtools {
                          (c.getDataType() != odcore::data::SharedData::ID())  &&
                          (c.getDataType() != odcore::data::SharedPointCloud::ID())  &&
                          (c.getDataType() != odcore::data::image::SharedImage::ID()) ) {
-                        if (m_out.get()) {
-                            (*m_out) << c;
-                        }
+                        m_writer->add(c);
                     }
                 }
 
-                if (m_out.get()) {
-                    m_out->flush();
+                // Without threading, the containers are written right away.
+                if (!m_threading) {
+                    m_writer->write();
                 }
             }
         }
@@ -0,0 +1,305 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <algorithm>
+#include <iostream>
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/Serializable.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/generated/odcore/data/SharedData.h"
+#include "opendavinci/generated/odcore/data/SharedPointCloud.h"
+#include "opendavinci/generated/odcore/data/image/SharedImage.h"
+#include "opendavinci/odtools/player/RecordingReader.h"
+#include "opendavinci/odtools/recorder/RecordingIndex.h"
+
+namespace odtools {
+    namespace recorder {
+
+        using namespace std;
+        using namespace odcore::base;
+        using namespace odcore::data;
+
+        RecordingIndex::Entry::Entry() :
+            m_source(REC),
+            m_dataType(0),
+            m_timeStamp(0),
+            m_offset(0) {}
+
+        RecordingIndex::Entry::Entry(const SOURCE &source, const int32_t &dataType, const int64_t &timeStamp, const uint64_t &offset) :
+            m_source(source),
+            m_dataType(dataType),
+            m_timeStamp(timeStamp),
+            m_offset(offset) {}
+
+        RecordingIndex::RecordingIndex() :
+            m_mutex(),
+            m_out(),
+            m_entries(),
+            m_latestTimeStamps() {}
+
+        RecordingIndex::RecordingIndex(std::shared_ptr<ostream> out) :
+            m_mutex(),
+            m_out(out),
+            m_entries(),
+            m_latestTimeStamps() {
+            if (m_out.get()) {
+                writeUInt32(*m_out, MAGIC);
+                writeUInt32(*m_out, VERSION);
+            }
+        }
+
+        RecordingIndex::~RecordingIndex() {
+            flush();
+        }
+
+        void RecordingIndex::add(const SOURCE &source, const Container &c, const uint64_t &offset) {
+            Entry entry(source, c.getDataType(), c.getReceivedTimeStamp().toMicroseconds(), offset);
+
+            Lock l(m_mutex);
+            append(entry);
+            if (m_out.get()) {
+                writeEntry(*m_out, entry);
+            }
+        }
+
+        void RecordingIndex::flush() {
+            Lock l(m_mutex);
+            if (m_out.get()) {
+                m_out->flush();
+            }
+        }
+
+        vector<RecordingIndex::Entry> RecordingIndex::getEntries(const SOURCE &source) const {
+            Lock l(m_mutex);
+            return m_entries[source];
+        }
+
+        vector<uint64_t> RecordingIndex::getOffsets(const SOURCE &source, const int32_t &dataType) const {
+            vector<uint64_t> offsets;
+
+            Lock l(m_mutex);
+            vector<Entry>::const_iterator it = m_entries[source].begin();
+            while (it != m_entries[source].end()) {
+                if (it->m_dataType == dataType) {
+                    offsets.push_back(it->m_offset);
+                }
+                ++it;
+            }
+            return offsets;
+        }
+
+        uint32_t RecordingIndex::getNumberOfEntries() const {
+            Lock l(m_mutex);
+            return static_cast<uint32_t>(m_entries[REC].size() + m_entries[MEM].size());
+        }
+
+        bool RecordingIndex::find(const SOURCE &source, const TimeStamp &ts, uint64_t &offset) const {
+            const int64_t timeStamp = ts.toMicroseconds();
+
+            Lock l(m_mutex);
+            const vector<int64_t> &latestTimeStamps = m_latestTimeStamps[source];
+
+            // Received time stamps of interleaved sources might decrease; their running maximum does not.
+            vector<int64_t>::const_iterator it = lower_bound(latestTimeStamps.begin(), latestTimeStamps.end(), timeStamp);
+
+            if (it != latestTimeStamps.end()) {
+                offset = m_entries[source][it - latestTimeStamps.begin()].m_offset;
+                return true;
+            }
+            return false;
+        }
+
+        bool RecordingIndex::getTimeRange(TimeStamp &begin, TimeStamp &end) const {
+            Lock l(m_mutex);
+
+            bool found = false;
+            int64_t first = 0;
+            int64_t last = 0;
+            for (uint32_t source = REC; source <= MEM; source++) {
+                if (!m_entries[source].empty()) {
+                    int64_t f = m_entries[source].front().m_timeStamp;
+                    vector<Entry>::const_iterator it = m_entries[source].begin();
+                    while (it != m_entries[source].end()) {
+                        f = min(f, it->m_timeStamp);
+                        ++it;
+                    }
+                    const int64_t b = m_latestTimeStamps[source].back();
+                    first = (found ? min(first, f) : f);
+                    last = (found ? max(last, b) : b);
+                    found = true;
+                }
+            }
+
+            if (found) {
+                begin = TimeStamp(static_cast<int32_t>(first / 1000000L), static_cast<int32_t>(first % 1000000L));
+                end = TimeStamp(static_cast<int32_t>(last / 1000000L), static_cast<int32_t>(last % 1000000L));
+            }
+            return found;
+        }
+
+        bool RecordingIndex::readFrom(istream &in) {
+            char header[HEADER_SIZE];
+            in.read(header, HEADER_SIZE);
+            if ( (in.gcount() != HEADER_SIZE) ||
+                 (readUInt32(header) != static_cast<uint32_t>(MAGIC)) ||
+                 (readUInt32(header + 4) != static_cast<uint32_t>(VERSION)) ) {
+                return false;
+            }
+
+            Lock l(m_mutex);
+            m_entries[REC].clear();
+            m_entries[MEM].clear();
+            m_latestTimeStamps[REC].clear();
+            m_latestTimeStamps[MEM].clear();
+
+            // An incomplete last entry from an aborted recording is skipped.
+            char buffer[ENTRY_SIZE];
+            while (in.read(buffer, ENTRY_SIZE) && (in.gcount() == ENTRY_SIZE)) {
+                const uint32_t source = readUInt32(buffer);
+                if (source > MEM) {
+                    return false;
+                }
+
+                Entry entry(static_cast<SOURCE>(source),
+                            static_cast<int32_t>(readUInt32(buffer + 4)),
+                            static_cast<int64_t>(readUInt64(buffer + 8)),
+                            readUInt64(buffer + 16));
+                append(entry);
+            }
+            return true;
+        }
+
+        void RecordingIndex::writeTo(ostream &out) const {
+            writeUInt32(out, MAGIC);
+            writeUInt32(out, VERSION);
+
+            Lock l(m_mutex);
+            for (uint32_t source = REC; source <= MEM; source++) {
+                vector<Entry>::const_iterator it = m_entries[source].begin();
+                while (it != m_entries[source].end()) {
+                    writeEntry(out, *it);
+                    ++it;
+                }
+            }
+            out.flush();
+        }
+
+        void RecordingIndex::append(const Entry &entry) {
+            vector<int64_t> &latestTimeStamps = m_latestTimeStamps[entry.m_source];
+            latestTimeStamps.push_back(latestTimeStamps.empty() ? entry.m_timeStamp : max(latestTimeStamps.back(), entry.m_timeStamp));
+            m_entries[entry.m_source].push_back(entry);
+        }
+
+        void RecordingIndex::writeEntry(ostream &out, const Entry &entry) const {
+            writeUInt32(out, static_cast<uint32_t>(entry.m_source));
+            writeUInt32(out, static_cast<uint32_t>(entry.m_dataType));
+            writeUInt64(out, static_cast<uint64_t>(entry.m_timeStamp));
+            writeUInt64(out, entry.m_offset);
+        }
+
+        void RecordingIndex::writeUInt32(ostream &out, const uint32_t &value) {
+            char buffer[4];
+            for (uint32_t i = 0; i < 4; i++) {
+                buffer[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+            }
+            out.write(buffer, 4);
+        }
+
+        void RecordingIndex::writeUInt64(ostream &out, const uint64_t &value) {
+            writeUInt32(out, static_cast<uint32_t>(value & 0xFFFFFFFF));
+            writeUInt32(out, static_cast<uint32_t>(value >> 32));
+        }
+
+        uint32_t RecordingIndex::readUInt32(const char *buffer) {
+            uint32_t value = 0;
+            for (uint32_t i = 0; i < 4; i++) {
+                value |= (static_cast<uint32_t>(static_cast<uint8_t>(buffer[i])) << (8 * i));
+            }
+            return value;
+        }
+
+        uint64_t RecordingIndex::readUInt64(const char *buffer) {
+            return (static_cast<uint64_t>(readUInt32(buffer)) | (static_cast<uint64_t>(readUInt32(buffer + 4)) << 32));
+        }
+
+        string RecordingIndex::getFileName(const string &recording) {
+            return recording + ".idx";
+        }
+
+        uint32_t RecordingIndex::getSizeOfSharedMemoryDump(const Container &c) {
+            uint32_t size = 0;
+
+            if (c.getDataType() == odcore::data::image::SharedImage::ID()) {
+                odcore::data::image::SharedImage si = const_cast<Container&>(c).getData<odcore::data::image::SharedImage>();
+
+                // For old recordings containing SharedImage, the attribute size is calculated "on-the-fly".
+                size = si.getSize();
+                size = (size > 0) ? size : (si.getWidth() * si.getHeight() * si.getBytesPerPixel());
+            }
+            else if (c.getDataType() == odcore::data::SharedData::ID()) {
+                odcore::data::SharedData sd = const_cast<Container&>(c).getData<odcore::data::SharedData>();
+                size = sd.getSize();
+            }
+            else if (c.getDataType() == odcore::data::SharedPointCloud::ID()) {
+                odcore::data::SharedPointCloud spc = const_cast<Container&>(c).getData<odcore::data::SharedPointCloud>();
+                size = spc.getSize();
+            }
+
+            return size;
+        }
+
+        void RecordingIndex::buildFrom(odtools::player::RecordingReader &reader, const SOURCE &source, RecordingIndex &index) {
+            bool hasMoreData = true;
+            while (hasMoreData) {
+                const int64_t offset = reader.getPosition();
+
+                Container c;
+                hasMoreData = reader.read(c);
+
+                if ( hasMoreData && (offset >= 0) && (c.getDataType() != Container::UNDEFINEDDATA) ) {
+                    index.add(source, c, static_cast<uint64_t>(offset));
+
+                    // Skip the raw data from the shared memory segment.
+                    if (source == MEM) {
+                        reader.skipPayload(getSizeOfSharedMemoryDump(c));
+                    }
+                }
+            }
+        }
+
+        bool RecordingIndex::build(const string &recording, RecordingIndex &index) {
+            odtools::player::RecordingReader rec(recording);
+            if (!rec.isValid()) {
+                return false;
+            }
+            buildFrom(rec, REC, index);
+
+            odtools::player::RecordingReader mem(recording + ".mem");
+            if (mem.isValid()) {
+                buildFrom(mem, MEM, index);
+            }
+
+            index.flush();
+            return true;
+        }
+
+    } // recorder
+} // tools
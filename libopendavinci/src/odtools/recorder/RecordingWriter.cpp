@@ -0,0 +1,133 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <iostream>
+#include <sstream>
+
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/Serializable.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odtools/recorder/RecordingIndex.h"
+#include "opendavinci/odtools/recorder/RecordingWriter.h"
+
+namespace odtools {
+    namespace recorder {
+
+        using namespace std;
+        using namespace odcore::base;
+        using namespace odcore::data;
+
+        RecordingWriter::RecordingWriter(std::shared_ptr<ostream> out, const uint32_t &highWaterMark, std::shared_ptr<RecordingIndex> index) :
+            m_out(out),
+            m_index(index),
+            m_highWaterMark(highWaterMark),
+            m_pendingCondition(),
+            m_pending(),
+            m_position(0),
+            m_droppedContainers(0),
+            m_writeMutex(),
+            m_writing() {
+            m_pending.reserve(BATCH_SIZE);
+            m_writing.reserve(BATCH_SIZE);
+
+            if (m_out.get()) {
+                const int64_t position = m_out->tellp();
+                m_position = (position > 0) ? static_cast<uint64_t>(position) : 0;
+            }
+        }
+
+        RecordingWriter::~RecordingWriter() {
+            CLOG1 << "RecordingWriter: Writing remaining entries... ";
+            write();
+            CLOG1 << "done." << endl;
+        }
+
+        bool RecordingWriter::add(const Container &c) {
+            // Serialize outside the lock.
+            stringstream sstr;
+            sstr << c;
+            const string data = sstr.str();
+
+            Lock l(m_pendingCondition);
+            if ( (!m_pending.empty()) && ((m_pending.size() + data.size()) > m_highWaterMark) ) {
+                m_droppedContainers++;
+                return false;
+            }
+
+            if (m_index.get()) {
+                m_index->add(RecordingIndex::REC, c, m_position + m_pending.size());
+            }
+
+            const bool batchCompleted = (m_pending.size() < BATCH_SIZE) && ((m_pending.size() + data.size()) >= BATCH_SIZE);
+            m_pending.append(data);
+
+            if (batchCompleted) {
+                m_pendingCondition.wakeAll();
+            }
+            return true;
+        }
+
+        void RecordingWriter::write() {
+            Lock l(m_writeMutex);
+            {
+                Lock l2(m_pendingCondition);
+                m_pending.swap(m_writing);
+                m_position += m_writing.size();
+            }
+
+            if (!m_writing.empty() && m_out.get()) {
+                m_out->write(m_writing.data(), m_writing.size());
+                m_out->flush();
+            }
+            m_writing.clear();
+
+            if (m_index.get()) {
+                m_index->flush();
+            }
+        }
+
+        uint32_t RecordingWriter::getNumberOfDroppedContainers() const {
+            Lock l(m_pendingCondition);
+            return m_droppedContainers;
+        }
+
+        void RecordingWriter::beforeStop() {
+            Lock l(m_pendingCondition);
+            m_pendingCondition.wakeAll();
+        }
+
+        void RecordingWriter::run() {
+            serviceReady();
+
+            while (isRunning()) {
+                {
+                    // Wait until a batch is completed or the maximum delay elapsed.
+                    Lock l(m_pendingCondition);
+                    if (isRunning() && (m_pending.size() < BATCH_SIZE)) {
+                        m_pendingCondition.waitOnSignalWithTimeout(MAX_WAIT_MS);
+                    }
+                }
+
+                write();
+            }
+        }
+
+    } // recorder
+} // tools
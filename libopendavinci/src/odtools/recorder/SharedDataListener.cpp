@@ -25,10 +25,12 @@
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/module/AbstractCIDModule.h"
 #include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/image/SharedImageChannel.h"
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/wrapper/SharedMemory.h"
 #include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
 #include "opendavinci/generated/odcore/data/buffer/MemorySegment.h"
+#include "opendavinci/odtools/recorder/RecordingIndex.h"
 #include "opendavinci/odtools/recorder/SharedDataListener.h"
 #include "opendavinci/odtools/recorder/SharedDataWriter.h"
 
@@ -40,7 +42,7 @@ namespace odtools {
         using namespace odcore::data;
         using namespace odtools;
 
-        SharedDataListener::SharedDataListener(std::shared_ptr<ostream> out, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading) :
+        SharedDataListener::SharedDataListener(std::shared_ptr<ostream> out, const uint32_t &memorySegmentSize, const uint32_t &numberOfMemorySegments, const bool &threading, std::shared_ptr<RecordingIndex> index) :
             m_threading(threading),
             m_sharedDataWriter(),
             m_mapOfAvailableSharedData(),
@@ -51,7 +53,9 @@ namespace odtools {
             m_bufferOut(),
             m_droppedSharedMemories(0),
             m_sharedPointers(),
-            m_out(out) {
+            m_sharedImageChannels(),
+            m_out(out),
+            m_index(index) {
 
             CLOG1 << "SharedDataListener: preparing buffer...";
             for(uint16_t id = 0; id < numberOfMemorySegments; id++) {
@@ -67,7 +71,7 @@ namespace odtools {
             CLOG1 << "done." << endl;
 
             // Hand over the buffer to the writer.
-            m_sharedDataWriter = unique_ptr<SharedDataWriter>(new SharedDataWriter(m_out, m_mapOfMemories, m_bufferIn, m_bufferOut));
+            m_sharedDataWriter = unique_ptr<SharedDataWriter>(new SharedDataWriter(m_out, m_mapOfMemories, m_bufferIn, m_bufferOut, m_index));
             if ( (m_sharedDataWriter.get() != NULL) && (m_threading) ) {
                 m_sharedDataWriter->start();
             }
@@ -142,6 +146,45 @@ namespace odtools {
             return copied;
         }
 
+        bool SharedDataListener::copySharedImageChannelToMemorySegment(const string &name, const Container &header) {
+            bool copied = false;
+
+            // Check if m_bufferIn has some capacity left to store the new image.
+            if (!m_bufferIn.isEmpty()) {
+                // Get next usable memory segment.
+                Container c = m_bufferIn.leave();
+                odcore::data::buffer::MemorySegment ms = c.getData<odcore::data::buffer::MemorySegment>();
+
+                std::shared_ptr<odcore::data::image::SharedImageChannel> channel = m_sharedImageChannels[name];
+                if ( (channel.get()) && (channel->isValid()) ) {
+                    const uint32_t size = channel->getSharedImage().getSize();
+
+                    // Copy the newest frame without stalling the producer.
+                    if ( (size < ms.getSize()) && channel->read(m_mapOfMemories[ms.getIdentifier()], size) ) {
+                        // Store meta information.
+                        ms.setHeader(header);
+                        ms.setConsumedSize(size);
+
+                        // Save meta information.
+                        c = Container(ms);
+
+                        copied = true;
+                    }
+                }
+
+                if (copied) {
+                    // Enter memory segment to processing queue.
+                    m_bufferOut.enter(c);
+                }
+                else {
+                    // Return the unused memory segment.
+                    m_bufferIn.enter(c);
+                }
+            }
+
+            return copied;
+        }
+
         void SharedDataListener::add(const Container &container) {
             bool hasCopied = false;
 
@@ -200,20 +243,41 @@ namespace odtools {
                 c.setSentTimeStamp(container.getSentTimeStamp());
                 c.setReceivedTimeStamp(container.getReceivedTimeStamp());
 
-                map<string, odcore::data::image::SharedImage>::iterator it = m_mapOfAvailableSharedImages.find(si.getName());
-                if (it == m_mapOfAvailableSharedImages.end()) {
-                    m_mapOfAvailableSharedImages[si.getName()] = si;
+                if (si.getSequence() > 0) {
+                    // The recording contains just the image; thus, odplayer can replay it without a SharedImageChannel.
+                    si.setSlot(0);
+                    si.setSequence(0);
+                    c = Container(si);
+                    c.setSentTimeStamp(container.getSentTimeStamp());
+                    c.setReceivedTimeStamp(container.getReceivedTimeStamp());
 
-                    CLOG1 << "Connecting to shared image " << si.getName() << " at ";
+                    map<string, std::shared_ptr<odcore::data::image::SharedImageChannel> >::iterator it = m_sharedImageChannels.find(si.getName());
+                    if (it == m_sharedImageChannels.end()) {
+                        CLOG1 << "Connecting to shared image channel " << si.getName() << " ";
 
-                    std::shared_ptr<odcore::wrapper::SharedMemory> sp = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
-                    m_sharedPointers[si.getName()] = sp;
+                        std::shared_ptr<odcore::data::image::SharedImageChannel> channel(new odcore::data::image::SharedImageChannel(const_cast<Container&>(container).getData<odcore::data::image::SharedImage>()));
+                        m_sharedImageChannels[si.getName()] = channel;
 
-                    CLOG1 << sp->getSharedMemory() << " ";
+                        CLOG1 << "done." << endl;
+                    }
+                    hasCopied = copySharedImageChannelToMemorySegment(si.getName(), c);
+                }
+                else {
+                    map<string, odcore::data::image::SharedImage>::iterator it = m_mapOfAvailableSharedImages.find(si.getName());
+                    if (it == m_mapOfAvailableSharedImages.end()) {
+                        m_mapOfAvailableSharedImages[si.getName()] = si;
 
-                    CLOG1 << "done." << endl;
+                        CLOG1 << "Connecting to shared image " << si.getName() << " at ";
+
+                        std::shared_ptr<odcore::wrapper::SharedMemory> sp = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
+                        m_sharedPointers[si.getName()] = sp;
+
+                        CLOG1 << sp->getSharedMemory() << " ";
+
+                        CLOG1 << "done." << endl;
+                    }
+                    hasCopied = copySharedMemoryToMemorySegment(si.getName(), c);
                 }
-                hasCopied = copySharedMemoryToMemorySegment(si.getName(), c);
             }
 
             // Update the statistics.
@@ -237,6 +301,10 @@ namespace odtools {
             return (getSize() == 0);
         }
 
+        uint32_t SharedDataListener::getNumberOfDroppedSharedMemories() const {
+            return m_droppedSharedMemories;
+        }
+
     } // recorder
 } // tools
 
@@ -26,6 +26,7 @@
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/generated/odcore/data/buffer/MemorySegment.h"
+#include "opendavinci/odtools/recorder/RecordingIndex.h"
 #include "opendavinci/odtools/recorder/SharedDataWriter.h"
 
 namespace odtools {
@@ -36,11 +37,12 @@ namespace odtools {
         using namespace odcore::data;
         using namespace odtools;
 
-        SharedDataWriter::SharedDataWriter(std::shared_ptr<ostream> out, map<uint32_t, char*> &mapOfMemories, FIFOQueue &bufferIn, FIFOQueue &bufferOut) :
+        SharedDataWriter::SharedDataWriter(std::shared_ptr<ostream> out, map<uint32_t, char*> &mapOfMemories, FIFOQueue &bufferIn, FIFOQueue &bufferOut, std::shared_ptr<RecordingIndex> index) :
             m_out(out),
             m_mapOfMemories(mapOfMemories),
             m_bufferIn(bufferIn),
-            m_bufferOut(bufferOut)
+            m_bufferOut(bufferOut),
+            m_index(index)
             {}
 
         SharedDataWriter::~SharedDataWriter() {
@@ -64,6 +66,14 @@ namespace odtools {
                     // Get pointer to memory with the data.
                     char *ptrToMemory = m_mapOfMemories[ms.getIdentifier()];
 
+                    // Remember where this entry starts.
+                    if (m_index.get()) {
+                        const int64_t offset = m_out->tellp();
+                        if (offset >= 0) {
+                            m_index->add(RecordingIndex::MEM, header, static_cast<uint64_t>(offset));
+                        }
+                    }
+
                     (*m_out) << header;
                     m_out->write(ptrToMemory, ms.getConsumedSize());
 
@@ -75,14 +85,14 @@ namespace odtools {
 
                     // After processing, put memory segment back into input queue.
                     m_bufferIn.enter(c);
-
-                    // Write to disk to not loose the content.
-                    m_out->flush();
                 }
-
-                // Allow rescheduling between processing the different containers.
-                Thread::usleepFor(500);
+                else {
+                    break;
+                }
             }
+
+            // Write to disk to not loose the content once all pending segments are processed.
+            m_out->flush();
         }
 
         void SharedDataWriter::run() {
@@ -43,19 +43,19 @@ namespace odtools {
 
         Splitter::~Splitter() {}
 
-        void Splitter::process(const string &source, const string &destination, const uint32_t &memorySegmentSize) {
-            process(source, destination, memorySegmentSize, 0, numeric_limits<uint32_t>::max());
+        void Splitter::process(const string &source, const string &destination, const uint32_t &memorySegmentSize, const bool &compression) {
+            process(source, destination, memorySegmentSize, 0, numeric_limits<uint32_t>::max(), compression);
         }
 
-        void Splitter::process(const string &source, const uint32_t &memorySegmentSize, const uint32_t &start, const uint32_t &end) {
+        void Splitter::process(const string &source, const uint32_t &memorySegmentSize, const uint32_t &start, const uint32_t &end, const bool &compression) {
             // Compose destination file name.
             stringstream destination;
             destination << source << "_" << start << "-" << end << ".rec";
 
-            process(source, destination.str(), memorySegmentSize, start, end);
+            process(source, destination.str(), memorySegmentSize, start, end, compression);
         }
 
-        void Splitter::process(const string &source, const string &destination, const uint32_t &memorySegmentSize, const uint32_t &start, const uint32_t &end) {
+        void Splitter::process(const string &source, const string &destination, const uint32_t &memorySegmentSize, const uint32_t &start, const uint32_t &end, const bool &compression) {
             // Run player and recorder in synchronous mode.
             const bool THREADING = false;
 
@@ -80,7 +80,7 @@ namespace odtools {
             const bool DUMP_SHARED_DATA = true;
 
             // Construct recorder.
-            Recorder recorder(recordingURL.str(), memorySegmentSize, NUMBER_OF_SEGMENTS, THREADING, DUMP_SHARED_DATA);
+            Recorder recorder(recordingURL.str(), memorySegmentSize, NUMBER_OF_SEGMENTS, THREADING, DUMP_SHARED_DATA, RecordingWriter::DEFAULT_HIGH_WATER_MARK, compression);
 
             // The next container to be sent.
             Container nextContainerToBeSent;
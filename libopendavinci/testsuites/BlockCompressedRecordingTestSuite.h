@@ -0,0 +1,153 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_BLOCKCOMPRESSEDRECORDINGTESTSUITE_H_
+#define CORE_BLOCKCOMPRESSEDRECORDINGTESTSUITE_H_
+
+#include <fstream>                      // for fstream
+#include <memory>                       // for shared_ptr
+#include <sstream>                      // for stringstream
+#include <string>                       // for string
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/data/Container.h"        // for Container
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
+#include "opendavinci/odcore/io/URL.h"                // for URL
+#include "opendavinci/odtools/player/BlockCompressedStreamBuffer.h"  // for BlockCompressedStreamBuffer
+#include "opendavinci/odtools/player/Player.h"        // for Player
+#include "opendavinci/odtools/player/RecordingReader.h"  // for RecordingReader
+#include "opendavinci/odtools/recorder/BlockCompressedOutputStream.h"  // for BlockCompressedOutputStream
+#include "opendavinci/odtools/recorder/Recorder.h"    // for Recorder
+#include "opendavinci/odtools/recorder/RecordingIndex.h"  // for RecordingIndex
+
+using namespace std;
+using namespace odcore::data;
+using namespace odcore::io;
+using namespace odtools::player;
+using namespace odtools::recorder;
+
+class BlockCompressedRecordingTest : public CxxTest::TestSuite {
+    public:
+        void testBlocks() {
+            const uint32_t NUMBER_OF_CONTAINERS = 2000;
+            std::shared_ptr<stringstream> sstr(new stringstream());
+            vector<int64_t> positions;
+            {
+                BlockCompressedOutputStream out(sstr, 4096);
+                for (uint32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                    positions.push_back(out.tellp());
+                    TimeStamp ts(i, 0);
+                    Container c(ts);
+                    out << c;
+                    out.flush();
+                }
+            }
+            const string data = sstr->str();
+
+            TS_ASSERT(BlockCompressedStreamBuffer::isBlockCompressed(data.c_str(), data.size()));
+            TS_ASSERT(!BlockCompressedStreamBuffer::isBlockCompressed(data.c_str() + 1, data.size() - 1));
+
+            BlockCompressedStreamBuffer buffer(data.c_str(), data.size());
+            TS_ASSERT(buffer.getNumberOfBlocks() > 1);
+            TS_ASSERT(data.size() < buffer.getSize());
+
+            // Read all containers sequentially.
+            istream in(&buffer);
+            bool correct = true;
+            for (uint32_t i = 0; correct && (i < NUMBER_OF_CONTAINERS); i++) {
+                correct &= (in.tellg() == positions.at(i));
+                Container c;
+                in >> c;
+                correct &= (c.getData<TimeStamp>().getSeconds() == static_cast<int32_t>(i));
+            }
+            TS_ASSERT(correct);
+            TS_ASSERT(static_cast<uint64_t>(in.tellg()) == buffer.getSize());
+
+            // Seek to containers in arbitrary order.
+            correct = true;
+            for (uint32_t i = NUMBER_OF_CONTAINERS - 1; correct && (i < NUMBER_OF_CONTAINERS); i -= 37) {
+                in.clear();
+                in.seekg(positions.at(i));
+                Container c;
+                in >> c;
+                correct &= (c.getData<TimeStamp>().getSeconds() == static_cast<int32_t>(i));
+            }
+            TS_ASSERT(correct);
+
+            // An incomplete last block is skipped.
+            const string truncated = data.substr(0, data.size() - 10);
+            BlockCompressedStreamBuffer truncatedBuffer(truncated.c_str(), truncated.size());
+            TS_ASSERT(truncatedBuffer.getNumberOfBlocks() == (buffer.getNumberOfBlocks() - 1));
+        }
+
+        void testRecorderAndPlayer() {
+            const string recording = "BlockCompressedRecordingTest.rec";
+            {
+                Recorder recorder("file://" + recording, 1000, 4, false, false, RecordingWriter::DEFAULT_HIGH_WATER_MARK, true);
+                for (uint32_t i = 0; i < 100; i++) {
+                    TimeStamp ts(i, 0);
+                    Container c(ts);
+                    c.setReceivedTimeStamp(TimeStamp(100 + i, 500));
+                    recorder.store(c);
+                }
+            }
+
+            {
+                RecordingReader reader(recording);
+                TS_ASSERT(reader.isValid());
+                TS_ASSERT(reader.isCompressed());
+                TS_ASSERT(!reader.isMemoryMapped());
+
+                bool correct = true;
+                for (uint32_t i = 0; correct && (i < 100); i++) {
+                    Container c;
+                    correct &= reader.read(c);
+                    correct &= (c.getData<TimeStamp>().getSeconds() == static_cast<int32_t>(i));
+                }
+                TS_ASSERT(correct);
+                TS_ASSERT(static_cast<uint64_t>(reader.getPosition()) == reader.getSize());
+
+                Container c;
+                TS_ASSERT(!reader.read(c));
+            }
+
+            // The index refers to the uncompressed data.
+            UNLINK(RecordingIndex::getFileName(recording).c_str());
+            Player player(URL("file://" + recording), false, 1000, 4, false);
+            Container c = player.getNextContainerToBeSent();
+            TS_ASSERT(c.getData<TimeStamp>().getSeconds() == 0);
+
+            TS_ASSERT(player.seekTo(TimeStamp(150, 0)));
+            c = player.getNextContainerToBeSent();
+            TS_ASSERT(c.getData<TimeStamp>().getSeconds() == 50);
+
+            TS_ASSERT(player.seekTo(TimeStamp(120, 500)));
+            c = player.getNextContainerToBeSent();
+            TS_ASSERT(c.getData<TimeStamp>().getSeconds() == 20);
+
+            UNLINK(recording.c_str());
+            UNLINK((recording + ".mem").c_str());
+            UNLINK(RecordingIndex::getFileName(recording).c_str());
+        }
+};
+
+#endif /*CORE_BLOCKCOMPRESSEDRECORDINGTESTSUITE_H_*/
@@ -22,6 +22,7 @@
 
 #include <sstream>                      // for stringstream, etc
 #include <string>                       // for operator==, basic_string
+#include <utility>                      // for move
 
 #include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
 
@@ -118,6 +119,102 @@ class ContainerTest : public CxxTest::TestSuite {
 
             TS_ASSERT(ts.toString() == ts2.toString());
         }
+
+        void testCopiedAndMovedContainer() {
+            TimeStamp ts(5, 6);
+            Container c(ts);
+
+            Container c2(c);
+            TS_ASSERT(c2.getDataType() == ts.getID());
+            TS_ASSERT(ts.toString() == c2.getData<TimeStamp>().toString());
+
+            Container c3;
+            c3 = c2;
+            TS_ASSERT(c3.getDataType() == ts.getID());
+            TS_ASSERT(ts.toString() == c3.getData<TimeStamp>().toString());
+
+            Container c4(std::move(c3));
+            TS_ASSERT(c4.getDataType() == ts.getID());
+            TS_ASSERT(ts.toString() == c4.getData<TimeStamp>().toString());
+
+            Container c5;
+            c5 = std::move(c4);
+            TS_ASSERT(c5.getDataType() == ts.getID());
+            TS_ASSERT(ts.toString() == c5.getData<TimeStamp>().toString());
+
+            // The original container must not be affected.
+            TS_ASSERT(ts.toString() == c.getData<TimeStamp>().toString());
+        }
+
+        void testDecodedDataIsUpdated() {
+            TimeStamp ts(7, 8);
+            Container c(ts);
+
+            stringstream s;
+            s << c;
+            s.flush();
+
+            Container c2(TimeStamp(1, 2));
+            TS_ASSERT(c2.getData<TimeStamp>().toString() == TimeStamp(1, 2).toString());
+
+            // Reading new data must replace the previously decoded data.
+            s >> c2;
+            TS_ASSERT(ts.toString() == c2.getData<TimeStamp>().toString());
+            TS_ASSERT(ts.toString() == c2.getData<TimeStamp>().toString());
+
+            // Copies keep the data they were created with.
+            Container c3(c2);
+            c2 = Container(TimeStamp(3, 4));
+            TS_ASSERT(c2.getData<TimeStamp>().toString() == TimeStamp(3, 4).toString());
+            TS_ASSERT(ts.toString() == c3.getData<TimeStamp>().toString());
+        }
+
+        void testCachedData() {
+            TimeStamp ts(9, 10);
+            Container c(ts);
+
+            // Without opting in, every call decodes into a new object.
+            TS_ASSERT(ts.toString() == c.getData<TimeStamp>().toString());
+
+            // The cached object is kept and shared with copies.
+            const TimeStamp &cached = c.getCachedData<TimeStamp>();
+            TS_ASSERT(ts.toString() == cached.toString());
+            TS_ASSERT(&cached == &c.getCachedData<TimeStamp>());
+
+            Container c2(c);
+            TS_ASSERT(&cached == &c2.getCachedData<TimeStamp>());
+            TS_ASSERT(ts.toString() == c2.getData<TimeStamp>().toString());
+
+            // Replacing the payload drops the cached object.
+            stringstream s;
+            s << Container(TimeStamp(11, 12));
+            s.flush();
+            s >> c2;
+            TS_ASSERT(c2.getCachedData<TimeStamp>().toString() == TimeStamp(11, 12).toString());
+            TS_ASSERT(ts.toString() == cached.toString());
+        }
+
+        void testSizeOfData() {
+            Container c;
+            TS_ASSERT(c.getSizeOfData() == 0);
+
+            TimeStamp ts(7, 8);
+            Container c2(ts);
+
+            stringstream s;
+            s << ts;
+            s.flush();
+            TS_ASSERT(c2.getSizeOfData() == s.str().length());
+
+            // The size is kept when serializing the container.
+            stringstream s2;
+            s2 << c2;
+            s2.flush();
+
+            Container c3;
+            s2 >> c3;
+            TS_ASSERT(c3.getSizeOfData() == c2.getSizeOfData());
+        }
 };
 
 #endif /*CORE_CONTAINERTESTSUITE_H_*/
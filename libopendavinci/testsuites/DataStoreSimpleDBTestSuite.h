@@ -20,6 +20,7 @@
 #ifndef CORE_DATASTORESIMPLEDBTESTSUITE_H_
 #define CORE_DATASTORESIMPLEDBTESTSUITE_H_
 
+#include <atomic>                       // for atomic
 #include <cstdlib>                      // for random
 #include <fstream>
 #include <string>                       // for string, operator<<, etc
@@ -78,6 +79,48 @@ class DataStoreTestService : public Service {
         bool m_found;
 };
 
+class DataStoreTestLatestValueReader : public Service {
+    public:
+        DataStoreTestLatestValueReader(KeyValueDataStore &ds) :
+                m_ds(ds), m_monotonic(true), m_latest(0) {
+        }
+
+        void beforeStop() {}
+
+        void run() {
+            serviceReady();
+            while (isRunning()) {
+                Container c = m_ds.get(TimeStamp::ID());
+                if (c.getDataType() == TimeStamp::ID()) {
+                    const int32_t seconds = c.getData<TimeStamp>().getSeconds();
+                    m_monotonic = m_monotonic && (seconds >= m_latest);
+                    m_latest = seconds;
+                }
+            }
+        }
+
+        bool isMonotonic() const {
+            return m_monotonic;
+        }
+
+        int32_t getLatest() const {
+            return m_latest;
+        }
+
+        bool waitForLatest(const int32_t &latest) const {
+            // Wait at most 5s.
+            for (uint32_t i = 0; (i < 500) && (m_latest < latest); i++) {
+                Thread::usleepFor(10000);
+            }
+            return (m_latest == latest);
+        }
+
+    private:
+        KeyValueDataStore &m_ds;
+        atomic<bool> m_monotonic;
+        atomic<int32_t> m_latest;
+};
+
 class DataStoreTestNestedData : public odcore::data::SerializableData {
     public:
         DataStoreTestNestedData() :
@@ -345,6 +388,38 @@ class DataStoreTest : public CxxTest::TestSuite {
             TS_ASSERT(!failed);
         }
 
+        void testLatestValue() {
+            KeyValueDataStore ds(std::shared_ptr<odcore::wrapper::KeyValueDatabase>(new MySimpleDB()));
+            DataStoreTestLatestValueReader reader(ds);
+            reader.start();
+
+            // Readers must only see complete and increasingly newer values.
+            const int32_t NUMBER_OF_VALUES = 20000;
+            for (int32_t i = 1; i <= NUMBER_OF_VALUES; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                ds.put(TimeStamp::ID(), c);
+            }
+            TS_ASSERT(reader.waitForLatest(NUMBER_OF_VALUES));
+            reader.stop();
+
+            TS_ASSERT(reader.isMonotonic());
+            TS_ASSERT(reader.getLatest() == NUMBER_OF_VALUES);
+            TS_ASSERT(ds.get(TimeStamp::ID()).getData<TimeStamp>().getSeconds() == NUMBER_OF_VALUES);
+
+            // Keys beyond the table's capacity are kept in the database.
+            for (int32_t i = 0; i < 2 * KeyValueDataStore::CAPACITY; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                ds.put(1000 + i, c);
+            }
+            bool correct = true;
+            for (int32_t i = 0; i < 2 * KeyValueDataStore::CAPACITY; i++) {
+                correct &= (ds.get(1000 + i).getData<TimeStamp>().getSeconds() == i);
+            }
+            TS_ASSERT(correct);
+            TS_ASSERT(ds.get(-1).getDataType() == Container::UNDEFINEDDATA);
+        }
 };
 
 #endif /*CORE_DATASTORESIMPLEDBTESTSUITE_H_*/
@@ -33,6 +33,7 @@
 #include "opendavinci/odcore/base/Hash.h"             // for CharList, CRC32, etc
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"  // for KeyValueConfiguration
 #include "opendavinci/odcore/base/Lock.h"             // for Lock
+#include "opendavinci/odcore/base/Mutex.h"            // for Mutex
 #include "opendavinci/odcore/base/SerializationFactory.h"  // for SerializationFactory
 #include "opendavinci/odcore/base/Serializer.h"       // for Serializer
 #include "opendavinci/odcore/base/Service.h"          // for Service
@@ -250,17 +251,21 @@ class DataTriggeredConferenceClientModuleTest : public CxxTest::TestSuite,
     public:
         DataTriggeredConferenceClientModuleTest() :
             m_configuration(),
-            m_connection() {}
+            m_connectionsMutex(),
+            m_connections() {}
 
         KeyValueConfiguration m_configuration;
-        std::shared_ptr<connection::ModuleConnection> m_connection;
+        // Keep all module connections as several modules are connected concurrently.
+        Mutex m_connectionsMutex;
+        vector<std::shared_ptr<connection::ModuleConnection> > m_connections;
 
         virtual KeyValueConfiguration getConfiguration(const ModuleDescriptor& /*md*/) {
             return m_configuration;
         }
 
         virtual void onNewModule(std::shared_ptr<odcore::dmcp::connection::ModuleConnection> mc) {
-            m_connection = mc;
+            Lock l(m_connectionsMutex);
+            m_connections.push_back(mc);
         }
 
         void testTimeTriggeredTimeTriggeredConferenceClientModule() {
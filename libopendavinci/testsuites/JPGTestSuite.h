@@ -0,0 +1,171 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_JPGTESTSUITE_H_
+#define CORE_JPGTESTSUITE_H_
+
+#include <algorithm>                    // for equal
+#include <cstdlib>                      // for free
+#include <iostream>                     // for clog, endl
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/data/TimeStamp.h"                  // for TimeStamp
+#include "opendavinci/odcore/wrapper/jpg/JPG.h"                 // for JPG
+#include "opendavinci/odcore/wrapper/jpg/ParallelJPGEncoder.h"  // for ParallelJPGEncoder
+
+using namespace std;
+using namespace odcore::data;
+using namespace odcore::wrapper::jpg;
+
+class JPGTest : public CxxTest::TestSuite {
+    public:
+        vector<uint8_t> createImage(const uint32_t &width, const uint32_t &height, const uint32_t &bytesPerPixel) {
+            // Gradients with some texture to keep the entropy coder busy.
+            vector<uint8_t> image(width * height * bytesPerPixel);
+            uint32_t noise = 1;
+            for (uint32_t y = 0; y < height; y++) {
+                for (uint32_t x = 0; x < width; x++) {
+                    noise = noise * 1103515245 + 12345;
+                    for (uint32_t c = 0; c < bytesPerPixel; c++) {
+                        image[(y * width + x) * bytesPerPixel + c] = static_cast<uint8_t>((x * (c + 1) + y * (3 - c) + ((noise >> 16) & 0x1F)) & 0xFF);
+                    }
+                }
+            }
+            return image;
+        }
+
+        vector<uint8_t> decompress(const vector<uint8_t> &compressed, const int &size, const uint32_t &bytesPerPixel) {
+            vector<uint8_t> image;
+            int width = 0;
+            int height = 0;
+            int actualBytesPerPixel = 0;
+            unsigned char *raw = JPG::decompress(&compressed[0], size, &width, &height, &actualBytesPerPixel, bytesPerPixel);
+            if (raw != NULL) {
+                image.assign(raw, raw + width * height * bytesPerPixel);
+                ::free(raw);
+            }
+            return image;
+        }
+
+        void testParallelJPGEncoderIsIndependentOfNumberOfThreads() {
+            // 100 is not a multiple of the strip height.
+            const uint32_t bytesPerPixels[] = { 1, 3 };
+            for (uint32_t i = 0; i < 2; i++) {
+                const uint32_t bpp = bytesPerPixels[i];
+                const vector<uint8_t> image = createImage(150, 100, bpp);
+
+                vector<uint8_t> reference(image.size());
+                int referenceSize = static_cast<int>(reference.size());
+                {
+                    ParallelJPGEncoder encoder(1);
+                    TS_ASSERT(encoder.getNumberOfThreads() == 1);
+                    TS_ASSERT(encoder.compress(&reference[0], referenceSize, 150, 100, bpp, &image[0], 50));
+                }
+
+                for (uint32_t threads = 2; threads <= 4; threads++) {
+                    ParallelJPGEncoder encoder(threads);
+                    TS_ASSERT(encoder.getNumberOfThreads() == threads);
+
+                    // Buffers are reused for subsequent images.
+                    for (uint32_t run = 0; run < 3; run++) {
+                        vector<uint8_t> compressed(image.size());
+                        int size = static_cast<int>(compressed.size());
+                        TS_ASSERT(encoder.compress(&compressed[0], size, 150, 100, bpp, &image[0], 50));
+                        TS_ASSERT(size == referenceSize);
+                        TS_ASSERT(equal(compressed.begin(), compressed.begin() + size, reference.begin()));
+                    }
+                }
+            }
+        }
+
+        void testParallelJPGEncoderMatchesJPG() {
+            const uint32_t bytesPerPixels[] = { 1, 3 };
+            for (uint32_t i = 0; i < 2; i++) {
+                const uint32_t bpp = bytesPerPixels[i];
+                const vector<uint8_t> image = createImage(200, 130, bpp);
+
+                vector<uint8_t> sequential(image.size());
+                int sequentialSize = static_cast<int>(sequential.size());
+                TS_ASSERT(JPG::compress(&sequential[0], sequentialSize, 200, 130, bpp, &image[0], 75));
+
+                ParallelJPGEncoder encoder(3);
+                vector<uint8_t> parallel(image.size());
+                int parallelSize = static_cast<int>(parallel.size());
+                TS_ASSERT(encoder.compress(&parallel[0], parallelSize, 200, 130, bpp, &image[0], 75));
+
+                // Restart intervals do not change the decompressed image.
+                const vector<uint8_t> expected = decompress(sequential, sequentialSize, bpp);
+                const vector<uint8_t> actual = decompress(parallel, parallelSize, bpp);
+                TS_ASSERT(expected.size() == image.size());
+                TS_ASSERT(actual == expected);
+            }
+        }
+
+        void testParallelJPGEncoderFailures() {
+            const vector<uint8_t> image = createImage(64, 64, 3);
+            vector<uint8_t> compressed(image.size());
+            ParallelJPGEncoder encoder(2);
+
+            int size = static_cast<int>(compressed.size());
+            TS_ASSERT(!encoder.compress(&compressed[0], size, 64, 64, 3, &image[0], 0));
+            TS_ASSERT(!encoder.compress(&compressed[0], size, 64, 64, 3, NULL, 50));
+            TS_ASSERT(!encoder.compress(&compressed[0], size, 0, 64, 3, &image[0], 50));
+
+            // Destination buffer too small.
+            size = 100;
+            TS_ASSERT(!encoder.compress(&compressed[0], size, 64, 64, 3, &image[0], 50));
+            TS_ASSERT(size == 100);
+
+            size = static_cast<int>(compressed.size());
+            TS_ASSERT(encoder.compress(&compressed[0], size, 64, 64, 3, &image[0], 50));
+        }
+
+        void testParallelJPGEncoderBenchmark() {
+            const uint32_t widths[] = { 640, 1280 };
+            const uint32_t heights[] = { 480, 960 };
+            const uint32_t FRAMES = 20;
+
+            clog << endl;
+            for (uint32_t i = 0; i < 2; i++) {
+                const vector<uint8_t> image = createImage(widths[i], heights[i], 3);
+                vector<uint8_t> compressed(image.size());
+
+                for (uint32_t threads = 1; threads <= 4; threads *= 2) {
+                    ParallelJPGEncoder encoder(threads);
+
+                    bool retVal = true;
+                    TimeStamp before;
+                    for (uint32_t frame = 0; frame < FRAMES; frame++) {
+                        int size = static_cast<int>(compressed.size());
+                        retVal &= encoder.compress(&compressed[0], size, widths[i], heights[i], 3, &image[0], 50);
+                    }
+                    TimeStamp after;
+                    TS_ASSERT(retVal);
+
+                    const double duration = (after - before).toMicroseconds() / 1000000.0;
+                    clog << "ParallelJPGEncoder " << widths[i] << "x" << heights[i] << ", " << threads << " thread(s): " << (FRAMES / duration) << " frames/s" << endl;
+                }
+            }
+        }
+};
+
+#endif /*CORE_JPGTESTSUITE_H_*/
@@ -21,7 +21,9 @@
 #define CORE_NETSTRINGSPROTOCOLTESTSUITE_H_
 
 #include <iostream>                     // for operator<<, basic_ostream, etc
+#include <sstream>                      // for stringstream
 #include <string>                       // for string, char_traits, etc
+#include <vector>                       // for vector
 
 #include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
 
@@ -31,6 +33,31 @@
 
 using namespace std;
 
+class NetstringsProtocolTestPeer : public odcore::io::StringListener, public odcore::io::StringSender {
+    public:
+        NetstringsProtocolTestPeer() :
+            m_received(),
+            m_sent(),
+            m_forwardTo(NULL) {}
+
+        virtual ~NetstringsProtocolTestPeer() {}
+
+        virtual void send(const string& data) {
+            m_sent += data;
+            if (m_forwardTo != NULL) {
+                m_forwardTo->nextString(data);
+            }
+        }
+
+        virtual void nextString(const string &s) {
+            m_received.push_back(s);
+        }
+
+        vector<string> m_received;
+        string m_sent;
+        odcore::io::protocol::NetstringsProtocol *m_forwardTo;
+};
+
 class NetstringsProtocolTest : public CxxTest::TestSuite, public odcore::io::StringListener, public odcore::io::StringSender {
     private:
         string m_receivedData;
@@ -123,6 +150,101 @@ class NetstringsProtocolTest : public CxxTest::TestSuite, public odcore::io::Str
             TS_ASSERT(m_receivedData.compare(testDataToBeSent) == 0); 
         }
 
+        void testNetstringsProtocolManyFramesReceive() {
+            odcore::io::protocol::NetstringsProtocol nsp;
+            NetstringsProtocolTestPeer peer;
+            nsp.setStringListener(&peer);
+
+            // Many small Netstrings received at once.
+            const uint32_t NUMBER_OF_FRAMES = 10000;
+            stringstream dataStream;
+            for (uint32_t i = 0; i < NUMBER_OF_FRAMES; i++) {
+                stringstream payload;
+                payload << "Frame" << i;
+                dataStream << payload.str().length() << ":" << payload.str() << ",";
+            }
+            const string data = dataStream.str();
+
+            // Split the data at arbitrary positions.
+            uint32_t position = 0;
+            uint32_t step = 1;
+            while (position < data.length()) {
+                nsp.nextString(data.substr(position, step));
+                position += step;
+                step = (step * 7 + 3) % 4093 + 1;
+            }
+
+            TS_ASSERT(peer.m_received.size() == NUMBER_OF_FRAMES);
+            bool correct = (peer.m_received.size() == NUMBER_OF_FRAMES);
+            for (uint32_t i = 0; correct && (i < NUMBER_OF_FRAMES); i++) {
+                stringstream payload;
+                payload << "Frame" << i;
+                correct &= (peer.m_received.at(i) == payload.str());
+            }
+            TS_ASSERT(correct);
+
+            // Corrupt data is dropped.
+            nsp.nextString("5:Hello;");
+            nsp.nextString("5:Hello,");
+            TS_ASSERT(peer.m_received.size() == NUMBER_OF_FRAMES + 1);
+            TS_ASSERT(peer.m_received.back() == "Hello");
+        }
+
+        void testNetstringsProtocolBinaryFraming() {
+            odcore::io::protocol::NetstringsProtocol a;
+            odcore::io::protocol::NetstringsProtocol b;
+            NetstringsProtocolTestPeer peerA;
+            NetstringsProtocolTestPeer peerB;
+            a.setStringListener(&peerA);
+            a.setStringSender(&peerA);
+            peerA.m_forwardTo = &b;
+            b.setStringListener(&peerB);
+            b.setStringSender(&peerB);
+            peerB.m_forwardTo = &a;
+
+            // Only one peer requested binary framing.
+            a.enableBinaryFraming();
+            TS_ASSERT(!a.isBinaryFramingActive());
+            TS_ASSERT(!b.isBinaryFramingActive());
+            TS_ASSERT(peerA.m_sent == "0:,");
+            TS_ASSERT(peerB.m_received.empty());
+
+            peerA.m_sent = "";
+            a.send("Hello");
+            TS_ASSERT(peerA.m_sent == "5:Hello,");
+
+            // Both peers agree on binary framing.
+            b.enableBinaryFraming();
+            TS_ASSERT(a.isBinaryFramingActive());
+            TS_ASSERT(b.isBinaryFramingActive());
+
+            peerA.m_sent = "";
+            a.send("World!");
+            TS_ASSERT(peerA.m_sent == string("\0\0\0\6World!", 10));
+
+            // Payloads starting with digits or separators.
+            b.send("12:34,");
+            b.send(string(100000, ','));
+
+            TS_ASSERT(peerB.m_received.size() == 2);
+            TS_ASSERT(peerB.m_received.at(0) == "Hello");
+            TS_ASSERT(peerB.m_received.at(1) == "World!");
+            TS_ASSERT(peerA.m_received.size() == 2);
+            if (peerA.m_received.size() == 2) {
+                TS_ASSERT(peerA.m_received.at(0) == "12:34,");
+                TS_ASSERT(peerA.m_received.at(1) == string(100000, ','));
+            }
+
+            // Netstrings and binary frames can be mixed.
+            b.nextString(string("3:abc,\0\0\0\2de1:f,", 16));
+            TS_ASSERT(peerB.m_received.size() == 5);
+            if (peerB.m_received.size() == 5) {
+                TS_ASSERT(peerB.m_received.at(2) == "abc");
+                TS_ASSERT(peerB.m_received.at(3) == "de");
+                TS_ASSERT(peerB.m_received.at(4) == "f");
+            }
+        }
+
 };
 
 #endif /*CORE_NETSTRINGSPROTOCOLTESTSUITE_H_*/
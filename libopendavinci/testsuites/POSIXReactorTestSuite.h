@@ -0,0 +1,365 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_POSIXREACTORTESTSUITE_H_
+#define CORE_POSIXREACTORTESTSUITE_H_
+
+#include <atomic>                       // for atomic
+#include <fstream>                      // for ifstream
+#include <iostream>                     // for operator<<, basic_ostream, etc
+#include <memory>                       // for shared_ptr
+#include <sstream>                      // for stringstream
+#include <string>                       // for string
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Condition.h"        // for Condition
+#include "opendavinci/odcore/base/Lock.h"             // for Lock
+#include "opendavinci/odcore/base/Mutex.h"            // for Mutex
+#include "opendavinci/odcore/base/Thread.h"           // for Thread
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
+#include "opendavinci/odcore/io/StringListener.h"     // for StringListener
+#include "opendavinci/odcore/io/tcp/TCPAcceptor.h"    // for TCPAcceptor
+#include "opendavinci/odcore/io/tcp/TCPAcceptorListener.h"  // for TCPAcceptorListener
+#include "opendavinci/odcore/io/tcp/TCPConnection.h"  // for TCPConnection
+#include "opendavinci/odcore/io/tcp/TCPFactory.h"     // for TCPFactory
+
+#ifndef WIN32
+    #include <signal.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+
+    #include "opendavinci/odcore/wrapper/POSIX/POSIXReactor.h"
+#endif
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data;
+using namespace odcore::io;
+using namespace odcore::io::tcp;
+
+class POSIXReactorTestCounter : public StringListener {
+    public:
+        POSIXReactorTestCounter() :
+            m_numberOfStrings(0) {}
+
+        virtual ~POSIXReactorTestCounter() {}
+
+        virtual void nextString(const string &/*s*/) {
+            m_numberOfStrings++;
+        }
+
+        std::atomic<uint32_t> m_numberOfStrings;
+};
+
+class POSIXReactorTestBlockingCounter : public StringListener {
+    public:
+        POSIXReactorTestBlockingCounter() :
+            m_numberOfStrings(0),
+            m_releaseCondition(),
+            m_release(false) {}
+
+        virtual ~POSIXReactorTestBlockingCounter() {}
+
+        virtual void nextString(const string &/*s*/) {
+            m_numberOfStrings++;
+
+            // Block the reactor's thread until released.
+            Lock l(m_releaseCondition);
+            while (!m_release) {
+                m_releaseCondition.waitOnSignal();
+            }
+        }
+
+        void release() {
+            Lock l(m_releaseCondition);
+            m_release = true;
+            m_releaseCondition.wakeAll();
+        }
+
+        std::atomic<uint32_t> m_numberOfStrings;
+
+    private:
+        Condition m_releaseCondition;
+        bool m_release;
+};
+
+class POSIXReactorTestAcceptorListener : public TCPAcceptorListener {
+    public:
+        POSIXReactorTestAcceptorListener(StringListener &listener) :
+            m_listener(listener),
+            m_connectionsMutex(),
+            m_connections() {}
+
+        virtual ~POSIXReactorTestAcceptorListener() {}
+
+        virtual void onNewConnection(std::shared_ptr<TCPConnection> connection) {
+            connection->setStringListener(&m_listener);
+            connection->start();
+
+            Lock l(m_connectionsMutex);
+            m_connections.push_back(connection);
+        }
+
+        uint32_t getNumberOfConnections() {
+            Lock l(m_connectionsMutex);
+            return static_cast<uint32_t>(m_connections.size());
+        }
+
+        void clear() {
+            Lock l(m_connectionsMutex);
+            m_connections.clear();
+        }
+
+    private:
+        StringListener &m_listener;
+        Mutex m_connectionsMutex;
+        vector<std::shared_ptr<TCPConnection> > m_connections;
+};
+
+class POSIXReactorTest : public CxxTest::TestSuite {
+    public:
+        /**
+         * @param key Entry in /proc/self/status.
+         * @return Value of the given entry or 0 if not available.
+         */
+        uint32_t getStatus(const string &key) {
+            uint32_t value = 0;
+            ifstream status("/proc/self/status");
+            string line;
+            while (getline(status, line)) {
+                if (line.find(key + ":") == 0) {
+                    stringstream sstr(line.substr(key.length() + 1));
+                    sstr >> value;
+                }
+            }
+            return value;
+        }
+
+        void testManyConnections() {
+#ifndef WIN32
+            const uint32_t NUMBER_OF_CONNECTIONS = 500;
+
+            const uint32_t threadsBefore = getStatus("Threads");
+            const uint32_t memoryBefore = getStatus("VmRSS");
+
+            POSIXReactorTestCounter counter;
+            POSIXReactorTestAcceptorListener acceptorListener(counter);
+            std::shared_ptr<TCPAcceptor> acceptor(TCPFactory::createTCPAcceptor(20010));
+            acceptor->setAcceptorListener(&acceptorListener);
+            acceptor->start();
+
+            POSIXReactorTestCounter clientCounter;
+            vector<std::shared_ptr<TCPConnection> > connections;
+            for (uint32_t i = 0; i < NUMBER_OF_CONNECTIONS; i++) {
+                std::shared_ptr<TCPConnection> connection(TCPFactory::createTCPConnectionTo("127.0.0.1", 20010));
+                connection->setStringListener(&clientCounter);
+                connection->start();
+                connections.push_back(connection);
+            }
+
+            // Wait at most 10s.
+            for (uint32_t i = 0; (i < 1000) && (acceptorListener.getNumberOfConnections() < NUMBER_OF_CONNECTIONS); i++) {
+                Thread::usleepFor(10000);
+            }
+            TS_ASSERT(acceptorListener.getNumberOfConnections() == NUMBER_OF_CONNECTIONS);
+
+            for (uint32_t i = 0; i < connections.size(); i++) {
+                connections.at(i)->send("Hello World!");
+            }
+            for (uint32_t i = 0; (i < 1000) && (counter.m_numberOfStrings < NUMBER_OF_CONNECTIONS); i++) {
+                Thread::usleepFor(10000);
+            }
+            TS_ASSERT(counter.m_numberOfStrings == NUMBER_OF_CONNECTIONS);
+
+            const uint32_t threadsAfter = getStatus("Threads");
+            const uint32_t memoryAfter = getStatus("VmRSS");
+            clog << endl << "POSIXReactor: " << NUMBER_OF_CONNECTIONS << " connections: "
+                 << threadsBefore << " -> " << threadsAfter << " threads, "
+                 << memoryBefore << " -> " << memoryAfter << " kB resident memory." << endl;
+
+            if (odcore::wrapper::POSIX::POSIXReactor::isSupported()) {
+                odcore::wrapper::POSIX::POSIXReactor &reactor = odcore::wrapper::POSIX::POSIXReactor::getInstance();
+                TS_ASSERT(reactor.getNumberOfHandlers() == (2 * NUMBER_OF_CONNECTIONS + 1));
+                TS_ASSERT(threadsAfter <= (threadsBefore + reactor.getNumberOfThreads()));
+            }
+
+            TimeStamp before;
+            connections.clear();
+            acceptorListener.clear();
+            acceptor->stop();
+            TimeStamp after;
+
+            if (odcore::wrapper::POSIX::POSIXReactor::isSupported()) {
+                // Stopping does not wait for any timeout.
+                TS_ASSERT((after - before).toMicroseconds() < 1000000);
+                TS_ASSERT(odcore::wrapper::POSIX::POSIXReactor::getInstance().getNumberOfHandlers() == 0);
+            }
+#endif
+        }
+
+        void testStop() {
+#ifndef WIN32
+            if (!odcore::wrapper::POSIX::POSIXReactor::isSupported()) {
+                return;
+            }
+            odcore::wrapper::POSIX::POSIXReactor &reactor = odcore::wrapper::POSIX::POSIXReactor::getInstance();
+
+            for (uint32_t run = 0; run < 2; run++) {
+                POSIXReactorTestCounter counter;
+                POSIXReactorTestAcceptorListener acceptorListener(counter);
+                std::shared_ptr<TCPAcceptor> acceptor(TCPFactory::createTCPAcceptor(20011));
+                acceptor->setAcceptorListener(&acceptorListener);
+                acceptor->start();
+
+                // The threads are started again after stopping.
+                TS_ASSERT(reactor.getNumberOfThreads() >= 1);
+
+                POSIXReactorTestCounter clientCounter;
+                std::shared_ptr<TCPConnection> connection(TCPFactory::createTCPConnectionTo("127.0.0.1", 20011));
+                connection->setStringListener(&clientCounter);
+                connection->start();
+                for (uint32_t i = 0; (i < 500) && (acceptorListener.getNumberOfConnections() < 1); i++) {
+                    Thread::usleepFor(10000);
+                }
+                connection->send("Hello World!");
+                for (uint32_t i = 0; (i < 500) && (counter.m_numberOfStrings < 1); i++) {
+                    Thread::usleepFor(10000);
+                }
+                TS_ASSERT(counter.m_numberOfStrings == 1);
+
+                connection.reset();
+                acceptorListener.clear();
+                acceptor->stop();
+                acceptor.reset();
+
+                const uint32_t threadsBefore = getStatus("Threads");
+                const uint32_t numberOfReactorThreads = reactor.getNumberOfThreads();
+                reactor.stop();
+                TS_ASSERT(reactor.getNumberOfThreads() == 0);
+                TS_ASSERT(getStatus("Threads") == (threadsBefore - numberOfReactorThreads));
+            }
+#endif
+        }
+
+        void testSpareThreadsRetire() {
+#ifndef WIN32
+            if (!odcore::wrapper::POSIX::POSIXReactor::isSupported()) {
+                return;
+            }
+            const uint32_t NUMBER_OF_CONNECTIONS = 3;
+            odcore::wrapper::POSIX::POSIXReactor &reactor = odcore::wrapper::POSIX::POSIXReactor::getInstance();
+
+            POSIXReactorTestBlockingCounter counter;
+            POSIXReactorTestAcceptorListener acceptorListener(counter);
+            std::shared_ptr<TCPAcceptor> acceptor(TCPFactory::createTCPAcceptor(20012));
+            acceptor->setAcceptorListener(&acceptorListener);
+            acceptor->start();
+
+            POSIXReactorTestCounter clientCounter;
+            vector<std::shared_ptr<TCPConnection> > connections;
+            for (uint32_t i = 0; i < NUMBER_OF_CONNECTIONS; i++) {
+                std::shared_ptr<TCPConnection> connection(TCPFactory::createTCPConnectionTo("127.0.0.1", 20012));
+                connection->setStringListener(&clientCounter);
+                connection->start();
+                connections.push_back(connection);
+            }
+            for (uint32_t i = 0; (i < 500) && (acceptorListener.getNumberOfConnections() < NUMBER_OF_CONNECTIONS); i++) {
+                Thread::usleepFor(10000);
+            }
+            const uint32_t numberOfThreads = reactor.getNumberOfThreads();
+
+            // Every blocked handler occupies one thread; spare threads keep waiting for events.
+            for (uint32_t i = 0; i < connections.size(); i++) {
+                connections.at(i)->send("Hello World!");
+            }
+            for (uint32_t i = 0; (i < 500) && (counter.m_numberOfStrings < NUMBER_OF_CONNECTIONS); i++) {
+                Thread::usleepFor(10000);
+            }
+            TS_ASSERT(counter.m_numberOfStrings == NUMBER_OF_CONNECTIONS);
+            TS_ASSERT(reactor.getNumberOfThreads() > NUMBER_OF_CONNECTIONS);
+            const uint32_t threadsBlocked = getStatus("Threads");
+
+            // The spare threads end after being idle (wait at most 10s).
+            counter.release();
+            for (uint32_t i = 0; (i < 1000) && (reactor.getNumberOfThreads() > numberOfThreads); i++) {
+                Thread::usleepFor(10000);
+            }
+            TS_ASSERT(reactor.getNumberOfThreads() <= numberOfThreads);
+            Thread::usleepFor(2 * odcore::wrapper::POSIX::POSIXReactor::SPARE_THREAD_IDLE_TIME * 1000);
+            TS_ASSERT(getStatus("Threads") < threadsBlocked);
+
+            connections.clear();
+            acceptorListener.clear();
+            acceptor->stop();
+#endif
+        }
+
+        void testExitWithBlockedHandler() {
+#ifndef WIN32
+            if (!odcore::wrapper::POSIX::POSIXReactor::isSupported()) {
+                return;
+            }
+
+            const pid_t pid = fork();
+            if (pid == 0) {
+                // The child's reactor threads are blocked in a handler when exiting.
+                POSIXReactorTestBlockingCounter counter;
+                POSIXReactorTestAcceptorListener acceptorListener(counter);
+                std::shared_ptr<TCPAcceptor> acceptor(TCPFactory::createTCPAcceptor(20013));
+                acceptor->setAcceptorListener(&acceptorListener);
+                acceptor->start();
+
+                POSIXReactorTestCounter clientCounter;
+                std::shared_ptr<TCPConnection> connection(TCPFactory::createTCPConnectionTo("127.0.0.1", 20013));
+                connection->setStringListener(&clientCounter);
+                connection->start();
+                for (uint32_t i = 0; (i < 500) && (acceptorListener.getNumberOfConnections() < 1); i++) {
+                    Thread::usleepFor(10000);
+                }
+                connection->send("Hello World!");
+                for (uint32_t i = 0; (i < 500) && (counter.m_numberOfStrings < 1); i++) {
+                    Thread::usleepFor(10000);
+                }
+                exit((counter.m_numberOfStrings == 1) ? 0 : 1);
+            }
+            TS_ASSERT(pid > 0);
+
+            // The child exits despite the blocked handler (wait at most 10s).
+            int status = 0;
+            pid_t exited = 0;
+            for (uint32_t i = 0; (i < 1000) && (exited == 0); i++) {
+                exited = waitpid(pid, &status, WNOHANG);
+                if (exited == 0) {
+                    Thread::usleepFor(10000);
+                }
+            }
+            if (exited == 0) {
+                kill(pid, SIGKILL);
+                waitpid(pid, &status, 0);
+            }
+            TS_ASSERT(exited == pid);
+            TS_ASSERT(WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+#endif
+        }
+};
+
+#endif /*CORE_POSIXREACTORTESTSUITE_H_*/
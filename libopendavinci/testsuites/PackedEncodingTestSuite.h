@@ -0,0 +1,294 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_PACKEDENCODINGTESTSUITE_H_
+#define CORE_PACKEDENCODINGTESTSUITE_H_
+
+#include <cmath>                        // for sin
+#include <iostream>                     // for operator<<, basic_ostream, etc
+#include <map>                          // for map
+#include <memory>
+#include <sstream>                      // for stringstream
+#include <string>                       // for string, operator==, etc
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Deserializer.h"     // for Deserializer
+#include "opendavinci/odcore/base/PackedEncoding.h"   // for PackedEncoding
+#include "opendavinci/odcore/base/SerializationFactory.h"  // for SerializationFactory
+#include "opendavinci/odcore/base/Serializer.h"       // for Serializer
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
+
+using namespace std;
+using namespace odcore;
+using namespace odcore::base;
+using namespace odcore::data;
+
+class PackedEncodingTest : public CxxTest::TestSuite {
+    private:
+        /**
+         * This method serializes the given list like the generated
+         * data structures did before the packed encoding was used.
+         */
+        template<typename T>
+        static string encodeAsText(const vector<T> &list) {
+            stringstream sstr;
+            for (uint32_t i = 0; i < list.size(); i++) {
+                sstr << list.at(i) << endl;
+            }
+            return sstr.str();
+        }
+
+        /**
+         * This method serializes the given list like the generated
+         * data structures do and deserializes it again.
+         */
+        static vector<double> roundTrip(const vector<double> &list, const bool &packed) {
+            stringstream inout;
+            {
+                SerializationFactory& sf = SerializationFactory::getInstance();
+                std::shared_ptr<Serializer> s = sf.getSerializer(inout);
+
+                const uint32_t numberOfElements = static_cast<uint32_t>(list.size());
+                s->write(1, numberOfElements);
+
+                string elements;
+                if (packed) {
+                    PackedEncoding::encode(list, elements);
+                }
+                else {
+                    elements = encodeAsText(list);
+                }
+                s->write(2, elements);
+            }
+
+            vector<double> result;
+            {
+                SerializationFactory& sf = SerializationFactory::getInstance();
+                std::shared_ptr<Deserializer> d = sf.getDeserializer(inout);
+
+                uint32_t numberOfElements = 0;
+                d->read(1, numberOfElements);
+
+                string elements;
+                d->read(2, elements);
+                PackedEncoding::decode(elements, numberOfElements, result);
+            }
+            return result;
+        }
+
+    public:
+        void testListsOfPrimitiveTypes() {
+            vector<bool> bools;
+            bools.push_back(true);
+            bools.push_back(false);
+            vector<char> chars;
+            chars.push_back('a');
+            chars.push_back('\n');
+            chars.push_back('\0');
+            vector<int8_t> int8s;
+            int8s.push_back(-128);
+            int8s.push_back(127);
+            vector<uint16_t> uint16s;
+            uint16s.push_back(65535);
+            uint16s.push_back(10);
+            vector<int32_t> int32s;
+            int32s.push_back(-2147483647 - 1);
+            int32s.push_back(2147483647);
+            vector<uint64_t> uint64s;
+            uint64s.push_back((static_cast<uint64_t>(0xFFFFFFFF) << 32) + 0xFFFFFFFF);
+            uint64s.push_back((static_cast<uint64_t>(0x01020304) << 32) + 0x05060708);
+            vector<float> floats;
+            floats.push_back(-1.25f);
+            floats.push_back(3.4e38f);
+            vector<double> doubles;
+            doubles.push_back(0.1);
+            doubles.push_back(-1.7e308);
+            vector<string> strings;
+            strings.push_back("Hello World!");
+            strings.push_back("");
+            strings.push_back(string("Line 1\nLine 2\0", 14));
+
+            string packed;
+            PackedEncoding::encode(bools, packed);
+            vector<bool> bools2;
+            PackedEncoding::decode(packed, bools.size(), bools2);
+            TS_ASSERT(bools2 == bools);
+
+            PackedEncoding::encode(chars, packed);
+            TS_ASSERT(packed.length() == PackedEncoding::HEADER_SIZE + 3);
+            vector<char> chars2;
+            PackedEncoding::decode(packed, chars.size(), chars2);
+            TS_ASSERT(chars2 == chars);
+
+            PackedEncoding::encode(int8s, packed);
+            vector<int8_t> int8s2;
+            PackedEncoding::decode(packed, int8s.size(), int8s2);
+            TS_ASSERT(int8s2 == int8s);
+
+            PackedEncoding::encode(uint16s, packed);
+            vector<uint16_t> uint16s2;
+            PackedEncoding::decode(packed, uint16s.size(), uint16s2);
+            TS_ASSERT(uint16s2 == uint16s);
+
+            PackedEncoding::encode(int32s, packed);
+            vector<int32_t> int32s2;
+            PackedEncoding::decode(packed, int32s.size(), int32s2);
+            TS_ASSERT(int32s2 == int32s);
+
+            PackedEncoding::encode(uint64s, packed);
+            TS_ASSERT(packed.length() == PackedEncoding::HEADER_SIZE + 2 * sizeof(uint64_t));
+            // Little endian byte order independent of the host.
+            TS_ASSERT(packed.at(PackedEncoding::HEADER_SIZE + sizeof(uint64_t)) == 0x08);
+            vector<uint64_t> uint64s2;
+            PackedEncoding::decode(packed, uint64s.size(), uint64s2);
+            TS_ASSERT(uint64s2 == uint64s);
+
+            PackedEncoding::encode(floats, packed);
+            vector<float> floats2;
+            PackedEncoding::decode(packed, floats.size(), floats2);
+            TS_ASSERT(floats2 == floats);
+
+            PackedEncoding::encode(doubles, packed);
+            vector<double> doubles2;
+            PackedEncoding::decode(packed, doubles.size(), doubles2);
+            TS_ASSERT(doubles2 == doubles);
+
+            PackedEncoding::encode(strings, packed);
+            vector<string> strings2;
+            PackedEncoding::decode(packed, strings.size(), strings2);
+            TS_ASSERT(strings2 == strings);
+        }
+
+        void testMapsOfPrimitiveTypes() {
+            map<uint32_t, double> distances;
+            distances[1] = 1.5;
+            distances[10] = -2.25;
+            distances[4000000000u] = 1e-300;
+
+            string packed;
+            PackedEncoding::encode(distances, packed);
+            TS_ASSERT(PackedEncoding::isPacked(packed));
+
+            map<uint32_t, double> distances2;
+            PackedEncoding::decode(packed, distances.size(), distances2);
+            TS_ASSERT(distances2 == distances);
+
+            map<string, string> strings;
+            strings["key"] = "value=with=delimiters";
+            strings["multi\nline"] = "value\n";
+
+            PackedEncoding::encode(strings, packed);
+            map<string, string> strings2;
+            PackedEncoding::decode(packed, strings.size(), strings2);
+            TS_ASSERT(strings2 == strings);
+        }
+
+        void testTextEncodingOfOlderVersions() {
+            vector<int32_t> int32s;
+            int32s.push_back(-3);
+            int32s.push_back(4000);
+            const string text = encodeAsText(int32s);
+            TS_ASSERT(!PackedEncoding::isPacked(text));
+
+            vector<int32_t> int32s2;
+            PackedEncoding::decode(text, int32s.size(), int32s2);
+            TS_ASSERT(int32s2 == int32s);
+
+            vector<string> strings;
+            strings.push_back("Hello World!");
+            strings.push_back("Hello Solar System!");
+
+            vector<string> strings2;
+            PackedEncoding::decode(encodeAsText(strings), strings.size(), strings2);
+            TS_ASSERT(strings2 == strings);
+
+            map<int32_t, string> m;
+            PackedEncoding::decode("1=One\n-2=Minus two\ninvalid\n=3\n4=\n", 5, m);
+            TS_ASSERT(m.size() == 2);
+            TS_ASSERT(m[1] == "One");
+            TS_ASSERT(m[-2] == "Minus two");
+        }
+
+        void testTruncatedData() {
+            vector<double> doubles;
+            doubles.push_back(1.0);
+            doubles.push_back(2.0);
+            doubles.push_back(3.0);
+
+            string packed;
+            PackedEncoding::encode(doubles, packed);
+            packed.resize(packed.length() - 1);
+
+            // Only complete elements are decoded even if more are announced.
+            vector<double> doubles2;
+            PackedEncoding::decode(packed, 1000000, doubles2);
+            TS_ASSERT(doubles2.size() == 2);
+            TS_ASSERT(doubles2.at(1) == 2.0);
+
+            vector<string> strings;
+            strings.push_back("Hello World!");
+
+            PackedEncoding::encode(strings, packed);
+            packed.resize(packed.length() - 1);
+            vector<string> strings2;
+            PackedEncoding::decode(packed, strings.size(), strings2);
+            TS_ASSERT(strings2.empty());
+        }
+
+        void testRoundTripOfLargeListOfDoubles() {
+            const uint32_t ITERATIONS = 20;
+            const uint32_t SIZE = 10000;
+
+            vector<double> doubles;
+            for (uint32_t i = 0; i < SIZE; i++) {
+                doubles.push_back(sin(i) * 1000.0);
+            }
+
+            string text = encodeAsText(doubles);
+            string packed;
+            PackedEncoding::encode(doubles, packed);
+            TS_ASSERT(packed.length() == PackedEncoding::HEADER_SIZE + SIZE * sizeof(double));
+
+            // The text encoding loses precision.
+            vector<double> result = roundTrip(doubles, false);
+            TS_ASSERT(result.size() == SIZE);
+            TS_ASSERT(result != doubles);
+
+            result = roundTrip(doubles, true);
+            TS_ASSERT(result == doubles);
+
+            TimeStamp before;
+            for (uint32_t i = 0; i < ITERATIONS; i++) {
+                TS_ASSERT(roundTrip(doubles, false).size() == SIZE);
+            }
+            TimeStamp afterText;
+            for (uint32_t i = 0; i < ITERATIONS; i++) {
+                TS_ASSERT(roundTrip(doubles, true).size() == SIZE);
+            }
+            TimeStamp afterPacked;
+
+            clog << "Text encoding: " << text.length() << " bytes, " << (afterText - before).toMicroseconds() / ITERATIONS << " us per round trip of " << SIZE << " doubles." << endl;
+            clog << "Packed encoding: " << packed.length() << " bytes, " << (afterPacked - afterText).toMicroseconds() / ITERATIONS << " us per round trip of " << SIZE << " doubles." << endl;
+        }
+};
+
+#endif /*CORE_PACKEDENCODINGTESTSUITE_H_*/
@@ -286,6 +286,64 @@ class QueueTest : public CxxTest::TestSuite {
             producer.stop();
         }
 
+        int32_t valueOf(Container c) {
+            return c.getData<QueueTestSampleData>().m_int;
+        }
+
+        void testFIFOKeepsOrderWhenOverflowing() {
+            FIFOQueue fifo;
+
+            // More containers than fit into the lock-free ring.
+            const int32_t NUMBER_OF_CONTAINERS = 1000;
+            for (int32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                QueueTestSampleData data;
+                data.m_int = i;
+                fifo.enter(Container(data));
+
+                // Free some slots in the ring while containers are overflowing.
+                if (i == 500) {
+                    for (int32_t j = 0; j < 10; j++) {
+                        TS_ASSERT(valueOf(fifo.leave()) == j);
+                    }
+                }
+            }
+            TS_ASSERT(fifo.getSize() == static_cast<uint32_t>(NUMBER_OF_CONTAINERS - 10));
+
+            for (int32_t i = 10; i < NUMBER_OF_CONTAINERS; i++) {
+                TS_ASSERT(valueOf(fifo.leave()) == i);
+            }
+            TS_ASSERT(fifo.isEmpty());
+            TS_ASSERT(fifo.getSize() == 0);
+        }
+
+        void testBufferedFIFOAccessByIndexKeepsOrder() {
+            BufferedFIFOQueue bufferedFifo(1000);
+
+            for (int32_t i = 0; i < 400; i++) {
+                QueueTestSampleData data;
+                data.m_int = i;
+                bufferedFifo.enter(Container(data));
+            }
+
+            // Accessing by index must not change the order of leaving.
+            TS_ASSERT(valueOf(bufferedFifo.getElementAt(300)) == 300);
+            TS_ASSERT(valueOf(bufferedFifo.leave()) == 0);
+
+            for (int32_t i = 400; i < 500; i++) {
+                QueueTestSampleData data;
+                data.m_int = i;
+                bufferedFifo.enter(Container(data));
+            }
+            TS_ASSERT(bufferedFifo.getSize() == 499);
+            TS_ASSERT(valueOf(bufferedFifo.getElementAt(0)) == 1);
+            TS_ASSERT(valueOf(bufferedFifo.getElementAt(498)) == 499);
+
+            for (int32_t i = 1; i < 500; i++) {
+                TS_ASSERT(valueOf(bufferedFifo.leave()) == i);
+            }
+            TS_ASSERT(bufferedFifo.isEmpty());
+        }
+
         void testBufferedFIFOAsRegularFIFO() {
             Condition blockTestCase;
             BufferedFIFOQueue bufferedFifo(1000);
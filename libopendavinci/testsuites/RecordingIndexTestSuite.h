@@ -0,0 +1,207 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_RECORDINGINDEXTESTSUITE_H_
+#define CORE_RECORDINGINDEXTESTSUITE_H_
+
+#include <fstream>                      // for fstream
+#include <sstream>                      // for stringstream
+#include <string>                       // for string
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/data/Container.h"        // for Container
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
+#include "opendavinci/odcore/io/URL.h"                // for URL
+#include "opendavinci/odtools/player/Player.h"        // for Player
+#include "opendavinci/odtools/recorder/Recorder.h"    // for Recorder
+#include "opendavinci/odtools/recorder/RecordingIndex.h"  // for RecordingIndex
+
+using namespace std;
+using namespace odcore::data;
+using namespace odcore::io;
+using namespace odtools::player;
+using namespace odtools::recorder;
+
+class RecordingIndexTest : public CxxTest::TestSuite {
+    public:
+        void record(const string &recording, const uint32_t &numberOfContainers) {
+            Recorder recorder("file://" + recording, 1000, 4, false, false);
+            for (uint32_t i = 0; i < numberOfContainers; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                c.setReceivedTimeStamp(TimeStamp(100 + i, 500));
+                recorder.store(c);
+            }
+        }
+
+        void cleanUp(const string &recording) {
+            UNLINK(recording.c_str());
+            UNLINK((recording + ".mem").c_str());
+            UNLINK(RecordingIndex::getFileName(recording).c_str());
+        }
+
+        void testRecorderWritesIndex() {
+            const string recording = "RecordingIndexTest1.rec";
+            record(recording, 100);
+
+            RecordingIndex index;
+            fstream fin(RecordingIndex::getFileName(recording).c_str(), ios::in | ios::binary);
+            TS_ASSERT(index.readFrom(fin));
+            TS_ASSERT(index.getNumberOfEntries() == 100);
+            TS_ASSERT(index.getOffsets(RecordingIndex::REC, TimeStamp::ID()).size() == 100);
+            TS_ASSERT(index.getOffsets(RecordingIndex::MEM, TimeStamp::ID()).size() == 0);
+
+            TimeStamp begin;
+            TimeStamp end;
+            TS_ASSERT(index.getTimeRange(begin, end));
+            TS_ASSERT(begin.toMicroseconds() == TimeStamp(100, 500).toMicroseconds());
+            TS_ASSERT(end.toMicroseconds() == TimeStamp(199, 500).toMicroseconds());
+
+            // The offsets point to the containers in the recording.
+            vector<RecordingIndex::Entry> entries = index.getEntries(RecordingIndex::REC);
+            fstream rec(recording.c_str(), ios::in | ios::binary);
+            bool correctOffsets = (entries.size() == 100);
+            for (uint32_t i = 0; correctOffsets && (i < entries.size()); i += 17) {
+                rec.seekg(entries.at(i).m_offset);
+                Container c;
+                rec >> c;
+                correctOffsets &= (c.getData<TimeStamp>().getSeconds() == static_cast<int32_t>(i));
+            }
+            TS_ASSERT(correctOffsets);
+
+            // Creating the index for an existing recording gives the same result.
+            RecordingIndex built;
+            TS_ASSERT(RecordingIndex::build(recording, built));
+            vector<RecordingIndex::Entry> builtEntries = built.getEntries(RecordingIndex::REC);
+            TS_ASSERT(builtEntries.size() == entries.size());
+            bool equal = (builtEntries.size() == entries.size());
+            for (uint32_t i = 0; equal && (i < entries.size()); i++) {
+                equal &= (builtEntries.at(i).m_offset == entries.at(i).m_offset);
+                equal &= (builtEntries.at(i).m_timeStamp == entries.at(i).m_timeStamp);
+                equal &= (builtEntries.at(i).m_dataType == entries.at(i).m_dataType);
+            }
+            TS_ASSERT(equal);
+
+            // Serializing the index keeps all entries.
+            stringstream sstr;
+            built.writeTo(sstr);
+            RecordingIndex copy;
+            TS_ASSERT(copy.readFrom(sstr));
+            TS_ASSERT(copy.getNumberOfEntries() == 100);
+
+            cleanUp(recording);
+        }
+
+        void testPlayerSeekTo() {
+            const string recording = "RecordingIndexTest2.rec";
+            record(recording, 100);
+
+            // Older recordings without index are indexed on demand.
+            UNLINK(RecordingIndex::getFileName(recording).c_str());
+
+            for (uint32_t run = 0; run < 2; run++) {
+                Player player(URL("file://" + recording), false, 1000, 4, false);
+
+                Container c = player.getNextContainerToBeSent();
+                TS_ASSERT(c.getData<TimeStamp>().getSeconds() == 0);
+
+                TS_ASSERT(player.seekTo(TimeStamp(150, 0)));
+                c = player.getNextContainerToBeSent();
+                TS_ASSERT(c.getData<TimeStamp>().getSeconds() == 50);
+                c = player.getNextContainerToBeSent();
+                TS_ASSERT(c.getData<TimeStamp>().getSeconds() == 51);
+
+                // Seeking backwards.
+                TS_ASSERT(player.seekTo(TimeStamp(120, 500)));
+                c = player.getNextContainerToBeSent();
+                TS_ASSERT(c.getData<TimeStamp>().getSeconds() == 20);
+
+                // Seeking behind the end of the recording.
+                TS_ASSERT(!player.seekTo(TimeStamp(300, 0)));
+
+                TimeStamp begin;
+                TimeStamp end;
+                TS_ASSERT(player.getTimeRange(begin, end));
+                TS_ASSERT(begin.getSeconds() == 100);
+
+                // Use an index created by odrecintegrity in the second run.
+                RecordingIndex index;
+                TS_ASSERT(RecordingIndex::build(recording, index));
+                fstream fout(RecordingIndex::getFileName(recording).c_str(), ios::out | ios::binary | ios::trunc);
+                index.writeTo(fout);
+            }
+
+            cleanUp(recording);
+        }
+
+        void testFindWithOutOfOrderTimeStamps() {
+            // Two interleaved sources with received time stamps 100, 90, 110, 95, 120, 105, ...
+            const int32_t NUMBER_OF_CONTAINERS = 20;
+            RecordingIndex index;
+            for (int32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                c.setReceivedTimeStamp(TimeStamp((i % 2 == 0) ? (100 + 5 * i) : (85 + 5 * i), 0));
+                index.add(RecordingIndex::REC, c, 1000 * i);
+            }
+
+            uint64_t offset = 0;
+            TS_ASSERT(index.find(RecordingIndex::REC, TimeStamp(100, 0), offset));
+            TS_ASSERT(offset == 0);
+
+            // The first container received at or after 104s is the third one (110s).
+            TS_ASSERT(index.find(RecordingIndex::REC, TimeStamp(104, 0), offset));
+            TS_ASSERT(offset == 2000);
+
+            TS_ASSERT(index.find(RecordingIndex::REC, TimeStamp(190, 0), offset));
+            TS_ASSERT(offset == 18000);
+            TS_ASSERT(!index.find(RecordingIndex::REC, TimeStamp(191, 0), offset));
+
+            // Every result is the first container in recorded order at or after the requested time stamp.
+            vector<RecordingIndex::Entry> entries = index.getEntries(RecordingIndex::REC);
+            bool correct = true;
+            for (int32_t t = 80; t <= 190; t++) {
+                uint32_t expected = 0;
+                while ( (expected < entries.size()) && (entries.at(expected).m_timeStamp < TimeStamp(t, 0).toMicroseconds()) ) {
+                    expected++;
+                }
+                correct &= index.find(RecordingIndex::REC, TimeStamp(t, 0), offset) && (offset == entries.at(expected).m_offset);
+            }
+            TS_ASSERT(correct);
+
+            TimeStamp begin;
+            TimeStamp end;
+            TS_ASSERT(index.getTimeRange(begin, end));
+            TS_ASSERT(begin.getSeconds() == 90);
+            TS_ASSERT(end.getSeconds() == 190);
+
+            // The same holds for an index read from a file.
+            stringstream sstr;
+            index.writeTo(sstr);
+            RecordingIndex copy;
+            TS_ASSERT(copy.readFrom(sstr));
+            TS_ASSERT(copy.find(RecordingIndex::REC, TimeStamp(104, 0), offset));
+            TS_ASSERT(offset == 2000);
+        }
+};
+
+#endif /*CORE_RECORDINGINDEXTESTSUITE_H_*/
@@ -0,0 +1,184 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_RECORDINGREADERTESTSUITE_H_
+#define CORE_RECORDINGREADERTESTSUITE_H_
+
+#include <cstring>                      // for memcmp
+#include <fstream>                      // for fstream
+#include <iostream>                     // for operator<<, basic_ostream, etc
+#include <memory>                       // for shared_ptr
+#include <sstream>                      // for stringstream
+#include <string>                       // for string
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/data/Container.h"        // for Container
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
+#include "opendavinci/odtools/player/RecordingReader.h"  // for RecordingReader
+#include "opendavinci/generated/odcore/data/LogMessage.h"
+#include "opendavinci/generated/odcore/data/SharedData.h"
+
+using namespace std;
+using namespace odcore::data;
+using namespace odtools::player;
+
+class RecordingReaderTest : public CxxTest::TestSuite {
+    public:
+        void testReadRecording() {
+            const string recording = "RecordingReaderTest1.rec";
+            const uint32_t NUMBER_OF_CONTAINERS = 10000;
+            {
+                fstream fout(recording.c_str(), ios::out | ios::binary | ios::trunc);
+                for (uint32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                    LogMessage lm;
+                    lm.setLogMessage(string(2000, static_cast<char>('a' + (i % 26))));
+                    Container c(lm);
+                    c.setReceivedTimeStamp(TimeStamp(i, 0));
+                    fout << c;
+                }
+            }
+
+            // Reading the recording as stream.
+            TimeStamp before;
+            uint32_t numberOfContainersFromStream = 0;
+            uint64_t size = 0;
+            {
+                fstream fin(recording.c_str(), ios::in | ios::binary);
+                while (fin.good()) {
+                    Container c;
+                    fin >> c;
+                    if (fin.gcount() > 0) {
+                        numberOfContainersFromStream++;
+                    }
+                }
+                fin.clear();
+                fin.seekg(0, ios::end);
+                size = fin.tellg();
+            }
+            const double durationStream = (TimeStamp() - before).toMicroseconds() / 1000000.0;
+            TS_ASSERT(numberOfContainersFromStream == NUMBER_OF_CONTAINERS);
+
+            // Reading the mapped recording.
+            before = TimeStamp();
+            RecordingReader reader(recording);
+            TS_ASSERT(reader.isValid());
+            TS_ASSERT(reader.isMemoryMapped());
+            TS_ASSERT(reader.getSize() == size);
+
+            uint32_t numberOfContainers = 0;
+            Container c;
+            while (reader.read(c)) {
+                numberOfContainers++;
+            }
+            const double durationMapped = (TimeStamp() - before).toMicroseconds() / 1000000.0;
+            TS_ASSERT(numberOfContainers == NUMBER_OF_CONTAINERS);
+
+            // Both ways give the same containers.
+            reader.seek(0);
+            fstream fin(recording.c_str(), ios::in | ios::binary);
+            bool correctContent = true;
+            for (uint32_t i = 0; correctContent && (i < NUMBER_OF_CONTAINERS); i++) {
+                Container fromStream;
+                fin >> fromStream;
+                correctContent &= reader.read(c);
+                correctContent &= (c.getDataType() == LogMessage::ID());
+                correctContent &= (c.getReceivedTimeStamp().toMicroseconds() == fromStream.getReceivedTimeStamp().toMicroseconds());
+                correctContent &= (c.getData<LogMessage>().getLogMessage() == fromStream.getData<LogMessage>().getLogMessage());
+            }
+            TS_ASSERT(correctContent);
+
+            // Seeking in the mapped recording.
+            reader.seek(0);
+            TS_ASSERT(reader.read(c));
+            TS_ASSERT(c.getReceivedTimeStamp().getSeconds() == 0);
+            reader.seek(-1);
+            TS_ASSERT(reader.getPosition() == static_cast<int64_t>(size));
+            TS_ASSERT(!reader.read(c));
+
+            const double MB = size / (1024.0 * 1024.0);
+            clog << endl << "RecordingReader: stream " << (MB / durationStream) << " MB/s, mapped " << (MB / durationMapped) << " MB/s." << endl;
+
+            UNLINK(recording.c_str());
+        }
+
+        void testReadPayload() {
+            const string payload = "0123456789abcdef";
+            SharedData sd;
+            sd.setName("RecordingReaderTest");
+            sd.setSize(payload.length());
+            Container c(sd);
+
+            stringstream sstr;
+            sstr << c;
+            sstr.write(payload.c_str(), payload.length());
+            sstr << c;
+            sstr.write(payload.c_str(), payload.length());
+
+            const string recording = "RecordingReaderTest2.rec.mem";
+            {
+                fstream fout(recording.c_str(), ios::out | ios::binary | ios::trunc);
+                fout << sstr.str();
+            }
+
+            // The payload refers into the mapped file.
+            {
+                RecordingReader reader(recording);
+                TS_ASSERT(reader.isMemoryMapped());
+                Container header;
+                TS_ASSERT(reader.read(header));
+                TS_ASSERT(header.getDataType() == SharedData::ID());
+                const char *data = reader.readPayload(payload.length(), NULL);
+                TS_ASSERT(data != NULL);
+                if (data != NULL) {
+                    TS_ASSERT(::memcmp(data, payload.c_str(), payload.length()) == 0);
+                }
+
+                // Truncated payload.
+                TS_ASSERT(reader.read(header));
+                TS_ASSERT(reader.readPayload(payload.length() + 1, NULL) == NULL);
+                reader.skipPayload(payload.length());
+                TS_ASSERT(!reader.read(header));
+            }
+
+            // The payload is copied if the data cannot be mapped.
+            {
+                std::shared_ptr<istream> in(new stringstream(sstr.str()));
+                RecordingReader reader(in);
+                TS_ASSERT(reader.isValid());
+                TS_ASSERT(!reader.isMemoryMapped());
+                Container header;
+                TS_ASSERT(reader.read(header));
+                char buffer[32];
+                TS_ASSERT(reader.readPayload(payload.length(), buffer) == buffer);
+                TS_ASSERT(::memcmp(buffer, payload.c_str(), payload.length()) == 0);
+                TS_ASSERT(reader.read(header));
+                TS_ASSERT(header.getDataType() == SharedData::ID());
+            }
+
+            // Missing files.
+            RecordingReader missing("RecordingReaderTestMissing.rec");
+            TS_ASSERT(!missing.isValid());
+
+            UNLINK(recording.c_str());
+        }
+};
+
+#endif /*CORE_RECORDINGREADERTESTSUITE_H_*/
@@ -0,0 +1,137 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_RECORDINGWRITERTESTSUITE_H_
+#define CORE_RECORDINGWRITERTESTSUITE_H_
+
+#include <memory>                       // for shared_ptr
+#include <sstream>                      // for stringstream
+#include <string>                       // for string
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Thread.h"           // for Thread
+#include "opendavinci/odcore/data/Container.h"        // for Container
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
+#include "opendavinci/odtools/recorder/RecordingIndex.h"   // for RecordingIndex
+#include "opendavinci/odtools/recorder/RecordingWriter.h"  // for RecordingWriter
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data;
+using namespace odtools::recorder;
+
+class RecordingWriterTest : public CxxTest::TestSuite {
+    public:
+        uint32_t countContainers(stringstream &in) {
+            uint32_t numberOfContainers = 0;
+            in.clear();
+            in.seekg(0);
+            while (in.good()) {
+                Container c;
+                in >> c;
+                if ( (in.gcount() > 0) && (c.getDataType() == TimeStamp::ID()) &&
+                     (c.getData<TimeStamp>().getSeconds() == static_cast<int32_t>(numberOfContainers)) ) {
+                    numberOfContainers++;
+                }
+            }
+            return numberOfContainers;
+        }
+
+        void testBatchedWrite() {
+            std::shared_ptr<stringstream> out(new stringstream());
+            std::shared_ptr<RecordingIndex> index(new RecordingIndex());
+            RecordingWriter writer(out, RecordingWriter::DEFAULT_HIGH_WATER_MARK, index);
+
+            for (uint32_t i = 0; i < 100; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                TS_ASSERT(writer.add(c));
+            }
+
+            // Nothing is written before the batch is handed over.
+            TS_ASSERT(out->str().empty());
+            writer.write();
+            TS_ASSERT(countContainers(*out) == 100);
+            TS_ASSERT(writer.getNumberOfDroppedContainers() == 0);
+
+            // The index refers to the written containers.
+            vector<RecordingIndex::Entry> entries = index->getEntries(RecordingIndex::REC);
+            TS_ASSERT(entries.size() == 100);
+            if (entries.size() == 100) {
+                out->clear();
+                out->seekg(entries.at(42).m_offset);
+                Container c;
+                *out >> c;
+                TS_ASSERT(c.getData<TimeStamp>().getSeconds() == 42);
+            }
+        }
+
+        void testHighWaterMark() {
+            std::shared_ptr<stringstream> out(new stringstream());
+
+            TimeStamp ts(0, 0);
+            Container c(ts);
+            stringstream sstr;
+            sstr << c;
+            const uint32_t SIZE = sstr.str().size();
+
+            // Room for ten containers.
+            RecordingWriter writer(out, 10 * SIZE);
+            uint32_t added = 0;
+            for (uint32_t i = 0; i < 15; i++) {
+                TimeStamp ts2(added, 0);
+                Container c2(ts2);
+                added += (writer.add(c2) ? 1 : 0);
+            }
+            TS_ASSERT(added == 10);
+            TS_ASSERT(writer.getNumberOfDroppedContainers() == 5);
+
+            // Writing frees the pending buffer.
+            writer.write();
+            TimeStamp ts3(added, 0);
+            Container c3(ts3);
+            TS_ASSERT(writer.add(c3));
+            writer.write();
+            TS_ASSERT(countContainers(*out) == 11);
+        }
+
+        void testThreadedWrite() {
+            std::shared_ptr<stringstream> out(new stringstream());
+            {
+                RecordingWriter writer(out, RecordingWriter::DEFAULT_HIGH_WATER_MARK);
+                writer.start();
+
+                for (uint32_t i = 0; i < 1000; i++) {
+                    TimeStamp ts(i, 0);
+                    Container c(ts);
+                    TS_ASSERT(writer.add(c));
+                }
+
+                // Pending containers are written by the writer's thread.
+                Thread::usleepFor(10 * RecordingWriter::MAX_WAIT_MS * 1000);
+                writer.stop();
+                TS_ASSERT(countContainers(*out) == 1000);
+            }
+        }
+};
+
+#endif /*CORE_RECORDINGWRITERTESTSUITE_H_*/
@@ -0,0 +1,180 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_RINGBUFFERTESTSUITE_H_
+#define CORE_RINGBUFFERTESTSUITE_H_
+
+#include <iostream>                     // for operator<<, basic_ostream, etc
+#include <string>                       // for string
+#include <utility>                      // for move
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/RingBuffer.h"       // for RingBuffer
+#include "opendavinci/odcore/base/Service.h"          // for Service
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data;
+
+class RingBufferTestProducer : public Service {
+    public:
+        RingBufferTestProducer(RingBuffer<uint32_t> &ring, const uint32_t &id, const uint32_t &numberOfEntries) :
+            m_ring(ring),
+            m_id(id),
+            m_numberOfEntries(numberOfEntries) {}
+
+        virtual void beforeStop() {}
+
+        virtual void run() {
+            serviceReady();
+
+            // Encode producer and sequence number to check the order per producer.
+            for (uint32_t i = 0; i < m_numberOfEntries; i++) {
+                uint32_t entry = (m_id << 24) | i;
+                m_ring.push(std::move(entry));
+            }
+        }
+
+    private:
+        RingBufferTestProducer(const RingBufferTestProducer &);
+        RingBufferTestProducer& operator=(const RingBufferTestProducer &);
+
+        RingBuffer<uint32_t> &m_ring;
+        const uint32_t m_id;
+        const uint32_t m_numberOfEntries;
+};
+
+class RingBufferTest : public CxxTest::TestSuite {
+    public:
+        void testCapacity() {
+            RingBuffer<string> ring(5, RingBuffer<string>::SINGLE_PRODUCER);
+            TS_ASSERT(ring.getCapacity() == 8);
+            TS_ASSERT(ring.isEmpty());
+            TS_ASSERT(ring.getSize() == 0);
+
+            for (uint32_t i = 0; i < ring.getCapacity(); i++) {
+                string s = "Entry";
+                TS_ASSERT(ring.tryPush(std::move(s)));
+            }
+            TS_ASSERT(ring.getSize() == 8);
+
+            // A failed push must not touch the entry.
+            string s = "Rejected";
+            TS_ASSERT(!ring.tryPush(std::move(s)));
+            TS_ASSERT(s == "Rejected");
+
+            string entry;
+            TS_ASSERT(ring.tryPop(entry));
+            TS_ASSERT(entry == "Entry");
+            TS_ASSERT(ring.tryPush(std::move(s)));
+            TS_ASSERT(ring.getSize() == 8);
+        }
+
+        void testOrderAndWrapAround() {
+            RingBuffer<uint32_t> ring(4, RingBuffer<uint32_t>::SINGLE_PRODUCER);
+
+            uint32_t next = 0;
+            for (uint32_t i = 0; i < 1000; i++) {
+                uint32_t a = 2 * i;
+                uint32_t b = 2 * i + 1;
+                TS_ASSERT(ring.tryPush(std::move(a)));
+                TS_ASSERT(ring.tryPush(std::move(b)));
+
+                uint32_t entry = 0;
+                TS_ASSERT(ring.tryPop(entry));
+                TS_ASSERT(entry == next++);
+                TS_ASSERT(ring.tryPop(entry));
+                TS_ASSERT(entry == next++);
+                TS_ASSERT(!ring.tryPop(entry));
+            }
+            TS_ASSERT(ring.isEmpty());
+        }
+
+        void testClose() {
+            RingBuffer<string> ring(2, RingBuffer<string>::SINGLE_PRODUCER);
+            string a = "A";
+            string b = "B";
+            TS_ASSERT(ring.push(std::move(a)));
+            TS_ASSERT(ring.push(std::move(b)));
+            ring.close();
+            TS_ASSERT(ring.isClosed());
+
+            // A closed and full ring must not block.
+            string c = "C";
+            TS_ASSERT(!ring.push(std::move(c)));
+
+            // Remaining entries are still available.
+            string entry;
+            TS_ASSERT(ring.pop(entry));
+            TS_ASSERT(entry == "A");
+            TS_ASSERT(ring.pop(entry));
+            TS_ASSERT(entry == "B");
+            TS_ASSERT(!ring.pop(entry));
+        }
+
+        void testMultipleProducers() {
+            const uint32_t NUMBER_OF_PRODUCERS = 4;
+            const uint32_t NUMBER_OF_ENTRIES = 50000;
+
+            // Small ring to exercise waiting for free slots and for new entries.
+            RingBuffer<uint32_t> ring(64, RingBuffer<uint32_t>::MULTIPLE_PRODUCERS);
+
+            vector<RingBufferTestProducer*> producers;
+            for (uint32_t i = 0; i < NUMBER_OF_PRODUCERS; i++) {
+                producers.push_back(new RingBufferTestProducer(ring, i, NUMBER_OF_ENTRIES));
+            }
+
+            TimeStamp before;
+            for (uint32_t i = 0; i < NUMBER_OF_PRODUCERS; i++) {
+                producers.at(i)->start();
+            }
+
+            vector<uint32_t> expected(NUMBER_OF_PRODUCERS, 0);
+            bool correctOrder = true;
+            for (uint32_t i = 0; i < NUMBER_OF_PRODUCERS * NUMBER_OF_ENTRIES; i++) {
+                uint32_t entry = 0;
+                TS_ASSERT(ring.pop(entry));
+
+                const uint32_t id = (entry >> 24);
+                const uint32_t sequence = (entry & 0xFFFFFF);
+                if ( (id >= NUMBER_OF_PRODUCERS) || (expected[id] != sequence) ) {
+                    correctOrder = false;
+                    break;
+                }
+                expected[id]++;
+            }
+            TimeStamp after;
+
+            for (uint32_t i = 0; i < NUMBER_OF_PRODUCERS; i++) {
+                producers.at(i)->stop();
+                delete producers.at(i);
+            }
+
+            TS_ASSERT(correctOrder);
+            TS_ASSERT(ring.isEmpty());
+
+            clog << endl << "RingBuffer: " << NUMBER_OF_PRODUCERS * NUMBER_OF_ENTRIES << " entries from " << NUMBER_OF_PRODUCERS << " producers in " << (after - before).toMicroseconds() << " us." << endl;
+        }
+};
+
+#endif /*CORE_RINGBUFFERTESTSUITE_H_*/
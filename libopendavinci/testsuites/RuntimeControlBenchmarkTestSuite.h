@@ -0,0 +1,134 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CONTEXT_RUNTIMECONTROLBENCHMARKTESTSUITE_H_
+#define CONTEXT_RUNTIMECONTROLBENCHMARKTESTSUITE_H_
+
+#include <chrono>                       // for steady_clock
+#include <iostream>                     // for clog, endl
+#include <string>                       // for string
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcontext/base/DirectInterface.h"  // for DirectInterface
+#include "opendavinci/odcontext/base/RuntimeControl.h"  // for RuntimeControl, etc
+#include "opendavinci/odcontext/base/RuntimeEnvironment.h"  // for RuntimeEnvironment
+#include "opendavinci/odcontext/base/SystemFeedbackComponent.h"
+#include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
+#include "opendavinci/generated/odcore/data/dmcp/ModuleExitCodeMessage.h"
+
+namespace odcontext { namespace base { class SendContainerToSystemsUnderTest; } }
+namespace odcore { namespace wrapper { class Time; } }
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::base::module;
+using namespace odcontext::base;
+
+class RuntimeControlBenchmarkTestModule : public TimeTriggeredConferenceClientModule {
+    public:
+        RuntimeControlBenchmarkTestModule(const int32_t &argc, char **argv) :
+            TimeTriggeredConferenceClientModule(argc, argv, "RuntimeControlBenchmarkTestModule"),
+            m_cycleCounter(0) {}
+
+        virtual void setUp() {}
+
+        virtual void tearDown() {}
+
+        virtual odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode body() {
+            while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
+                m_cycleCounter++;
+            }
+
+            return odcore::data::dmcp::ModuleExitCodeMessage::OKAY;
+        }
+
+        uint32_t getCycleCounter() const {
+            return m_cycleCounter;
+        }
+
+    private:
+        uint32_t m_cycleCounter;
+};
+
+class RuntimeControlBenchmarkTestDummySystemPart : public SystemFeedbackComponent {
+    public:
+        RuntimeControlBenchmarkTestDummySystemPart() :
+            m_freq(1) {}
+
+        float getFrequency() const {
+            return m_freq;
+        }
+
+        virtual void setup() {}
+
+        virtual void tearDown() {}
+
+        virtual void step(const odcore::wrapper::Time &/*t*/, SendContainerToSystemsUnderTest &/*sender*/) {}
+
+        const float m_freq;
+};
+
+class RuntimeControlBenchmarkTest : public CxxTest::TestSuite {
+    public:
+        void testRuntimeControlSimulatedStepsPerSecond() {
+            const uint32_t SIMULATED_SECONDS = 20;
+
+            DirectInterface di("225.0.0.101", 101, "");
+            RuntimeControl sc(di);
+            sc.setup(RuntimeControl::TAKE_CONTROL);
+
+            // Setup application running at 100Hz.
+            string argv0("runtimecontrolbenchmarktestmodule");
+            string argv1("--cid=101");
+            string argv2("--freq=100");
+            int32_t argc = 3;
+            char **argv;
+            argv = new char*[3];
+            argv[0] = const_cast<char*>(argv0.c_str());
+            argv[1] = const_cast<char*>(argv1.c_str());
+            argv[2] = const_cast<char*>(argv2.c_str());
+
+            RuntimeControlBenchmarkTestModule rcbtm(argc, argv);
+
+            RuntimeControlBenchmarkTestDummySystemPart rcbtdsc;
+
+            RuntimeEnvironment rte;
+            rte.add(rcbtm);
+            rte.add(rcbtdsc);
+
+            // TimeStamps are controlled by RuntimeControl; thus, the wall-clock time is measured separately.
+            const std::chrono::steady_clock::time_point before = std::chrono::steady_clock::now();
+            TS_ASSERT(sc.run(rte, SIMULATED_SECONDS) == RuntimeControl::RUNTIME_TIMEOUT);
+            const std::chrono::steady_clock::time_point after = std::chrono::steady_clock::now();
+
+            sc.tearDown();
+
+            const double duration = std::chrono::duration_cast<std::chrono::microseconds>(after - before).count() / 1000000.0;
+            clog << endl << "RuntimeControl: " << rcbtm.getCycleCounter() << " simulated steps in " << duration << "s wall-clock time: " << (rcbtm.getCycleCounter() / duration) << " steps/s." << endl;
+
+            // The first cycle is the head of the app's while-loop.
+            TS_ASSERT(rcbtm.getCycleCounter() == SIMULATED_SECONDS * 100 - 1);
+
+            delete [] argv;
+        }
+};
+
+#endif /*CONTEXT_RUNTIMECONTROLBENCHMARKTESTSUITE_H_*/
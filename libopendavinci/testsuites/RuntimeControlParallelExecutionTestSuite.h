@@ -0,0 +1,235 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CONTEXT_RUNTIMECONTROLPARALLELEXECUTIONTESTSUITE_H_
+#define CONTEXT_RUNTIMECONTROLPARALLELEXECUTIONTESTSUITE_H_
+
+#include <iostream>                     // for clog, endl
+#include <memory>                       // for shared_ptr
+#include <sstream>                      // for stringstream
+#include <string>                       // for string
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcontext/base/DirectInterface.h"  // for DirectInterface
+#include "opendavinci/odcontext/base/RuntimeControl.h"  // for RuntimeControl, etc
+#include "opendavinci/odcontext/base/RuntimeEnvironment.h"  // for RuntimeEnvironment
+#include "opendavinci/odcontext/base/SendContainerToSystemsUnderTest.h"
+#include "opendavinci/odcontext/base/SystemFeedbackComponent.h"
+#include "opendavinci/odcontext/base/SystemReportingComponent.h"
+#include "opendavinci/odcore/base/Thread.h"           // for Thread
+#include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
+#include "opendavinci/odcore/data/Container.h"        // for Container
+#include "opendavinci/generated/odcore/data/LogMessage.h"
+#include "opendavinci/generated/odcore/data/dmcp/ModuleExitCodeMessage.h"
+
+namespace odcore { namespace wrapper { class Time; } }
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::base::module;
+using namespace odcore::data;
+using namespace odcontext::base;
+
+class RuntimeControlParallelExecutionTestModule : public TimeTriggeredConferenceClientModule {
+    public:
+        RuntimeControlParallelExecutionTestModule(const int32_t &argc, char **argv, const string &name) :
+            TimeTriggeredConferenceClientModule(argc, argv, "RuntimeControlParallelExecutionTestModule"),
+            m_name(name),
+            m_cycleCounter(0) {}
+
+        virtual void setUp() {}
+
+        virtual void tearDown() {}
+
+        virtual odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode body() {
+            while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
+                m_cycleCounter++;
+
+                // Send two containers per cycle with some work in between.
+                for (uint32_t i = 0; i < 2; i++) {
+                    stringstream sstr;
+                    sstr << m_cycleCounter << "." << i;
+
+                    LogMessage lm;
+                    lm.setComponentName(m_name);
+                    lm.setLogMessage(sstr.str());
+                    Container c(lm);
+                    getConference().send(c);
+
+                    Thread::usleepFor(50);
+                }
+            }
+
+            return odcore::data::dmcp::ModuleExitCodeMessage::OKAY;
+        }
+
+        uint32_t getCycleCounter() const {
+            return m_cycleCounter;
+        }
+
+    private:
+        string m_name;
+        uint32_t m_cycleCounter;
+};
+
+class RuntimeControlParallelExecutionTestSensor : public SystemFeedbackComponent {
+    public:
+        RuntimeControlParallelExecutionTestSensor(const string &name, const float &freq) :
+            m_name(name),
+            m_freq(freq),
+            m_counter(0) {}
+
+        float getFrequency() const {
+            return m_freq;
+        }
+
+        virtual void setup() {}
+
+        virtual void tearDown() {}
+
+        virtual void step(const odcore::wrapper::Time &/*t*/, SendContainerToSystemsUnderTest &sender) {
+            getFIFO().clear();
+
+            for (uint32_t i = 0; i < 2; i++) {
+                stringstream sstr;
+                sstr << m_counter << "." << i;
+
+                LogMessage lm;
+                lm.setComponentName(m_name);
+                lm.setLogMessage(sstr.str());
+                Container c(lm);
+                sender.sendToSystemsUnderTest(c);
+
+                Thread::usleepFor(50);
+            }
+            m_counter++;
+        }
+
+        const string m_name;
+        const float m_freq;
+        uint32_t m_counter;
+};
+
+class RuntimeControlParallelExecutionTestRecorder : public SystemReportingComponent {
+    public:
+        RuntimeControlParallelExecutionTestRecorder() :
+            m_containers() {}
+
+        virtual void setup() {}
+
+        virtual void tearDown() {}
+
+        virtual void report(const odcore::wrapper::Time &t) {
+            // Record the order of the distributed containers.
+            const uint32_t SIZE = getFIFO().getSize();
+            for (uint32_t i = 0; i < SIZE; i++) {
+                Container c = getFIFO().leave();
+                if (c.getDataType() == LogMessage::ID()) {
+                    LogMessage lm = c.getData<LogMessage>();
+
+                    stringstream sstr;
+                    sstr << t.getSeconds() << "." << t.getPartialMicroseconds() << ": " << lm.getComponentName() << " " << lm.getLogMessage();
+                    m_containers.push_back(sstr.str());
+                }
+            }
+        }
+
+        vector<string> m_containers;
+};
+
+class RuntimeControlParallelExecutionTest : public CxxTest::TestSuite {
+    public:
+        vector<string> runSimulation(const uint32_t &numberOfThreads, uint32_t &cyclesApp1, uint32_t &cyclesApp2) {
+            DirectInterface di("225.0.0.102", 102, "");
+            RuntimeControl sc(di);
+            sc.setup(RuntimeControl::TAKE_CONTROL);
+            sc.setVerbosity(RuntimeControl::QUIET);
+            sc.setParallelExecution(numberOfThreads);
+
+            string argv0("runtimecontrolparallelexecutiontestmodule");
+            string argv1("--cid=102");
+            string argv2("--freq=10");
+            int32_t argc = 3;
+            char **argv;
+            argv = new char*[3];
+            argv[0] = const_cast<char*>(argv0.c_str());
+            argv[1] = const_cast<char*>(argv1.c_str());
+            argv[2] = const_cast<char*>(argv2.c_str());
+
+            RuntimeControlParallelExecutionTestModule app1(argc, argv, "app1");
+            RuntimeControlParallelExecutionTestModule app2(argc, argv, "app2");
+
+            // Sensors running at different frequencies.
+            vector<std::shared_ptr<RuntimeControlParallelExecutionTestSensor> > sensors;
+            for (uint32_t i = 0; i < 4; i++) {
+                stringstream sstr;
+                sstr << "sensor" << i;
+                sensors.push_back(std::shared_ptr<RuntimeControlParallelExecutionTestSensor>(new RuntimeControlParallelExecutionTestSensor(sstr.str(), (i % 2 == 0) ? 10 : 5)));
+            }
+
+            RuntimeControlParallelExecutionTestRecorder recorder;
+
+            RuntimeEnvironment rte;
+            rte.add(app1);
+            rte.add(app2);
+            for (uint32_t i = 0; i < sensors.size(); i++) {
+                rte.add(*sensors.at(i));
+            }
+            rte.add(recorder);
+
+            TS_ASSERT(sc.run(rte, 3) == RuntimeControl::RUNTIME_TIMEOUT);
+
+            sc.tearDown();
+
+            cyclesApp1 = app1.getCycleCounter();
+            cyclesApp2 = app2.getCycleCounter();
+
+            delete [] argv;
+
+            return recorder.m_containers;
+        }
+
+        void testParallelExecutionDeliversContainersInOrder() {
+            uint32_t cyclesApp1 = 0;
+            uint32_t cyclesApp2 = 0;
+
+            const vector<string> sequential = runSimulation(1, cyclesApp1, cyclesApp2);
+            TS_ASSERT(cyclesApp1 == 29);
+            TS_ASSERT(cyclesApp2 == 29);
+
+            // 3s: 30 ticks for sensor0 and sensor2, 15 ticks for sensor1 and sensor3, and 29 cycles per app; two containers each.
+            clog << "Sequential execution: " << sequential.size() << " containers." << endl;
+            TS_ASSERT(sequential.size() == 2 * (30 + 15 + 30 + 15 + 29 + 29));
+
+            for (uint32_t run = 0; run < 2; run++) {
+                const vector<string> parallel = runSimulation(4, cyclesApp1, cyclesApp2);
+                TS_ASSERT(cyclesApp1 == 29);
+                TS_ASSERT(cyclesApp2 == 29);
+
+                clog << "Parallel execution: " << parallel.size() << " containers." << endl;
+                TS_ASSERT(parallel.size() == sequential.size());
+                TS_ASSERT(parallel == sequential);
+            }
+        }
+};
+
+#endif /*CONTEXT_RUNTIMECONTROLPARALLELEXECUTIONTESTSUITE_H_*/
@@ -0,0 +1,186 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_SERIALIZATIONBENCHMARKTESTSUITE_H_
+#define CORE_SERIALIZATIONBENCHMARKTESTSUITE_H_
+
+#include <iostream>                     // for operator<<, basic_ostream, etc
+#include <memory>
+#include <sstream>                      // for stringstream
+#include <string>                       // for string, operator==, etc
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Deserializer.h"     // for Deserializer
+#include "opendavinci/odcore/base/Hash.h"             // for CharList, CRC32, etc
+#include "opendavinci/odcore/base/InputMemoryStreambuf.h"  // for InputMemoryStreambuf
+#include "opendavinci/odcore/base/QueryableNetstringsDeserializerABCF.h"  // for QueryableNetstringsDeserializerABCF
+#include "opendavinci/odcore/base/SerializationFactory.h"  // for SerializationFactory
+#include "opendavinci/odcore/base/Serializer.h"       // for Serializer
+#include "opendavinci/odcore/data/Container.h"        // for Container
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
+
+using namespace std;
+using namespace odcore;
+using namespace odcore::base;
+using namespace odcore::data;
+
+class SerializationBenchmarkTest : public CxxTest::TestSuite {
+    private:
+        /**
+         * @return Serialized representation of a deterministic Container
+         *         as produced by the stringstream-based implementation.
+         */
+        static string getReferenceContainer() {
+            const char reference[] = "\xab\xcf\x3d\x01\x01\x18\x02\x14\x13\xab\xcf\x0f\x9c\xf7\x88\x4c"
+                                     "\x03\xf2\xc0\x01\xae\xf7\x88\x4c\x02\xcc\x0a\x2c\x03\x10\xab\xcf"
+                                     "\x0c\x9c\xf7\x88\x4c\x01\x02\xae\xf7\x88\x4c\x01\x04\x2c\x04\x10"
+                                     "\xab\xcf\x0c\x9c\xf7\x88\x4c\x01\x06\xae\xf7\x88\x4c\x01\x08\x2c"
+                                     "\x2c";
+            return string(reference, sizeof(reference) - 1);
+        }
+
+        static Container getContainer() {
+            Container c(TimeStamp(12345, 678));
+            c.setSentTimeStamp(TimeStamp(1, 2));
+            c.setReceivedTimeStamp(TimeStamp(3, 4));
+            return c;
+        }
+
+        static void checkContainer(Container &c) {
+            TS_ASSERT(c.getDataType() == TimeStamp::ID());
+            TS_ASSERT(c.getSentTimeStamp().getSeconds() == 1);
+            TS_ASSERT(c.getSentTimeStamp().getFractionalMicroseconds() == 2);
+            TS_ASSERT(c.getReceivedTimeStamp().getSeconds() == 3);
+            TS_ASSERT(c.getReceivedTimeStamp().getFractionalMicroseconds() == 4);
+
+            TimeStamp payload = c.getData<TimeStamp>();
+            TS_ASSERT(payload.getSeconds() == 12345);
+            TS_ASSERT(payload.getFractionalMicroseconds() == 678);
+        }
+
+    public:
+        void testWireFormatIsUnchanged() {
+            stringstream out;
+            out << getContainer();
+
+            TS_ASSERT(out.str() == getReferenceContainer());
+        }
+
+        void testDeserializeReferenceContainer() {
+            stringstream in(getReferenceContainer());
+            Container c;
+            in >> c;
+
+            checkContainer(c);
+        }
+
+        void testDeserializeFromMemoryWithoutCopying() {
+            const string reference = getReferenceContainer();
+
+            // Two consecutive Containers in the same memory region.
+            const string data = reference + reference;
+            InputMemoryStreambuf buffer(data.data(), data.length());
+            istream in(&buffer);
+
+            Container c1;
+            in >> c1;
+            checkContainer(c1);
+            TS_ASSERT(buffer.available() == reference.length());
+
+            Container c2;
+            in >> c2;
+            checkContainer(c2);
+            TS_ASSERT(buffer.available() == 0);
+            TS_ASSERT(in.good());
+
+            // Truncated data must not be consumed.
+            InputMemoryStreambuf truncatedBuffer(reference.data(), reference.length() - 1);
+            istream truncated(&truncatedBuffer);
+            Container c3;
+            truncated >> c3;
+            TS_ASSERT(truncated.fail());
+        }
+
+        void testDeserializeFromPointer() {
+            const string reference = getReferenceContainer();
+
+            QueryableNetstringsDeserializerABCF d;
+            TS_ASSERT(d.deserializeDataFrom(reference.data(), reference.length()) == reference.length());
+
+            int32_t dataType = 0;
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL2('i', 'd') >::RESULT, 1, "Container.id", "id", dataType);
+            TS_ASSERT(dataType == TimeStamp::ID());
+
+            TimeStamp sent;
+            d.read(CRC32 < OPENDAVINCI_CORE_STRINGLITERAL4('s', 'e', 'n', 't') >::RESULT, 3, "Container.sent", "sent", sent);
+            TS_ASSERT(sent.getSeconds() == 1);
+
+            // Incomplete frames are not consumed at all.
+            QueryableNetstringsDeserializerABCF d2;
+            TS_ASSERT(d2.deserializeDataFrom(reference.data(), reference.length() - 1) == 0);
+        }
+
+        void testLargeUnsignedValues() {
+            const uint64_t value = (static_cast<uint64_t>(0x12345678) << 32) + 0x9ABCDEF0;
+
+            stringstream inout;
+            SerializationFactory& sf=SerializationFactory::getInstance();
+            {
+                std::shared_ptr<Serializer> s = sf.getSerializer(inout);
+                s->write(1, value);
+            }
+
+            std::shared_ptr<Deserializer> d = sf.getDeserializer(inout);
+            uint64_t value2 = 0;
+            d->read(1, value2);
+
+            TS_ASSERT(value2 == value);
+        }
+
+        void testEncodeDecodeDuration() {
+            const uint32_t ITERATIONS = 20000;
+            const Container c = getContainer();
+            const string reference = getReferenceContainer();
+
+            uint32_t bytes = 0;
+            TimeStamp before;
+            for (uint32_t i = 0; i < ITERATIONS; i++) {
+                stringstream out;
+                out << c;
+                bytes += out.str().length();
+            }
+            TimeStamp afterEncoding;
+            for (uint32_t i = 0; i < ITERATIONS; i++) {
+                stringstream in(reference);
+                Container c2;
+                in >> c2;
+                bytes += c2.getDataType();
+            }
+            TimeStamp afterDecoding;
+
+            TS_ASSERT(bytes > 0);
+
+            clog << "Encoding: " << (afterEncoding - before).toMicroseconds() * 1000 / ITERATIONS << " ns per Container." << endl;
+            clog << "Decoding: " << (afterDecoding - afterEncoding).toMicroseconds() * 1000 / ITERATIONS << " ns per Container." << endl;
+        }
+};
+
+#endif /*CORE_SERIALIZATIONBENCHMARKTESTSUITE_H_*/
@@ -0,0 +1,229 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_SHAREDIMAGECHANNELTESTSUITE_H_
+#define CORE_SHAREDIMAGECHANNELTESTSUITE_H_
+
+#include <atomic>                       // for atomic
+#include <cstring>                      // for memset
+#include <memory>                       // for shared_ptr
+#include <sstream>                      // for stringstream
+#include <string>                       // for string
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Lock.h"                     // for Lock
+#include "opendavinci/odcore/base/Serializable.h"             // for operator<<, operator>>
+#include "opendavinci/odcore/data/image/SharedImageChannel.h" // for SharedImageChannel
+#include "opendavinci/odcore/wrapper/ConcurrencyFactory.h"    // for ConcurrencyFactory
+#include "opendavinci/odcore/wrapper/Runnable.h"              // for Runnable
+#include "opendavinci/odcore/wrapper/SharedMemory.h"          // for SharedMemory
+#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"   // for SharedMemoryFactory
+#include "opendavinci/odcore/wrapper/Thread.h"                // for Thread
+#include "opendavinci/generated/odcore/data/image/SharedImage.h"  // for SharedImage
+
+using namespace std;
+using namespace odcore::data::image;
+
+class SharedImageChannelTestProducer : public odcore::wrapper::Runnable {
+    public:
+        SharedImageChannelTestProducer(SharedImageChannel &channel, const uint32_t &size, const uint64_t &sequence) :
+            m_channel(channel),
+            m_size(size),
+            m_running(true),
+            m_sequence(sequence) {}
+
+        virtual ~SharedImageChannelTestProducer() {}
+
+        virtual bool isRunning() {
+            return m_running;
+        }
+
+        void stop() {
+            m_running = false;
+        }
+
+        uint64_t getSequence() const {
+            return m_sequence;
+        }
+
+        virtual void run() {
+            while (m_running) {
+                // Every frame consists of one value only; thus, torn frames are detected.
+                char *slot = m_channel.beginWrite();
+                const uint64_t sequence = m_sequence + 1;
+                for (uint32_t i = 0; i < m_size; i++) {
+                    slot[i] = static_cast<char>(sequence % 251);
+                }
+                m_sequence = m_channel.endWrite().getSequence();
+            }
+        }
+
+    private:
+        SharedImageChannel &m_channel;
+        uint32_t m_size;
+        std::atomic<bool> m_running;
+        std::atomic<uint64_t> m_sequence;
+};
+
+class SharedImageChannelTest : public CxxTest::TestSuite {
+    public:
+        SharedImage describe(const string &name, const uint32_t &width, const uint32_t &height) {
+            SharedImage si;
+            si.setName(name);
+            si.setWidth(width);
+            si.setHeight(height);
+            si.setBytesPerPixel(3);
+            si.setSize(width * height * 3);
+            return si;
+        }
+
+        void testSharedImageSerialization() {
+            SharedImage si = describe("camera", 640, 480);
+            si.setSlot(2);
+            si.setSequence((static_cast<uint64_t>(1) << 40) + 1);
+
+            stringstream sstr;
+            sstr << si;
+
+            SharedImage si2;
+            sstr >> si2;
+            TS_ASSERT(si2.getName() == "camera");
+            TS_ASSERT(si2.getSize() == 640 * 480 * 3);
+            TS_ASSERT(si2.getSlot() == 2);
+            TS_ASSERT(si2.getSequence() == (static_cast<uint64_t>(1) << 40) + 1);
+        }
+
+        void testPublishAndRead() {
+            const SharedImage description = describe("SharedImageChannelTest1", 64, 48);
+            SharedImageChannel producer(description, 3);
+            TS_ASSERT(producer.isValid());
+            TS_ASSERT(producer.getNumberOfSlots() == 3);
+
+            vector<char> frame(description.getSize(), 'a');
+            SharedImage si = producer.write(&frame[0], static_cast<uint32_t>(frame.size()));
+            TS_ASSERT(si.getName() == description.getName());
+            TS_ASSERT(si.getSequence() == 1);
+            TS_ASSERT(si.getSlot() == 1);
+
+            // Consumers attach using the received SharedImage.
+            SharedImageChannel consumer(si);
+            TS_ASSERT(consumer.isValid());
+            TS_ASSERT(consumer.getNumberOfSlots() == 3);
+
+            vector<char> buffer(description.getSize(), 0);
+            TS_ASSERT(consumer.read(&buffer[0], static_cast<uint32_t>(buffer.size())));
+            TS_ASSERT(buffer == frame);
+            TS_ASSERT(consumer.getSequence() == 1);
+
+            // Consumers always get the newest frame.
+            for (uint32_t i = 0; i < 5; i++) {
+                memset(producer.beginWrite(), 'b' + i, description.getSize());
+                si = producer.endWrite();
+            }
+            TS_ASSERT(si.getSequence() == 6);
+            TS_ASSERT(si.getSlot() == 0);
+            TS_ASSERT(consumer.read(&buffer[0], static_cast<uint32_t>(buffer.size())));
+            TS_ASSERT(buffer == vector<char>(description.getSize(), 'f'));
+            TS_ASSERT(consumer.getSequence() == 6);
+
+            // A frame being written is not visible.
+            memset(producer.beginWrite(), 'x', description.getSize());
+            TS_ASSERT(consumer.read(&buffer[0], static_cast<uint32_t>(buffer.size())));
+            TS_ASSERT(buffer == vector<char>(description.getSize(), 'f'));
+            producer.endWrite();
+        }
+
+        void testSharedMemoryContainingJustTheImage() {
+            // Images from odplayer or older producers.
+            const SharedImage si = describe("SharedImageChannelTest2", 16, 16);
+            std::shared_ptr<odcore::wrapper::SharedMemory> memory = odcore::wrapper::SharedMemoryFactory::createSharedMemory(si.getName(), si.getSize());
+            {
+                odcore::base::Lock l(memory);
+                memset(memory->getSharedMemory(), 'z', si.getSize());
+            }
+
+            SharedImageChannel consumer(si);
+            TS_ASSERT(consumer.isValid());
+            TS_ASSERT(consumer.getNumberOfSlots() == 0);
+
+            vector<char> buffer(si.getSize(), 0);
+            TS_ASSERT(consumer.read(&buffer[0], static_cast<uint32_t>(buffer.size())));
+            TS_ASSERT(buffer == vector<char>(si.getSize(), 'z'));
+
+            // Such a shared memory is not mistaken for a SharedImageChannel.
+            SharedImage published = si;
+            published.setSequence(1);
+            SharedImageChannel invalid(published);
+            TS_ASSERT(!invalid.isValid());
+            TS_ASSERT(!invalid.read(&buffer[0], static_cast<uint32_t>(buffer.size())));
+
+            // Missing shared memory.
+            SharedImageChannel missing(describe("SharedImageChannelTest3", 16, 16));
+            TS_ASSERT(!missing.isValid());
+        }
+
+        void testNoTornFrames() {
+            const SharedImage description = describe("SharedImageChannelTest4", 320, 240);
+            SharedImageChannel producer(description, SharedImageChannel::DEFAULT_NUMBER_OF_SLOTS);
+            TS_ASSERT(producer.isValid());
+            const vector<char> empty(description.getSize(), static_cast<char>(1));
+            const SharedImage first = producer.write(&empty[0], description.getSize());
+
+            SharedImageChannel consumer(first);
+            TS_ASSERT(consumer.isValid());
+
+            // The producer publishes frames as fast as possible.
+            SharedImageChannelTestProducer p(producer, description.getSize(), first.getSequence());
+            std::shared_ptr<odcore::wrapper::Thread> thread(odcore::wrapper::ConcurrencyFactory::createThread(p));
+            thread->start();
+
+            vector<char> buffer(description.getSize(), 0);
+            uint32_t reads = 0;
+            uint32_t tornFrames = 0;
+            uint64_t lastSequence = 0;
+            bool increasing = true;
+            for (uint32_t i = 0; i < 2000; i++) {
+                if (consumer.read(&buffer[0], static_cast<uint32_t>(buffer.size()))) {
+                    reads++;
+                    const char value = static_cast<char>(consumer.getSequence() % 251);
+                    for (uint32_t j = 0; j < buffer.size(); j++) {
+                        if (buffer[j] != value) {
+                            tornFrames++;
+                            break;
+                        }
+                    }
+                    increasing &= (consumer.getSequence() >= lastSequence);
+                    lastSequence = consumer.getSequence();
+                }
+            }
+
+            p.stop();
+            thread->stop();
+
+            clog << endl << "SharedImageChannel: " << reads << " reads while " << p.getSequence() << " frames were published." << endl;
+            TS_ASSERT(reads > 0);
+            TS_ASSERT(tornFrames == 0);
+            TS_ASSERT(increasing);
+        }
+};
+
+#endif /*CORE_SHAREDIMAGECHANNELTESTSUITE_H_*/
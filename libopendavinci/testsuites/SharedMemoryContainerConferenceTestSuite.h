@@ -0,0 +1,293 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_SHAREDMEMORYCONTAINERCONFERENCETESTSUITE_H_
+#define CORE_SHAREDMEMORYCONTAINERCONFERENCETESTSUITE_H_
+
+#include <iostream>                     // for operator<<, basic_ostream, etc
+#include <memory>                       // for shared_ptr
+#include <sstream>                      // for stringstream
+#include <string>                       // for string
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/FIFOQueue.h"        // for FIFOQueue
+#include "opendavinci/odcore/base/KeyValueConfiguration.h"  // for KeyValueConfiguration
+#include "opendavinci/odcore/base/Thread.h"           // for Thread
+#include "opendavinci/odcore/data/Container.h"        // for Container
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
+#include "opendavinci/odcore/io/conference/BridgedContainerConference.h"
+#include "opendavinci/odcore/io/conference/ContainerConference.h"
+#include "opendavinci/odcore/io/conference/ContainerConferenceFactory.h"
+#include "opendavinci/odcore/io/conference/ContainerListener.h"
+#include "opendavinci/odcore/io/conference/SharedMemoryContainerConference.h"
+#include "opendavinci/odcore/io/conference/UDPMultiCastContainerConference.h"
+#include "opendavinci/generated/odcore/data/LogMessage.h"
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data;
+using namespace odcore::io::conference;
+
+class SharedMemoryContainerConferenceTestListener : public ContainerListener {
+    public:
+        SharedMemoryContainerConferenceTestListener() :
+            m_fifo() {}
+
+        virtual ~SharedMemoryContainerConferenceTestListener() {}
+
+        virtual void nextContainer(Container &c) {
+            m_fifo.add(c);
+        }
+
+        bool waitForContainers(const uint32_t &numberOfContainers) {
+            // Wait at most 5s.
+            for (uint32_t i = 0; (i < 500) && (m_fifo.getSize() < numberOfContainers); i++) {
+                Thread::usleepFor(10000);
+            }
+            return (m_fifo.getSize() == numberOfContainers);
+        }
+
+        FIFOQueue& getFIFO() {
+            return m_fifo;
+        }
+
+    private:
+        FIFOQueue m_fifo;
+};
+
+class SharedMemoryContainerConferenceTest : public CxxTest::TestSuite {
+    public:
+        void testTransportSelection() {
+            const string group = "225.0.0.201";
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            TS_ASSERT(ccf.getTransport(group) == ContainerConferenceFactory::UDP_MULTICAST);
+
+            stringstream config;
+            config << "global.conference.transport = sharedmemory" << endl
+                   << "global.conference.sharedmemory.size = 65536" << endl;
+            KeyValueConfiguration kvc;
+            kvc.readFrom(config);
+
+            TS_ASSERT(ccf.configureTransport(group, kvc, "127.0.0.1"));
+            TS_ASSERT(ccf.getTransport(group) == ContainerConferenceFactory::SHARED_MEMORY);
+            TS_ASSERT(!ccf.configureTransport(group, kvc, "127.0.0.1"));
+
+            // Other addresses are not affected.
+            TS_ASSERT(ccf.getTransport("225.0.0.202") == ContainerConferenceFactory::UDP_MULTICAST);
+
+            std::shared_ptr<ContainerConference> cc = ccf.getContainerConference(group);
+            SharedMemoryContainerConference *smcc = dynamic_cast<SharedMemoryContainerConference*>(cc.get());
+            TS_ASSERT(smcc != NULL);
+            if (smcc != NULL) {
+                TS_ASSERT(smcc->getCapacity() == 65536);
+            }
+            cc.reset();
+
+            // An empty configuration selects UDP multicast again.
+            KeyValueConfiguration empty;
+            TS_ASSERT(ccf.configureTransport(group, empty, "127.0.0.1"));
+            cc = ccf.getContainerConference(group);
+            TS_ASSERT(dynamic_cast<UDPMultiCastContainerConference*>(cc.get()) != NULL);
+        }
+
+        void testTransportSelectionForRemoteSupercomponent() {
+            const string group = "225.0.0.204";
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+
+            TS_ASSERT(ContainerConferenceFactory::isLocalAddress("127.0.0.1"));
+            // Address reserved for documentation (RFC 5737); never assigned to a local interface.
+            TS_ASSERT(!ContainerConferenceFactory::isLocalAddress("203.0.113.7"));
+
+            stringstream config;
+            config << "global.conference.transport = sharedmemory" << endl;
+            KeyValueConfiguration kvc;
+            kvc.readFrom(config);
+
+            // A module on another host than supercomponent must keep UDP multicast.
+            TS_ASSERT(!ccf.configureTransport(group, kvc, "203.0.113.7"));
+            TS_ASSERT(ccf.getTransport(group) == ContainerConferenceFactory::UDP_MULTICAST);
+            std::shared_ptr<ContainerConference> cc = ccf.getContainerConference(group);
+            TS_ASSERT(dynamic_cast<UDPMultiCastContainerConference*>(cc.get()) != NULL);
+            cc.reset();
+
+            // The same configuration on supercomponent's host selects shared memory.
+            TS_ASSERT(ccf.configureTransport(group, kvc, "127.0.0.1"));
+            TS_ASSERT(ccf.getTransport(group) == ContainerConferenceFactory::SHARED_MEMORY);
+            ccf.setTransport(group, ContainerConferenceFactory::UDP_MULTICAST);
+        }
+
+        void testExchange() {
+            const string group = "225.0.0.203";
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            ccf.setTransport(group, ContainerConferenceFactory::SHARED_MEMORY, 256 * 1024);
+
+            std::shared_ptr<ContainerConference> sender = ccf.getContainerConference(group);
+            std::shared_ptr<ContainerConference> receiver = ccf.getContainerConference(group);
+            TS_ASSERT(dynamic_cast<SharedMemoryContainerConference*>(sender.get()) != NULL);
+            TS_ASSERT(dynamic_cast<SharedMemoryContainerConference*>(receiver.get()) != NULL);
+
+            SharedMemoryContainerConferenceTestListener senderListener;
+            SharedMemoryContainerConferenceTestListener receiverListener;
+            sender->setContainerListener(&senderListener);
+            receiver->setContainerListener(&receiverListener);
+
+            // Wrap around the ring several times.
+            const uint32_t NUMBER_OF_CONTAINERS = 2000;
+            for (uint32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                sender->send(c);
+
+                // Give the readers a chance to keep up with the small ring.
+                if ((i % 100) == 0) {
+                    receiverListener.waitForContainers(i + 1);
+                    senderListener.waitForContainers(i + 1);
+                }
+            }
+
+            // Containers are delivered to all participants including the sender.
+            TS_ASSERT(receiverListener.waitForContainers(NUMBER_OF_CONTAINERS));
+            TS_ASSERT(senderListener.waitForContainers(NUMBER_OF_CONTAINERS));
+
+            bool correctOrder = true;
+            for (uint32_t i = 0; (i < NUMBER_OF_CONTAINERS) && !receiverListener.getFIFO().isEmpty(); i++) {
+                Container c = receiverListener.getFIFO().leave();
+                correctOrder &= (c.getDataType() == TimeStamp::ID());
+                correctOrder &= (c.getData<TimeStamp>().getSeconds() == static_cast<int32_t>(i));
+            }
+            TS_ASSERT(correctOrder);
+
+            // Containers that do not fit into a UDP packet.
+            string largeMessage(100 * 1024, 'x');
+            LogMessage lm;
+            lm.setLogMessage(largeMessage);
+            Container c(lm);
+            sender->send(c);
+
+            TS_ASSERT(receiverListener.waitForContainers(1));
+            if (receiverListener.getFIFO().getSize() == 1) {
+                Container received = receiverListener.getFIFO().leave();
+                TS_ASSERT(received.getDataType() == LogMessage::ID());
+                TS_ASSERT(received.getData<LogMessage>().getLogMessage() == largeMessage);
+            }
+
+            // Containers exceeding the ring's capacity are dropped.
+            LogMessage tooLarge;
+            tooLarge.setLogMessage(string(512 * 1024, 'y'));
+            Container c2(tooLarge);
+            sender->send(c2);
+            TS_ASSERT(!receiverListener.waitForContainers(1));
+
+            sender->setContainerListener(NULL);
+            receiver->setContainerListener(NULL);
+        }
+
+        void testBridgeToOtherHosts() {
+            const string group = "225.0.0.205";
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+
+            // A module on another host uses UDP multicast.
+            ccf.setTransport(group, ContainerConferenceFactory::UDP_MULTICAST);
+            std::shared_ptr<ContainerConference> remote = ccf.getContainerConference(group);
+            TS_ASSERT(dynamic_cast<UDPMultiCastContainerConference*>(remote.get()) != NULL);
+
+            // supercomponent and a module on its host use shared memory.
+            ccf.setTransport(group, ContainerConferenceFactory::SHARED_MEMORY);
+            std::shared_ptr<ContainerConference> supercomponent = ccf.getBridgedContainerConference(group);
+            std::shared_ptr<ContainerConference> local = ccf.getContainerConference(group);
+            TS_ASSERT(dynamic_cast<BridgedContainerConference*>(supercomponent.get()) != NULL);
+            TS_ASSERT(dynamic_cast<SharedMemoryContainerConference*>(local.get()) != NULL);
+
+            SharedMemoryContainerConferenceTestListener remoteListener;
+            SharedMemoryContainerConferenceTestListener supercomponentListener;
+            SharedMemoryContainerConferenceTestListener localListener;
+            remote->setContainerListener(&remoteListener);
+            supercomponent->setContainerListener(&supercomponentListener);
+            local->setContainerListener(&localListener);
+
+            // Every participant receives every container exactly once, including its own.
+            for (int32_t i = 1; i < 4; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                switch (i) {
+                    case 1: local->send(c); break; // From this host to the other hosts.
+                    case 2: remote->send(c); break; // From another host to this host.
+                    case 3: supercomponent->send(c); break;
+                }
+
+                TS_ASSERT(remoteListener.waitForContainers(1));
+                TS_ASSERT(supercomponentListener.waitForContainers(1));
+                TS_ASSERT(localListener.waitForContainers(1));
+
+                // Containers must not be passed back and forth.
+                Thread::usleepFor(500 * 1000);
+                TS_ASSERT(remoteListener.getFIFO().getSize() == 1);
+                TS_ASSERT(supercomponentListener.getFIFO().getSize() == 1);
+                TS_ASSERT(localListener.getFIFO().getSize() == 1);
+
+                FIFOQueue *fifos[3] = { &remoteListener.getFIFO(), &supercomponentListener.getFIFO(), &localListener.getFIFO() };
+                for (uint32_t j = 0; j < 3; j++) {
+                    if (!fifos[j]->isEmpty()) {
+                        Container received = fifos[j]->leave();
+                        TS_ASSERT(received.getDataType() == TimeStamp::ID());
+                        TS_ASSERT(received.getData<TimeStamp>().getSeconds() == i);
+                    }
+                    fifos[j]->clear();
+                }
+            }
+
+            local->setContainerListener(NULL);
+            supercomponent->setContainerListener(NULL);
+            remote->setContainerListener(NULL);
+            ccf.setTransport(group, ContainerConferenceFactory::UDP_MULTICAST);
+        }
+
+        void testLatency() {
+            const string group = "225.0.0.204";
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            ccf.setTransport(group, ContainerConferenceFactory::SHARED_MEMORY);
+
+            std::shared_ptr<ContainerConference> sender = ccf.getContainerConference(group);
+            std::shared_ptr<ContainerConference> receiver = ccf.getContainerConference(group);
+
+            SharedMemoryContainerConferenceTestListener receiverListener;
+            receiver->setContainerListener(&receiverListener);
+
+            const uint32_t NUMBER_OF_CONTAINERS = 1000;
+            int64_t latency = 0;
+            for (uint32_t i = 0; i < NUMBER_OF_CONTAINERS; i++) {
+                TimeStamp ts;
+                Container c(ts);
+                sender->send(c);
+
+                TS_ASSERT(receiverListener.waitForContainers(1));
+                if (receiverListener.getFIFO().getSize() == 1) {
+                    Container received = receiverListener.getFIFO().leave();
+                    latency += (received.getReceivedTimeStamp() - received.getSentTimeStamp()).toMicroseconds();
+                }
+            }
+            receiver->setContainerListener(NULL);
+
+            clog << endl << "SharedMemoryContainerConference: average latency " << (latency / NUMBER_OF_CONTAINERS) << " us." << endl;
+        }
+};
+
+#endif /*CORE_SHAREDMEMORYCONTAINERCONFERENCETESTSUITE_H_*/
@@ -20,6 +20,7 @@
 #ifndef CORE_SHAREDMEMORYTESTSUITE_H_
 #define CORE_SHAREDMEMORYTESTSUITE_H_
 
+#include <cstring>                      // for memset
 #include <iosfwd>                       // for stringstream, istream, etc
 #include <string>                       // for operator==, basic_string
 
@@ -29,12 +30,59 @@
 #include <memory>
 #include "opendavinci/odcore/base/Lock.h"             // for Lock
 #include "opendavinci/odcore/base/Serializable.h"     // for operator<<, operator>>
+#include "opendavinci/odcore/base/Thread.h"           // for Thread
+#include "opendavinci/odcore/wrapper/ConcurrencyFactory.h"  // for ConcurrencyFactory
+#include "opendavinci/odcore/wrapper/Runnable.h"      // for Runnable
 #include "opendavinci/odcore/wrapper/SharedMemory.h"  // for SharedMemory
 #include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"  // for SharedMemoryFactory
+#include "opendavinci/odcore/wrapper/Thread.h"     // for Thread
 #include "opendavinci/generated/odcore/data/SharedData.h"  // for SharedData
 
+#ifdef __linux__
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+    #include "opendavinci/odcore/wrapper/POSIX/POSIXMappedSharedMemory.h"
+#endif
+
 using namespace std;
 
+class SharedMemoryTestIncrementer : public odcore::wrapper::Runnable {
+    public:
+        SharedMemoryTestIncrementer(const string &name, const uint32_t &iterations) :
+            m_name(name),
+            m_iterations(iterations) {}
+
+        virtual ~SharedMemoryTestIncrementer() {}
+
+        virtual bool isRunning() {
+            return true;
+        }
+
+        virtual void run() {
+            // Every thread attaches on its own like an independent process.
+            std::shared_ptr<odcore::wrapper::SharedMemory> sm = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(m_name);
+            if (sm->isValid()) {
+                for (uint32_t i = 0; i < m_iterations; i++) {
+                    sm->lock();
+                    uint32_t *counter = static_cast<uint32_t*>(sm->getSharedMemory());
+                    const uint32_t value = *counter;
+                    if ((i % 100) == 0) {
+                        odcore::base::Thread::usleepFor(1);
+                    }
+                    *counter = value + 1;
+                    sm->unlock();
+                }
+            }
+        }
+
+    private:
+        string m_name;
+        uint32_t m_iterations;
+};
+
 class SharedMemoryTest : public CxxTest::TestSuite {
     public:
         void testSharedData1() {
@@ -128,6 +176,121 @@ class SharedMemoryTest : public CxxTest::TestSuite {
             }
         }
 
+        void testSharedMemoryForImages() {
+            const uint32_t SIZE = 640 * 480 * 3;
+            std::shared_ptr<odcore::wrapper::SharedMemory> memServer = odcore::wrapper::SharedMemoryFactory::createSharedMemory("SharedMemoryTest/camera", SIZE);
+            TS_ASSERT(memServer->isValid());
+            TS_ASSERT(memServer->getSize() == SIZE);
+            TS_ASSERT(memServer->getName() == "SharedMemoryTest/camera");
+            memServer->lock();
+            memset(memServer->getSharedMemory(), 'x', SIZE);
+            memServer->unlock();
+
+            std::shared_ptr<odcore::wrapper::SharedMemory> memClient = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory("SharedMemoryTest/camera");
+            TS_ASSERT(memClient->isValid());
+            TS_ASSERT(memClient->getSize() == SIZE);
+            if (memClient->isValid()) {
+                odcore::base::Lock l(memClient);
+                const char *data = static_cast<const char*>(memClient->getSharedMemory());
+                TS_ASSERT(data[0] == 'x');
+                TS_ASSERT(data[SIZE - 1] == 'x');
+            }
+
+            // Attaching to a non-existing shared memory fails.
+            TS_ASSERT(!odcore::wrapper::SharedMemoryFactory::attachToSharedMemory("SharedMemoryTest/unknown")->isValid());
+        }
+
+        void testSharedMemoryWithLongNames() {
+            // Names that differ only after the first 14 characters.
+            const string prefix = "SharedMemoryTest/a-rather-long-name-for-";
+            std::shared_ptr<odcore::wrapper::SharedMemory> left = odcore::wrapper::SharedMemoryFactory::createSharedMemory(prefix + "left-camera", 16);
+            std::shared_ptr<odcore::wrapper::SharedMemory> right = odcore::wrapper::SharedMemoryFactory::createSharedMemory(prefix + "right-camera", 16);
+            TS_ASSERT(left->isValid());
+            TS_ASSERT(right->isValid());
+            if (left->isValid() && right->isValid()) {
+                static_cast<char*>(left->getSharedMemory())[0] = 'L';
+                static_cast<char*>(right->getSharedMemory())[0] = 'R';
+
+                std::shared_ptr<odcore::wrapper::SharedMemory> memClient = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(prefix + "left-camera");
+                TS_ASSERT(memClient->isValid());
+                if (memClient->isValid()) {
+                    TS_ASSERT(static_cast<char*>(memClient->getSharedMemory())[0] == 'L');
+                }
+            }
+        }
+
+        void testSharedMemoryLockWithContention() {
+            const string NAME = "SharedMemoryTest/counter";
+            std::shared_ptr<odcore::wrapper::SharedMemory> memServer = odcore::wrapper::SharedMemoryFactory::createSharedMemory(NAME, sizeof(uint32_t));
+            TS_ASSERT(memServer->isValid());
+            *static_cast<uint32_t*>(memServer->getSharedMemory()) = 0;
+
+            const uint32_t NUMBER_OF_THREADS = 4;
+            const uint32_t ITERATIONS = 10000;
+            SharedMemoryTestIncrementer incrementer(NAME, ITERATIONS);
+            std::shared_ptr<odcore::wrapper::Thread> threads[NUMBER_OF_THREADS];
+            for (uint32_t i = 0; i < NUMBER_OF_THREADS; i++) {
+                threads[i] = std::shared_ptr<odcore::wrapper::Thread>(odcore::wrapper::ConcurrencyFactory::createThread(incrementer));
+                threads[i]->start();
+            }
+            for (uint32_t i = 0; i < NUMBER_OF_THREADS; i++) {
+                threads[i]->stop();
+            }
+
+            odcore::base::Lock l(memServer);
+            TS_ASSERT(*static_cast<uint32_t*>(memServer->getSharedMemory()) == NUMBER_OF_THREADS * ITERATIONS);
+        }
+
+#ifdef __linux__
+        void testSharedMemoryLeftOverFromCrashedOwner() {
+            // Simulate a segment with a 64 bytes header whose owner crashed while holding the lock.
+            const string NAME = "SharedMemoryTest/crashed";
+            const string internalName = odcore::wrapper::POSIX::POSIXMappedSharedMemory::getInternalName(NAME);
+            const int32_t fd = ::shm_open(internalName.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+            TS_ASSERT(fd >= 0);
+            TS_ASSERT(::ftruncate(fd, 64 + 16) == 0);
+            void *mapping = ::mmap(NULL, 64 + 16, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            TS_ASSERT(mapping != MAP_FAILED);
+            ::memset(mapping, 0xFF, 64);
+            ::munmap(mapping, 64 + 16);
+            ::close(fd);
+
+            std::shared_ptr<odcore::wrapper::SharedMemory> memServer = odcore::wrapper::SharedMemoryFactory::createSharedMemory(NAME, 16);
+            TS_ASSERT(memServer->isValid());
+            TS_ASSERT(memServer->getSize() == 16);
+            if (memServer->isValid()) {
+                // Would block forever if the stale lock was kept.
+                odcore::base::Lock l(memServer);
+                static_cast<char*>(memServer->getSharedMemory())[0] = 'C';
+            }
+
+            std::shared_ptr<odcore::wrapper::SharedMemory> memClient = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(NAME);
+            TS_ASSERT(memClient->isValid());
+            if (memClient->isValid()) {
+                odcore::base::Lock l(memClient);
+                TS_ASSERT(static_cast<char*>(memClient->getSharedMemory())[0] == 'C');
+            }
+        }
+
+        void testAttachingToUnpublishedSharedMemory() {
+            // Simulate an owner that has not yet published the header.
+            const string NAME = "SharedMemoryTest/unpublished";
+            const string internalName = odcore::wrapper::POSIX::POSIXMappedSharedMemory::getInternalName(NAME);
+            const int32_t fd = ::shm_open(internalName.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+            TS_ASSERT(fd >= 0);
+            TS_ASSERT(::ftruncate(fd, 64 + 16) == 0);
+            ::close(fd);
+
+            // Attaching gives up after waiting for the magic word.
+            TS_ASSERT(!odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(NAME)->isValid());
+
+            // Once the owner has created the segment, attaching succeeds.
+            std::shared_ptr<odcore::wrapper::SharedMemory> memServer = odcore::wrapper::SharedMemoryFactory::createSharedMemory(NAME, 16);
+            TS_ASSERT(memServer->isValid());
+            TS_ASSERT(odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(NAME)->isValid());
+        }
+#endif
+
 };
 
 #endif /*CORE_SHAREDMEMORYTESTSUITE_H_*/
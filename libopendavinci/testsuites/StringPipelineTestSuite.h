@@ -20,19 +20,52 @@
 #ifndef CORE_STRINGPIPELINETESTSUITE_H_
 #define CORE_STRINGPIPELINETESTSUITE_H_
 
+#include <sstream>
 #include <string>
 #include <vector>
 
 #include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
 
+#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
 #include "opendavinci/odcore/io/StringListener.h"
 #include "opendavinci/odcore/io/StringPipeline.h"
 
 using namespace std;
 using namespace odcore::base;
+using namespace odcore::data;
 using namespace odcore::io;
 
+class StringPipelineTestBlockingListener : public StringListener {
+    public:
+        StringPipelineTestBlockingListener() :
+            m_condition(),
+            m_released(false),
+            m_receivedData() {}
+
+        virtual ~StringPipelineTestBlockingListener() {}
+
+        void nextString(const string &s) {
+            Lock l(m_condition);
+            while (!m_released) {
+                m_condition.waitOnSignal();
+            }
+            m_receivedData.push_back(s);
+        }
+
+        void release() {
+            Lock l(m_condition);
+            m_released = true;
+            m_condition.wakeAll();
+        }
+
+        Condition m_condition;
+        bool m_released;
+        vector<string> m_receivedData;
+};
+
 class StringPipelineTest : public CxxTest::TestSuite, StringListener {
     private:
         vector<string> m_receivedData;
@@ -88,6 +121,45 @@ class StringPipelineTest : public CxxTest::TestSuite, StringListener {
             m_receivedData.clear();
             TS_ASSERT(m_receivedData.size() == 0);
         }
+
+        void testSlowListenerDoesNotBlockSender() {
+            StringPipelineTestBlockingListener listener;
+
+            StringPipeline spl;
+            spl.setStringListener(&listener);
+            spl.start();
+
+            // Many more strings than the ring can hold must be accepted right away.
+            const uint32_t NUMBER_OF_STRINGS = 5000;
+            const TimeStamp before;
+            for (uint32_t i = 0; i < NUMBER_OF_STRINGS; i++) {
+                stringstream sstr;
+                sstr << i;
+                spl.nextString(sstr.str());
+            }
+            TS_ASSERT((TimeStamp() - before).toMicroseconds() < 2 * 1000 * 1000);
+
+            // All strings are delivered in order after the listener has caught up.
+            listener.release();
+            spl.stop();
+
+            TS_ASSERT(listener.m_receivedData.size() == NUMBER_OF_STRINGS);
+            bool inOrder = (listener.m_receivedData.size() == NUMBER_OF_STRINGS);
+            for (uint32_t i = 0; inOrder && (i < NUMBER_OF_STRINGS); i++) {
+                stringstream sstr;
+                sstr << i;
+                inOrder = (listener.m_receivedData.at(i) == sstr.str());
+            }
+            TS_ASSERT(inOrder);
+
+            // Strings received after stopping are counted.
+            TS_ASSERT(spl.getNumberOfDroppedStrings() == 0);
+            spl.nextString("String1");
+            TS_ASSERT(spl.getNumberOfDroppedStrings() == 1);
+            TS_ASSERT(listener.m_receivedData.size() == NUMBER_OF_STRINGS);
+
+            spl.setStringListener(NULL);
+        }
 };
 
 #endif /*CORE_STRINGPIPELINETESTSUITE_H_*/
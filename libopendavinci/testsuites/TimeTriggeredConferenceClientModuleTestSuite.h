@@ -29,11 +29,13 @@
 #include "opendavinci/odcore/opendavinci.h"
 #include <memory>
 #include "opendavinci/odcore/base/Condition.h"        // for Condition
+#include "opendavinci/odcore/base/FIFOQueue.h"        // for FIFOQueue
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"  // for KeyValueConfiguration
 #include "opendavinci/odcore/base/Lock.h"             // for Lock
 #include "opendavinci/odcore/base/Service.h"          // for Service
 #include "opendavinci/odcore/base/Thread.h"           // for Thread
 #include "opendavinci/odcore/base/module/TimeTriggeredConferenceClientModule.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
 #include "opendavinci/odcore/dmcp/ModuleConfigurationProvider.h"
 #include "opendavinci/odcore/dmcp/connection/ConnectionHandler.h"
 #include "opendavinci/odcore/dmcp/connection/ModuleConnection.h"
@@ -122,6 +124,8 @@ class TimeTriggeredConferenceClientModuleTestService : public Service {
         TimeTriggeredConferenceClientModuleTestService(const int32_t &argc, char **argv, Condition& condition) :
                 myCCMTM(argc, argv, condition) {}
 
+        virtual ~TimeTriggeredConferenceClientModuleTestService() {}
+
         virtual void beforeStop() {
             myCCMTM.setModuleState(odcore::data::dmcp::ModuleStateMessage::NOT_RUNNING);
         }
@@ -134,6 +138,53 @@ class TimeTriggeredConferenceClientModuleTestService : public Service {
         TimeTriggeredConferenceClientModuleTestModule myCCMTM;
 };
 
+class TimeTriggeredConferenceClientModuleTestReceiver : public TimeTriggeredConferenceClientModule {
+    public:
+        TimeTriggeredConferenceClientModuleTestReceiver(int argc, char** argv) :
+            TimeTriggeredConferenceClientModule(argc, argv, "TimeTriggeredConferenceClientModuleTestReceiver") {}
+
+        virtual ~TimeTriggeredConferenceClientModuleTestReceiver() {}
+
+        virtual void setUp() {}
+
+        virtual odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode body() {
+            return odcore::data::dmcp::ModuleExitCodeMessage::OKAY;
+        }
+
+        virtual void tearDown() {}
+
+        void add(AbstractDataStore &dataStore) {
+            addDataStoreFor(dataStore);
+        }
+
+        void add(const int32_t &datatype, AbstractDataStore &dataStore) {
+            addDataStoreFor(datatype, dataStore);
+        }
+};
+
+class TimeTriggeredConferenceClientModuleTestSender : public Service {
+    public:
+        TimeTriggeredConferenceClientModuleTestSender(ContainerConference &conference) :
+                m_conference(conference) {}
+
+        virtual ~TimeTriggeredConferenceClientModuleTestSender() {}
+
+        virtual void beforeStop() {}
+
+        virtual void run() {
+            serviceReady();
+            while (isRunning()) {
+                TimeStamp ts;
+                Container c(ts);
+                m_conference.send(c);
+                Thread::usleepFor(500);
+            }
+        }
+
+    private:
+        ContainerConference &m_conference;
+};
+
 class TimeTriggeredConferenceClientModuleTest : public CxxTest::TestSuite,
                      public connection::ConnectionHandler,
                      public ModuleConfigurationProvider {
@@ -153,6 +204,61 @@ class TimeTriggeredConferenceClientModuleTest : public CxxTest::TestSuite,
             m_connection = mc;
         }
 
+        void testAddDataStoresWhileReceiving() {
+            std::shared_ptr<ContainerConference> conference = ContainerConferenceFactory::getInstance().getContainerConference("225.0.0.104");
+
+            string argv0("TimeTriggeredConferenceClientModuleTestReceiver");
+            string argv1("--cid=104");
+            int argc = 2;
+            char **argv;
+            argv = new char*[argc];
+            argv[0] = const_cast<char*>(argv0.c_str());
+            argv[1] = const_cast<char*>(argv1.c_str());
+
+            // The data stores must outlive the module.
+            const uint32_t NUMBER_OF_DATASTORES = 50;
+            vector<std::shared_ptr<FIFOQueue> > queues;
+            vector<std::shared_ptr<FIFOQueue> > queuesForTimeStamp;
+
+            TimeTriggeredConferenceClientModuleTestReceiver *receiver = new TimeTriggeredConferenceClientModuleTestReceiver(argc, argv);
+
+            // Containers are flowing before the data stores are registered.
+            TimeTriggeredConferenceClientModuleTestSender sender(*conference);
+            sender.start();
+            Thread::usleepFor(100 * 1000);
+
+            for (uint32_t i = 0; i < NUMBER_OF_DATASTORES; i++) {
+                queues.push_back(std::shared_ptr<FIFOQueue>(new FIFOQueue()));
+                receiver->add(*queues.back());
+
+                queuesForTimeStamp.push_back(std::shared_ptr<FIFOQueue>(new FIFOQueue()));
+                receiver->add(TimeStamp::ID(), *queuesForTimeStamp.back());
+
+                Thread::usleepFor(1000);
+            }
+
+            // The data stores registered last receive containers as well (wait at most 5s).
+            for (uint32_t i = 0; (i < 500) && (queues.back()->isEmpty() || queuesForTimeStamp.back()->isEmpty()); i++) {
+                Thread::usleepFor(10 * 1000);
+            }
+            TS_ASSERT(!queues.back()->isEmpty());
+            TS_ASSERT(!queuesForTimeStamp.back()->isEmpty());
+
+            // Destroying the module while containers are still flowing
+            // waits for the dispatch in progress; no container is
+            // distributed afterwards.
+            delete receiver;
+            const uint32_t size = queues.back()->getSize();
+            const uint32_t sizeForTimeStamp = queuesForTimeStamp.back()->getSize();
+            Thread::usleepFor(100 * 1000);
+            TS_ASSERT(queues.back()->getSize() == size);
+            TS_ASSERT(queuesForTimeStamp.back()->getSize() == sizeForTimeStamp);
+
+            sender.stop();
+
+            delete [] argv;
+        }
+
         void testTimeTriggeredTimeTriggeredConferenceClientModule() {
             // Setup ContainerConference.
             std::shared_ptr<ContainerConference> conference = ContainerConferenceFactory::getInstance().getContainerConference("225.0.0.101");
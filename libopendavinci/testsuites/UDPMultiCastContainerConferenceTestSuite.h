@@ -0,0 +1,261 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef CORE_UDPMULTICASTCONTAINERCONFERENCETESTSUITE_H_
+#define CORE_UDPMULTICASTCONTAINERCONFERENCETESTSUITE_H_
+
+#include <memory>                       // for shared_ptr
+#include <sstream>                      // for stringstream
+#include <string>                       // for string
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/FIFOQueue.h"        // for FIFOQueue
+#include "opendavinci/odcore/base/KeyValueConfiguration.h"  // for KeyValueConfiguration
+#include "opendavinci/odcore/base/Thread.h"           // for Thread
+#include "opendavinci/odcore/data/Container.h"        // for Container
+#include "opendavinci/odcore/data/TimeStamp.h"        // for TimeStamp
+#include "opendavinci/odcore/io/conference/ContainerConference.h"
+#include "opendavinci/odcore/io/conference/ContainerConferenceFactory.h"
+#include "opendavinci/odcore/io/conference/ContainerListener.h"
+#include "opendavinci/odcore/io/conference/UDPMultiCastContainerConference.h"
+#include "opendavinci/generated/odcore/data/LogMessage.h"
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data;
+using namespace odcore::io::conference;
+
+class UDPMultiCastContainerConferenceTestListener : public ContainerListener {
+    public:
+        UDPMultiCastContainerConferenceTestListener() :
+            m_fifo() {}
+
+        virtual ~UDPMultiCastContainerConferenceTestListener() {}
+
+        virtual void nextContainer(Container &c) {
+            m_fifo.add(c);
+        }
+
+        bool waitForContainers(const uint32_t &numberOfContainers) {
+            // Wait at most 5s.
+            for (uint32_t i = 0; (i < 500) && (m_fifo.getSize() < numberOfContainers); i++) {
+                Thread::usleepFor(10000);
+            }
+            return (m_fifo.getSize() == numberOfContainers);
+        }
+
+        FIFOQueue& getFIFO() {
+            return m_fifo;
+        }
+
+    private:
+        FIFOQueue m_fifo;
+};
+
+class UDPMultiCastContainerConferenceTest : public CxxTest::TestSuite {
+    public:
+        string serialize(const string &message) {
+            LogMessage lm;
+            lm.setLogMessage(message);
+            Container c(lm);
+
+            stringstream sstr;
+            sstr << c;
+            return sstr.str();
+        }
+
+        void testFragmentedExchange() {
+            std::shared_ptr<ContainerConference> cc = ContainerConferenceFactory::getInstance().getContainerConference("225.0.0.205");
+            UDPMultiCastContainerConferenceTestListener listener;
+            cc->setContainerListener(&listener);
+
+            // A compressed camera frame does not fit into one UDP packet.
+            string message(300 * 1024, 'x');
+            for (uint32_t i = 0; i < message.length(); i++) {
+                message[i] = static_cast<char>('a' + (i % 26));
+            }
+            LogMessage lm;
+            lm.setLogMessage(message);
+            Container c(lm);
+            cc->send(c);
+
+            // Small containers are still sent in one packet.
+            TimeStamp ts(1, 2);
+            Container c2(ts);
+            cc->send(c2);
+
+            TS_ASSERT(listener.waitForContainers(2));
+            if (listener.getFIFO().getSize() == 2) {
+                Container received = listener.getFIFO().leave();
+                TS_ASSERT(received.getDataType() == LogMessage::ID());
+                TS_ASSERT(received.getData<LogMessage>().getLogMessage() == message);
+
+                received = listener.getFIFO().leave();
+                TS_ASSERT(received.getDataType() == TimeStamp::ID());
+                TS_ASSERT(received.getData<TimeStamp>().toMicroseconds() == ts.toMicroseconds());
+            }
+
+            cc->setContainerListener(NULL);
+        }
+
+        void testReassembly() {
+            std::shared_ptr<ContainerConference> cc = ContainerConferenceFactory::getInstance().getContainerConference("225.0.0.206", 12176);
+            UDPMultiCastContainerConference *udpmccf = dynamic_cast<UDPMultiCastContainerConference*>(cc.get());
+            TS_ASSERT(udpmccf != NULL);
+            if (udpmccf == NULL) {
+                return;
+            }
+
+            UDPMultiCastContainerConferenceTestListener listener;
+            cc->setContainerListener(&listener);
+
+            const string data = serialize(string(200 * 1024, 'y'));
+            vector<string> fragments = UDPMultiCastContainerConference::createFragments(data, 42, 1);
+            TS_ASSERT(fragments.size() == 4);
+            for (uint32_t i = 0; i < fragments.size(); i++) {
+                TS_ASSERT(fragments.at(i).length() <= UDPMultiCastContainerConference::MAX_PACKET_SIZE);
+            }
+
+            // Fragments arriving out of order and duplicated.
+            udpmccf->nextString(fragments.at(3));
+            udpmccf->nextString(fragments.at(1));
+            udpmccf->nextString(fragments.at(1));
+            udpmccf->nextString(fragments.at(0));
+            TS_ASSERT(listener.getFIFO().getSize() == 0);
+            udpmccf->nextString(fragments.at(2));
+            TS_ASSERT(listener.getFIFO().getSize() == 1);
+            TS_ASSERT(udpmccf->getNumberOfDroppedContainers() == 0);
+
+            // Too many incomplete containers at the same time.
+            for (uint32_t i = 0; i <= UDPMultiCastContainerConference::MAX_PENDING_CONTAINERS; i++) {
+                udpmccf->nextString(UDPMultiCastContainerConference::createFragments(data, 42, 100 + i).at(0));
+            }
+            TS_ASSERT(udpmccf->getNumberOfDroppedContainers() == 1);
+
+            // The oldest container was dropped; the others can still be completed.
+            fragments = UDPMultiCastContainerConference::createFragments(data, 42, 101);
+            for (uint32_t i = 1; i < fragments.size(); i++) {
+                udpmccf->nextString(fragments.at(i));
+            }
+            TS_ASSERT(listener.getFIFO().getSize() == 2);
+
+            // Incomplete containers are dropped after the timeout.
+            Thread::usleepFor((UDPMultiCastContainerConference::REASSEMBLY_TIMEOUT + 100) * 1000);
+            udpmccf->nextString(UDPMultiCastContainerConference::createFragments(data, 43, 1).at(0));
+            TS_ASSERT(udpmccf->getNumberOfDroppedContainers() == UDPMultiCastContainerConference::MAX_PENDING_CONTAINERS);
+
+            cc->setContainerListener(NULL);
+        }
+
+        void testMalformedFragments() {
+            std::shared_ptr<ContainerConference> cc = ContainerConferenceFactory::getInstance().getContainerConference("225.0.0.207", 12176);
+            UDPMultiCastContainerConference *udpmccf = dynamic_cast<UDPMultiCastContainerConference*>(cc.get());
+            TS_ASSERT(udpmccf != NULL);
+            if (udpmccf == NULL) {
+                return;
+            }
+
+            UDPMultiCastContainerConferenceTestListener listener;
+            cc->setContainerListener(&listener);
+
+            const string data = serialize(string(200 * 1024, 'z'));
+            const vector<string> fragments = UDPMultiCastContainerConference::createFragments(data, 44, 1);
+            TS_ASSERT(fragments.size() == 4);
+
+            // A truncated fragment in the middle would leave a gap.
+            udpmccf->nextString(fragments.at(0));
+            udpmccf->nextString(fragments.at(1).substr(0, fragments.at(1).length() - 100));
+            udpmccf->nextString(fragments.at(2));
+            udpmccf->nextString(fragments.at(3));
+            TS_ASSERT(listener.getFIFO().getSize() == 0);
+
+            // A truncated or extended last fragment does not match the declared size.
+            const string &last = fragments.at(3);
+            udpmccf->nextString(last.substr(0, last.length() - 1));
+            udpmccf->nextString(last + "x");
+            TS_ASSERT(listener.getFIFO().getSize() == 0);
+
+            // A full-size fragment claiming the position of the shorter last one.
+            vector<string> beyond = UDPMultiCastContainerConference::createFragments(data, 44, 2);
+            string shifted = beyond.at(0);
+            shifted[2] = 0;
+            shifted[3] = 3;
+            for (uint32_t i = 0; i < 3; i++) {
+                udpmccf->nextString(beyond.at(i));
+            }
+            udpmccf->nextString(shifted);
+            TS_ASSERT(listener.getFIFO().getSize() == 0);
+
+            // The correct fragment completes the container.
+            udpmccf->nextString(fragments.at(1));
+            TS_ASSERT(listener.getFIFO().getSize() == 1);
+            if (listener.getFIFO().getSize() == 1) {
+                Container received = listener.getFIFO().leave();
+                TS_ASSERT(received.getDataType() == LogMessage::ID());
+                TS_ASSERT(received.getData<LogMessage>().getLogMessage() == string(200 * 1024, 'z'));
+            }
+
+            cc->setContainerListener(NULL);
+        }
+
+        void testConfiguredUDPParameters() {
+            const string group = "225.0.0.207";
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            TS_ASSERT(ccf.getUDPBatchSize(group) == UDPMultiCastContainerConference::BATCH_SIZE);
+            TS_ASSERT(ccf.getUDPReceiveBufferSize(group) == UDPMultiCastContainerConference::RECEIVE_BUFFER_SIZE);
+
+            stringstream config;
+            config << "global.conference.udp.batchSize = 1" << endl;
+            config << "global.conference.udp.receiveBufferSize = 262144" << endl;
+            KeyValueConfiguration kvc;
+            kvc.readFrom(config);
+
+            // Changed socket parameters require a new conference.
+            TS_ASSERT(ccf.configureTransport(group, kvc, "127.0.0.1"));
+            TS_ASSERT(!ccf.configureTransport(group, kvc, "127.0.0.1"));
+            TS_ASSERT(ccf.getTransport(group) == ContainerConferenceFactory::UDP_MULTICAST);
+            TS_ASSERT(ccf.getUDPBatchSize(group) == 1);
+            TS_ASSERT(ccf.getUDPReceiveBufferSize(group) == 262144);
+
+            // Other addresses are not affected.
+            TS_ASSERT(ccf.getUDPBatchSize("225.0.0.208") == UDPMultiCastContainerConference::BATCH_SIZE);
+
+            // Exchange without batched receiving.
+            std::shared_ptr<ContainerConference> cc = ccf.getContainerConference(group);
+            TS_ASSERT(dynamic_cast<UDPMultiCastContainerConference*>(cc.get()) != NULL);
+            UDPMultiCastContainerConferenceTestListener listener;
+            cc->setContainerListener(&listener);
+
+            TimeStamp ts(3, 4);
+            Container c(ts);
+            cc->send(c);
+            TS_ASSERT(listener.waitForContainers(1));
+            cc->setContainerListener(NULL);
+
+            // An empty configuration restores the defaults.
+            KeyValueConfiguration empty;
+            TS_ASSERT(ccf.configureTransport(group, empty, "127.0.0.1"));
+            TS_ASSERT(ccf.getUDPBatchSize(group) == UDPMultiCastContainerConference::BATCH_SIZE);
+        }
+};
+
+#endif /*CORE_UDPMULTICASTCONTAINERCONFERENCETESTSUITE_H_*/
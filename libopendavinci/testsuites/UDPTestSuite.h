@@ -21,19 +21,102 @@
 #define CORE_WRAPPER_UDPTESTSUITE_H_
 
 #include <iostream>                     // for endl, operator<<, etc
+#include <sstream>                      // for stringstream
 #include <string>                       // for string
+#include <vector>                       // for vector
 
 #include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
 
 #include "opendavinci/odcore/opendavinci.h"
 #include <memory>
+#include "opendavinci/odcore/base/Lock.h"           // for Lock
+#include "opendavinci/odcore/base/Mutex.h"          // for Mutex
+#include "opendavinci/odcore/base/Thread.h"         // for Thread
+#include "opendavinci/odcore/data/TimeStamp.h"      // for TimeStamp
+#include "opendavinci/odcore/io/Packet.h"           // for Packet
+#include "opendavinci/odcore/io/PacketListener.h"   // for PacketListener
+#include "opendavinci/odcore/io/udp/UDPReceiver.h"  // for UDPReceiver
+#include "opendavinci/odcore/io/udp/UDPSender.h"    // for UDPSender
 #include "mocks/StringListenerMock.h"
 
-namespace odcore { namespace io { namespace udp { class UDPReceiver; } } }
-namespace odcore { namespace io { namespace udp { class UDPSender; } } }
-
 using namespace std;
 
+class UDPPacketCounter : public odcore::io::PacketListener {
+    public:
+        UDPPacketCounter() :
+            m_mutex(),
+            m_count(0),
+            m_invalid(0),
+            m_sender(),
+            m_lastPacket() {}
+
+        virtual void nextPacket(const odcore::io::Packet &p) {
+            odcore::base::Lock l(m_mutex);
+            if ( (p.getData().length() < 4) || (p.getData().substr(0, 4) != "UDP ") ) {
+                m_invalid++;
+            }
+            m_count++;
+            m_sender = p.getSender();
+            m_lastPacket = odcore::data::TimeStamp();
+        }
+
+        uint32_t getCount() {
+            odcore::base::Lock l(m_mutex);
+            return m_count;
+        }
+
+        uint32_t getInvalid() {
+            odcore::base::Lock l(m_mutex);
+            return m_invalid;
+        }
+
+        string getSender() {
+            odcore::base::Lock l(m_mutex);
+            return m_sender;
+        }
+
+        odcore::data::TimeStamp getLastPacket() {
+            odcore::base::Lock l(m_mutex);
+            return m_lastPacket;
+        }
+
+        /**
+         * This method waits until no further packets arrive.
+         *
+         * @param expected Number of packets after which waiting is not necessary.
+         */
+        void waitForPackets(const uint32_t &expected) {
+            uint32_t last = getCount();
+            while (last < expected) {
+                odcore::base::Thread::usleepFor(100 * 1000);
+                const uint32_t current = getCount();
+                if (current == last) {
+                    break;
+                }
+                last = current;
+            }
+        }
+
+    private:
+        odcore::base::Mutex m_mutex;
+        uint32_t m_count;
+        uint32_t m_invalid;
+        string m_sender;
+        odcore::data::TimeStamp m_lastPacket;
+};
+
+static vector<string> createUDPPackets(const uint32_t &numberOfPackets, const uint32_t &size) {
+    vector<string> packets;
+    for (uint32_t i = 0; i < numberOfPackets; i++) {
+        stringstream sstr;
+        sstr << "UDP " << i << " ";
+        string packet = sstr.str();
+        packet.resize(size, 'x');
+        packets.push_back(packet);
+    }
+    return packets;
+}
+
 #ifndef WIN32
     #include "opendavinci/odcore/wrapper/POSIX/POSIXUDPFactoryWorker.h"
     #include "opendavinci/odcore/wrapper/POSIX/POSIXUDPReceiver.h"
@@ -68,6 +151,84 @@ using namespace std;
             receiver->setStringListener(NULL);
             receiver->stop();
         }
+
+        static void testBatch(UDPPacketCounter &counter, const uint32_t &numberOfPackets)
+        {
+            clog << endl << "UDPTestPOSIX (batch)" << endl;
+            const string group = "225.0.0.13";
+            const uint32_t port = 4568;
+
+            std::shared_ptr<odcore::io::udp::UDPReceiver> receiver(
+                    odcore::wrapper::UDPFactoryWorker<odcore::wrapper::NetworkLibraryPosix>::createUDPReceiver(group, port));
+
+            std::shared_ptr<odcore::io::udp::UDPSender> sender(
+                                odcore::wrapper::UDPFactoryWorker<odcore::wrapper::NetworkLibraryPosix>::createUDPSender(group, port));
+
+            receiver->setReceiveBufferSize(1024 * 1024);
+            receiver->setBatchSize(16);
+            receiver->setPacketListener(&counter);
+            receiver->start();
+
+            sender->sendBatch(createUDPPackets(numberOfPackets, 64));
+
+            counter.waitForPackets(numberOfPackets);
+
+            receiver->stop();
+            receiver->setPacketListener(NULL);
+        }
+
+        static void benchmark(const uint32_t &batchSize, const uint32_t &receiveBufferSize)
+        {
+            const string group = "225.0.0.13";
+            const uint32_t port = 4569;
+            const uint32_t NUMBER_OF_PACKETS = 20000;
+
+            std::shared_ptr<odcore::io::udp::UDPReceiver> receiver(
+                    odcore::wrapper::UDPFactoryWorker<odcore::wrapper::NetworkLibraryPosix>::createUDPReceiver(group, port));
+
+            std::shared_ptr<odcore::io::udp::UDPSender> sender(
+                                odcore::wrapper::UDPFactoryWorker<odcore::wrapper::NetworkLibraryPosix>::createUDPSender(group, port));
+
+            UDPPacketCounter counter;
+            if (receiveBufferSize > 0) {
+                receiver->setReceiveBufferSize(receiveBufferSize);
+            }
+            receiver->setBatchSize(batchSize);
+            receiver->setPacketListener(&counter);
+            receiver->start();
+
+            const vector<string> packets = createUDPPackets(NUMBER_OF_PACKETS, 64);
+
+            odcore::data::TimeStamp before;
+            if (batchSize > 1) {
+                sender->sendBatch(packets);
+            }
+            else {
+                for (vector<string>::const_iterator it = packets.begin(); it != packets.end(); ++it) {
+                    sender->send(*it);
+                }
+            }
+            odcore::data::TimeStamp afterSending;
+            counter.waitForPackets(NUMBER_OF_PACKETS);
+
+            receiver->stop();
+            receiver->setPacketListener(NULL);
+
+            const uint32_t received = counter.getCount();
+            const double duration = (counter.getLastPacket() - before).toMicroseconds() / 1000000.0;
+            stringstream bufferSize;
+            if (receiveBufferSize > 0) {
+                bufferSize << receiveBufferSize << " bytes";
+            }
+            else {
+                bufferSize << "default";
+            }
+            clog << "Batch size " << batchSize << ", receive buffer " << bufferSize.str() << ": " << received << " of " << NUMBER_OF_PACKETS << " packets received ("
+                 << (NUMBER_OF_PACKETS - received) << " dropped), "
+                 << (duration > 0 ? static_cast<uint32_t>(received / duration) : 0) << " packets/s received, sending took " << (afterSending - before).toMicroseconds() << " us." << endl;
+
+            TS_ASSERT(counter.getInvalid() == 0);
+        }
     };
 
 #endif
@@ -128,6 +289,32 @@ using namespace std;
                 TS_ASSERT( mock.CALLWAITER_nextString.wasCalled() );
                 TS_ASSERT( mock.correctCalled() );
             }
+
+            void testBatchedDataExchange()
+            {
+                #ifndef WIN32
+                const uint32_t NUMBER_OF_PACKETS = 50;
+                UDPPacketCounter counter;
+                UDPTestPOSIX::testBatch(counter, NUMBER_OF_PACKETS);
+
+                TS_ASSERT(counter.getCount() == NUMBER_OF_PACKETS);
+                TS_ASSERT(counter.getInvalid() == 0);
+                TS_ASSERT(counter.getSender() != "");
+                #endif
+            }
+
+            void testBenchmarkBatchedReceiving()
+            {
+                #ifndef WIN32
+                clog << endl << "UDPTestPOSIX (benchmark)" << endl;
+                // Per packet system calls with the default receive buffer.
+                UDPTestPOSIX::benchmark(1, 0);
+                // recvmmsg/sendmmsg with the default receive buffer.
+                UDPTestPOSIX::benchmark(32, 0);
+                // recvmmsg/sendmmsg with a larger receive buffer.
+                UDPTestPOSIX::benchmark(32, 4 * 1024 * 1024);
+                #endif
+            }
     };
 
 
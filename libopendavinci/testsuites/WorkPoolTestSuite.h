@@ -0,0 +1,146 @@
+/**
+ * OpenDaVINCI - Portable middleware for distributed components.
+ * Copyright (C) 2015 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ * 
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+
+#ifndef CORE_WORKPOOLTESTSUITE_H_
+#define CORE_WORKPOOLTESTSUITE_H_
+
+#include <stdexcept>                    // for runtime_error
+#include <string>                       // for string
+#include <vector>                       // for vector
+
+#include "cxxtest/TestSuite.h"          // for TS_ASSERT, TestSuite
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/WorkPool.h"  // for WorkPool
+
+using namespace std;
+using namespace odcore::base;
+
+class WorkPoolTestCounter : public WorkPool::Task {
+    public:
+        WorkPoolTestCounter(const uint32_t &numberOfItems) :
+            m_counts(numberOfItems, 0) {}
+
+        virtual void process(const uint32_t &item) {
+            // Every item is processed by one thread only; thus, no lock is needed.
+            m_counts[item]++;
+        }
+
+    public:
+        vector<uint32_t> m_counts;
+};
+
+class WorkPoolTestThrower : public WorkPool::Task {
+    public:
+        WorkPoolTestThrower(const uint32_t &numberOfItems) :
+            m_processed(numberOfItems, 0) {}
+
+        virtual void process(const uint32_t &item) {
+            m_processed[item] = 1;
+            if ( (item == 3) || (item == 7) ) {
+                throw runtime_error((item == 3) ? "3" : "7");
+            }
+        }
+
+    public:
+        vector<uint8_t> m_processed;
+};
+
+class WorkPoolTest : public CxxTest::TestSuite {
+    public:
+        void testNumberOfThreads() {
+            WorkPool pool1(1);
+            TS_ASSERT(pool1.getNumberOfThreads() == 1);
+
+            WorkPool pool3(3);
+            TS_ASSERT(pool3.getNumberOfThreads() == 3);
+
+            WorkPool poolCores(0);
+            TS_ASSERT(poolCores.getNumberOfThreads() >= 1);
+        }
+
+        void testEveryItemIsProcessedOnce() {
+            const uint32_t threads[] = { 1, 2, 4 };
+            for (uint32_t i = 0; i < 3; i++) {
+                WorkPool pool(threads[i]);
+
+                // Every job is joined by the workers anew.
+                const uint32_t JOBS = 50;
+                WorkPoolTestCounter counter(1000);
+                for (uint32_t job = 0; job < JOBS; job++) {
+                    pool.execute(counter, counter.m_counts.size());
+
+                    // All items are processed when execute returns.
+                    bool processed = true;
+                    for (uint32_t item = 0; item < counter.m_counts.size(); item++) {
+                        processed &= (counter.m_counts.at(item) == (job + 1));
+                    }
+                    TS_ASSERT(processed);
+                }
+            }
+        }
+
+        void testJobsOfDifferentSizes() {
+            WorkPool pool(4);
+
+            WorkPoolTestCounter empty(0);
+            pool.execute(empty, 0);
+            TS_ASSERT(empty.m_counts.empty());
+
+            WorkPoolTestCounter single(1);
+            pool.execute(single, 1);
+            TS_ASSERT(single.m_counts.at(0) == 1);
+
+            // Fewer items than threads.
+            WorkPoolTestCounter few(3);
+            pool.execute(few, 3);
+            TS_ASSERT(few.m_counts.at(0) == 1);
+            TS_ASSERT(few.m_counts.at(1) == 1);
+            TS_ASSERT(few.m_counts.at(2) == 1);
+        }
+
+        void testFirstExceptionIsRethrown() {
+            WorkPool pool(3);
+            WorkPoolTestThrower thrower(100);
+
+            string what;
+            try {
+                pool.execute(thrower, thrower.m_processed.size());
+            }
+            catch(const runtime_error &e) {
+                what = e.what();
+            }
+            TS_ASSERT(what == "3");
+
+            // The remaining items are processed nevertheless.
+            bool processed = true;
+            for (uint32_t item = 0; item < thrower.m_processed.size(); item++) {
+                processed &= (thrower.m_processed.at(item) == 1);
+            }
+            TS_ASSERT(processed);
+
+            // The pool can be used afterwards.
+            WorkPoolTestCounter counter(100);
+            pool.execute(counter, counter.m_counts.size());
+            TS_ASSERT(counter.m_counts.at(99) == 1);
+        }
+};
+
+#endif /*CORE_WORKPOOLTESTSUITE_H_*/
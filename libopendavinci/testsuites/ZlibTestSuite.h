@@ -44,6 +44,26 @@ class ZlibTest : public CxxTest::TestSuite {
             TS_ASSERT(odcore::strings::StringToolbox::equalsIgnoreCase(input, decompressedOutput));
         }
 
+        void testBlockCompressionDecompression() {
+            // Binary data larger than the buffer used by compress().
+            string input(100000, '\0');
+            for (uint32_t i = 0; i < input.size(); i++) {
+                input[i] = static_cast<char>((i * 7) % 13);
+            }
+
+            string compressedOutput;
+            TS_ASSERT(Zlib::compressBlock(input.c_str(), input.size(), compressedOutput));
+            TS_ASSERT(compressedOutput.size() > 0);
+            TS_ASSERT(compressedOutput.size() < input.size());
+
+            string decompressedOutput;
+            TS_ASSERT(Zlib::decompressBlock(compressedOutput.c_str(), compressedOutput.size(), input.size(), decompressedOutput));
+            TS_ASSERT(decompressedOutput == input);
+
+            // Wrong length of the original data.
+            TS_ASSERT(!Zlib::decompressBlock(compressedOutput.c_str(), compressedOutput.size(), input.size() - 1, decompressedOutput));
+        }
+
 };
 
 #endif /*CORE_ZLIBTESTSUITE_H_*/
@@ -26,6 +26,7 @@
 
 #include "opendavinci/odcore/data/SerializableData.h"
 #include "opendlv/data/environment/Point3.h"
+#include "opendlv/data/environment/PolygonXY.h"
 
 namespace opendlv {
     namespace data {
@@ -141,6 +142,7 @@ namespace opendlv {
 
                 private:
                     vector<Point3> m_listOfVertices;
+                    PolygonXY m_verticesXY;
             };
 
         }
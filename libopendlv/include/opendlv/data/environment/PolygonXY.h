@@ -0,0 +1,132 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_DATA_ENVIRONMENT_POLYGONXY_H_
+#define HESPERIA_DATA_ENVIRONMENT_POLYGONXY_H_
+
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace opendlv {
+    namespace data {
+        namespace environment {
+
+            using namespace std;
+
+            /**
+             * This class stores the X and Y coordinates of a closed
+             * polygon as structure of arrays and provides the kernels
+             * for segment intersection and point-in-polygon tests used
+             * by Polygon. The kernels are vectorized with AVX or SSE2
+             * where available; otherwise, a scalar implementation
+             * producing identical results is used.
+             */
+            class OPENDAVINCI_API PolygonXY {
+                private:
+                    const static double EPSILON;
+
+                public:
+                    PolygonXY();
+
+                    /**
+                     * Copy constructor.
+                     *
+                     * @param obj Reference to an object of this class.
+                     */
+                    PolygonXY(const PolygonXY &obj);
+
+                    virtual ~PolygonXY();
+
+                    /**
+                     * Assignment operator.
+                     *
+                     * @param obj Reference to an object of this class.
+                     * @return Reference to this instance.
+                     */
+                    PolygonXY& operator=(const PolygonXY &obj);
+
+                    /**
+                     * This method removes all vertices.
+                     */
+                    void clear();
+
+                    /**
+                     * This method adds a vertex.
+                     *
+                     * @param x X coordinate.
+                     * @param y Y coordinate.
+                     */
+                    void add(const double &x, const double &y);
+
+                    /**
+                     * @return Number of vertices.
+                     */
+                    uint32_t getSize() const;
+
+                    /**
+                     * @param i Index of the vertex; getSize() refers to the first vertex again.
+                     * @return X coordinate of the i-th vertex.
+                     */
+                    double getX(const uint32_t &i) const;
+
+                    /**
+                     * @param i Index of the vertex; getSize() refers to the first vertex again.
+                     * @return Y coordinate of the i-th vertex.
+                     */
+                    double getY(const uint32_t &i) const;
+
+                    /**
+                     * This method checks if the given point is within
+                     * this polygon like Polygon::containsIgnoreZ.
+                     *
+                     * @param x X coordinate of the point to be tested.
+                     * @param y Y coordinate of the point to be tested.
+                     * @return true, if the point is within this polygon.
+                     */
+                    bool containsIgnoreZ(const double &x, const double &y) const;
+
+                    /**
+                     * This method intersects the line from A to B with
+                     * every edge of this polygon like Line::intersectIgnoreZ
+                     * called on the line AB. Edge j connects the vertices
+                     * j and j+1; the last edge closes the polygon.
+                     *
+                     * @param aX X coordinate of A.
+                     * @param aY Y coordinate of A.
+                     * @param bX X coordinate of B.
+                     * @param bY Y coordinate of B.
+                     * @param hits hits[j] != 0 if edge j is intersected.
+                     * @param resultX X coordinates of the intersection points.
+                     * @param resultY Y coordinates of the intersection points.
+                     */
+                    void intersectEdgesIgnoreZ(const double &aX, const double &aY, const double &bX, const double &bY,
+                                               vector<uint8_t> &hits, vector<double> &resultX, vector<double> &resultY) const;
+
+                private:
+                    // The first vertex is repeated at the end to close the polygon.
+                    vector<double> m_x;
+                    vector<double> m_y;
+            };
+
+        }
+    }
+} // opendlv::data::environment
+
+#endif /*HESPERIA_DATA_ENVIRONMENT_POLYGONXY_H_*/
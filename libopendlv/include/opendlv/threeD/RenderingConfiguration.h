@@ -31,6 +31,8 @@
 namespace opendlv {
     namespace threeD {
 
+        class SoftwareRenderer;
+
         /**
          * This class configures several options for the rendering method.
          */
@@ -89,8 +91,25 @@ namespace opendlv {
                  */
                 void setNodeRenderingConfiguration(const NodeDescriptor &nd, const NodeRenderingConfiguration &nrc);
 
+                /**
+                 * This method returns the renderer to be used
+                 * instead of OpenGL.
+                 *
+                 * @return SoftwareRenderer or NULL if OpenGL is used.
+                 */
+                SoftwareRenderer* getSoftwareRenderer() const;
+
+                /**
+                 * This method sets the renderer to be used instead
+                 * of OpenGL.
+                 *
+                 * @param softwareRenderer SoftwareRenderer or NULL to use OpenGL.
+                 */
+                void setSoftwareRenderer(SoftwareRenderer *softwareRenderer);
+
             private:
                 bool m_drawTextures;
+                SoftwareRenderer *m_softwareRenderer;
                 map<NodeDescriptor, NodeRenderingConfiguration, NodeDescriptorComparator> m_nodesRenderingConfiguration;
         };
 
@@ -0,0 +1,343 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_CORE_THREED_SOFTWARERENDERER_H_
+#define HESPERIA_CORE_THREED_SOFTWARERENDERER_H_
+
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Mutex.h"
+#include "opendavinci/odcore/base/WorkPool.h"
+#include "opendlv/core/wrapper/Image.h"
+#include "opendlv/data/environment/Point3.h"
+
+namespace opendlv {
+    namespace threeD {
+
+        using namespace std;
+
+        /**
+         * This class renders a scene without OpenGL into a BGR image
+         * in main memory. It is used by the scene graph's nodes in place
+         * of OpenGL if the RenderingConfiguration provides an instance.
+         *
+         * Like the OpenGL fixed function pipeline without lighting, the
+         * primitives are transformed by a matrix stack, clipped at the
+         * near plane, and drawn with per-vertex colors or a texture
+         * (nearest texel, repeated) using a depth test. The primitives
+         * are collected first and binned into tiles of TILE_WIDTH x
+         * TILE_HEIGHT pixels; render() rasterizes the tiles using
+         * several threads including the calling one. As every tile
+         * draws its primitives in the order they were added, the
+         * image does not depend on the number of threads.
+         *
+         * @code
+         * SoftwareRenderer sr(640, 480, 0);
+         * sr.setPerspective(60, 640.0/480.0, 1, 20);
+         * sr.clear(Point3(0, 0.58, 0.78));
+         * sr.loadIdentity();
+         * sr.lookAt(Point3(0, 0, 2.8), Point3(15, 0, 0), Point3(0, 0, 1));
+         *
+         * RenderingConfiguration r;
+         * r.setSoftwareRenderer(&sr);
+         * root->render(r);
+         *
+         * sr.render(image->getRawData());
+         * @endcode
+         */
+        class OPENDAVINCI_API SoftwareRenderer : private odcore::base::WorkPool::Task {
+            public:
+                enum TILES {
+                    TILE_WIDTH = 64,
+                    TILE_HEIGHT = 32
+                };
+
+            private:
+                /**
+                 * Column-major 4x4 matrix like OpenGL's.
+                 */
+                struct Matrix {
+                    double m_m[16];
+                };
+
+                /**
+                 * Vertex after projection to the screen; color and
+                 * texture coordinates are not yet divided by w.
+                 */
+                struct ScreenVertex {
+                    double m_x;
+                    double m_y;
+                    double m_z;
+                    double m_invW;
+                    double m_r;
+                    double m_g;
+                    double m_b;
+                    double m_u;
+                    double m_v;
+                };
+
+                enum ATTRIBUTES {
+                    Z,
+                    INVW,
+                    R,
+                    G,
+                    B,
+                    U,
+                    V,
+                    NUMBER_OF_ATTRIBUTES
+                };
+
+                /**
+                 * Triangle prepared for rasterization: edge functions
+                 * and attribute planes in screen coordinates.
+                 */
+                struct Triangle {
+                    double m_edgeA[3];
+                    double m_edgeB[3];
+                    double m_edgeC[3];
+                    double m_dx[NUMBER_OF_ATTRIBUTES];
+                    double m_dy[NUMBER_OF_ATTRIBUTES];
+                    double m_c[NUMBER_OF_ATTRIBUTES];
+                    int32_t m_minX;
+                    int32_t m_minY;
+                    int32_t m_maxX;
+                    int32_t m_maxY;
+                    const core::wrapper::Image *m_texture;
+                };
+
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                SoftwareRenderer(const SoftwareRenderer &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                SoftwareRenderer& operator=(const SoftwareRenderer &/*obj*/);
+
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param width Width of the image.
+                 * @param height Height of the image.
+                 * @param numberOfThreads Number of threads including the calling thread (0 = number of cores).
+                 */
+                SoftwareRenderer(const uint32_t &width, const uint32_t &height, const uint32_t &numberOfThreads);
+
+                virtual ~SoftwareRenderer();
+
+                uint32_t getWidth() const;
+
+                uint32_t getHeight() const;
+
+                /**
+                 * @return Number of threads including the calling thread.
+                 */
+                uint32_t getNumberOfThreads() const;
+
+                /**
+                 * @return Number of triangles to be drawn by the next call to render().
+                 */
+                uint32_t getNumberOfTriangles() const;
+
+                /**
+                 * This method sets the projection like gluPerspective.
+                 *
+                 * @param fovY Vertical field of view in degrees.
+                 * @param aspect Ratio of width to height.
+                 * @param zNear Distance to the near plane.
+                 * @param zFar Distance to the far plane.
+                 */
+                void setPerspective(const double &fovY, const double &aspect, const double &zNear, const double &zFar);
+
+                /**
+                 * This method removes all primitives added so far and
+                 * sets the background color for the next call to render().
+                 *
+                 * @param color Background color (R, G, B between 0 and 1).
+                 */
+                void clear(const opendlv::data::environment::Point3 &color);
+
+                /**
+                 * This method replaces the current model view matrix
+                 * by the identity matrix.
+                 */
+                void loadIdentity();
+
+                /**
+                 * This method multiplies the current model view matrix
+                 * with a viewing transformation like gluLookAt.
+                 *
+                 * @param eye Position of the eye.
+                 * @param center Point to look at.
+                 * @param up Direction of up.
+                 */
+                void lookAt(const opendlv::data::environment::Point3 &eye, const opendlv::data::environment::Point3 &center, const opendlv::data::environment::Point3 &up);
+
+                void pushMatrix();
+
+                void popMatrix();
+
+                void translate(const opendlv::data::environment::Point3 &t);
+
+                /**
+                 * This method rotates the current model view matrix.
+                 *
+                 * @param angle Angle in RAD.
+                 * @param axis Axis to rotate around.
+                 */
+                void rotate(const double &angle, const opendlv::data::environment::Point3 &axis);
+
+                void scale(const opendlv::data::environment::Point3 &s);
+
+                /**
+                 * This method sets the color for the following
+                 * primitives without individual colors.
+                 *
+                 * @param color Color (R, G, B between 0 and 1).
+                 */
+                void setColor(const opendlv::data::environment::Point3 &color);
+
+                /**
+                 * This method sets the texture for the following textured
+                 * triangles. The image must be valid until render() returns.
+                 *
+                 * @param texture Texture or NULL to use the current color.
+                 */
+                void setTexture(const core::wrapper::Image *texture);
+
+                /**
+                 * This method adds a triangle using the current color.
+                 */
+                void addTriangle(const opendlv::data::environment::Point3 &a,
+                                 const opendlv::data::environment::Point3 &b,
+                                 const opendlv::data::environment::Point3 &c);
+
+                /**
+                 * This method adds a triangle with colors per vertex
+                 * that are interpolated.
+                 */
+                void addColoredTriangle(const opendlv::data::environment::Point3 &a, const opendlv::data::environment::Point3 &colorA,
+                                        const opendlv::data::environment::Point3 &b, const opendlv::data::environment::Point3 &colorB,
+                                        const opendlv::data::environment::Point3 &c, const opendlv::data::environment::Point3 &colorC);
+
+                /**
+                 * This method adds a triangle using the current texture;
+                 * the texture coordinates are taken from X and Y.
+                 */
+                void addTexturedTriangle(const opendlv::data::environment::Point3 &a, const opendlv::data::environment::Point3 &textureA,
+                                         const opendlv::data::environment::Point3 &b, const opendlv::data::environment::Point3 &textureB,
+                                         const opendlv::data::environment::Point3 &c, const opendlv::data::environment::Point3 &textureC);
+
+                /**
+                 * This method adds a line using the current color.
+                 *
+                 * @param a Start of the line.
+                 * @param b End of the line.
+                 * @param width Width in pixels.
+                 */
+                void addLine(const opendlv::data::environment::Point3 &a, const opendlv::data::environment::Point3 &b, const float &width);
+
+                /**
+                 * This method adds a point using the current color.
+                 *
+                 * @param p Position of the point.
+                 * @param width Width in pixels.
+                 */
+                void addPoint(const opendlv::data::environment::Point3 &p, const float &width);
+
+                /**
+                 * This method draws all primitives added since the last
+                 * call to clear().
+                 *
+                 * @param bgr Image with getWidth()*getHeight() BGR pixels; the first row is the top one.
+                 */
+                void render(uint8_t *bgr);
+
+            private:
+                void updateModelViewProjection();
+
+                void multiply(const Matrix &m);
+
+                /**
+                 * This method transforms a vertex to clip coordinates.
+                 */
+                void transform(const opendlv::data::environment::Point3 &p, double *clip) const;
+
+                /**
+                 * This method clips a triangle in clip coordinates
+                 * (x, y, z, w, r, g, b, u, v) at the near plane and
+                 * adds the resulting triangles.
+                 */
+                void addClipTriangle(const double *a, const double *b, const double *c, const core::wrapper::Image *texture);
+
+                void toScreen(const double *clip, ScreenVertex &v) const;
+
+                void addScreenTriangle(const ScreenVertex &a, const ScreenVertex &b, const ScreenVertex &c, const core::wrapper::Image *texture);
+
+                /**
+                 * This method rasterizes one tile of the current image.
+                 *
+                 * @param item Index of the tile.
+                 */
+                virtual void process(const uint32_t &item);
+
+                void renderTile(const uint32_t &tile);
+
+            private:
+                uint32_t m_width;
+                uint32_t m_height;
+                uint32_t m_tilesX;
+                uint32_t m_tilesY;
+
+                Matrix m_projection;
+                vector<Matrix> m_modelView;
+                Matrix m_modelViewProjection;
+                double m_zNear;
+                opendlv::data::environment::Point3 m_color;
+                const core::wrapper::Image *m_texture;
+                uint8_t m_clearColor[3];
+
+                vector<Triangle> m_triangles;
+                vector<vector<uint32_t> > m_tiles;
+                vector<float> m_depth;
+
+                odcore::base::WorkPool m_workPool;
+                odcore::base::Mutex m_renderMutex;
+
+                // Current image.
+                uint8_t *m_bgr;
+        };
+
+    }
+} // opendlv::threeD
+
+#endif /*HESPERIA_CORE_THREED_SOFTWARERENDERER_H_*/
@@ -43,9 +43,9 @@ namespace opendlv {
                      * Constructor.
                      *
                     * @param nodeDesciptor Description for this node.
-                     * @param textureHandle Handle for the image's data inside an OpenGL texture.
+                     * @param image Image to be used as texture.
                      */
-                    AerialImageRenderer(const NodeDescriptor &nodeDescriptor, const uint32_t &textureHandle);
+                    AerialImageRenderer(const NodeDescriptor &nodeDescriptor, const core::wrapper::Image *image);
 
                     /**
                      * Copy constructor.
@@ -67,7 +67,8 @@ namespace opendlv {
                     virtual void render(RenderingConfiguration &renderingConfiguration);
 
                 private:
-                    uint32_t m_textureHandle;
+                    const core::wrapper::Image *m_image;
+                    int32_t m_textureHandle;
             };
 
             /**
@@ -115,7 +116,6 @@ namespace opendlv {
                     opendlv::data::environment::Point3 m_scalingPixelXY;
                     float m_rotationZ;
 
-                    uint32_t m_textureHandle;
                     TransformGroup *m_aerialImageNode;
                     AerialImageRenderer *m_aerialImageRenderer;
                     TransformGroup *m_translateToTheCenterOfTheImage;
@@ -20,6 +20,8 @@
 #ifndef HESPERIA_CORE_THREED_MODELS_HEIGHTGRID_H_
 #define HESPERIA_CORE_THREED_MODELS_HEIGHTGRID_H_
 
+#include <vector>
+
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendlv/core/wrapper/Image.h"
 
@@ -44,10 +46,16 @@ namespace opendlv {
                      * Constructor.
                      *
                     * @param nodeDesciptor Description for this node.
-                     * @param callList Handle for the height grid's call list.
+                     * @param width Number of grid points along the X-axis.
+                     * @param height Number of grid points along the Y-axis.
+                     * @param elevation Elevation per grid point (row by row).
+                     * @param intensity Gray value between 0 and 1 per grid point (row by row).
                      */
                     HeightGridRenderer(const NodeDescriptor &nodeDescriptor,
-                                       const uint32_t &callList);
+                                       const uint32_t &width,
+                                       const uint32_t &height,
+                                       const vector<float> &elevation,
+                                       const vector<float> &intensity);
 
                     /**
                      * Copy constructor.
@@ -69,7 +77,18 @@ namespace opendlv {
                     virtual void render(RenderingConfiguration &renderingConfiguration);
 
                 private:
-                    uint32_t m_callList;
+                    mutable bool m_compiled;
+                    mutable uint32_t m_callList;
+                    uint32_t m_width;
+                    uint32_t m_height;
+                    vector<float> m_elevation;
+                    vector<float> m_intensity;
+
+                    /**
+                     * This method compiles the height grid using OpenGL
+                     * compile lists.
+                     */
+                    void compile() const;
             };
 
             /**
@@ -126,7 +145,6 @@ namespace opendlv {
                     float m_min;
                     float m_max;
 
-                    uint32_t m_callList;
                     TransformGroup *m_heightImageNode;
                     HeightGridRenderer *m_heightImageRenderer;
 
@@ -20,7 +20,9 @@
 #ifndef VEHICLECONTEXT_MODEL_IRUS_H_
 #define VEHICLECONTEXT_MODEL_IRUS_H_
 
+#include <map>
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
 #include "opendavinci/odcore/data/Container.h"
@@ -32,6 +34,7 @@
 #include "opendlv/data/environment/Polygon.h"
 
 #include "opendlv/vehiclecontext/model/PointSensor.h"
+#include "opendlv/vehiclecontext/model/SegmentGrid.h"
 
 namespace opendlv { namespace vehiclecontext {
     namespace model {
@@ -100,6 +103,7 @@ namespace opendlv { namespace vehiclecontext {
 
                 uint32_t m_numberOfPolygons;
                 map<uint32_t, opendlv::data::environment::Polygon> m_mapOfPolygons;
+                SegmentGrid m_segmentGrid;
                 vector<uint32_t> m_listOfPolygonsInsideFOV;
                 map<string, PointSensor*> m_mapOfPointSensors;
                 map<string, double> m_distances;
@@ -26,7 +26,7 @@
 #include <memory>
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
 #include "opendlv/core/wrapper/Image.h"
-#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/data/image/SharedImageChannel.h"
 
 #include "opendlv/data/environment/EgoState.h"
 #include "opendlv/io/camera/ImageGrabber.h"
@@ -81,10 +81,19 @@ namespace opendlv { namespace vehiclecontext {
 
                 virtual std::shared_ptr<core::wrapper::Image> getNextImage();
 
+                /**
+                 * This method returns the description of the image
+                 * published by the last call to getNextImage().
+                 *
+                 * @return SharedImage to be sent to the consumers.
+                 */
+                const odcore::data::image::SharedImage getSharedImage() const;
+
             private:
                 odcore::base::KeyValueConfiguration m_kvc;
                 std::shared_ptr<core::wrapper::Image> m_image;
-                std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedMemory;
+                std::shared_ptr<odcore::data::image::SharedImageChannel> m_sharedImageChannel;
+                odcore::data::image::SharedImage m_sharedImage;
                 std::shared_ptr<opendlv::threeD::TransformGroup> m_root;
         };
 
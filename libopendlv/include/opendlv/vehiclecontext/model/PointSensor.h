@@ -21,10 +21,13 @@
 #define VEHICLECONTEXT_MODEL_POINTSENSOR_H_
 
 #include <string>
-#include <map>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
 
 #include "opendlv/data/environment/Point3.h"
 #include "opendlv/data/environment/Polygon.h"
+#include "opendlv/vehiclecontext/model/SegmentGrid.h"
 
 namespace opendlv { namespace vehiclecontext {
     namespace model {
@@ -34,7 +37,12 @@ namespace opendlv { namespace vehiclecontext {
         /**
          * This class encapsulates a point providing sensor using polygon data from an SCNX file.
          */
-        class PointSensor {
+        class OPENDAVINCI_API PointSensor {
+            public:
+                enum RAYCASTING {
+                    RAYS_PER_DEGREE = 2
+                };
+
             private:
                 /**
                  * "Forbidden" copy constructor. Goal: The compiler should warn
@@ -83,12 +91,25 @@ namespace opendlv { namespace vehiclecontext {
                 opendlv::data::environment::Polygon updateFOV(const opendlv::data::environment::Point3 &translation, const opendlv::data::environment::Point3 &rotation);
 
                 /**
-                 * This methods calculates the distance.
+                 * This methods calculates the distance to the closest
+                 * polygon inside the current FOV. Therefore, a batch of
+                 * rays (RAYS_PER_DEGREE) is cast across the FOV against
+                 * the segments from the grid overlapping the FOV; the
+                 * segments' vertices inside the FOV are considered as
+                 * well to not miss obstacles between two rays.
                  *
-                 * @param mapOfPolygons Map of polygons to iterate through.
-                 * @return distance to the closest line or -1.
+                 * Thus, the result is the distance to the closest point
+                 * of a polygon's outline inside the FOV (e.g. the foot of
+                 * the perpendicular on a wall in front of the sensor) and
+                 * not the closest vertex of the FOV clipped by the polygon
+                 * as computed formerly; between two rays, the closest
+                 * point is approximated by the rays and the vertices.
+                 * If the sensor itself is inside a polygon, 0 is returned.
+                 *
+                 * @param segmentGrid Grid of the polygons' segments.
+                 * @return distance to the closest point, 0 if the sensor is inside a polygon, or -1.
                  */
-                double getDistance(map<uint32_t, opendlv::data::environment::Polygon> &mapOfPolygons);
+                double getDistance(const SegmentGrid &segmentGrid);
 
                 bool hasShowFOV() const;
 
@@ -115,8 +136,16 @@ namespace opendlv { namespace vehiclecontext {
 
                 opendlv::data::environment::Polygon m_FOV;
                 opendlv::data::environment::Point3 m_sensorPosition;
+                opendlv::data::environment::Point3 m_leftBoundaryFOV;
+                opendlv::data::environment::Point3 m_rightBoundaryFOV;
+
+                // Reused between calls to avoid allocations.
+                vector<uint32_t> m_candidates;
+                vector<double> m_rayX;
+                vector<double> m_rayY;
+                vector<double> m_rayLength;
 
-                bool isInFOV(const opendlv::data::environment::Point3 &pt) const;
+                bool isInFOV(const double &x, const double &y) const;
         };
 
     }
@@ -0,0 +1,151 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VEHICLECONTEXT_MODEL_SEGMENTGRID_H_
+#define VEHICLECONTEXT_MODEL_SEGMENTGRID_H_
+
+#include <map>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+#include "opendlv/data/environment/Polygon.h"
+
+namespace opendlv { namespace vehiclecontext {
+    namespace model {
+
+        using namespace std;
+
+        /**
+         * This class is a static uniform grid over the edges of polygons
+         * from a scenario (ignoring Z). It is built once and afterwards,
+         * the edges overlapping an axis-aligned rectangle can be queried
+         * without iterating through all polygons.
+         */
+        class OPENDAVINCI_API SegmentGrid {
+            public:
+                enum GRIDPARAMETERS {
+                    SEGMENTS_PER_CELL = 4,
+                    MAXIMUM_CELLS_PER_AXIS = 1024
+                };
+
+                /**
+                 * One edge of a polygon in the XY-plane.
+                 */
+                struct Segment {
+                    double m_aX;
+                    double m_aY;
+                    double m_bX;
+                    double m_bY;
+                    uint32_t m_polygon; // Running number of the polygon this segment belongs to.
+                    bool m_closed; // True if the segment belongs to a closed outline (i.e. at least three vertices).
+                };
+
+            private:
+                /**
+                 * "Forbidden" copy constructor. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the copy constructor.
+                 *
+                 * @param obj Reference to an object of this class.
+                 */
+                SegmentGrid(const SegmentGrid &/*obj*/);
+
+                /**
+                 * "Forbidden" assignment operator. Goal: The compiler should warn
+                 * already at compile time for unwanted bugs caused by any misuse
+                 * of the assignment operator.
+                 *
+                 * @param obj Reference to an object of this class.
+                 * @return Reference to this instance.
+                 */
+                SegmentGrid& operator=(const SegmentGrid &/*obj*/);
+
+            public:
+                SegmentGrid();
+
+                virtual ~SegmentGrid();
+
+                /**
+                 * This method (re-)builds the grid from the closed
+                 * outlines of the given polygons.
+                 *
+                 * @param mapOfPolygons Polygons to be indexed.
+                 */
+                void build(const map<uint32_t, opendlv::data::environment::Polygon> &mapOfPolygons);
+
+                /**
+                 * @return Number of indexed segments.
+                 */
+                uint32_t getNumberOfSegments() const;
+
+                /**
+                 * @param index Index of the segment.
+                 * @return Segment.
+                 */
+                const Segment& getSegment(const uint32_t &index) const;
+
+                /**
+                 * This method returns the indices of all segments that
+                 * might overlap the given rectangle. Every index is
+                 * returned only once and in ascending order.
+                 *
+                 * @param minX Lower X of the rectangle.
+                 * @param minY Lower Y of the rectangle.
+                 * @param maxX Upper X of the rectangle.
+                 * @param maxY Upper Y of the rectangle.
+                 * @param segments Indices of segments to be filled (cleared before).
+                 */
+                void getSegmentsInside(const double &minX, const double &minY, const double &maxX, const double &maxY, vector<uint32_t> &segments) const;
+
+                /**
+                 * This method returns true if the given point is inside
+                 * the closed outline of any polygon (even-odd rule).
+                 *
+                 * @param x X of the point.
+                 * @param y Y of the point.
+                 * @return true if the point is inside a polygon.
+                 */
+                bool isInside(const double &x, const double &y) const;
+
+            private:
+                uint32_t getCellX(const double &x) const;
+
+                uint32_t getCellY(const double &y) const;
+
+            private:
+                vector<Segment> m_segments;
+
+                double m_minX;
+                double m_minY;
+                double m_maxX;
+                double m_maxY;
+                double m_cellSize;
+                uint32_t m_cellsX;
+                uint32_t m_cellsY;
+
+                // Compressed storage: The segments of cell i are m_cellSegments[m_cellStart[i] .. m_cellStart[i+1]).
+                vector<uint32_t> m_cellStart;
+                vector<uint32_t> m_cellSegments;
+        };
+
+    }
+} } // opendlv::vehiclecontext::model
+
+#endif /*VEHICLECONTEXT_MODEL_SEGMENTGRID_H_*/
@@ -30,9 +30,9 @@
 #include "opendavinci/odcore/base/Serializable.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
-#include "opendlv/data/environment/Line.h"
 #include "opendlv/data/environment/Point3.h"
 #include "opendlv/data/environment/Polygon.h"
+#include "opendlv/data/environment/PolygonXY.h"
 
 namespace opendlv {
     namespace data {
@@ -45,15 +45,18 @@ namespace opendlv {
             const double Polygon::EPSILON = 1e-10;
 
             Polygon::Polygon() :
-                m_listOfVertices() {}
+                m_listOfVertices(),
+                m_verticesXY() {}
 
             Polygon::Polygon(const vector<Point3> &vertices) :
-                m_listOfVertices(vertices) {
+                m_listOfVertices(vertices),
+                m_verticesXY() {
                 sort();            
             }
 
             Polygon::Polygon(const Polygon &obj) :
-                m_listOfVertices(obj.m_listOfVertices) {
+                m_listOfVertices(obj.m_listOfVertices),
+                m_verticesXY() {
                 sort();            
             }
 
@@ -68,6 +71,7 @@ namespace opendlv {
 
             void Polygon::add(const Point3 &p) {
                 m_listOfVertices.push_back(p);
+                m_verticesXY.add(p.getX(), p.getY());
             }
 
             uint32_t Polygon::getSize() const {
@@ -79,87 +83,7 @@ namespace opendlv {
             }
 
             bool Polygon::containsIgnoreZ(const Point3 &p) const {
-                // http://rw7.de/ralf/inffaq/polygon.html
-                bool retVal = false;
-
-                if (getSize() > 0) {
-                    Point3 oldPoint = m_listOfVertices.back();
-                    Point3 currentPoint;
-
-                    int32_t alpha = 0;
-                    int32_t quadrant = 0;
-                    int32_t currentQuadrant = 0;
-
-                    if ( (oldPoint.getY() < p.getY()) || (oldPoint.getY() - p.getY() < Polygon::EPSILON) ) {
-                        if ( (oldPoint.getX() < p.getX()) || (oldPoint.getX() - p.getX() < Polygon::EPSILON) ) {
-                            quadrant = 0;
-                        }
-                        else {
-                            quadrant = 1;
-                        }
-                    }
-                    else if ( (oldPoint.getX() <= p.getX()) || (oldPoint.getX() - p.getX() < Polygon::EPSILON) ) {
-                        quadrant = 3;
-                    }
-                    else {
-                        quadrant = 2;
-                    }
-
-                    for(uint32_t i = 0; i < getSize(); i++) {
-                        currentPoint = m_listOfVertices.at(i);
-
-                        if ( (currentPoint.getY() < p.getY()) || (currentPoint.getY() - p.getY() < Polygon::EPSILON) ) {
-                            if ( (currentPoint.getX() < p.getX()) || (currentPoint.getX() - p.getX() < Polygon::EPSILON) ) {
-                                currentQuadrant = 0;
-                            }
-                            else {
-                                currentQuadrant = 1;
-                            }
-                        }
-                        else if ( (currentPoint.getX() < p.getX()) || (currentPoint.getX() - p.getX() < Polygon::EPSILON) ) {
-                            currentQuadrant = 3;
-                        }
-                        else {
-                            currentQuadrant = 2;
-                        }
-
-                        switch ((currentQuadrant - quadrant) & 3) {
-                            case 0:
-                            break;
-                            case 1:
-                                alpha++;
-                            break;
-                            case 3:
-                                alpha--;
-                            break;
-                            default: {
-                                const double nominator = (currentPoint.getX() - oldPoint.getX()) * (p.getY() - oldPoint.getY());
-                                const double denominator = (currentPoint.getY() - oldPoint.getY());
-                                if (fabs(denominator) > Polygon::EPSILON) {
-                                    const double value = nominator / denominator + oldPoint.getX();
-
-                                    if (fabs(p.getX() - value) < Polygon::EPSILON) {
-                                        return false;
-                                    }
-
-                                    if ( (p.getX() > value) == (currentPoint.getY() > oldPoint.getY()) ) {
-                                        alpha -= 2;
-                                    }
-                                    else {
-                                        alpha += 2;
-                                    }
-                                }
-                            }
-                        }
-
-                        oldPoint = currentPoint;
-                        quadrant = currentQuadrant;
-                    }
-
-                    retVal = ((alpha == 4) || (alpha == -4));
-                }
-
-                return retVal;
+                return m_verticesXY.containsIgnoreZ(p.getX(), p.getY());
             }
 
             Polygon Polygon::intersectIgnoreZ(const Polygon &other) const {
@@ -170,35 +94,31 @@ namespace opendlv {
 
                 Polygon resultingPolygon;
 
-                vector<Point3> thisPolygon = getVertices();
-                vector<Point3> otherPolygon = other.getVertices();
-
-                if ( (thisPolygon.size() > 0) && (otherPolygon.size() > 0) ) {
-                    // Modify vertices by adding the first vertex at the end of both lists for closing the polygon.
-                    thisPolygon.push_back((*thisPolygon.begin()));
-                    otherPolygon.push_back((*otherPolygon.begin()));
+                const uint32_t thisSize = getSize();
+                const uint32_t otherSize = other.getSize();
 
-                    for(uint32_t i = 0; i < thisPolygon.size() - 1; i++) {
-                        Point3 thisA = thisPolygon.at(i);
-                        Point3 thisB = thisPolygon.at(i+1);
-                        Line thisLine(thisA, thisB);
+                if ( (thisSize > 0) && (otherSize > 0) ) {
+                    vector<uint8_t> hits;
+                    vector<double> resultX;
+                    vector<double> resultY;
 
-                        for(uint32_t j = 0; j < otherPolygon.size() - 1; j++) {
-                            Point3 otherA = otherPolygon.at(j);
-                            Point3 otherB = otherPolygon.at(j+1);
-                            Line otherLine(otherA, otherB);
+                    for(uint32_t i = 0; i < thisSize; i++) {
+                        // Intersect all sides of the other polygon at once.
+                        other.m_verticesXY.intersectEdgesIgnoreZ(m_verticesXY.getX(i), m_verticesXY.getY(i),
+                                                                 m_verticesXY.getX(i+1), m_verticesXY.getY(i+1),
+                                                                 hits, resultX, resultY);
 
-                            Point3 result;
-                            if (thisLine.intersectIgnoreZ(otherLine, result)) {
+                        for(uint32_t j = 0; j < otherSize; j++) {
+                            if (hits[j] != 0) {
                                 // Intersection point found.
-                                resultingPolygon.add(result);
+                                resultingPolygon.add(Point3(resultX[j], resultY[j], 0));
                             }
                         }
                     }
 
                     // Now, check if one vertex from other is within this polygon.
-                    for(uint32_t j = 0; j < otherPolygon.size()-1; j++) {
-                        Point3 otherVertex = otherPolygon.at(j);
+                    for(uint32_t j = 0; j < otherSize; j++) {
+                        const Point3 &otherVertex = other.m_listOfVertices[j];
 
                         if (containsIgnoreZ(otherVertex)) {
                             resultingPolygon.add(otherVertex);
@@ -236,6 +156,13 @@ namespace opendlv {
             void Polygon::sort() {
                 AngleXYComparator angleXYComparator(getCenter());
                 std::sort(m_listOfVertices.begin(), m_listOfVertices.end(), angleXYComparator);
+
+                m_verticesXY.clear();
+                vector<Point3>::const_iterator it = m_listOfVertices.begin();
+                while (it != m_listOfVertices.end()) {
+                    m_verticesXY.add(it->getX(), it->getY());
+                    it++;
+                }
             }
 
             Polygon Polygon::getVisiblePolygonIgnoreZ(const Point3 &point) const {
@@ -247,41 +174,38 @@ namespace opendlv {
                 //    If no such point exists, the vertex is directly visible.
                 Polygon contour;
 
-                vector<Point3> thisPolygon = getVertices();
+                const uint32_t SIZE = getSize();
 
-                if (thisPolygon.size() > 0) {
+                if (SIZE > 0) {
                     vector<Point3> resultingVertices;
 
-                    // Add the first vertex to the end to close the polygon.
-                    vector<Point3> thisPolygonCyclic = getVertices();
-                    thisPolygonCyclic.push_back((*thisPolygonCyclic.begin()));
-
-                    for(uint32_t i = 0; i < thisPolygon.size(); i++) {
-                        Point3 thisA = thisPolygon.at(i);
-                        Line viewingPositionLine(point, thisA);
+                    vector<uint8_t> hits;
+                    vector<double> resultX;
+                    vector<double> resultY;
 
+                    for(uint32_t i = 0; i < SIZE; i++) {
                         // ALL sides of the other polygon must be tested.
+                        m_verticesXY.intersectEdgesIgnoreZ(point.getX(), point.getY(),
+                                                           m_verticesXY.getX(i), m_verticesXY.getY(i),
+                                                           hits, resultX, resultY);
+
                         bool thisACanBeSeenDirectly = true;
-                        for(uint32_t j = 0; j < thisPolygonCyclic.size() - 1; j++) {
+                        for(uint32_t j = 0; j < SIZE; j++) {
                             // Skip the vertex to be checked itself.
                             if ((i == j) || (i == j+1)) {
                                 continue;
                             }
 
-                            Point3 thisPolygonA = thisPolygonCyclic.at(j);
-                            Point3 thisPolygonB = thisPolygonCyclic.at(j+1);
-                            Line thisPolygonLine(thisPolygonA, thisPolygonB);
-
-                            Point3 result;
-                            if (viewingPositionLine.intersectIgnoreZ(thisPolygonLine, result)) {
-                                // Found one side of the polygon that is intersect by viewingPositionLine.
+                            if (hits[j] != 0) {
+                                // Found one side of the polygon that is intersected by the line of sight.
                                 thisACanBeSeenDirectly = false;
+                                break;
                             }
                         }
 
                         // This vertex is not hidden.
                         if (thisACanBeSeenDirectly) {
-                            resultingVertices.push_back(thisA);
+                            resultingVertices.push_back(m_listOfVertices[i]);
                         }
                     }
 
@@ -392,6 +316,7 @@ namespace opendlv {
 
                 // Clean up.
                 m_listOfVertices.clear();
+                m_verticesXY.clear();
 
                 // Read number of vertices.
                 uint32_t numberOfVertices = 0;
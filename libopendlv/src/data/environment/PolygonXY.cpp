@@ -0,0 +1,351 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if defined(__AVX__)
+# include <immintrin.h>
+# define POLYGONXY_USE_AVX
+#elif defined(__SSE2__) || defined(_M_X64)
+# include <emmintrin.h>
+# define POLYGONXY_USE_SSE2
+#endif
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendlv/data/environment/PolygonXY.h"
+
+namespace opendlv {
+    namespace data {
+        namespace environment {
+
+            using namespace std;
+
+            // Same as Polygon::EPSILON and Line::EPSILON.
+            const double PolygonXY::EPSILON = 1e-10;
+
+            /**
+             * This function determines the quadrant of the vertex
+             * around the point (x, y) as in Polygon::containsIgnoreZ.
+             */
+            static inline int32_t getQuadrant(const double &vX, const double &vY, const double &x, const double &y, const double &epsilon) {
+                const bool lowerX = (vX - x < epsilon);
+                if (vY - y < epsilon) {
+                    return (lowerX ? 0 : 1);
+                }
+                return (lowerX ? 3 : 2);
+            }
+
+            /**
+             * This function intersects the line AB with the edge CD
+             * and performs exactly the same floating point operations
+             * as Line::intersectIgnoreZ.
+             */
+            static inline bool intersectEdge(const double &aX, const double &aY, const double &bX, const double &bY,
+                                             const double &cX, const double &cY, const double &dX, const double &dY,
+                                             const double &epsilon, double &resultX, double &resultY) {
+                // Lines in homogeneous coordinates.
+                const double l1X = aY - bY, l1Y = bX - aX, l1Z = aX * bY - aY * bX;
+                const double l2X = cY - dY, l2Y = dX - cX, l2Z = cX * dY - cY * dX;
+
+                const double rX = l1Y * l2Z - l1Z * l2Y;
+                const double rY = l1Z * l2X - l1X * l2Z;
+                const double rZ = l1X * l2Y - l1Y * l2X;
+
+                if (fabs(rZ) < epsilon) {
+                    return false;
+                }
+
+                const double inverse = 1 / rZ;
+                resultX = rX * inverse;
+                resultY = rY * inverse;
+
+                const double thisDX = bX - aX;
+                const double thisDY = bY - aY;
+                const double detA = (cX - aX) * thisDY - (cY - aY) * thisDX;
+                const double detB = (dX - aX) * thisDY - (dY - aY) * thisDX;
+
+                if ( (-detA > epsilon && detB > epsilon) || (detA > epsilon && -detB > epsilon) ) {
+                    return true;
+                }
+                if (fabs(detA) < epsilon) {
+                    return ( (fabs(detB) < epsilon) || ( (fabs(dX - cX) < epsilon) && (fabs(dY - cY) < epsilon) ) );
+                }
+                if (fabs(detB) < epsilon) {
+                    return ( (fabs(thisDX) < epsilon) && (fabs(thisDY) < epsilon) );
+                }
+                return false;
+            }
+
+            PolygonXY::PolygonXY() :
+                m_x(),
+                m_y() {}
+
+            PolygonXY::PolygonXY(const PolygonXY &obj) :
+                m_x(obj.m_x),
+                m_y(obj.m_y) {}
+
+            PolygonXY::~PolygonXY() {}
+
+            PolygonXY& PolygonXY::operator=(const PolygonXY &obj) {
+                m_x = obj.m_x;
+                m_y = obj.m_y;
+
+                return (*this);
+            }
+
+            void PolygonXY::clear() {
+                m_x.clear();
+                m_y.clear();
+            }
+
+            void PolygonXY::add(const double &x, const double &y) {
+                if (m_x.empty()) {
+                    m_x.push_back(x);
+                    m_y.push_back(y);
+                }
+                else {
+                    // Replace the closing vertex.
+                    m_x.back() = x;
+                    m_y.back() = y;
+                }
+                m_x.push_back(m_x.front());
+                m_y.push_back(m_y.front());
+            }
+
+            uint32_t PolygonXY::getSize() const {
+                return (m_x.empty() ? 0 : static_cast<uint32_t>(m_x.size() - 1));
+            }
+
+            double PolygonXY::getX(const uint32_t &i) const {
+                return m_x[i];
+            }
+
+            double PolygonXY::getY(const uint32_t &i) const {
+                return m_y[i];
+            }
+
+            bool PolygonXY::containsIgnoreZ(const double &x, const double &y) const {
+                // http://rw7.de/ralf/inffaq/polygon.html
+                const uint32_t SIZE = getSize();
+                if (SIZE == 0) {
+                    return false;
+                }
+
+                const double *vX = &m_x[0];
+                const double *vY = &m_y[0];
+
+                double oldX = vX[SIZE - 1];
+                double oldY = vY[SIZE - 1];
+                int32_t quadrant = getQuadrant(oldX, oldY, x, y, EPSILON);
+                int32_t alpha = 0;
+
+                // The quadrants are determined blockwise; the winding is accumulated sequentially.
+                const uint32_t BLOCK = 4;
+                int32_t quadrants[BLOCK];
+                for (uint32_t i = 0; i < SIZE; i += BLOCK) {
+                    const uint32_t count = min(BLOCK, SIZE - i);
+                    uint32_t k = 0;
+#if defined(POLYGONXY_USE_AVX)
+                    if (count == 4) {
+                        const __m256d epsilon = _mm256_set1_pd(EPSILON);
+                        const int lowerX = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_sub_pd(_mm256_loadu_pd(vX + i), _mm256_set1_pd(x)), epsilon, _CMP_LT_OQ));
+                        const int lowerY = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_sub_pd(_mm256_loadu_pd(vY + i), _mm256_set1_pd(y)), epsilon, _CMP_LT_OQ));
+                        for (; k < 4; k++) {
+                            const int32_t lx = (lowerX >> k) & 1;
+                            quadrants[k] = (((lowerY >> k) & 1) ? (1 - lx) : (2 + lx));
+                        }
+                    }
+#elif defined(POLYGONXY_USE_SSE2)
+                    const __m128d epsilon = _mm_set1_pd(EPSILON);
+                    for (; k + 2 <= count; k += 2) {
+                        const int lowerX = _mm_movemask_pd(_mm_cmplt_pd(_mm_sub_pd(_mm_loadu_pd(vX + i + k), _mm_set1_pd(x)), epsilon));
+                        const int lowerY = _mm_movemask_pd(_mm_cmplt_pd(_mm_sub_pd(_mm_loadu_pd(vY + i + k), _mm_set1_pd(y)), epsilon));
+                        for (uint32_t l = 0; l < 2; l++) {
+                            const int32_t lx = (lowerX >> l) & 1;
+                            quadrants[k + l] = (((lowerY >> l) & 1) ? (1 - lx) : (2 + lx));
+                        }
+                    }
+#endif
+                    for (; k < count; k++) {
+                        quadrants[k] = getQuadrant(vX[i + k], vY[i + k], x, y, EPSILON);
+                    }
+
+                    for (k = 0; k < count; k++) {
+                        const double currentX = vX[i + k];
+                        const double currentY = vY[i + k];
+                        const int32_t currentQuadrant = quadrants[k];
+
+                        switch ((currentQuadrant - quadrant) & 3) {
+                            case 0:
+                            break;
+                            case 1:
+                                alpha++;
+                            break;
+                            case 3:
+                                alpha--;
+                            break;
+                            default: {
+                                const double nominator = (currentX - oldX) * (y - oldY);
+                                const double denominator = (currentY - oldY);
+                                if (fabs(denominator) > EPSILON) {
+                                    const double value = nominator / denominator + oldX;
+
+                                    if (fabs(x - value) < EPSILON) {
+                                        return false;
+                                    }
+
+                                    if ( (x > value) == (currentY > oldY) ) {
+                                        alpha -= 2;
+                                    }
+                                    else {
+                                        alpha += 2;
+                                    }
+                                }
+                            }
+                        }
+
+                        oldX = currentX;
+                        oldY = currentY;
+                        quadrant = currentQuadrant;
+                    }
+                }
+
+                return ((alpha == 4) || (alpha == -4));
+            }
+
+            void PolygonXY::intersectEdgesIgnoreZ(const double &aX, const double &aY, const double &bX, const double &bY,
+                                                  vector<uint8_t> &hits, vector<double> &resultX, vector<double> &resultY) const {
+                const uint32_t SIZE = getSize();
+                hits.resize(SIZE);
+                resultX.resize(SIZE);
+                resultY.resize(SIZE);
+                if (SIZE == 0) {
+                    return;
+                }
+
+                const double *vX = &m_x[0];
+                const double *vY = &m_y[0];
+
+                uint32_t j = 0;
+#if defined(POLYGONXY_USE_AVX)
+                {
+                    const __m256d epsilon = _mm256_set1_pd(EPSILON);
+                    const __m256d sign = _mm256_set1_pd(-0.0);
+                    const __m256d one = _mm256_set1_pd(1.0);
+                    const __m256d a_x = _mm256_set1_pd(aX), a_y = _mm256_set1_pd(aY);
+                    const __m256d l1X = _mm256_set1_pd(aY - bY), l1Y = _mm256_set1_pd(bX - aX), l1Z = _mm256_set1_pd(aX * bY - aY * bX);
+                    const __m256d thisDX = _mm256_set1_pd(bX - aX), thisDY = _mm256_set1_pd(bY - aY);
+                    const __m256d thisDegenerated = ( (fabs(bX - aX) < EPSILON) && (fabs(bY - aY) < EPSILON) ) ? _mm256_castsi256_pd(_mm256_set1_epi64x(-1)) : _mm256_setzero_pd();
+
+                    for (; j + 4 <= SIZE; j += 4) {
+                        const __m256d cX = _mm256_loadu_pd(vX + j), cY = _mm256_loadu_pd(vY + j);
+                        const __m256d dX = _mm256_loadu_pd(vX + j + 1), dY = _mm256_loadu_pd(vY + j + 1);
+
+                        const __m256d l2X = _mm256_sub_pd(cY, dY);
+                        const __m256d l2Y = _mm256_sub_pd(dX, cX);
+                        const __m256d l2Z = _mm256_sub_pd(_mm256_mul_pd(cX, dY), _mm256_mul_pd(cY, dX));
+
+                        const __m256d rX = _mm256_sub_pd(_mm256_mul_pd(l1Y, l2Z), _mm256_mul_pd(l1Z, l2Y));
+                        const __m256d rY = _mm256_sub_pd(_mm256_mul_pd(l1Z, l2X), _mm256_mul_pd(l1X, l2Z));
+                        const __m256d rZ = _mm256_sub_pd(_mm256_mul_pd(l1X, l2Y), _mm256_mul_pd(l1Y, l2X));
+                        const __m256d validZ = _mm256_cmp_pd(_mm256_andnot_pd(sign, rZ), epsilon, _CMP_NLT_UQ);
+
+                        const __m256d inverse = _mm256_div_pd(one, rZ);
+                        _mm256_storeu_pd(&resultX[j], _mm256_mul_pd(rX, inverse));
+                        _mm256_storeu_pd(&resultY[j], _mm256_mul_pd(rY, inverse));
+
+                        const __m256d detA = _mm256_sub_pd(_mm256_mul_pd(_mm256_sub_pd(cX, a_x), thisDY), _mm256_mul_pd(_mm256_sub_pd(cY, a_y), thisDX));
+                        const __m256d detB = _mm256_sub_pd(_mm256_mul_pd(_mm256_sub_pd(dX, a_x), thisDY), _mm256_mul_pd(_mm256_sub_pd(dY, a_y), thisDX));
+
+                        const __m256d differentSides = _mm256_or_pd(
+                            _mm256_and_pd(_mm256_cmp_pd(_mm256_xor_pd(detA, sign), epsilon, _CMP_GT_OQ), _mm256_cmp_pd(detB, epsilon, _CMP_GT_OQ)),
+                            _mm256_and_pd(_mm256_cmp_pd(detA, epsilon, _CMP_GT_OQ), _mm256_cmp_pd(_mm256_xor_pd(detB, sign), epsilon, _CMP_GT_OQ)));
+                        const __m256d zeroA = _mm256_cmp_pd(_mm256_andnot_pd(sign, detA), epsilon, _CMP_LT_OQ);
+                        const __m256d zeroB = _mm256_cmp_pd(_mm256_andnot_pd(sign, detB), epsilon, _CMP_LT_OQ);
+                        const __m256d otherDegenerated = _mm256_and_pd(_mm256_cmp_pd(_mm256_andnot_pd(sign, l2Y), epsilon, _CMP_LT_OQ),
+                                                                       _mm256_cmp_pd(_mm256_andnot_pd(sign, _mm256_sub_pd(dY, cY)), epsilon, _CMP_LT_OQ));
+
+                        const __m256d hit = _mm256_and_pd(validZ, _mm256_or_pd(differentSides, _mm256_or_pd(
+                            _mm256_and_pd(zeroA, _mm256_or_pd(zeroB, otherDegenerated)),
+                            _mm256_andnot_pd(zeroA, _mm256_and_pd(zeroB, thisDegenerated)))));
+
+                        const int mask = _mm256_movemask_pd(hit);
+                        for (uint32_t l = 0; l < 4; l++) {
+                            hits[j + l] = static_cast<uint8_t>((mask >> l) & 1);
+                        }
+                    }
+                }
+#elif defined(POLYGONXY_USE_SSE2)
+                {
+                    const __m128d epsilon = _mm_set1_pd(EPSILON);
+                    const __m128d sign = _mm_set1_pd(-0.0);
+                    const __m128d one = _mm_set1_pd(1.0);
+                    const __m128d a_x = _mm_set1_pd(aX), a_y = _mm_set1_pd(aY);
+                    const __m128d l1X = _mm_set1_pd(aY - bY), l1Y = _mm_set1_pd(bX - aX), l1Z = _mm_set1_pd(aX * bY - aY * bX);
+                    const __m128d thisDX = _mm_set1_pd(bX - aX), thisDY = _mm_set1_pd(bY - aY);
+                    const __m128d thisDegenerated = ( (fabs(bX - aX) < EPSILON) && (fabs(bY - aY) < EPSILON) ) ? _mm_castsi128_pd(_mm_set1_epi32(-1)) : _mm_setzero_pd();
+
+                    for (; j + 2 <= SIZE; j += 2) {
+                        const __m128d cX = _mm_loadu_pd(vX + j), cY = _mm_loadu_pd(vY + j);
+                        const __m128d dX = _mm_loadu_pd(vX + j + 1), dY = _mm_loadu_pd(vY + j + 1);
+
+                        const __m128d l2X = _mm_sub_pd(cY, dY);
+                        const __m128d l2Y = _mm_sub_pd(dX, cX);
+                        const __m128d l2Z = _mm_sub_pd(_mm_mul_pd(cX, dY), _mm_mul_pd(cY, dX));
+
+                        const __m128d rX = _mm_sub_pd(_mm_mul_pd(l1Y, l2Z), _mm_mul_pd(l1Z, l2Y));
+                        const __m128d rY = _mm_sub_pd(_mm_mul_pd(l1Z, l2X), _mm_mul_pd(l1X, l2Z));
+                        const __m128d rZ = _mm_sub_pd(_mm_mul_pd(l1X, l2Y), _mm_mul_pd(l1Y, l2X));
+                        const __m128d validZ = _mm_cmpnlt_pd(_mm_andnot_pd(sign, rZ), epsilon);
+
+                        const __m128d inverse = _mm_div_pd(one, rZ);
+                        _mm_storeu_pd(&resultX[j], _mm_mul_pd(rX, inverse));
+                        _mm_storeu_pd(&resultY[j], _mm_mul_pd(rY, inverse));
+
+                        const __m128d detA = _mm_sub_pd(_mm_mul_pd(_mm_sub_pd(cX, a_x), thisDY), _mm_mul_pd(_mm_sub_pd(cY, a_y), thisDX));
+                        const __m128d detB = _mm_sub_pd(_mm_mul_pd(_mm_sub_pd(dX, a_x), thisDY), _mm_mul_pd(_mm_sub_pd(dY, a_y), thisDX));
+
+                        const __m128d differentSides = _mm_or_pd(
+                            _mm_and_pd(_mm_cmpgt_pd(_mm_xor_pd(detA, sign), epsilon), _mm_cmpgt_pd(detB, epsilon)),
+                            _mm_and_pd(_mm_cmpgt_pd(detA, epsilon), _mm_cmpgt_pd(_mm_xor_pd(detB, sign), epsilon)));
+                        const __m128d zeroA = _mm_cmplt_pd(_mm_andnot_pd(sign, detA), epsilon);
+                        const __m128d zeroB = _mm_cmplt_pd(_mm_andnot_pd(sign, detB), epsilon);
+                        const __m128d otherDegenerated = _mm_and_pd(_mm_cmplt_pd(_mm_andnot_pd(sign, l2Y), epsilon),
+                                                                    _mm_cmplt_pd(_mm_andnot_pd(sign, _mm_sub_pd(dY, cY)), epsilon));
+
+                        const __m128d hit = _mm_and_pd(validZ, _mm_or_pd(differentSides, _mm_or_pd(
+                            _mm_and_pd(zeroA, _mm_or_pd(zeroB, otherDegenerated)),
+                            _mm_andnot_pd(zeroA, _mm_and_pd(zeroB, thisDegenerated)))));
+
+                        const int mask = _mm_movemask_pd(hit);
+                        hits[j] = static_cast<uint8_t>(mask & 1);
+                        hits[j + 1] = static_cast<uint8_t>((mask >> 1) & 1);
+                    }
+                }
+#endif
+                for (; j < SIZE; j++) {
+                    hits[j] = intersectEdge(aX, aY, bX, bY, vX[j], vY[j], vX[j + 1], vY[j + 1], EPSILON, resultX[j], resultY[j]) ? 1 : 0;
+                }
+            }
+
+        }
+    }
+} // opendlv::data::environment
@@ -176,12 +176,8 @@ namespace opendlv { namespace vehiclecontext {
 
             // Share information about this image.
             if (m_image.get()) {
-                m_sharedImage.setWidth(m_image->getWidth());
-                m_sharedImage.setHeight(m_image->getHeight());
-                // TODO: Refactor me!
-                m_sharedImage.setBytesPerPixel(3);
-                m_sharedImage.setSize(m_sharedImage.getWidth() * m_sharedImage.getHeight() * m_sharedImage.getBytesPerPixel());
-                m_sharedImage.setName("odsimcamera");
+                // The grabber has published the image to its slot already.
+                m_sharedImage = m_grabber->getSharedImage();
             }
 
             if ((frameCounter % 20) == 0) {
@@ -39,6 +39,7 @@
 #include "opendlv/scenario/SCNXArchiveFactory.h"
 #include "opendlv/vehiclecontext/model/IRUS.h"
 #include "opendlv/vehiclecontext/model/PointSensor.h"
+#include "opendlv/vehiclecontext/model/SegmentGrid.h"
 
 namespace core { namespace exceptions { class ValueForKeyNotFoundException; } }
 namespace opendlv { namespace data { namespace scenario { class Shape; } } }
@@ -60,6 +61,7 @@ namespace opendlv { namespace vehiclecontext {
             m_freq(0),
             m_numberOfPolygons(0),
             m_mapOfPolygons(),
+            m_segmentGrid(),
             m_listOfPolygonsInsideFOV(),
             m_mapOfPointSensors(),
             m_distances(),
@@ -76,6 +78,7 @@ namespace opendlv { namespace vehiclecontext {
             m_freq(freq),
             m_numberOfPolygons(0),
             m_mapOfPolygons(),
+            m_segmentGrid(),
             m_listOfPolygonsInsideFOV(),
             m_mapOfPointSensors(),
             m_distances(),
@@ -127,6 +130,10 @@ namespace opendlv { namespace vehiclecontext {
                 }
             }
 
+            // Index the polygons' segments once as the scenario is static.
+            m_segmentGrid.build(m_mapOfPolygons);
+            cerr << "[IRUS] Indexed " << m_segmentGrid.getNumberOfSegments() << " segments." << endl;
+
             // Setup all point sensors.
             for (uint32_t i = 0; i < m_kvc.getValue<uint32_t>("odsimirus.numberOfSensors"); i++) {
                 stringstream sensorID;
@@ -232,7 +239,7 @@ namespace opendlv { namespace vehiclecontext {
                 m_FOVs[sensor->getName()] = FOV;
 
                 // Calculate distance.
-                m_distances[sensor->getName()] = sensor->getDistance(m_mapOfPolygons);
+                m_distances[sensor->getName()] = sensor->getDistance(m_segmentGrid);
                 cerr << sensor->getName() << ": " << m_distances[sensor->getName()] << endl;
 
                 // Store data for sensorboard.
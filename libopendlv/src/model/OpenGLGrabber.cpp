@@ -25,7 +25,7 @@
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
 #include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/io/URL.h"
-#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+#include "opendavinci/odcore/data/image/SharedImageChannel.h"
 #include "opendlv/core/wrapper/ImageFactory.h"
 #include "opendlv/data/camera/ImageGrabberID.h"
 #include "opendlv/threeD/decorator/DecoratorFactory.h"
@@ -58,7 +58,8 @@ namespace opendlv { namespace vehiclecontext {
             ImageGrabber(imageGrabberID, imageGrabberCalibration),
             m_kvc(kvc),
             m_image(),
-            m_sharedMemory(),
+            m_sharedImageChannel(),
+            m_sharedImage(),
             m_root() {
 
             const URL urlOfSCNXFile(m_kvc.getValue<string>("global.scenario"));
@@ -75,9 +76,16 @@ namespace opendlv { namespace vehiclecontext {
                     m_root->addChild(new Grid(NodeDescriptor("Grid"), 10, 2));
                 }
 
-                m_sharedMemory = odcore::wrapper::SharedMemoryFactory::createSharedMemory("odsimcamera", 640 * 480 * 3);
+                odcore::data::image::SharedImage si;
+                si.setName("odsimcamera");
+                si.setWidth(640);
+                si.setHeight(480);
+                si.setBytesPerPixel(3);
+                si.setSize(si.getWidth() * si.getHeight() * si.getBytesPerPixel());
+                m_sharedImageChannel = std::shared_ptr<odcore::data::image::SharedImageChannel>(new odcore::data::image::SharedImageChannel(si, odcore::data::image::SharedImageChannel::DEFAULT_NUMBER_OF_SLOTS));
 
-                m_image = std::shared_ptr<core::wrapper::Image>(core::wrapper::ImageFactory::getInstance().getImage(640, 480, core::wrapper::Image::BGR_24BIT, static_cast<char*>(m_sharedMemory->getSharedMemory())));
+                // The image is rendered into local memory and published afterwards without waiting for any consumer.
+                m_image = std::shared_ptr<core::wrapper::Image>(core::wrapper::ImageFactory::getInstance().getImage(640, 480, core::wrapper::Image::BGR_24BIT));
 
                 if (m_image.get()) {
                     cerr << "OpenGLGrabber initialized." << endl;
@@ -92,24 +100,28 @@ namespace opendlv { namespace vehiclecontext {
         }
 
         std::shared_ptr<core::wrapper::Image> OpenGLGrabber::getNextImage() {
-            if ( (m_sharedMemory.get()) && (m_sharedMemory->isValid()) ) {
-                m_sharedMemory->lock();
-                    RenderingConfiguration r = RenderingConfiguration();
-                    m_root->render(r);
+            if ( (m_sharedImageChannel.get()) && (m_sharedImageChannel->isValid()) && (m_image.get()) ) {
+                RenderingConfiguration r = RenderingConfiguration();
+                m_root->render(r);
 
-                    // TODO Read pixels using BGRA!!!
-                    glReadBuffer(GL_BACK);
-                    glPixelStorei(GL_PACK_ALIGNMENT, 1);
-                    glReadPixels(0, 0, m_image->getWidth(), m_image->getHeight(), GL_BGR, GL_UNSIGNED_BYTE, m_sharedMemory->getSharedMemory());
+                // TODO Read pixels using BGRA!!!
+                glReadBuffer(GL_BACK);
+                glPixelStorei(GL_PACK_ALIGNMENT, 1);
+                glReadPixels(0, 0, m_image->getWidth(), m_image->getHeight(), GL_BGR, GL_UNSIGNED_BYTE, m_image->getRawData());
 
-                    // Flip the image horizontally.
-                    m_image->flipHorizontally();
+                // Flip the image horizontally.
+                m_image->flipHorizontally();
 
-                m_sharedMemory->unlock();
+                // Publish the image.
+                m_sharedImage = m_sharedImageChannel->write(m_image->getRawData(), m_image->getWidth() * m_image->getHeight() * 3);
             }
 
             return m_image;
         }
 
+        const odcore::data::image::SharedImage OpenGLGrabber::getSharedImage() const {
+            return m_sharedImage;
+        }
+
     }
 } } // opendlv::vehiclecontext::model
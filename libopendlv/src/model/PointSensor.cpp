@@ -17,10 +17,10 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -29,6 +29,7 @@
 #include "opendlv/data/environment/Point3.h"
 #include "opendlv/data/environment/Polygon.h"
 #include "opendlv/vehiclecontext/model/PointSensor.h"
+#include "opendlv/vehiclecontext/model/SegmentGrid.h"
 
 namespace opendlv { namespace vehiclecontext {
     namespace model {
@@ -51,7 +52,13 @@ namespace opendlv { namespace vehiclecontext {
             m_faultModelNoise(faultModelNoise),
             m_totalRotation(0),
             m_FOV(),
-            m_sensorPosition()
+            m_sensorPosition(),
+            m_leftBoundaryFOV(),
+            m_rightBoundaryFOV(),
+            m_candidates(),
+            m_rayX(),
+            m_rayY(),
+            m_rayLength()
         {}
 
         PointSensor::~PointSensor() {}
@@ -74,6 +81,8 @@ namespace opendlv { namespace vehiclecontext {
             // 3. Translate the FOV to the sensor's position.
             leftBoundaryFOV += m_sensorPosition;
             rightBoundaryFOV += m_sensorPosition;
+            m_leftBoundaryFOV = leftBoundaryFOV;
+            m_rightBoundaryFOV = rightBoundaryFOV;
 
             // Iterate through all available polygons and intersect FOV-polygon with polygon.
             Polygon FOV;
@@ -86,69 +95,88 @@ namespace opendlv { namespace vehiclecontext {
             return m_FOV;
         }
 
-        bool PointSensor::isInFOV(const Point3 &pt) const {
-            bool retVal = false;
+        bool PointSensor::isInFOV(const double &x, const double &y) const {
+            const double EPSILON = 1e-9;
 
-            // Calculate angle deviation.
-            double angleDelta = (pt - m_sensorPosition).getAngleXY() - m_totalRotation;
+            const double sX = m_sensorPosition.getX(), sY = m_sensorPosition.getY();
+            const double lX = m_leftBoundaryFOV.getX(), lY = m_leftBoundaryFOV.getY();
+            const double rX = m_rightBoundaryFOV.getX(), rY = m_rightBoundaryFOV.getY();
 
-            // If total rotation angle is negative, normalize angleDelta.
-            if (m_totalRotation < 0) {
-                // Normalize angle to interval -PI ... PI.
-                while (angleDelta < -cartesian::Constants::PI) {
-                    angleDelta += 2.0*cartesian::Constants::PI;
-                }
-                while (angleDelta > cartesian::Constants::PI) {
-                    angleDelta -= 2.0*cartesian::Constants::PI;
-                }
-            }
+            // The point is inside the FOV triangle if it is on the same side of all three edges.
+            const double c1 = (rX - sX) * (y - sY) - (rY - sY) * (x - sX);
+            const double c2 = (lX - rX) * (y - rY) - (lY - rY) * (x - rX);
+            const double c3 = (sX - lX) * (y - lY) - (sY - lY) * (x - lX);
 
-//           cerr << m_name << " angleDelta: " << angleDelta << ", totalRotation: " << m_totalRotation << ", left: " << (m_totalRotation + (m_angleFOV/2.0)*cartesian::Constants::DEG2RAD) << ", right: " << (m_totalRotation - (m_angleFOV/2.0)*cartesian::Constants::DEG2RAD) << ", " << (m_totalRotation + angleDelta) << endl;
-
-            // Check if the point is within the FOV.
-            if ( ( ((m_totalRotation + angleDelta) > (m_totalRotation - (m_angleFOV/2.0)*cartesian::Constants::DEG2RAD)) &&
-                   ((m_totalRotation + angleDelta) < (m_totalRotation + (m_angleFOV/2.0)*cartesian::Constants::DEG2RAD)) ) || 
-                 ( (fabs((m_totalRotation - (m_angleFOV/2.0)*cartesian::Constants::DEG2RAD) - (m_totalRotation + angleDelta)) < 1e-4) ||
-                   (fabs((m_totalRotation + (m_angleFOV/2.0)*cartesian::Constants::DEG2RAD) - (m_totalRotation + angleDelta)) < 1e-4) )
-               ) {
-                // Distance found.
-//              cerr << "Object's distance: " << (pt - m_sensorPosition).lengthXY() << ", Pos: " << pt.toString() << ", angleDelta: " << angleDelta << endl;
-                retVal = true;
-            }
-
-            return retVal;
+            return ( (c1 > -EPSILON) && (c2 > -EPSILON) && (c3 > -EPSILON) ) ||
+                   ( (c1 < EPSILON) && (c2 < EPSILON) && (c3 < EPSILON) );
         }
 
-        double PointSensor::getDistance(map<uint32_t, opendlv::data::environment::Polygon> &mapOfPolygons) {
-            Point3 nearest;
+        double PointSensor::getDistance(const SegmentGrid &segmentGrid) {
+            const double EPSILON = 1e-12;
             double distanceToSensor = -1;
 
-            map<uint32_t, opendlv::data::environment::Polygon>::const_iterator it = mapOfPolygons.begin();
-            while (it != mapOfPolygons.end()) {
-                Polygon p = it->second;
+            const double sX = m_sensorPosition.getX(), sY = m_sensorPosition.getY();
+            const double lX = m_leftBoundaryFOV.getX(), lY = m_leftBoundaryFOV.getY();
+            const double rX = m_rightBoundaryFOV.getX(), rY = m_rightBoundaryFOV.getY();
+
+            // Get the segments that might overlap the FOV; a sensor inside an obstacle is blocked completely.
+            if (segmentGrid.isInside(sX, sY)) {
+                distanceToSensor = 0;
+                m_candidates.clear();
+            }
+            else {
+                segmentGrid.getSegmentsInside(min(sX, min(lX, rX)), min(sY, min(lY, rY)),
+                                              max(sX, max(lX, rX)), max(sY, max(lY, rY)), m_candidates);
+            }
 
-                // Get overlapping parts of polygon...
-                Polygon contour = m_FOV.intersectIgnoreZ(p);
+            if (!m_candidates.empty()) {
+                // Rays from the sensor to equidistant points on the far edge of the FOV; thus, t in [0, 1] is inside the FOV.
+                const uint32_t numberOfRays = max(2, static_cast<int>(ceil(m_angleFOV * RAYS_PER_DEGREE)) + 1);
+                m_rayX.resize(numberOfRays);
+                m_rayY.resize(numberOfRays);
+                m_rayLength.resize(numberOfRays);
+                for (uint32_t k = 0; k < numberOfRays; k++) {
+                    const double f = static_cast<double>(k) / (numberOfRays - 1);
+                    m_rayX[k] = (rX + (lX - rX) * f) - sX;
+                    m_rayY[k] = (rY + (lY - rY) * f) - sY;
+                    m_rayLength[k] = sqrt(m_rayX[k] * m_rayX[k] + m_rayY[k] * m_rayY[k]);
+                }
 
-                if (contour.getSize() > 0) {
-                    // Get nearest point from contour.
-                    const vector<Point3> listOfPoints = contour.getVertices();
-                    vector<Point3>::const_iterator jt = listOfPoints.begin();
+                for (uint32_t i = 0; i < m_candidates.size(); i++) {
+                    const SegmentGrid::Segment &s = segmentGrid.getSegment(m_candidates[i]);
 
-                    while (jt != listOfPoints.end()) {
-                        Point3 pt = (*jt++);
-                        double d = (pt - m_sensorPosition).lengthXY();
+                    // Vertices inside the FOV.
+                    if (isInFOV(s.m_aX, s.m_aY)) {
+                        const double d = sqrt((s.m_aX - sX) * (s.m_aX - sX) + (s.m_aY - sY) * (s.m_aY - sY));
+                        if ((distanceToSensor < 0) || (d < distanceToSensor)) {
+                            distanceToSensor = d;
+                        }
+                    }
+                    if (isInFOV(s.m_bX, s.m_bY)) {
+                        const double d = sqrt((s.m_bX - sX) * (s.m_bX - sX) + (s.m_bY - sY) * (s.m_bY - sY));
+                        if ((distanceToSensor < 0) || (d < distanceToSensor)) {
+                            distanceToSensor = d;
+                        }
+                    }
 
-                        if (isInFOV(pt)) {
-                            if ((distanceToSensor < 0) || (d < distanceToSensor)) {
-                                nearest = pt;
-                                distanceToSensor = d;
+                    // Intersect all rays with the segment: sensor + t * ray = A + u * (B - A).
+                    const double eX = s.m_bX - s.m_aX, eY = s.m_bY - s.m_aY;
+                    const double wX = s.m_aX - sX, wY = s.m_aY - sY;
+                    const double wCrossE = wX * eY - wY * eX;
+                    for (uint32_t k = 0; k < numberOfRays; k++) {
+                        const double denominator = m_rayX[k] * eY - m_rayY[k] * eX;
+                        if (fabs(denominator) > EPSILON) {
+                            const double t = wCrossE / denominator;
+                            const double u = (wX * m_rayY[k] - wY * m_rayX[k]) / denominator;
+                            if ( (t >= 0) && (t <= 1) && (u >= 0) && (u <= 1) ) {
+                                const double d = t * m_rayLength[k];
+                                if ((distanceToSensor < 0) || (d < distanceToSensor)) {
+                                    distanceToSensor = d;
+                                }
                             }
                         }
                     }
                 }
-
-                it++;
             }
 
             if (distanceToSensor > m_clampDistance) {
@@ -0,0 +1,226 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/data/environment/Polygon.h"
+#include "opendlv/vehiclecontext/model/SegmentGrid.h"
+
+namespace opendlv { namespace vehiclecontext {
+    namespace model {
+
+        using namespace std;
+        using namespace opendlv::data::environment;
+
+        SegmentGrid::SegmentGrid() :
+            m_segments(),
+            m_minX(0),
+            m_minY(0),
+            m_maxX(0),
+            m_maxY(0),
+            m_cellSize(1),
+            m_cellsX(0),
+            m_cellsY(0),
+            m_cellStart(),
+            m_cellSegments() {}
+
+        SegmentGrid::~SegmentGrid() {}
+
+        void SegmentGrid::build(const map<uint32_t, Polygon> &mapOfPolygons) {
+            m_segments.clear();
+            m_cellStart.clear();
+            m_cellSegments.clear();
+            m_cellsX = m_cellsY = 0;
+
+            // Collect the closed outlines.
+            uint32_t polygon = 0;
+            map<uint32_t, Polygon>::const_iterator it = mapOfPolygons.begin();
+            while (it != mapOfPolygons.end()) {
+                const vector<Point3> listOfVertices = (it++)->second.getVertices();
+                const uint32_t SIZE = static_cast<uint32_t>(listOfVertices.size());
+                for (uint32_t i = 0; i < SIZE; i++) {
+                    // A single vertex results in a segment without length.
+                    const Point3 &a = listOfVertices.at(i);
+                    const Point3 &b = listOfVertices.at((i + 1) % SIZE);
+
+                    Segment s;
+                    s.m_aX = a.getX();
+                    s.m_aY = a.getY();
+                    s.m_bX = b.getX();
+                    s.m_bY = b.getY();
+                    s.m_polygon = polygon;
+                    s.m_closed = (SIZE > 2);
+                    m_segments.push_back(s);
+
+                    // Closing a polygon with two vertices would duplicate its only edge.
+                    if (SIZE == 2) {
+                        break;
+                    }
+                }
+                polygon++;
+            }
+
+            if (m_segments.empty()) {
+                return;
+            }
+
+            m_minX = m_maxX = m_segments.front().m_aX;
+            m_minY = m_maxY = m_segments.front().m_aY;
+            for (uint32_t i = 0; i < m_segments.size(); i++) {
+                const Segment &s = m_segments[i];
+                m_minX = min(m_minX, min(s.m_aX, s.m_bX));
+                m_maxX = max(m_maxX, max(s.m_aX, s.m_bX));
+                m_minY = min(m_minY, min(s.m_aY, s.m_bY));
+                m_maxY = max(m_maxY, max(s.m_aY, s.m_bY));
+            }
+
+            // Choose square cells for SEGMENTS_PER_CELL segments on average.
+            const double width = m_maxX - m_minX;
+            const double height = m_maxY - m_minY;
+            const double numberOfCells = max(1.0, static_cast<double>(m_segments.size()) / SEGMENTS_PER_CELL);
+            m_cellSize = sqrt((width * height) / numberOfCells);
+            m_cellSize = max(m_cellSize, max(width, height) / MAXIMUM_CELLS_PER_AXIS);
+            if (!(m_cellSize > 0)) {
+                m_cellSize = 1;
+            }
+            m_cellsX = min(static_cast<uint32_t>(width / m_cellSize) + 1, static_cast<uint32_t>(MAXIMUM_CELLS_PER_AXIS));
+            m_cellsY = min(static_cast<uint32_t>(height / m_cellSize) + 1, static_cast<uint32_t>(MAXIMUM_CELLS_PER_AXIS));
+
+            // First pass: Count the segments per cell using their bounding boxes.
+            m_cellStart.assign(m_cellsX * m_cellsY + 1, 0);
+            for (uint32_t i = 0; i < m_segments.size(); i++) {
+                const Segment &s = m_segments[i];
+                const uint32_t x0 = getCellX(min(s.m_aX, s.m_bX)), x1 = getCellX(max(s.m_aX, s.m_bX));
+                const uint32_t y0 = getCellY(min(s.m_aY, s.m_bY)), y1 = getCellY(max(s.m_aY, s.m_bY));
+                for (uint32_t y = y0; y <= y1; y++) {
+                    for (uint32_t x = x0; x <= x1; x++) {
+                        m_cellStart[y * m_cellsX + x + 1]++;
+                    }
+                }
+            }
+            for (uint32_t i = 1; i < m_cellStart.size(); i++) {
+                m_cellStart[i] += m_cellStart[i - 1];
+            }
+
+            // Second pass: Store the segments' indices.
+            m_cellSegments.resize(m_cellStart.back());
+            vector<uint32_t> fill(m_cellStart.begin(), m_cellStart.end() - 1);
+            for (uint32_t i = 0; i < m_segments.size(); i++) {
+                const Segment &s = m_segments[i];
+                const uint32_t x0 = getCellX(min(s.m_aX, s.m_bX)), x1 = getCellX(max(s.m_aX, s.m_bX));
+                const uint32_t y0 = getCellY(min(s.m_aY, s.m_bY)), y1 = getCellY(max(s.m_aY, s.m_bY));
+                for (uint32_t y = y0; y <= y1; y++) {
+                    for (uint32_t x = x0; x <= x1; x++) {
+                        m_cellSegments[fill[y * m_cellsX + x]++] = i;
+                    }
+                }
+            }
+        }
+
+        uint32_t SegmentGrid::getNumberOfSegments() const {
+            return static_cast<uint32_t>(m_segments.size());
+        }
+
+        const SegmentGrid::Segment& SegmentGrid::getSegment(const uint32_t &index) const {
+            return m_segments[index];
+        }
+
+        uint32_t SegmentGrid::getCellX(const double &x) const {
+            if (x <= m_minX) {
+                return 0;
+            }
+            if (x >= m_maxX) {
+                return m_cellsX - 1;
+            }
+            return min(static_cast<uint32_t>((x - m_minX) / m_cellSize), m_cellsX - 1);
+        }
+
+        uint32_t SegmentGrid::getCellY(const double &y) const {
+            if (y <= m_minY) {
+                return 0;
+            }
+            if (y >= m_maxY) {
+                return m_cellsY - 1;
+            }
+            return min(static_cast<uint32_t>((y - m_minY) / m_cellSize), m_cellsY - 1);
+        }
+
+        void SegmentGrid::getSegmentsInside(const double &minX, const double &minY, const double &maxX, const double &maxY, vector<uint32_t> &segments) const {
+            segments.clear();
+
+            if ( m_segments.empty() ||
+                 (maxX < m_minX) || (minX > m_maxX) ||
+                 (maxY < m_minY) || (minY > m_maxY) ) {
+                return;
+            }
+
+            const uint32_t x0 = getCellX(minX), x1 = getCellX(maxX);
+            const uint32_t y0 = getCellY(minY), y1 = getCellY(maxY);
+            for (uint32_t y = y0; y <= y1; y++) {
+                for (uint32_t x = x0; x <= x1; x++) {
+                    const uint32_t cell = y * m_cellsX + x;
+                    segments.insert(segments.end(), m_cellSegments.begin() + m_cellStart[cell], m_cellSegments.begin() + m_cellStart[cell + 1]);
+                }
+            }
+
+            // Segments spanning several cells are reported only once.
+            std::sort(segments.begin(), segments.end());
+            segments.erase(std::unique(segments.begin(), segments.end()), segments.end());
+        }
+
+
+        bool SegmentGrid::isInside(const double &x, const double &y) const {
+            // Count the crossings of the half-line from (x, y) towards +X per polygon.
+            vector<uint32_t> segments;
+            getSegmentsInside(x, y, m_maxX, y, segments);
+
+            vector<uint32_t> crossedPolygons;
+            for (uint32_t i = 0; i < segments.size(); i++) {
+                const Segment &s = m_segments[segments[i]];
+                if (s.m_closed && ((s.m_aY > y) != (s.m_bY > y))) {
+                    const double crossingX = s.m_aX + (y - s.m_aY) * (s.m_bX - s.m_aX) / (s.m_bY - s.m_aY);
+                    if (crossingX > x) {
+                        crossedPolygons.push_back(s.m_polygon);
+                    }
+                }
+            }
+
+            // The point is inside a polygon if its outline is crossed an odd number of times.
+            std::sort(crossedPolygons.begin(), crossedPolygons.end());
+            uint32_t i = 0;
+            while (i < crossedPolygons.size()) {
+                uint32_t j = i;
+                while ((j < crossedPolygons.size()) && (crossedPolygons[j] == crossedPolygons[i])) {
+                    j++;
+                }
+                if (((j - i) % 2) == 1) {
+                    return true;
+                }
+                i = j;
+            }
+            return false;
+        }
+
+    }
+} } // opendlv::vehiclecontext::model
@@ -24,16 +24,19 @@ namespace opendlv {
 
         RenderingConfiguration::RenderingConfiguration() :
             m_drawTextures(true),
+            m_softwareRenderer(NULL),
             m_nodesRenderingConfiguration() {}
 
         RenderingConfiguration::RenderingConfiguration(const RenderingConfiguration &obj) :
         	m_drawTextures(obj.m_drawTextures),
+        	m_softwareRenderer(obj.m_softwareRenderer),
         	m_nodesRenderingConfiguration(obj.m_nodesRenderingConfiguration) {}
 
         RenderingConfiguration::~RenderingConfiguration() {}
 
         RenderingConfiguration& RenderingConfiguration::operator=(const RenderingConfiguration &obj) {
         	m_drawTextures = obj.m_drawTextures;
+        	m_softwareRenderer = obj.m_softwareRenderer;
         	m_nodesRenderingConfiguration = obj.m_nodesRenderingConfiguration;
 
         	return (*this);
@@ -55,5 +58,13 @@ namespace opendlv {
             m_nodesRenderingConfiguration[nd] = nrc;
         }
 
+        SoftwareRenderer* RenderingConfiguration::getSoftwareRenderer() const {
+            return m_softwareRenderer;
+        }
+
+        void RenderingConfiguration::setSoftwareRenderer(SoftwareRenderer *softwareRenderer) {
+            m_softwareRenderer = softwareRenderer;
+        }
+
     }
 } // opendlv::threeD
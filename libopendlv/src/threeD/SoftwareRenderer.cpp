@@ -0,0 +1,601 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "automotivedata/generated/cartesian/Constants.h"
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
+
+namespace opendlv {
+    namespace threeD {
+
+        using namespace std;
+        using namespace odcore::base;
+        using namespace opendlv::data::environment;
+
+        // Vertices in clip coordinates: x, y, z, w, r, g, b, u, v.
+        enum {
+            CLIP_VERTEX_SIZE = 9
+        };
+
+        // Screen coordinates are snapped to 1/SUBPIXELS of a pixel; thus,
+        // the edge functions are computed exactly and, together with the
+        // top-left rule, adjacent triangles neither overlap nor leave gaps.
+        static const double SUBPIXELS = 16;
+
+        static inline double snap(const double &v) {
+            return floor(v * SUBPIXELS + 0.5) / SUBPIXELS;
+        }
+
+        static inline uint8_t toByte(const double &c) {
+            return static_cast<uint8_t>(min(max(c, 0.0), 1.0) * 255.0 + 0.5);
+        }
+
+        SoftwareRenderer::SoftwareRenderer(const uint32_t &width, const uint32_t &height, const uint32_t &numberOfThreads) :
+            m_width(width),
+            m_height(height),
+            m_tilesX((width + TILE_WIDTH - 1) / TILE_WIDTH),
+            m_tilesY((height + TILE_HEIGHT - 1) / TILE_HEIGHT),
+            m_projection(),
+            m_modelView(),
+            m_modelViewProjection(),
+            m_zNear(1),
+            m_color(1, 1, 1),
+            m_texture(NULL),
+            m_clearColor(),
+            m_triangles(),
+            m_tiles(m_tilesX * m_tilesY),
+            m_depth(width * height, 1.0f),
+            m_workPool(numberOfThreads),
+            m_renderMutex(),
+            m_bgr(NULL) {
+            ::memset(m_projection.m_m, 0, sizeof(m_projection.m_m));
+            m_projection.m_m[0] = m_projection.m_m[5] = m_projection.m_m[10] = m_projection.m_m[15] = 1;
+            m_modelView.push_back(m_projection);
+            m_clearColor[0] = m_clearColor[1] = m_clearColor[2] = 0;
+            updateModelViewProjection();
+        }
+
+        SoftwareRenderer::~SoftwareRenderer() {}
+
+        uint32_t SoftwareRenderer::getWidth() const {
+            return m_width;
+        }
+
+        uint32_t SoftwareRenderer::getHeight() const {
+            return m_height;
+        }
+
+        uint32_t SoftwareRenderer::getNumberOfThreads() const {
+            return m_workPool.getNumberOfThreads();
+        }
+
+        uint32_t SoftwareRenderer::getNumberOfTriangles() const {
+            return m_triangles.size();
+        }
+
+        void SoftwareRenderer::setPerspective(const double &fovY, const double &aspect, const double &zNear, const double &zFar) {
+            const double f = 1.0 / tan(fovY * cartesian::Constants::DEG2RAD / 2.0);
+
+            ::memset(m_projection.m_m, 0, sizeof(m_projection.m_m));
+            m_projection.m_m[0] = f / aspect;
+            m_projection.m_m[5] = f;
+            m_projection.m_m[10] = (zFar + zNear) / (zNear - zFar);
+            m_projection.m_m[11] = -1;
+            m_projection.m_m[14] = (2 * zFar * zNear) / (zNear - zFar);
+            m_zNear = zNear;
+
+            updateModelViewProjection();
+        }
+
+        void SoftwareRenderer::clear(const Point3 &color) {
+            m_triangles.clear();
+            for (uint32_t i = 0; i < m_tiles.size(); i++) {
+                m_tiles[i].clear();
+            }
+
+            m_clearColor[0] = toByte(color.getZ());
+            m_clearColor[1] = toByte(color.getY());
+            m_clearColor[2] = toByte(color.getX());
+        }
+
+        void SoftwareRenderer::loadIdentity() {
+            Matrix &m = m_modelView.back();
+            ::memset(m.m_m, 0, sizeof(m.m_m));
+            m.m_m[0] = m.m_m[5] = m.m_m[10] = m.m_m[15] = 1;
+
+            updateModelViewProjection();
+        }
+
+        void SoftwareRenderer::lookAt(const Point3 &eye, const Point3 &center, const Point3 &up) {
+            Point3 f = center - eye;
+            f.normalize();
+            Point3 s = f.cross(up);
+            s.normalize();
+            const Point3 u = s.cross(f);
+
+            Matrix m;
+            ::memset(m.m_m, 0, sizeof(m.m_m));
+            m.m_m[0] = s.getX();
+            m.m_m[4] = s.getY();
+            m.m_m[8] = s.getZ();
+            m.m_m[1] = u.getX();
+            m.m_m[5] = u.getY();
+            m.m_m[9] = u.getZ();
+            m.m_m[2] = -f.getX();
+            m.m_m[6] = -f.getY();
+            m.m_m[10] = -f.getZ();
+            m.m_m[15] = 1;
+            multiply(m);
+
+            translate(eye * -1);
+        }
+
+        void SoftwareRenderer::pushMatrix() {
+            m_modelView.push_back(m_modelView.back());
+        }
+
+        void SoftwareRenderer::popMatrix() {
+            if (m_modelView.size() > 1) {
+                m_modelView.pop_back();
+                updateModelViewProjection();
+            }
+        }
+
+        void SoftwareRenderer::translate(const Point3 &t) {
+            Matrix m;
+            ::memset(m.m_m, 0, sizeof(m.m_m));
+            m.m_m[0] = m.m_m[5] = m.m_m[10] = m.m_m[15] = 1;
+            m.m_m[12] = t.getX();
+            m.m_m[13] = t.getY();
+            m.m_m[14] = t.getZ();
+            multiply(m);
+        }
+
+        void SoftwareRenderer::rotate(const double &angle, const Point3 &axis) {
+            Point3 a = axis;
+            a.normalize();
+            const double x = a.getX();
+            const double y = a.getY();
+            const double z = a.getZ();
+            const double c = cos(angle);
+            const double s = sin(angle);
+
+            // Same as glRotate.
+            Matrix m;
+            ::memset(m.m_m, 0, sizeof(m.m_m));
+            m.m_m[0] = x * x * (1 - c) + c;
+            m.m_m[1] = y * x * (1 - c) + z * s;
+            m.m_m[2] = x * z * (1 - c) - y * s;
+            m.m_m[4] = x * y * (1 - c) - z * s;
+            m.m_m[5] = y * y * (1 - c) + c;
+            m.m_m[6] = y * z * (1 - c) + x * s;
+            m.m_m[8] = x * z * (1 - c) + y * s;
+            m.m_m[9] = y * z * (1 - c) - x * s;
+            m.m_m[10] = z * z * (1 - c) + c;
+            m.m_m[15] = 1;
+            multiply(m);
+        }
+
+        void SoftwareRenderer::scale(const Point3 &s) {
+            Matrix m;
+            ::memset(m.m_m, 0, sizeof(m.m_m));
+            m.m_m[0] = s.getX();
+            m.m_m[5] = s.getY();
+            m.m_m[10] = s.getZ();
+            m.m_m[15] = 1;
+            multiply(m);
+        }
+
+        void SoftwareRenderer::multiply(const Matrix &m) {
+            const Matrix current = m_modelView.back();
+            Matrix &result = m_modelView.back();
+            for (uint32_t col = 0; col < 4; col++) {
+                for (uint32_t row = 0; row < 4; row++) {
+                    double sum = 0;
+                    for (uint32_t k = 0; k < 4; k++) {
+                        sum += current.m_m[k * 4 + row] * m.m_m[col * 4 + k];
+                    }
+                    result.m_m[col * 4 + row] = sum;
+                }
+            }
+
+            updateModelViewProjection();
+        }
+
+        void SoftwareRenderer::updateModelViewProjection() {
+            const Matrix &modelView = m_modelView.back();
+            for (uint32_t col = 0; col < 4; col++) {
+                for (uint32_t row = 0; row < 4; row++) {
+                    double sum = 0;
+                    for (uint32_t k = 0; k < 4; k++) {
+                        sum += m_projection.m_m[k * 4 + row] * modelView.m_m[col * 4 + k];
+                    }
+                    m_modelViewProjection.m_m[col * 4 + row] = sum;
+                }
+            }
+        }
+
+        void SoftwareRenderer::setColor(const Point3 &color) {
+            m_color = color;
+        }
+
+        void SoftwareRenderer::setTexture(const core::wrapper::Image *texture) {
+            m_texture = texture;
+        }
+
+        void SoftwareRenderer::transform(const Point3 &p, double *clip) const {
+            const double *m = m_modelViewProjection.m_m;
+            for (uint32_t row = 0; row < 4; row++) {
+                clip[row] = m[row] * p.getX() + m[4 + row] * p.getY() + m[8 + row] * p.getZ() + m[12 + row];
+            }
+            clip[4] = m_color.getX();
+            clip[5] = m_color.getY();
+            clip[6] = m_color.getZ();
+            clip[7] = 0;
+            clip[8] = 0;
+        }
+
+        void SoftwareRenderer::addTriangle(const Point3 &a, const Point3 &b, const Point3 &c) {
+            double clipA[CLIP_VERTEX_SIZE], clipB[CLIP_VERTEX_SIZE], clipC[CLIP_VERTEX_SIZE];
+            transform(a, clipA);
+            transform(b, clipB);
+            transform(c, clipC);
+            addClipTriangle(clipA, clipB, clipC, NULL);
+        }
+
+        void SoftwareRenderer::addColoredTriangle(const Point3 &a, const Point3 &colorA, const Point3 &b, const Point3 &colorB, const Point3 &c, const Point3 &colorC) {
+            double clipA[CLIP_VERTEX_SIZE], clipB[CLIP_VERTEX_SIZE], clipC[CLIP_VERTEX_SIZE];
+            transform(a, clipA);
+            transform(b, clipB);
+            transform(c, clipC);
+
+            clipA[4] = colorA.getX(); clipA[5] = colorA.getY(); clipA[6] = colorA.getZ();
+            clipB[4] = colorB.getX(); clipB[5] = colorB.getY(); clipB[6] = colorB.getZ();
+            clipC[4] = colorC.getX(); clipC[5] = colorC.getY(); clipC[6] = colorC.getZ();
+
+            addClipTriangle(clipA, clipB, clipC, NULL);
+        }
+
+        void SoftwareRenderer::addTexturedTriangle(const Point3 &a, const Point3 &textureA, const Point3 &b, const Point3 &textureB, const Point3 &c, const Point3 &textureC) {
+            double clipA[CLIP_VERTEX_SIZE], clipB[CLIP_VERTEX_SIZE], clipC[CLIP_VERTEX_SIZE];
+            transform(a, clipA);
+            transform(b, clipB);
+            transform(c, clipC);
+
+            clipA[7] = textureA.getX(); clipA[8] = textureA.getY();
+            clipB[7] = textureB.getX(); clipB[8] = textureB.getY();
+            clipC[7] = textureC.getX(); clipC[8] = textureC.getY();
+
+            addClipTriangle(clipA, clipB, clipC, m_texture);
+        }
+
+        void SoftwareRenderer::addLine(const Point3 &a, const Point3 &b, const float &width) {
+            double clipA[CLIP_VERTEX_SIZE], clipB[CLIP_VERTEX_SIZE];
+            transform(a, clipA);
+            transform(b, clipB);
+
+            // Clip at the near plane (z >= -w).
+            const double distanceA = clipA[2] + clipA[3];
+            const double distanceB = clipB[2] + clipB[3];
+            if ( (distanceA < 0) && (distanceB < 0) ) {
+                return;
+            }
+            if ( (distanceA < 0) || (distanceB < 0) ) {
+                double *outside = (distanceA < 0) ? clipA : clipB;
+                const double *inside = (distanceA < 0) ? clipB : clipA;
+                const double t = (distanceA < 0) ? (distanceA / (distanceA - distanceB)) : (distanceB / (distanceB - distanceA));
+                for (uint32_t i = 0; i < CLIP_VERTEX_SIZE; i++) {
+                    outside[i] += t * (inside[i] - outside[i]);
+                }
+            }
+
+            ScreenVertex screenA, screenB;
+            toScreen(clipA, screenA);
+            toScreen(clipB, screenB);
+
+            const double dx = screenB.m_x - screenA.m_x;
+            const double dy = screenB.m_y - screenA.m_y;
+            const double length = sqrt(dx * dx + dy * dy);
+            if (!(length > 0)) {
+                return;
+            }
+
+            // Wide lines are quads in screen coordinates without perspective.
+            const double nx = -dy / length * width / 2.0;
+            const double ny = dx / length * width / 2.0;
+            screenA.m_invW = screenB.m_invW = 1;
+
+            ScreenVertex quad[4] = { screenA, screenB, screenB, screenA };
+            quad[0].m_x += nx; quad[0].m_y += ny;
+            quad[1].m_x += nx; quad[1].m_y += ny;
+            quad[2].m_x -= nx; quad[2].m_y -= ny;
+            quad[3].m_x -= nx; quad[3].m_y -= ny;
+
+            addScreenTriangle(quad[0], quad[1], quad[2], NULL);
+            addScreenTriangle(quad[0], quad[2], quad[3], NULL);
+        }
+
+        void SoftwareRenderer::addPoint(const Point3 &p, const float &width) {
+            double clip[CLIP_VERTEX_SIZE];
+            transform(p, clip);
+            if (clip[2] + clip[3] < 0) {
+                return;
+            }
+
+            ScreenVertex center;
+            toScreen(clip, center);
+            center.m_invW = 1;
+
+            // Points are squares in screen coordinates.
+            const double half = width / 2.0;
+            ScreenVertex quad[4] = { center, center, center, center };
+            quad[0].m_x -= half; quad[0].m_y -= half;
+            quad[1].m_x += half; quad[1].m_y -= half;
+            quad[2].m_x += half; quad[2].m_y += half;
+            quad[3].m_x -= half; quad[3].m_y += half;
+
+            addScreenTriangle(quad[0], quad[1], quad[2], NULL);
+            addScreenTriangle(quad[0], quad[2], quad[3], NULL);
+        }
+
+        void SoftwareRenderer::addClipTriangle(const double *a, const double *b, const double *c, const core::wrapper::Image *texture) {
+            const double *input[3] = { a, b, c };
+
+            // Clip at the near plane (z >= -w); the result has up to four vertices.
+            double output[4][CLIP_VERTEX_SIZE];
+            uint32_t numberOfVertices = 0;
+            for (uint32_t i = 0; i < 3; i++) {
+                const double *current = input[i];
+                const double *next = input[(i + 1) % 3];
+                const double distanceCurrent = current[2] + current[3];
+                const double distanceNext = next[2] + next[3];
+
+                if (distanceCurrent >= 0) {
+                    ::memcpy(output[numberOfVertices++], current, sizeof(double) * CLIP_VERTEX_SIZE);
+                }
+                if ( (distanceCurrent >= 0) != (distanceNext >= 0) ) {
+                    const double t = distanceCurrent / (distanceCurrent - distanceNext);
+                    for (uint32_t j = 0; j < CLIP_VERTEX_SIZE; j++) {
+                        output[numberOfVertices][j] = current[j] + t * (next[j] - current[j]);
+                    }
+                    numberOfVertices++;
+                }
+            }
+
+            if (numberOfVertices < 3) {
+                return;
+            }
+
+            ScreenVertex screen[4];
+            for (uint32_t i = 0; i < numberOfVertices; i++) {
+                toScreen(output[i], screen[i]);
+            }
+            for (uint32_t i = 2; i < numberOfVertices; i++) {
+                addScreenTriangle(screen[0], screen[i - 1], screen[i], texture);
+            }
+        }
+
+        void SoftwareRenderer::toScreen(const double *clip, ScreenVertex &v) const {
+            // The near plane keeps w >= zNear.
+            v.m_invW = 1.0 / max(clip[3], m_zNear * 1e-6);
+            v.m_x = (clip[0] * v.m_invW + 1.0) * 0.5 * m_width;
+            v.m_y = (1.0 - clip[1] * v.m_invW) * 0.5 * m_height;
+            v.m_z = (clip[2] * v.m_invW + 1.0) * 0.5;
+            v.m_r = clip[4];
+            v.m_g = clip[5];
+            v.m_b = clip[6];
+            v.m_u = clip[7];
+            v.m_v = clip[8];
+        }
+
+        void SoftwareRenderer::addScreenTriangle(const ScreenVertex &a, const ScreenVertex &b, const ScreenVertex &c, const core::wrapper::Image *texture) {
+            double x[3] = { snap(a.m_x), snap(b.m_x), snap(c.m_x) };
+            double y[3] = { snap(a.m_y), snap(b.m_y), snap(c.m_y) };
+            const ScreenVertex *v[3] = { &a, &b, &c };
+
+            double area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+            if (!(fabs(area) > 0)) {
+                // Degenerated or invalid triangle.
+                return;
+            }
+            if (area < 0) {
+                // Both sides are drawn; use the same orientation for all triangles.
+                swap(x[1], x[2]);
+                swap(y[1], y[2]);
+                swap(v[1], v[2]);
+                area = -area;
+            }
+
+            // Pixels are covered if their centers are inside.
+            const double minX = max(ceil(min(x[0], min(x[1], x[2])) - 0.5), 0.0);
+            const double maxX = min(floor(max(x[0], max(x[1], x[2])) - 0.5), m_width - 1.0);
+            const double minY = max(ceil(min(y[0], min(y[1], y[2])) - 0.5), 0.0);
+            const double maxY = min(floor(max(y[0], max(y[1], y[2])) - 0.5), m_height - 1.0);
+            if ( !(minX <= maxX) || !(minY <= maxY) ) {
+                return;
+            }
+
+            Triangle t;
+            t.m_minX = static_cast<int32_t>(minX);
+            t.m_maxX = static_cast<int32_t>(maxX);
+            t.m_minY = static_cast<int32_t>(minY);
+            t.m_maxY = static_cast<int32_t>(maxY);
+            t.m_texture = texture;
+
+            // Edge functions: A*x + B*y + C >= 0 inside.
+            for (uint32_t i = 0; i < 3; i++) {
+                const uint32_t j = (i + 1) % 3;
+                t.m_edgeA[i] = y[i] - y[j];
+                t.m_edgeB[i] = x[j] - x[i];
+                t.m_edgeC[i] = -(t.m_edgeA[i] * x[i] + t.m_edgeB[i] * y[i]);
+
+                // Top-left rule: Pixel centers exactly on an edge belong to the triangle only if
+                // the edge is a left edge (A > 0) or a horizontal top edge (A = 0 and B > 0).
+                // At pixel centers, the edge functions are multiples of 1/SUBPIXELS^2; thus,
+                // half of it as bias excludes exactly the centers on the other edges.
+                const bool isLeftEdge = (t.m_edgeA[i] > 0);
+                const bool isTopEdge = !(fabs(t.m_edgeA[i]) > 0) && (t.m_edgeB[i] > 0);
+                if (!isLeftEdge && !isTopEdge) {
+                    t.m_edgeC[i] -= 0.5 / (SUBPIXELS * SUBPIXELS);
+                }
+            }
+
+            // Attributes divided by w are linear in screen coordinates.
+            double attributes[3][NUMBER_OF_ATTRIBUTES];
+            for (uint32_t i = 0; i < 3; i++) {
+                attributes[i][Z] = v[i]->m_z;
+                attributes[i][INVW] = v[i]->m_invW;
+                attributes[i][R] = v[i]->m_r * v[i]->m_invW;
+                attributes[i][G] = v[i]->m_g * v[i]->m_invW;
+                attributes[i][B] = v[i]->m_b * v[i]->m_invW;
+                attributes[i][U] = v[i]->m_u * v[i]->m_invW;
+                attributes[i][V] = v[i]->m_v * v[i]->m_invW;
+            }
+            for (uint32_t k = 0; k < NUMBER_OF_ATTRIBUTES; k++) {
+                const double d1 = attributes[1][k] - attributes[0][k];
+                const double d2 = attributes[2][k] - attributes[0][k];
+                t.m_dx[k] = (d1 * (y[2] - y[0]) - d2 * (y[1] - y[0])) / area;
+                t.m_dy[k] = (d2 * (x[1] - x[0]) - d1 * (x[2] - x[0])) / area;
+                t.m_c[k] = attributes[0][k] - t.m_dx[k] * x[0] - t.m_dy[k] * y[0];
+            }
+
+            const uint32_t index = m_triangles.size();
+            m_triangles.push_back(t);
+
+            for (int32_t tileY = t.m_minY / TILE_HEIGHT; tileY <= t.m_maxY / TILE_HEIGHT; tileY++) {
+                for (int32_t tileX = t.m_minX / TILE_WIDTH; tileX <= t.m_maxX / TILE_WIDTH; tileX++) {
+                    m_tiles[tileY * m_tilesX + tileX].push_back(index);
+                }
+            }
+        }
+
+        void SoftwareRenderer::render(uint8_t *bgr) {
+            if (bgr == NULL) {
+                return;
+            }
+
+            Lock l(m_renderMutex);
+
+            m_bgr = bgr;
+            m_workPool.execute(*this, m_tiles.size());
+            m_bgr = NULL;
+        }
+
+        void SoftwareRenderer::process(const uint32_t &item) {
+            renderTile(item);
+        }
+
+        void SoftwareRenderer::renderTile(const uint32_t &tile) {
+            const int32_t tileMinX = (tile % m_tilesX) * TILE_WIDTH;
+            const int32_t tileMinY = (tile / m_tilesX) * TILE_HEIGHT;
+            const int32_t tileMaxX = min(tileMinX + TILE_WIDTH, static_cast<int32_t>(m_width)) - 1;
+            const int32_t tileMaxY = min(tileMinY + TILE_HEIGHT, static_cast<int32_t>(m_height)) - 1;
+
+            // Clear the tile.
+            for (int32_t y = tileMinY; y <= tileMaxY; y++) {
+                uint8_t *pixel = m_bgr + 3 * (y * m_width + tileMinX);
+                for (int32_t x = tileMinX; x <= tileMaxX; x++) {
+                    *pixel++ = m_clearColor[0];
+                    *pixel++ = m_clearColor[1];
+                    *pixel++ = m_clearColor[2];
+                }
+                std::fill(m_depth.begin() + y * m_width + tileMinX, m_depth.begin() + y * m_width + tileMaxX + 1, 1.0f);
+            }
+
+            const vector<uint32_t> &listOfTriangles = m_tiles[tile];
+            for (uint32_t i = 0; i < listOfTriangles.size(); i++) {
+                const Triangle &t = m_triangles[listOfTriangles[i]];
+
+                const int32_t minX = max(t.m_minX, tileMinX);
+                const int32_t maxX = min(t.m_maxX, tileMaxX);
+                const int32_t minY = max(t.m_minY, tileMinY);
+                const int32_t maxY = min(t.m_maxY, tileMaxY);
+
+                const uint8_t *texture = NULL;
+                int32_t textureWidth = 0, textureHeight = 0, textureWidthStep = 0;
+                bool textureIsRGB = false;
+                if ( (t.m_texture != NULL) && (t.m_texture->getWidth() > 0) && (t.m_texture->getHeight() > 0) ) {
+                    texture = reinterpret_cast<const uint8_t*>(t.m_texture->getRawData());
+                    textureWidth = t.m_texture->getWidth();
+                    textureHeight = t.m_texture->getHeight();
+                    textureWidthStep = t.m_texture->getWidthStep();
+                    textureIsRGB = (t.m_texture->getFormat() == core::wrapper::Image::RGB_24BIT);
+                }
+
+                for (int32_t y = minY; y <= maxY; y++) {
+                    const double px = minX + 0.5;
+                    const double py = y + 0.5;
+
+                    double e0 = t.m_edgeA[0] * px + t.m_edgeB[0] * py + t.m_edgeC[0];
+                    double e1 = t.m_edgeA[1] * px + t.m_edgeB[1] * py + t.m_edgeC[1];
+                    double e2 = t.m_edgeA[2] * px + t.m_edgeB[2] * py + t.m_edgeC[2];
+
+                    double a[NUMBER_OF_ATTRIBUTES];
+                    for (uint32_t k = 0; k < NUMBER_OF_ATTRIBUTES; k++) {
+                        a[k] = t.m_dx[k] * px + t.m_dy[k] * py + t.m_c[k];
+                    }
+
+                    float *depth = &m_depth[y * m_width + minX];
+                    uint8_t *pixel = m_bgr + 3 * (y * m_width + minX);
+                    for (int32_t x = minX; x <= maxX; x++) {
+                        if ( (e0 >= 0) && (e1 >= 0) && (e2 >= 0) ) {
+                            const float z = static_cast<float>(a[Z]);
+                            if ( (z >= 0) && (z < *depth) ) {
+                                *depth = z;
+
+                                const double w = 1.0 / a[INVW];
+                                if (texture != NULL) {
+                                    // Nearest texel; the texture is repeated like GL_REPEAT.
+                                    int32_t u = static_cast<int32_t>(floor(a[U] * w * textureWidth)) % textureWidth;
+                                    int32_t v = static_cast<int32_t>(floor(a[V] * w * textureHeight)) % textureHeight;
+                                    u = (u < 0) ? u + textureWidth : u;
+                                    v = (v < 0) ? v + textureHeight : v;
+
+                                    const uint8_t *texel = texture + v * textureWidthStep + 3 * u;
+                                    pixel[0] = textureIsRGB ? texel[2] : texel[0];
+                                    pixel[1] = texel[1];
+                                    pixel[2] = textureIsRGB ? texel[0] : texel[2];
+                                }
+                                else {
+                                    pixel[0] = toByte(a[B] * w);
+                                    pixel[1] = toByte(a[G] * w);
+                                    pixel[2] = toByte(a[R] * w);
+                                }
+                            }
+                        }
+
+                        e0 += t.m_edgeA[0];
+                        e1 += t.m_edgeA[1];
+                        e2 += t.m_edgeA[2];
+                        for (uint32_t k = 0; k < NUMBER_OF_ATTRIBUTES; k++) {
+                            a[k] += t.m_dx[k];
+                        }
+                        depth++;
+                        pixel += 3;
+                    }
+                }
+            }
+        }
+
+    }
+} // opendlv::threeD
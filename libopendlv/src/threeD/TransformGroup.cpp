@@ -34,6 +34,7 @@
 #include "opendlv/threeD/NodeDescriptor.h"
 #include "opendlv/threeD/TransformGroup.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
 
 namespace opendlv { namespace threeD { class TransformGroupVisitor; } }
 
@@ -68,8 +69,20 @@ namespace opendlv {
 
             // Render if unnamed or not disabled.
             if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
-                glPushMatrix();
-                {
+                SoftwareRenderer *sr = renderingConfiguration.getSoftwareRenderer();
+                if (sr != NULL) {
+                    sr->pushMatrix();
+
+                    // Same transformations as for OpenGL.
+                    sr->translate(m_translation);
+                    sr->rotate(m_rotation.getX(), Point3(1, 0, 0));
+                    sr->rotate(m_rotation.getY(), Point3(0, 1, 0));
+                    sr->rotate(m_rotation.getZ(), Point3(0, 0, 1));
+                    sr->scale(m_scaling);
+                }
+                else {
+                    glPushMatrix();
+
                     // Translate the model.
                     glTranslated(m_translation.getX(), m_translation.getY(), m_translation.getZ());
 
@@ -80,17 +93,23 @@ namespace opendlv {
 
                     // Scale the model.
                     glScaled(m_scaling.getX(), m_scaling.getY(), m_scaling.getZ());
+                }
 
-                    // Draw all existing children.
-                    vector<Node*>::const_iterator it = m_listOfChildren.begin();
-                    while (it != m_listOfChildren.end()) {
-                        Node *n = (*it++);
-                        if (n != NULL) {
-                            n->render(renderingConfiguration);
-                        }
+                // Draw all existing children.
+                vector<Node*>::const_iterator it = m_listOfChildren.begin();
+                while (it != m_listOfChildren.end()) {
+                    Node *n = (*it++);
+                    if (n != NULL) {
+                        n->render(renderingConfiguration);
                     }
                 }
-                glPopMatrix();
+
+                if (sr != NULL) {
+                    sr->popMatrix();
+                }
+                else {
+                    glPopMatrix();
+                }
             }
         }
 
@@ -31,6 +31,7 @@
 #include "opendlv/threeD/NodeDescriptor.h"
 #include "opendlv/threeD/NodeRenderingConfiguration.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
 #include "opendlv/threeD/TextureManager.h"
 #include "opendlv/threeD/models/AerialImage.h"
 
@@ -43,16 +44,19 @@ namespace opendlv {
             using namespace opendlv::data::environment;
             using namespace odcore::wrapper;
 
-            AerialImageRenderer::AerialImageRenderer(const NodeDescriptor &nodeDescriptor, const uint32_t &textureHandle) :
+            AerialImageRenderer::AerialImageRenderer(const NodeDescriptor &nodeDescriptor, const core::wrapper::Image *image) :
                     Node(nodeDescriptor),
-                    m_textureHandle(textureHandle) {}
+                    m_image(image),
+                    m_textureHandle(-1) {}
 
             AerialImageRenderer::AerialImageRenderer(const AerialImageRenderer &obj) :
                     Node(obj.getNodeDescriptor()),
+                    m_image(obj.m_image),
                     m_textureHandle(obj.m_textureHandle) {}
 
             AerialImageRenderer& AerialImageRenderer::operator=(const AerialImageRenderer &obj) {
                 setNodeDescriptor(obj.getNodeDescriptor());
+                m_image = obj.m_image;
                 m_textureHandle = obj.m_textureHandle;
                 return (*this);
             }
@@ -61,33 +65,58 @@ namespace opendlv {
 
             void AerialImageRenderer::render(RenderingConfiguration &renderingConfiguration) {
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
-                    glPushMatrix();
-                    {
+                    SoftwareRenderer *sr = renderingConfiguration.getSoftwareRenderer();
+                    if (sr != NULL) {
+                        const Point3 A(0, 0, 0), B(0, 1, 0), C(1, 1, 0), D(1, 0, 0);
                         if (renderingConfiguration.hasDrawTextures()) {
-                            glEnable(GL_TEXTURE_2D);
-                            glBindTexture(GL_TEXTURE_2D, m_textureHandle);
-                            glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_DECAL);
+                            sr->setTexture(m_image);
+                            sr->addTexturedTriangle(A, Point3(0, 0, 0), B, Point3(0, 1, 0), C, Point3(1, 1, 0));
+                            sr->addTexturedTriangle(A, Point3(0, 0, 0), C, Point3(1, 1, 0), D, Point3(1, 0, 0));
+                            sr->setTexture(NULL);
+                        }
+                        else {
+                            sr->addTriangle(A, B, C);
+                            sr->addTriangle(A, C, D);
+                        }
+                    }
+                    else {
+                        // Create the texture within the OpenGL context.
+                        if (m_textureHandle <= 0) {
+                            TextureManager& tm = TextureManager::getInstance();
+                            tm.addImage("SCNX.AerialImage", m_image);
+                            m_textureHandle = tm.getTexture("SCNX.AerialImage");
                         }
 
-                        glBegin(GL_QUADS);
-                        glTexCoord2f(0, 0);
-                        glVertex3f(0, 0, 0);
-
-                        glTexCoord2f(0, 1);
-                        glVertex3f(0, 1, 0);
-
-                        glTexCoord2f(1, 1);
-                        glVertex3f(1, 1, 0);
-
-                        glTexCoord2f(1, 0);
-                        glVertex3f(1, 0, 0);
-                        glEnd();
-
-                        if (renderingConfiguration.hasDrawTextures()) {
-                            glDisable(GL_TEXTURE_2D);
+                        if (m_textureHandle > 0) {
+                            glPushMatrix();
+                            {
+                                if (renderingConfiguration.hasDrawTextures()) {
+                                    glEnable(GL_TEXTURE_2D);
+                                    glBindTexture(GL_TEXTURE_2D, static_cast<uint32_t>(m_textureHandle));
+                                    glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_DECAL);
+                                }
+
+                                glBegin(GL_QUADS);
+                                glTexCoord2f(0, 0);
+                                glVertex3f(0, 0, 0);
+
+                                glTexCoord2f(0, 1);
+                                glVertex3f(0, 1, 0);
+
+                                glTexCoord2f(1, 1);
+                                glVertex3f(1, 1, 0);
+
+                                glTexCoord2f(1, 0);
+                                glVertex3f(1, 0, 0);
+                                glEnd();
+
+                                if (renderingConfiguration.hasDrawTextures()) {
+                                    glDisable(GL_TEXTURE_2D);
+                                }
+                            }
+                            glPopMatrix();
                         }
                     }
-                    glPopMatrix();
                 }
             }
 
@@ -99,7 +128,6 @@ namespace opendlv {
                     m_originPixelXY(originPixelXY),
                     m_scalingPixelXY(scalingPixelXY),
                     m_rotationZ(rotationZ),
-                    m_textureHandle(0),
                     m_aerialImageNode(NULL),
                     m_aerialImageRenderer(NULL),
                     m_translateToTheCenterOfTheImage(NULL),
@@ -115,7 +143,6 @@ namespace opendlv {
                     m_originPixelXY(obj.m_originPixelXY),
                     m_scalingPixelXY(obj.m_scalingPixelXY),
                     m_rotationZ(obj.m_rotationZ),
-                    m_textureHandle(obj.m_textureHandle),
                     m_aerialImageNode(NULL),
                     m_aerialImageRenderer(NULL),
                     m_translateToTheCenterOfTheImage(NULL),
@@ -131,7 +158,6 @@ namespace opendlv {
                 m_originPixelXY = obj.m_originPixelXY;
                 m_scalingPixelXY = obj.m_scalingPixelXY;
                 m_rotationZ = obj.m_rotationZ;
-                m_textureHandle = obj.m_textureHandle;
 
                 // Setup aerial image renderer.
                 init();
@@ -157,15 +183,8 @@ namespace opendlv {
                     scale.setX(m_image->getWidth() * m_scalingPixelXY.getX());
                     scale.setY(m_image->getHeight() * m_scalingPixelXY.getY());
 
-                    // Create texture.
-                    TextureManager& tm = TextureManager::getInstance();
-                    tm.addImage("SCNX.AerialImage", m_image);
-                    int32_t textureHandle = tm.getTexture("SCNX.AerialImage");
-                    if (textureHandle > 0) {
-                        m_textureHandle = static_cast<uint32_t>(textureHandle);
-                        // Set up aerialImageRenderer.
-                        m_aerialImageRenderer = new AerialImageRenderer(getNodeDescriptor(), m_textureHandle);
-                    }
+                    // Set up aerialImageRenderer; the OpenGL texture is created when rendered first.
+                    m_aerialImageRenderer = new AerialImageRenderer(getNodeDescriptor(), m_image);
 
                     // Create transformation group for modifying the aerial image.
                     // The image is flipped by PI around the X-axis. Therefore,
@@ -31,6 +31,7 @@
 #include "opendlv/threeD/NodeDescriptor.h"
 #include "opendlv/threeD/NodeRenderingConfiguration.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
 #include "opendlv/threeD/models/CheckerBoard.h"
 
 namespace opendlv {
@@ -70,8 +71,8 @@ namespace opendlv {
 
             void CheckerBoard::render(RenderingConfiguration &renderingConfiguration) {
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
-                    glPushMatrix();
-                    {
+                    SoftwareRenderer *sr = renderingConfiguration.getSoftwareRenderer();
+                    if (sr != NULL) {
                         bool color = false;
                         uint32_t squares = 0;
                         double height = 0;
@@ -81,20 +82,19 @@ namespace opendlv {
                             squares = 0;
                             while (d > 0.1) {
                                 if (color) {
-                                    glColor3d(1, 1, 1);
+                                    sr->setColor(Point3(1, 1, 1));
                                 } else {
-                                    glColor3d(0.1, 0.1, 0.1);
+                                    sr->setColor(Point3(0.1, 0.1, 0.1));
                                 }
 
-                                glBegin(GL_QUADS);
-                                {
-                                    glVertex3d(p.getX(), p.getY(), height);
-                                    glVertex3d(p.getX(), p.getY(), height + 0.1);
-                                    p += Point3(0.1, 0, 0);
-                                    glVertex3d(p.getX(), p.getY(), height + 0.1);
-                                    glVertex3d(p.getX(), p.getY(), height);
-                                }
-                                glEnd();
+                                const Point3 A(p.getX(), p.getY(), height);
+                                const Point3 B(p.getX(), p.getY(), height + 0.1);
+                                p += Point3(0.1, 0, 0);
+                                const Point3 C(p.getX(), p.getY(), height + 0.1);
+                                const Point3 D(p.getX(), p.getY(), height);
+                                sr->addTriangle(A, B, C);
+                                sr->addTriangle(A, C, D);
+
                                 color = !color;
                                 d = p.getDistanceTo(m_positionB);
                                 squares++;
@@ -105,8 +105,45 @@ namespace opendlv {
                             height += 0.1;
                         }
                     }
+                    else {
+                        glPushMatrix();
+                        {
+                            bool color = false;
+                            uint32_t squares = 0;
+                            double height = 0;
+                            while (height < m_height) {
+                                Point3 p = m_positionA;
+                                double d = p.getDistanceTo(m_positionB);
+                                squares = 0;
+                                while (d > 0.1) {
+                                    if (color) {
+                                        glColor3d(1, 1, 1);
+                                    } else {
+                                        glColor3d(0.1, 0.1, 0.1);
+                                    }
+
+                                    glBegin(GL_QUADS);
+                                    {
+                                        glVertex3d(p.getX(), p.getY(), height);
+                                        glVertex3d(p.getX(), p.getY(), height + 0.1);
+                                        p += Point3(0.1, 0, 0);
+                                        glVertex3d(p.getX(), p.getY(), height + 0.1);
+                                        glVertex3d(p.getX(), p.getY(), height);
+                                    }
+                                    glEnd();
+                                    color = !color;
+                                    d = p.getDistanceTo(m_positionB);
+                                    squares++;
+                                }
+                                if ((squares % 2) == 0) {
+                                    color = !color;
+                                }
+                                height += 0.1;
+                            }
+                        }
 
-                    glPopMatrix();
+                        glPopMatrix();
+                    }
                 }
             }
         }
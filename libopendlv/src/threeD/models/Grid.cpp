@@ -26,16 +26,20 @@
 #include <string>
 
 #include "opendavinci/odcore/opendavinci.h"
+#include "opendlv/data/environment/Point3.h"
 #include "opendlv/threeD/Node.h"
 #include "opendlv/threeD/NodeDescriptor.h"
 #include "opendlv/threeD/NodeRenderingConfiguration.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
 #include "opendlv/threeD/models/Grid.h"
 
 namespace opendlv {
     namespace threeD {
         namespace models {
 
+            using namespace opendlv::data::environment;
+
             Grid::Grid(const NodeDescriptor &nodeDescriptor, const uint32_t &size, const float &lineWidth) :
                     Node(nodeDescriptor),
                     m_size(size),
@@ -57,29 +61,45 @@ namespace opendlv {
 
             void Grid::render(RenderingConfiguration &renderingConfiguration) {
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
-                    glPushMatrix();
-                    {
-                        glLineWidth(m_lineWidth);
-                        glColor3f(1, 1, 1);
-
-                        glBegin(GL_LINES);
+                    SoftwareRenderer *sr = renderingConfiguration.getSoftwareRenderer();
+                    if (sr != NULL) {
+                        sr->setColor(Point3(1, 1, 1));
                         int32_t size = m_size;
                         for (int32_t y = -size; y <= size; y++) {
                             for (int32_t x = -size; x <= size; x++) {
                                 // X-axis.
-                                glVertex3f(0, static_cast<float>(y), 0);
-                                glVertex3f(static_cast<float>(x), static_cast<float>(y), 0);
+                                sr->addLine(Point3(0, y, 0), Point3(x, y, 0), m_lineWidth);
 
                                 // Y-axis.
-                                glVertex3f(static_cast<float>(x), 0, 0);
-                                glVertex3f(static_cast<float>(x), static_cast<float>(y), 0);
+                                sr->addLine(Point3(x, 0, 0), Point3(x, y, 0), m_lineWidth);
                             }
                         }
-                        glEnd();
+                    }
+                    else {
+                        glPushMatrix();
+                        {
+                            glLineWidth(m_lineWidth);
+                            glColor3f(1, 1, 1);
+
+                            glBegin(GL_LINES);
+                            int32_t size = m_size;
+                            for (int32_t y = -size; y <= size; y++) {
+                                for (int32_t x = -size; x <= size; x++) {
+                                    // X-axis.
+                                    glVertex3f(0, static_cast<float>(y), 0);
+                                    glVertex3f(static_cast<float>(x), static_cast<float>(y), 0);
 
-                        glLineWidth(1);
+                                    // Y-axis.
+                                    glVertex3f(static_cast<float>(x), 0, 0);
+                                    glVertex3f(static_cast<float>(x), static_cast<float>(y), 0);
+                                }
+                            }
+                            glEnd();
+
+                            glLineWidth(1);
+                        }
+                        glPopMatrix();
                     }
-                    glPopMatrix();
                 }
             }
 
@@ -26,6 +26,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendlv/core/wrapper/Image.h"
@@ -34,6 +35,7 @@
 #include "opendlv/threeD/NodeDescriptor.h"
 #include "opendlv/threeD/NodeRenderingConfiguration.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
 #include "opendlv/threeD/models/HeightGrid.h"
 
 namespace opendlv {
@@ -43,29 +45,89 @@ namespace opendlv {
             using namespace odcore;
             using namespace opendlv::data::environment;
 
-            HeightGridRenderer::HeightGridRenderer(const NodeDescriptor &nodeDescriptor, const uint32_t &callList) :
+            HeightGridRenderer::HeightGridRenderer(const NodeDescriptor &nodeDescriptor, const uint32_t &width, const uint32_t &height, const vector<float> &elevation, const vector<float> &intensity) :
                     Node(nodeDescriptor),
-                    m_callList(callList) {}
+                    m_compiled(false),
+                    m_callList(0),
+                    m_width(width),
+                    m_height(height),
+                    m_elevation(elevation),
+                    m_intensity(intensity) {}
 
             HeightGridRenderer::HeightGridRenderer(const HeightGridRenderer &obj) :
                     Node(obj.getNodeDescriptor()),
-                    m_callList(obj.m_callList) {}
+                    m_compiled(obj.m_compiled),
+                    m_callList(obj.m_callList),
+                    m_width(obj.m_width),
+                    m_height(obj.m_height),
+                    m_elevation(obj.m_elevation),
+                    m_intensity(obj.m_intensity) {}
 
             HeightGridRenderer& HeightGridRenderer::operator=(const HeightGridRenderer &obj) {
                 setNodeDescriptor(obj.getNodeDescriptor());
+                m_compiled = obj.m_compiled;
                 m_callList = obj.m_callList;
+                m_width = obj.m_width;
+                m_height = obj.m_height;
+                m_elevation = obj.m_elevation;
+                m_intensity = obj.m_intensity;
                 return (*this);
             }
 
             HeightGridRenderer::~HeightGridRenderer() {}
 
+            void HeightGridRenderer::compile() const {
+                m_callList = glGenLists(1);
+                glNewList(m_callList, GL_COMPILE);
+                for (uint32_t y = 0; (y + 1) < m_height; y++) {
+                    glBegin(GL_TRIANGLE_STRIP);
+                    for (uint32_t x = 0; x < m_width; x++) {
+                        glColor3f(m_intensity[y * m_width + x], m_intensity[y * m_width + x], m_intensity[y * m_width + x]);
+
+                        glVertex3f(static_cast<float>(x), static_cast<float>(y), m_elevation[y * m_width + x]);
+                        glVertex3f(static_cast<float>(x), static_cast<float>(y + 1), m_elevation[(y + 1) * m_width + x]);
+                    }
+                    glEnd();
+                }
+                glEndList();
+                m_compiled = true;
+            }
+
             void HeightGridRenderer::render(RenderingConfiguration &renderingConfiguration) {
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
-                    glPushMatrix();
-                    {
-                        glCallList(m_callList);
+                    SoftwareRenderer *sr = renderingConfiguration.getSoftwareRenderer();
+                    if (sr != NULL) {
+                        for (uint32_t y = 0; (y + 1) < m_height; y++) {
+                            for (uint32_t x = 0; (x + 1) < m_width; x++) {
+                                const uint32_t i = y * m_width + x;
+                                const uint32_t j = i + m_width;
+
+                                const Point3 A(x, y, m_elevation[i]);
+                                const Point3 B(x, y + 1, m_elevation[j]);
+                                const Point3 C(x + 1, y, m_elevation[i + 1]);
+                                const Point3 D(x + 1, y + 1, m_elevation[j + 1]);
+
+                                // Like in the triangle strips, the upper row uses the colors of the lower one.
+                                const Point3 colorAB(m_intensity[i], m_intensity[i], m_intensity[i]);
+                                const Point3 colorCD(m_intensity[i + 1], m_intensity[i + 1], m_intensity[i + 1]);
+
+                                sr->addColoredTriangle(A, colorAB, B, colorAB, C, colorCD);
+                                sr->addColoredTriangle(B, colorAB, C, colorCD, D, colorCD);
+                            }
+                        }
+                    }
+                    else {
+                        // Use compiled lists.
+                        if (!m_compiled) {
+                            compile();
+                        }
+
+                        glPushMatrix();
+                        {
+                            glCallList(m_callList);
+                        }
+                        glPopMatrix();
                     }
-                    glPopMatrix();
                 }
             }
 
@@ -80,7 +142,6 @@ namespace opendlv {
                     m_ground(ground),
                     m_min(min),
                     m_max(max),
-                    m_callList(0),
                     m_heightImageNode(NULL),
                     m_heightImageRenderer(NULL) {
                 // Setup height grid renderer.
@@ -96,7 +157,6 @@ namespace opendlv {
                     m_ground(obj.m_ground),
                     m_min(obj.m_min),
                     m_max(obj.m_max),
-                    m_callList(obj.m_callList),
                     m_heightImageNode(NULL),
                     m_heightImageRenderer(NULL) {
                 // Setup height grid renderer.
@@ -183,19 +243,18 @@ namespace opendlv {
                     }
                     clog << "Ground height: " << m_ground << ", scaling Z : " << scaleZ << ", translation for z-direction: " << (-1 * scaleZ * m_ground) << endl;
 
-                    m_callList = glGenLists(1);
-                    glNewList(m_callList, GL_COMPILE);
-                    for (uint32_t y = 0; y < m_heightImage->getHeight() - 2; y++) {
-                        glBegin(GL_TRIANGLE_STRIP);
-                        for (uint32_t x = 0; x < m_heightImage->getWidth(); x++) {
-                            glColor3f(static_cast<int>(img.getPixel(x, m_heightImage->getHeight() - 1 - y)->r) / 255.0f, static_cast<int>(img.getPixel(x, m_heightImage->getHeight() - 1 - y)->r) / 255.0f, static_cast<int>(img.getPixel(x, m_heightImage->getHeight() - 1 - y)->r) / 255.0f);
-
-                            glVertex3f(static_cast<float>(x), static_cast<float>(y), (static_cast<int>(img.getPixel(x, m_heightImage->getHeight() - 1 - y)->r) / 255.0f - m_ground) * scaleZ);
-                            glVertex3f(static_cast<float>(x), static_cast<float>(y + 1), (static_cast<int>(img.getPixel(x, m_heightImage->getHeight() - 1 - (y + 1))->r) / 255.0f - m_ground) * scaleZ);
+                    // Grid points from the bottom row of the height image upwards.
+                    const uint32_t width = m_heightImage->getWidth();
+                    const uint32_t height = (m_heightImage->getHeight() > 1) ? (m_heightImage->getHeight() - 1) : 0;
+                    vector<float> elevation(width * height);
+                    vector<float> intensity(width * height);
+                    for (uint32_t y = 0; y < height; y++) {
+                        for (uint32_t x = 0; x < width; x++) {
+                            const float value = static_cast<int>(img.getPixel(x, m_heightImage->getHeight() - 1 - y)->r) / 255.0f;
+                            intensity[y * width + x] = value;
+                            elevation[y * width + x] = (value - m_ground) * scaleZ;
                         }
-                        glEnd();
                     }
-                    glEndList();
 
                     // Compute translation.
                     Point3 translate;
@@ -207,7 +266,7 @@ namespace opendlv {
                     scale.setZ(1.0);
 
                     // Set up the actual renderer.
-                    m_heightImageRenderer = new HeightGridRenderer(getNodeDescriptor(), m_callList);
+                    m_heightImageRenderer = new HeightGridRenderer(getNodeDescriptor(), width, height, elevation, intensity);
 
                     // Set up transform group.
                     m_heightImageNode = new TransformGroup();
@@ -30,6 +30,7 @@
 #include "opendlv/threeD/NodeDescriptor.h"
 #include "opendlv/threeD/NodeRenderingConfiguration.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
 #include "opendlv/threeD/models/Line.h"
 
 namespace opendlv {
@@ -67,19 +68,26 @@ namespace opendlv {
             void Line::render(RenderingConfiguration &renderingConfiguration) {
                 // Render if unnamed or not disabled.
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
-                    glPushMatrix();
-                    {
-                        glLineWidth(m_width);
-                        glColor3d(m_color.getX(), m_color.getY(), m_color.getZ());
+                    SoftwareRenderer *sr = renderingConfiguration.getSoftwareRenderer();
+                    if (sr != NULL) {
+                        sr->setColor(m_color);
+                        sr->addLine(m_positionA, m_positionB, m_width);
+                    }
+                    else {
+                        glPushMatrix();
+                        {
+                            glLineWidth(m_width);
+                            glColor3d(m_color.getX(), m_color.getY(), m_color.getZ());
 
-                        glBegin(GL_LINES);
-                        glVertex3d(m_positionA.getX(), m_positionA.getY(), m_positionA.getZ());
-                        glVertex3d(m_positionB.getX(), m_positionB.getY(), m_positionB.getZ());
-                        glEnd();
+                            glBegin(GL_LINES);
+                            glVertex3d(m_positionA.getX(), m_positionA.getY(), m_positionA.getZ());
+                            glVertex3d(m_positionB.getX(), m_positionB.getY(), m_positionB.getZ());
+                            glEnd();
 
-                        glLineWidth(1);
+                            glLineWidth(1);
+                        }
+                        glPopMatrix();
                     }
-                    glPopMatrix();
                 }
             }
 
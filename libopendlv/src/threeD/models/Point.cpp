@@ -30,6 +30,7 @@
 #include "opendlv/threeD/NodeDescriptor.h"
 #include "opendlv/threeD/NodeRenderingConfiguration.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
 #include "opendlv/threeD/models/Point.h"
 
 namespace opendlv {
@@ -63,18 +64,25 @@ namespace opendlv {
 
             void Point::render(RenderingConfiguration &renderingConfiguration) {
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
-                    glPushMatrix();
-                    {
-                        glPointSize(m_width);
-                        glColor3d(m_color.getX(), m_color.getY(), m_color.getZ());
+                    SoftwareRenderer *sr = renderingConfiguration.getSoftwareRenderer();
+                    if (sr != NULL) {
+                        sr->setColor(m_color);
+                        sr->addPoint(m_position, m_width);
+                    }
+                    else {
+                        glPushMatrix();
+                        {
+                            glPointSize(m_width);
+                            glColor3d(m_color.getX(), m_color.getY(), m_color.getZ());
 
-                        glBegin(GL_POINTS);
-                        glVertex3d(m_position.getX(), m_position.getY(), m_position.getZ());
-                        glEnd();
+                            glBegin(GL_POINTS);
+                            glVertex3d(m_position.getX(), m_position.getY(), m_position.getZ());
+                            glEnd();
 
-                        glPointSize(1);
+                            glPointSize(1);
+                        }
+                        glPopMatrix();
                     }
-                    glPopMatrix();
                 }
             }
 
@@ -32,6 +32,7 @@
 #include "opendlv/threeD/NodeDescriptor.h"
 #include "opendlv/threeD/NodeRenderingConfiguration.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
 #include "opendlv/threeD/models/Polygon.h"
 
 namespace opendlv {
@@ -71,45 +72,72 @@ namespace opendlv {
 
             void Polygon::render(RenderingConfiguration &renderingConfiguration) {
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
-                    glPushMatrix();
-                    {
-                        glColor3d(m_color.getX(), m_color.getY(), m_color.getZ());
-
-                        glBegin(GL_QUADS);
-                        for (uint32_t i = 0; i < m_listOfGroundVertices.size() - 1; i++) {
+                    SoftwareRenderer *sr = renderingConfiguration.getSoftwareRenderer();
+                    if (sr != NULL) {
+                        sr->setColor(m_color);
+                        for (uint32_t i = 0; (i + 1) < m_listOfGroundVertices.size(); i++) {
                             const Point3 &p1 = m_listOfGroundVertices[i];
                             const Point3 &p2 = m_listOfGroundVertices[i+1];
 
-                            Point3 P12 = p2 - p1;
-                            P12.setZ(0);
-                            const Point3 P1H = Point3(p1.getX(), p1.getY(), m_height);
-                            const Point3 P1HxP12 = P1H.cross(P12);
-
-                            glVertex3d(p1.getX(), p1.getY(), 0);
-                            glVertex3d(p1.getX(), p1.getY(), m_height);
-                            glVertex3d(p2.getX(), p2.getY(), m_height);
-                            glVertex3d(p2.getX(), p2.getY(), 0);
-                            glNormal3d(P1HxP12.getX(), P1HxP12.getY(), P1HxP12.getZ());
+                            const Point3 A(p1.getX(), p1.getY(), 0);
+                            const Point3 B(p1.getX(), p1.getY(), m_height);
+                            const Point3 C(p2.getX(), p2.getY(), m_height);
+                            const Point3 D(p2.getX(), p2.getY(), 0);
+                            sr->addTriangle(A, B, C);
+                            sr->addTriangle(A, C, D);
                         }
-                        glEnd();
 
-                        // Bottom of the polygon.
-                        glBegin(GL_POLYGON);
-                        for (uint32_t i = 0; i < m_listOfGroundVertices.size(); i++) {
-                            const Point3 &p1 = m_listOfGroundVertices[i];
-                            glVertex3d(p1.getX(), p1.getY(), 0);
-                        }
-                        glEnd();
+                        // Bottom and top of the polygon.
+                        for (uint32_t i = 2; i < m_listOfGroundVertices.size(); i++) {
+                            const Point3 &p0 = m_listOfGroundVertices[0];
+                            const Point3 &p1 = m_listOfGroundVertices[i-1];
+                            const Point3 &p2 = m_listOfGroundVertices[i];
 
-                        // Top of the polygon.
-                        glBegin(GL_POLYGON);
-                        for (uint32_t i = 0; i < m_listOfGroundVertices.size(); i++) {
-                            const Point3 &p1 = m_listOfGroundVertices[i];
-                            glVertex3d(p1.getX(), p1.getY(), m_height);
+                            sr->addTriangle(Point3(p0.getX(), p0.getY(), 0), Point3(p1.getX(), p1.getY(), 0), Point3(p2.getX(), p2.getY(), 0));
+                            sr->addTriangle(Point3(p0.getX(), p0.getY(), m_height), Point3(p1.getX(), p1.getY(), m_height), Point3(p2.getX(), p2.getY(), m_height));
+                        }
+                    }
+                    else {
+                        glPushMatrix();
+                        {
+                            glColor3d(m_color.getX(), m_color.getY(), m_color.getZ());
+
+                            glBegin(GL_QUADS);
+                            for (uint32_t i = 0; i < m_listOfGroundVertices.size() - 1; i++) {
+                                const Point3 &p1 = m_listOfGroundVertices[i];
+                                const Point3 &p2 = m_listOfGroundVertices[i+1];
+
+                                Point3 P12 = p2 - p1;
+                                P12.setZ(0);
+                                const Point3 P1H = Point3(p1.getX(), p1.getY(), m_height);
+                                const Point3 P1HxP12 = P1H.cross(P12);
+
+                                glVertex3d(p1.getX(), p1.getY(), 0);
+                                glVertex3d(p1.getX(), p1.getY(), m_height);
+                                glVertex3d(p2.getX(), p2.getY(), m_height);
+                                glVertex3d(p2.getX(), p2.getY(), 0);
+                                glNormal3d(P1HxP12.getX(), P1HxP12.getY(), P1HxP12.getZ());
+                            }
+                            glEnd();
+
+                            // Bottom of the polygon.
+                            glBegin(GL_POLYGON);
+                            for (uint32_t i = 0; i < m_listOfGroundVertices.size(); i++) {
+                                const Point3 &p1 = m_listOfGroundVertices[i];
+                                glVertex3d(p1.getX(), p1.getY(), 0);
+                            }
+                            glEnd();
+
+                            // Top of the polygon.
+                            glBegin(GL_POLYGON);
+                            for (uint32_t i = 0; i < m_listOfGroundVertices.size(); i++) {
+                                const Point3 &p1 = m_listOfGroundVertices[i];
+                                glVertex3d(p1.getX(), p1.getY(), m_height);
+                            }
+                            glEnd();
                         }
-                        glEnd();
+                        glPopMatrix();
                     }
-                    glPopMatrix();
                 }
             }
 
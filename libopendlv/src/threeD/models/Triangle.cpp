@@ -32,6 +32,7 @@
 #include "opendlv/threeD/NodeDescriptor.h"
 #include "opendlv/threeD/NodeRenderingConfiguration.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
 #include "opendlv/threeD/models/Triangle.h"
 
 namespace opendlv {
@@ -101,19 +102,27 @@ namespace opendlv {
 
             void Triangle::render(RenderingConfiguration &renderingConfiguration) {
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
-                    glPushMatrix();
-                    {
-                        glBegin(GL_TRIANGLES);
-                        glNormal3d(m_normal.getX(), m_normal.getY(), m_normal.getZ());
-                        for (uint32_t i = 0; i < 3; i++) {
-                            if (m_textureCoordinates.size() == 3) {
-                                glTexCoord2d(m_textureCoordinates[i].getX(), m_textureCoordinates[i].getY());
+                    SoftwareRenderer *sr = renderingConfiguration.getSoftwareRenderer();
+                    if (sr != NULL) {
+                        if (m_vertices.size() == 3) {
+                            sr->addTriangle(m_vertices[0], m_vertices[1], m_vertices[2]);
+                        }
+                    }
+                    else {
+                        glPushMatrix();
+                        {
+                            glBegin(GL_TRIANGLES);
+                            glNormal3d(m_normal.getX(), m_normal.getY(), m_normal.getZ());
+                            for (uint32_t i = 0; i < 3; i++) {
+                                if (m_textureCoordinates.size() == 3) {
+                                    glTexCoord2d(m_textureCoordinates[i].getX(), m_textureCoordinates[i].getY());
+                                }
+                                glVertex3d(m_vertices[i].getX(), m_vertices[i].getY(), m_vertices[i].getZ());
                             }
-                            glVertex3d(m_vertices[i].getX(), m_vertices[i].getY(), m_vertices[i].getZ());
+                            glEnd();
                         }
-                        glEnd();
+                        glPopMatrix();
                     }
-                    glPopMatrix();
                 }
             }
 
@@ -33,6 +33,7 @@
 #include "opendlv/threeD/NodeDescriptor.h"
 #include "opendlv/threeD/NodeRenderingConfiguration.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
 #include "opendlv/threeD/models/Triangle.h"
 #include "opendlv/threeD/models/TriangleSet.h"
 
@@ -125,63 +126,73 @@ namespace opendlv {
 
             void TriangleSet::render(RenderingConfiguration &renderingConfiguration) {
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
-                    glPushMatrix();
-                    {
-                        // Try to load an apropriate texture.
-                        int32_t textureHandle = m_material.getTextureHandle();
-
-                        if (textureHandle > 0) {
-                            if (renderingConfiguration.hasDrawTextures()) {
-                                glEnable(GL_TEXTURE_2D);
-                                glBindTexture(GL_TEXTURE_2D, static_cast<uint32_t>(textureHandle));
-                                glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_DECAL);
-                            }
+                    SoftwareRenderer *sr = renderingConfiguration.getSoftwareRenderer();
+                    if (sr != NULL) {
+                        // OpenGL textures are not available; use the diffuse color instead.
+                        sr->setColor(m_material.getDiffuse());
+                        for (uint32_t i = 0; (i + 2) < m_vertices.size(); i += 3) {
+                            sr->addTriangle(m_vertices[i], m_vertices[i + 1], m_vertices[i + 2]);
                         }
-                        else {
-                            glEnable(GL_COLOR_MATERIAL);
-                            glColorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE);
-                            float ambient[] = { static_cast<float>(m_material.getAmbient().getX()),
-                                                static_cast<float>(m_material.getAmbient().getY()),
-                                                static_cast<float>(m_material.getAmbient().getZ()) };
-//                            float ambient[] = { 0,
-//                                                0,
-//                                                0
-//                                              };
+                    }
+                    else {
+                        glPushMatrix();
+                        {
+                            // Try to load an apropriate texture.
+                            int32_t textureHandle = m_material.getTextureHandle();
+
+                            if (textureHandle > 0) {
+                                if (renderingConfiguration.hasDrawTextures()) {
+                                    glEnable(GL_TEXTURE_2D);
+                                    glBindTexture(GL_TEXTURE_2D, static_cast<uint32_t>(textureHandle));
+                                    glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_DECAL);
+                                }
+                            }
+                            else {
+                                glEnable(GL_COLOR_MATERIAL);
+                                glColorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE);
+                                float ambient[] = { static_cast<float>(m_material.getAmbient().getX()),
+                                                    static_cast<float>(m_material.getAmbient().getY()),
+                                                    static_cast<float>(m_material.getAmbient().getZ()) };
+    //                            float ambient[] = { 0,
+    //                                                0,
+    //                                                0
+    //                                              };
 
-                            glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, ambient);
+                                glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, ambient);
 
-                            float diffuse[] = { static_cast<float>(m_material.getDiffuse().getX()),
-                                                static_cast<float>(m_material.getDiffuse().getY()),
-                                                static_cast<float>(m_material.getDiffuse().getZ())
-                                              };
+                                float diffuse[] = { static_cast<float>(m_material.getDiffuse().getX()),
+                                                    static_cast<float>(m_material.getDiffuse().getY()),
+                                                    static_cast<float>(m_material.getDiffuse().getZ())
+                                                  };
 
-                            glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, diffuse);
+                                glMaterialfv(GL_FRONT_AND_BACK, GL_DIFFUSE, diffuse);
 
-                            float specular[] = { static_cast<float>(m_material.getSpecular().getX()),
-                                                static_cast<float>(m_material.getSpecular().getY()),
-                                                static_cast<float>(m_material.getSpecular().getZ()) };
+                                float specular[] = { static_cast<float>(m_material.getSpecular().getX()),
+                                                    static_cast<float>(m_material.getSpecular().getY()),
+                                                    static_cast<float>(m_material.getSpecular().getZ()) };
 
-                            glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, specular);
+                                glMaterialfv(GL_FRONT_AND_BACK, GL_SPECULAR, specular);
 
-                            glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, static_cast<float>(m_material.getShininess()));
+                                glMaterialf(GL_FRONT_AND_BACK, GL_SHININESS, static_cast<float>(m_material.getShininess()));
 
-                            glColor3d(m_material.getDiffuse().getX(), m_material.getDiffuse().getY(), m_material.getDiffuse().getZ());
-                        }
+                                glColor3d(m_material.getDiffuse().getX(), m_material.getDiffuse().getY(), m_material.getDiffuse().getZ());
+                            }
 
-                        // Use compiled lists.
-                        if (!m_compiled) {
-                            compile();
-                        }
+                            // Use compiled lists.
+                            if (!m_compiled) {
+                                compile();
+                            }
 
-                        glCallList(m_callList);
+                            glCallList(m_callList);
 
-                        if (textureHandle) {
-                            if (renderingConfiguration.hasDrawTextures()) {
-                                glDisable(GL_TEXTURE_2D);
+                            if (textureHandle) {
+                                if (renderingConfiguration.hasDrawTextures()) {
+                                    glDisable(GL_TEXTURE_2D);
+                                }
                             }
                         }
+                        glPopMatrix();
                     }
-                    glPopMatrix();
                 }
             }
         }
@@ -23,17 +23,23 @@
 
 #include <GL/gl.h>
 #include <string>
+#include <vector>
 
+#include "opendlv/data/environment/Point3.h"
 #include "opendlv/threeD/Node.h"
 #include "opendlv/threeD/NodeDescriptor.h"
 #include "opendlv/threeD/NodeRenderingConfiguration.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
 #include "opendlv/threeD/models/XYZAxes.h"
 
 namespace opendlv {
     namespace threeD {
         namespace models {
 
+            using namespace std;
+            using namespace opendlv::data::environment;
+
             XYZAxes::XYZAxes(const NodeDescriptor &nodeDescriptor) :
                     Node(nodeDescriptor),
                     m_lineWidth(1),
@@ -61,77 +67,93 @@ namespace opendlv {
             void XYZAxes::render(RenderingConfiguration &renderingConfiguration) {
                 // Render if unnamed or not disabled.
                 if ((getNodeDescriptor().getName().size() == 0) || (renderingConfiguration.getNodeRenderingConfiguration(getNodeDescriptor()).hasParameter(NodeRenderingConfiguration::ENABLED))) {
-                    glPushMatrix();
+                    // Pairs of vertices for the lines.
+                    vector<Point3> listOfVertices;
                     {
-                        glLineWidth(m_lineWidth);
-                        glColor3f(1, 1, 1);
-
-                        glBegin(GL_LINES);
                         // X-axis.
-                        glVertex3f(0, 0, 0);
-                        glVertex3f(m_lineLength, 0, 0);
+                        listOfVertices.push_back(Point3(0, 0, 0));
+                        listOfVertices.push_back(Point3(m_lineLength, 0, 0));
 
                         // Arrow.
-                        glVertex3f(m_lineLength, 0, 0);
-                        glVertex3f((m_lineLength - 0.1f), 0.1f, 0);
+                        listOfVertices.push_back(Point3(m_lineLength, 0, 0));
+                        listOfVertices.push_back(Point3((m_lineLength - 0.1f), 0.1f, 0));
 
-                        glVertex3f(m_lineLength, 0, 0);
-                        glVertex3f((m_lineLength - 0.1f), -0.1f, 0);
+                        listOfVertices.push_back(Point3(m_lineLength, 0, 0));
+                        listOfVertices.push_back(Point3((m_lineLength - 0.1f), -0.1f, 0));
 
                         // X-label.
-                        glVertex3f(-0.3f + (m_lineLength - 0.1f), -0.3f + 0.1f, 0);
-                        glVertex3f(-0.3f + (m_lineLength + 0.1f), -0.3f + -0.1f, 0);
+                        listOfVertices.push_back(Point3(-0.3f + (m_lineLength - 0.1f), -0.3f + 0.1f, 0));
+                        listOfVertices.push_back(Point3(-0.3f + (m_lineLength + 0.1f), -0.3f + -0.1f, 0));
 
-                        glVertex3f(-0.3f + (m_lineLength + 0.1f), -0.3f + 0.1f, 0);
-                        glVertex3f(-0.3f + (m_lineLength - 0.1f), -0.3f + -0.1f, 0);
+                        listOfVertices.push_back(Point3(-0.3f + (m_lineLength + 0.1f), -0.3f + 0.1f, 0));
+                        listOfVertices.push_back(Point3(-0.3f + (m_lineLength - 0.1f), -0.3f + -0.1f, 0));
 
                         // Y-axis
-                        glVertex3f(0, 0, 0);
-                        glVertex3f(0, m_lineLength, 0);
+                        listOfVertices.push_back(Point3(0, 0, 0));
+                        listOfVertices.push_back(Point3(0, m_lineLength, 0));
 
                         // Arrow.
-                        glVertex3f(0, m_lineLength, 0);
-                        glVertex3f(0.1f, (m_lineLength - 0.1f), 0);
+                        listOfVertices.push_back(Point3(0, m_lineLength, 0));
+                        listOfVertices.push_back(Point3(0.1f, (m_lineLength - 0.1f), 0));
 
-                        glVertex3f(0, m_lineLength, 0);
-                        glVertex3f(-0.1f, (m_lineLength - 0.1f), 0);
+                        listOfVertices.push_back(Point3(0, m_lineLength, 0));
+                        listOfVertices.push_back(Point3(-0.1f, (m_lineLength - 0.1f), 0));
 
                         // Y-label.
-                        glVertex3f(-0.3f + -0.1f, m_lineLength, 0);
-                        glVertex3f(-0.3f + 0, (m_lineLength - 0.1f), 0);
+                        listOfVertices.push_back(Point3(-0.3f + -0.1f, m_lineLength, 0));
+                        listOfVertices.push_back(Point3(-0.3f + 0, (m_lineLength - 0.1f), 0));
 
-                        glVertex3f(-0.3f + 0.1f, m_lineLength, 0);
-                        glVertex3f(-0.3f + 0, (m_lineLength - 0.1f), 0);
+                        listOfVertices.push_back(Point3(-0.3f + 0.1f, m_lineLength, 0));
+                        listOfVertices.push_back(Point3(-0.3f + 0, (m_lineLength - 0.1f), 0));
 
-                        glVertex3f(-0.3f + 0, (m_lineLength - 0.1f), 0);
-                        glVertex3f(-0.3f + 0, (m_lineLength - 0.2f), 0);
+                        listOfVertices.push_back(Point3(-0.3f + 0, (m_lineLength - 0.1f), 0));
+                        listOfVertices.push_back(Point3(-0.3f + 0, (m_lineLength - 0.2f), 0));
 
                         // Z-axis
-                        glVertex3f(0, 0, 0);
-                        glVertex3f(0, 0, m_lineLength);
+                        listOfVertices.push_back(Point3(0, 0, 0));
+                        listOfVertices.push_back(Point3(0, 0, m_lineLength));
 
                         // Arrow.
-                        glVertex3f(0, 0, m_lineLength);
-                        glVertex3f(0.1f, 0, (m_lineLength - 0.1f));
+                        listOfVertices.push_back(Point3(0, 0, m_lineLength));
+                        listOfVertices.push_back(Point3(0.1f, 0, (m_lineLength - 0.1f)));
 
-                        glVertex3f(0, 0, m_lineLength);
-                        glVertex3f(-0.1f, 0, (m_lineLength - 0.1f));
+                        listOfVertices.push_back(Point3(0, 0, m_lineLength));
+                        listOfVertices.push_back(Point3(-0.1f, 0, (m_lineLength - 0.1f)));
 
                         // Z-label.
-                        glVertex3f(-0.3f + -0.1f, 0, m_lineLength);
-                        glVertex3f(-0.3f + 0.1f, 0, m_lineLength);
-
-                        glVertex3f(-0.3f + 0.1f, 0, m_lineLength);
-                        glVertex3f(-0.3f + -0.1f, 0, (m_lineLength - 0.1f));
+                        listOfVertices.push_back(Point3(-0.3f + -0.1f, 0, m_lineLength));
+                        listOfVertices.push_back(Point3(-0.3f + 0.1f, 0, m_lineLength));
 
-                        glVertex3f(-0.3f + -0.1f, 0, (m_lineLength - 0.1f));
-                        glVertex3f(-0.3f + 0.1f, 0, (m_lineLength - 0.1f));
-                        glEnd();
+                        listOfVertices.push_back(Point3(-0.3f + 0.1f, 0, m_lineLength));
+                        listOfVertices.push_back(Point3(-0.3f + -0.1f, 0, (m_lineLength - 0.1f)));
 
-                        glLineWidth(1);
+                        listOfVertices.push_back(Point3(-0.3f + -0.1f, 0, (m_lineLength - 0.1f)));
+                        listOfVertices.push_back(Point3(-0.3f + 0.1f, 0, (m_lineLength - 0.1f)));
                     }
 
-                    glPopMatrix();
+                    SoftwareRenderer *sr = renderingConfiguration.getSoftwareRenderer();
+                    if (sr != NULL) {
+                        sr->setColor(Point3(1, 1, 1));
+                        for (uint32_t i = 0; (i + 1) < listOfVertices.size(); i += 2) {
+                            sr->addLine(listOfVertices[i], listOfVertices[i + 1], m_lineWidth);
+                        }
+                    }
+                    else {
+                        glPushMatrix();
+                        {
+                            glLineWidth(m_lineWidth);
+                            glColor3f(1, 1, 1);
+
+                            glBegin(GL_LINES);
+                            for (uint32_t i = 0; i < listOfVertices.size(); i++) {
+                                glVertex3d(listOfVertices[i].getX(), listOfVertices[i].getY(), listOfVertices[i].getZ());
+                            }
+                            glEnd();
+
+                            glLineWidth(1);
+                        }
+                        glPopMatrix();
+                    }
                 }
             }
 
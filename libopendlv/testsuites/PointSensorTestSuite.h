@@ -0,0 +1,234 @@
+/**
+ * libvehiclecontext - Models for simulating automotive systems.
+ * Copyright (C) 2012 - 2016 Christian Berger
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+#ifndef VEHICLECONTEXT_POINTSENSORTESTSUITE_H_
+#define VEHICLECONTEXT_POINTSENSORTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "automotivedata/generated/cartesian/Constants.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/data/environment/Polygon.h"
+#include "opendlv/vehiclecontext/model/PointSensor.h"
+#include "opendlv/vehiclecontext/model/SegmentGrid.h"
+
+using namespace std;
+using namespace opendlv::data::environment;
+using namespace opendlv::vehiclecontext::model;
+
+class PointSensorTest : public CxxTest::TestSuite {
+    public:
+        Polygon createBox(const double &x, const double &y, const double &size) {
+            Polygon p;
+            p.add(Point3(x, y, 0));
+            p.add(Point3(x + size, y, 0));
+            p.add(Point3(x + size, y + size, 0));
+            p.add(Point3(x, y + size, 0));
+            return p;
+        }
+
+        void testSegmentGrid() {
+            map<uint32_t, Polygon> mapOfPolygons;
+            mapOfPolygons[1] = createBox(0, 0, 1);
+            mapOfPolygons[2] = createBox(10, 10, 1);
+
+            SegmentGrid grid;
+            grid.build(mapOfPolygons);
+            TS_ASSERT(grid.getNumberOfSegments() == 8);
+
+            vector<uint32_t> segments;
+            grid.getSegmentsInside(-1, -1, 2, 2, segments);
+            TS_ASSERT(segments.size() == 4);
+            for (uint32_t i = 0; i < segments.size(); i++) {
+                TS_ASSERT(segments.at(i) < 4);
+            }
+
+            grid.getSegmentsInside(-1, -1, 20, 20, segments);
+            TS_ASSERT(segments.size() == 8);
+
+            grid.getSegmentsInside(30, 30, 40, 40, segments);
+            TS_ASSERT(segments.empty());
+
+            TS_ASSERT(grid.isInside(0.5, 0.5));
+            TS_ASSERT(grid.isInside(10.5, 10.5));
+            TS_ASSERT(!grid.isInside(5, 5));
+            TS_ASSERT(!grid.isInside(-0.5, 0.5));
+            TS_ASSERT(!grid.isInside(30, 30));
+
+            // Empty scenario.
+            map<uint32_t, Polygon> empty;
+            grid.build(empty);
+            TS_ASSERT(grid.getNumberOfSegments() == 0);
+            grid.getSegmentsInside(-1, -1, 20, 20, segments);
+            TS_ASSERT(segments.empty());
+            TS_ASSERT(!grid.isInside(0.5, 0.5));
+
+            // A line does not enclose anything.
+            map<uint32_t, Polygon> lines;
+            Polygon line;
+            line.add(Point3(1, -1, 0));
+            line.add(Point3(1, 1, 0));
+            lines[1] = line;
+            grid.build(lines);
+            TS_ASSERT(grid.getNumberOfSegments() == 1);
+            TS_ASSERT(!grid.isInside(0, 0));
+        }
+
+        void testDistance() {
+            map<uint32_t, Polygon> mapOfPolygons;
+            mapOfPolygons[1] = createBox(5, -1, 2);
+
+            SegmentGrid grid;
+            grid.build(mapOfPolygons);
+
+            // Sensor looking along the X-axis: The closest point is the
+            // middle of the box's front edge and not its corner (sqrt(26)).
+            PointSensor ps(0, "front", Point3(0, 0, 0), 0, 30, 10, 8, false, 0, 0);
+            ps.updateFOV(Point3(0, 0, 0), Point3(1, 0, 0));
+            TS_ASSERT_DELTA(ps.getDistance(grid), 5, 1e-6);
+
+            // Vehicle moved towards the obstacle.
+            ps.updateFOV(Point3(2, 0, 0), Point3(1, 0, 0));
+            TS_ASSERT_DELTA(ps.getDistance(grid), 3, 1e-6);
+
+            // Vehicle turned around.
+            ps.updateFOV(Point3(0, 0, 0), Point3(-1, 0, 0));
+            TS_ASSERT_DELTA(ps.getDistance(grid), -1, 1e-6);
+
+            // Obstacle beyond clampDistance.
+            ps.updateFOV(Point3(-4, 0, 0), Point3(1, 0, 0));
+            TS_ASSERT_DELTA(ps.getDistance(grid), -1, 1e-6);
+
+            // Sensor mounted on the left side of the vehicle.
+            PointSensor left(1, "left", Point3(0, 0, 0), 90, 30, 10, 8, false, 0, 0);
+            left.updateFOV(Point3(6, -5, 0), Point3(1, 0, 0));
+            TS_ASSERT_DELTA(left.getDistance(grid), 4, 1e-6);
+        }
+
+        void testDistanceInsideObstacle() {
+            map<uint32_t, Polygon> mapOfPolygons;
+            mapOfPolygons[1] = createBox(5, -1, 2);
+
+            SegmentGrid grid;
+
+            // An obstacle enclosing the entire FOV blocks the sensor.
+            mapOfPolygons[2] = createBox(-50, -50, 100);
+            grid.build(mapOfPolygons);
+            PointSensor ps(0, "front", Point3(0, 0, 0), 0, 30, 10, 8, false, 0, 0);
+            ps.updateFOV(Point3(0, 0, 0), Point3(1, 0, 0));
+            TS_ASSERT_DELTA(ps.getDistance(grid), 0, 1e-6);
+
+            // Sensor inside a small obstacle.
+            mapOfPolygons.erase(2);
+            grid.build(mapOfPolygons);
+            ps.updateFOV(Point3(6, 0, 0), Point3(-1, 0, 0));
+            TS_ASSERT_DELTA(ps.getDistance(grid), 0, 1e-6);
+
+            // Leaving the obstacle.
+            ps.updateFOV(Point3(8, 0, 0), Point3(1, 0, 0));
+            TS_ASSERT_DELTA(ps.getDistance(grid), -1, 1e-6);
+        }
+
+        void testDistanceToSmallObstacleBetweenRays() {
+            // A small obstacle between two rays is found by its vertices.
+            map<uint32_t, Polygon> mapOfPolygons;
+            const double angle = 0.25 * cartesian::Constants::DEG2RAD / PointSensor::RAYS_PER_DEGREE;
+            mapOfPolygons[1] = createBox(6 * cos(angle), 6 * sin(angle), 0.001);
+
+            SegmentGrid grid;
+            grid.build(mapOfPolygons);
+
+            PointSensor ps(0, "front", Point3(0, 0, 0), 0, 30, 10, 10, false, 0, 0);
+            ps.updateFOV(Point3(0, 0, 0), Point3(1, 0, 0));
+            TS_ASSERT_DELTA(ps.getDistance(grid), 6, 1e-6);
+        }
+
+        void testDistanceBenchmark() {
+            const uint32_t ITERATIONS = 100;
+
+            clog << endl;
+            for (uint32_t numberOfObstacles = 10; numberOfObstacles <= 10000; numberOfObstacles *= 10) {
+                // Obstacles on a regular lattice with 10m spacing.
+                const uint32_t perRow = static_cast<uint32_t>(ceil(sqrt(static_cast<double>(numberOfObstacles))));
+                map<uint32_t, Polygon> mapOfPolygons;
+                for (uint32_t i = 0; i < numberOfObstacles; i++) {
+                    mapOfPolygons[i + 1] = createBox((i % perRow) * 10.0 + 3, (i / perRow) * 10.0 + 3, 2);
+                }
+
+                const std::chrono::steady_clock::time_point beforeBuild = std::chrono::steady_clock::now();
+                SegmentGrid grid;
+                grid.build(mapOfPolygons);
+                const std::chrono::steady_clock::time_point afterBuild = std::chrono::steady_clock::now();
+
+                PointSensor ps(0, "front", Point3(0, 0, 0), 0, 30, 20, 20, false, 0, 0);
+
+                uint32_t hits = 0;
+                double durationIndexed = 0;
+                double durationAllPolygons = 0;
+                for (uint32_t i = 0; i < ITERATIONS; i++) {
+                    // Drive along the lattice while turning.
+                    const double position = (i * 0.37 * perRow) / ITERATIONS * 10.0;
+                    const double heading = i * 0.1;
+                    const Point3 sensorPosition(position, position * 0.5, 0);
+                    const Polygon FOV = ps.updateFOV(sensorPosition, Point3(cos(heading), sin(heading), 0));
+
+                    std::chrono::steady_clock::time_point before = std::chrono::steady_clock::now();
+                    const double distance = ps.getDistance(grid);
+                    std::chrono::steady_clock::time_point after = std::chrono::steady_clock::now();
+                    durationIndexed += std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count() / 1000.0;
+                    if (!(distance < 0)) {
+                        hits++;
+                    }
+
+                    // Reference: Intersect the FOV with every polygon and use the closest vertex of the intersections inside the FOV.
+                    double closestVertex = -1;
+                    before = std::chrono::steady_clock::now();
+                    map<uint32_t, Polygon>::const_iterator it = mapOfPolygons.begin();
+                    while (it != mapOfPolygons.end()) {
+                        const vector<Point3> listOfVertices = FOV.intersectIgnoreZ((it++)->second).getVertices();
+                        for (uint32_t j = 0; j < listOfVertices.size(); j++) {
+                            const double d = (listOfVertices.at(j) - sensorPosition).lengthXY();
+                            if (FOV.containsIgnoreZ(listOfVertices.at(j)) && ((closestVertex < 0) || (d < closestVertex))) {
+                                closestVertex = d;
+                            }
+                        }
+                    }
+                    after = std::chrono::steady_clock::now();
+                    durationAllPolygons += std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count() / 1000.0;
+
+                    // Both see the same obstacles but the closest point is never farther than the closest vertex.
+                    TS_ASSERT((distance < 0) == (closestVertex < 0));
+                    TS_ASSERT(distance < (closestVertex + 1e-6));
+                }
+                TS_ASSERT(hits > 0);
+
+                const double build = std::chrono::duration_cast<std::chrono::microseconds>(afterBuild - beforeBuild).count() / 1000.0;
+                clog << "PointSensor: " << numberOfObstacles << " obstacles, build " << build << "ms, "
+                     << (durationIndexed / ITERATIONS) << "us per distance (intersecting all polygons: " << (durationAllPolygons / ITERATIONS) << "us)." << endl;
+            }
+        }
+};
+
+#endif /*VEHICLECONTEXT_POINTSENSORTESTSUITE_H_*/
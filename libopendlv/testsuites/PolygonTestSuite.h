@@ -0,0 +1,354 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_POLYGONTESTSUITE_H_
+#define HESPERIA_POLYGONTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include "opendlv/data/environment/Line.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/data/environment/Polygon.h"
+#include "opendlv/data/environment/PolygonXY.h"
+
+using namespace std;
+using namespace opendlv::data::environment;
+
+/**
+ * Implementation of Polygon's algorithms on vector<Point3> and Line
+ * as before PolygonXY to compare results and run times.
+ */
+class PolygonTestReference {
+    public:
+        static bool containsIgnoreZ(const vector<Point3> &vertices, const Point3 &p) {
+            const double EPSILON = 1e-10;
+            bool retVal = false;
+
+            if (vertices.size() > 0) {
+                Point3 oldPoint = vertices.back();
+                Point3 currentPoint;
+
+                int32_t alpha = 0;
+                int32_t quadrant = 0;
+                int32_t currentQuadrant = 0;
+
+                if ( (oldPoint.getY() < p.getY()) || (oldPoint.getY() - p.getY() < EPSILON) ) {
+                    quadrant = ( (oldPoint.getX() < p.getX()) || (oldPoint.getX() - p.getX() < EPSILON) ) ? 0 : 1;
+                }
+                else {
+                    quadrant = ( (oldPoint.getX() <= p.getX()) || (oldPoint.getX() - p.getX() < EPSILON) ) ? 3 : 2;
+                }
+
+                for(uint32_t i = 0; i < vertices.size(); i++) {
+                    currentPoint = vertices.at(i);
+
+                    if ( (currentPoint.getY() < p.getY()) || (currentPoint.getY() - p.getY() < EPSILON) ) {
+                        currentQuadrant = ( (currentPoint.getX() < p.getX()) || (currentPoint.getX() - p.getX() < EPSILON) ) ? 0 : 1;
+                    }
+                    else {
+                        currentQuadrant = ( (currentPoint.getX() < p.getX()) || (currentPoint.getX() - p.getX() < EPSILON) ) ? 3 : 2;
+                    }
+
+                    switch ((currentQuadrant - quadrant) & 3) {
+                        case 0:
+                        break;
+                        case 1:
+                            alpha++;
+                        break;
+                        case 3:
+                            alpha--;
+                        break;
+                        default: {
+                            const double nominator = (currentPoint.getX() - oldPoint.getX()) * (p.getY() - oldPoint.getY());
+                            const double denominator = (currentPoint.getY() - oldPoint.getY());
+                            if (fabs(denominator) > EPSILON) {
+                                const double value = nominator / denominator + oldPoint.getX();
+
+                                if (fabs(p.getX() - value) < EPSILON) {
+                                    return false;
+                                }
+
+                                if ( (p.getX() > value) == (currentPoint.getY() > oldPoint.getY()) ) {
+                                    alpha -= 2;
+                                }
+                                else {
+                                    alpha += 2;
+                                }
+                            }
+                        }
+                    }
+
+                    oldPoint = currentPoint;
+                    quadrant = currentQuadrant;
+                }
+
+                retVal = ((alpha == 4) || (alpha == -4));
+            }
+
+            return retVal;
+        }
+
+        static Polygon intersectIgnoreZ(const vector<Point3> &thisVertices, const vector<Point3> &otherVertices) {
+            Polygon result;
+
+            vector<Point3> thisPolygon = thisVertices;
+            vector<Point3> otherPolygon = otherVertices;
+
+            if ( (thisPolygon.size() > 0) && (otherPolygon.size() > 0) ) {
+                thisPolygon.push_back((*thisPolygon.begin()));
+                otherPolygon.push_back((*otherPolygon.begin()));
+
+                for(uint32_t i = 0; i < thisPolygon.size() - 1; i++) {
+                    Line thisLine(thisPolygon.at(i), thisPolygon.at(i+1));
+
+                    for(uint32_t j = 0; j < otherPolygon.size() - 1; j++) {
+                        Line otherLine(otherPolygon.at(j), otherPolygon.at(j+1));
+
+                        Point3 p;
+                        if (thisLine.intersectIgnoreZ(otherLine, p)) {
+                            result.add(p);
+                        }
+                    }
+                }
+
+                for(uint32_t j = 0; j < otherPolygon.size()-1; j++) {
+                    if (containsIgnoreZ(thisVertices, otherPolygon.at(j))) {
+                        result.add(otherPolygon.at(j));
+                    }
+                }
+
+                result.sort();
+            }
+
+            return result;
+        }
+
+        static bool isSmallerAngle(const Point3 &point, const Point3 &p1, const Point3 &p2) {
+            return ((p1-point).getAngleXY() < (p2-point).getAngleXY());
+        }
+
+        static Polygon getVisiblePolygonIgnoreZ(const vector<Point3> &vertices, const Point3 &point) {
+            vector<Point3> result;
+
+            if (vertices.size() > 0) {
+                vector<Point3> cyclic = vertices;
+                cyclic.push_back((*cyclic.begin()));
+
+                for(uint32_t i = 0; i < vertices.size(); i++) {
+                    Line viewingPositionLine(point, vertices.at(i));
+
+                    bool visible = true;
+                    for(uint32_t j = 0; j < cyclic.size() - 1; j++) {
+                        if ((i == j) || (i == j+1)) {
+                            continue;
+                        }
+
+                        Line side(cyclic.at(j), cyclic.at(j+1));
+                        Point3 p;
+                        if (viewingPositionLine.intersectIgnoreZ(side, p)) {
+                            visible = false;
+                        }
+                    }
+
+                    if (visible) {
+                        result.push_back(vertices.at(i));
+                    }
+                }
+
+                std::sort(result.begin(), result.end(), std::bind(&PolygonTestReference::isSmallerAngle, point, std::placeholders::_1, std::placeholders::_2));
+            }
+
+            return Polygon(result);
+        }
+};
+
+class PolygonTest : public CxxTest::TestSuite {
+    public:
+        PolygonTest() :
+            m_seed(1) {}
+
+        double random(const double &range) {
+            m_seed = m_seed * 1103515245 + 12345;
+            return ((m_seed >> 8) & 0xFFFF) / 65535.0 * range;
+        }
+
+        /**
+         * Vertices on a coarse grid to provoke collinear, touching,
+         * and duplicated cases; the polygon is not sorted.
+         */
+        Polygon createPolygon(const uint32_t &size, const bool &onGrid) {
+            Polygon p;
+            for (uint32_t i = 0; i < size; i++) {
+                if (onGrid) {
+                    p.add(Point3(floor(random(8)), floor(random(8)), random(1)));
+                }
+                else {
+                    p.add(Point3(random(10), random(10), random(1)));
+                }
+            }
+            return p;
+        }
+
+        bool isEqual(const vector<Point3> &a, const vector<Point3> &b) {
+            if (a.size() != b.size()) {
+                return false;
+            }
+            for (uint32_t i = 0; i < a.size(); i++) {
+                // Bitwise identical results are expected.
+                if ( (a.at(i).getX() != b.at(i).getX()) || (a.at(i).getY() != b.at(i).getY()) || (a.at(i).getZ() != b.at(i).getZ()) ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void testPolygonXY() {
+            PolygonXY p;
+            TS_ASSERT(p.getSize() == 0);
+            TS_ASSERT(!p.containsIgnoreZ(0, 0));
+
+            p.add(0, 0);
+            p.add(2, 0);
+            p.add(2, 2);
+            p.add(0, 2);
+            TS_ASSERT(p.getSize() == 4);
+            TS_ASSERT_DELTA(p.getX(4), 0, 1e-10);
+            TS_ASSERT_DELTA(p.getY(3), 2, 1e-10);
+
+            TS_ASSERT(p.containsIgnoreZ(1, 1));
+            TS_ASSERT(!p.containsIgnoreZ(3, 1));
+
+            vector<uint8_t> hits;
+            vector<double> x;
+            vector<double> y;
+            p.intersectEdgesIgnoreZ(1, -1, 1, 3, hits, x, y);
+            TS_ASSERT(hits.size() == 4);
+            TS_ASSERT(hits[0] != 0);
+            TS_ASSERT(hits[1] == 0);
+            TS_ASSERT(hits[2] != 0);
+            TS_ASSERT(hits[3] == 0);
+            TS_ASSERT_DELTA(x[0], 1, 1e-10);
+            TS_ASSERT_DELTA(y[0], 0, 1e-10);
+            TS_ASSERT_DELTA(x[2], 1, 1e-10);
+            TS_ASSERT_DELTA(y[2], 2, 1e-10);
+
+            p.clear();
+            TS_ASSERT(p.getSize() == 0);
+        }
+
+        void testPolygonMatchesReference() {
+            for (uint32_t run = 0; run < 400; run++) {
+                const bool onGrid = (run % 2 == 0);
+                const Polygon a = createPolygon(1 + (run % 13), onGrid);
+                const Polygon b = createPolygon(1 + ((run * 7) % 11), onGrid);
+
+                for (uint32_t k = 0; k < 20; k++) {
+                    const Point3 p = onGrid ? Point3(floor(random(9)), floor(random(9)), 0) : Point3(random(10), random(10), 0);
+                    TS_ASSERT(a.containsIgnoreZ(p) == PolygonTestReference::containsIgnoreZ(a.getVertices(), p));
+
+                    TS_ASSERT(isEqual(a.getVisiblePolygonIgnoreZ(p).getVertices(), PolygonTestReference::getVisiblePolygonIgnoreZ(a.getVertices(), p).getVertices()));
+                }
+
+                TS_ASSERT(isEqual(a.intersectIgnoreZ(b).getVertices(), PolygonTestReference::intersectIgnoreZ(a.getVertices(), b.getVertices()).getVertices()));
+            }
+        }
+
+        void testPolygonBenchmark() {
+            const uint32_t ITERATIONS = 200;
+
+            clog << endl;
+            for (uint32_t size = 4; size <= 256; size *= 4) {
+                const Polygon a = createPolygon(size, false);
+                const Polygon b = createPolygon(size, false);
+                const vector<Point3> verticesA = a.getVertices();
+                const vector<Point3> verticesB = b.getVertices();
+
+                vector<Point3> points;
+                for (uint32_t i = 0; i < ITERATIONS; i++) {
+                    points.push_back(Point3(random(10), random(10), 0));
+                }
+
+                uint32_t inside = 0;
+                uint32_t insideReference = 0;
+                std::chrono::steady_clock::time_point before = std::chrono::steady_clock::now();
+                for (uint32_t i = 0; i < ITERATIONS; i++) {
+                    inside += a.containsIgnoreZ(points.at(i)) ? 1 : 0;
+                }
+                std::chrono::steady_clock::time_point after = std::chrono::steady_clock::now();
+                const double contains = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count() / 1000.0 / ITERATIONS;
+
+                before = std::chrono::steady_clock::now();
+                for (uint32_t i = 0; i < ITERATIONS; i++) {
+                    insideReference += PolygonTestReference::containsIgnoreZ(verticesA, points.at(i)) ? 1 : 0;
+                }
+                after = std::chrono::steady_clock::now();
+                const double containsReference = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count() / 1000.0 / ITERATIONS;
+                TS_ASSERT(inside == insideReference);
+
+                const uint32_t INTERSECTIONS = max(static_cast<uint32_t>(1), ITERATIONS / size);
+                uint32_t vertices = 0;
+                uint32_t verticesReference = 0;
+                before = std::chrono::steady_clock::now();
+                for (uint32_t i = 0; i < INTERSECTIONS; i++) {
+                    vertices += a.intersectIgnoreZ(b).getSize();
+                }
+                after = std::chrono::steady_clock::now();
+                const double intersect = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count() / 1000.0 / INTERSECTIONS;
+
+                before = std::chrono::steady_clock::now();
+                for (uint32_t i = 0; i < INTERSECTIONS; i++) {
+                    verticesReference += PolygonTestReference::intersectIgnoreZ(verticesA, verticesB).getSize();
+                }
+                after = std::chrono::steady_clock::now();
+                const double intersectReference = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count() / 1000.0 / INTERSECTIONS;
+                TS_ASSERT(vertices == verticesReference);
+
+                before = std::chrono::steady_clock::now();
+                for (uint32_t i = 0; i < INTERSECTIONS; i++) {
+                    vertices += a.getVisiblePolygonIgnoreZ(points.at(i)).getSize();
+                }
+                after = std::chrono::steady_clock::now();
+                const double visible = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count() / 1000.0 / INTERSECTIONS;
+
+                before = std::chrono::steady_clock::now();
+                for (uint32_t i = 0; i < INTERSECTIONS; i++) {
+                    verticesReference += PolygonTestReference::getVisiblePolygonIgnoreZ(verticesA, points.at(i)).getSize();
+                }
+                after = std::chrono::steady_clock::now();
+                const double visibleReference = std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count() / 1000.0 / INTERSECTIONS;
+                TS_ASSERT(vertices == verticesReference);
+
+                clog << "Polygon with " << size << " vertices: containsIgnoreZ " << contains << "us (before: " << containsReference << "us), "
+                     << "intersectIgnoreZ " << intersect << "us (before: " << intersectReference << "us), "
+                     << "getVisiblePolygonIgnoreZ " << visible << "us (before: " << visibleReference << "us)." << endl;
+            }
+        }
+
+    private:
+        uint32_t m_seed;
+};
+
+#endif /*HESPERIA_POLYGONTESTSUITE_H_*/
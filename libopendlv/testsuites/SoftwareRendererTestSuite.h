@@ -0,0 +1,364 @@
+/**
+ * OpenDLV - Simulation environment
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef HESPERIA_SOFTWARERENDERERTESTSUITE_H_
+#define HESPERIA_SOFTWARERENDERERTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "automotivedata/generated/cartesian/Constants.h"
+#include "opendlv/core/wrapper/Image.h"
+#include "opendlv/data/environment/Point3.h"
+#include "opendlv/threeD/NodeDescriptor.h"
+#include "opendlv/threeD/RenderingConfiguration.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
+#include "opendlv/threeD/TransformGroup.h"
+#include "opendlv/threeD/models/AerialImage.h"
+#include "opendlv/threeD/models/Line.h"
+#include "opendlv/threeD/models/Polygon.h"
+
+using namespace std;
+using namespace opendlv::data::environment;
+using namespace opendlv::threeD;
+using namespace opendlv::threeD::models;
+
+/**
+ * Image in main memory to be used as texture.
+ */
+class SoftwareRendererTestImage : public core::wrapper::Image {
+    public:
+        SoftwareRendererTestImage(const uint32_t &width, const uint32_t &height) :
+            m_width(width),
+            m_height(height),
+            m_data(width * height * 3, 0) {}
+
+        virtual FORMAT getFormat() const { return BGR_24BIT; }
+        virtual void setFormat(const FORMAT &/*format*/) {}
+        virtual uint32_t getWidth() const { return m_width; }
+        virtual uint32_t getHeight() const { return m_height; }
+        virtual uint32_t getWidthStep() const { return m_width * 3; }
+        virtual char* getRawData() const { return const_cast<char*>(&m_data[0]); }
+        virtual void rotate(const float &/*rad*/) {}
+        virtual void flipHorizontally() {}
+        virtual void flipVertically() {}
+
+        void setPixel(const uint32_t &x, const uint32_t &y, const uint8_t &b, const uint8_t &g, const uint8_t &r) {
+            m_data[3 * (y * m_width + x) + 0] = static_cast<char>(b);
+            m_data[3 * (y * m_width + x) + 1] = static_cast<char>(g);
+            m_data[3 * (y * m_width + x) + 2] = static_cast<char>(r);
+        }
+
+    private:
+        uint32_t m_width;
+        uint32_t m_height;
+        vector<char> m_data;
+};
+
+class SoftwareRendererTest : public CxxTest::TestSuite {
+    public:
+        bool hasColor(const vector<uint8_t> &image, const uint32_t &width, const uint32_t &x, const uint32_t &y, const uint8_t &r, const uint8_t &g, const uint8_t &b) {
+            const uint8_t *pixel = &image[3 * (y * width + x)];
+            return (pixel[0] == b) && (pixel[1] == g) && (pixel[2] == r);
+        }
+
+        void testTriangleAndDepth() {
+            // Without projection, the vertices are given in normalized device coordinates.
+            SoftwareRenderer sr(64, 48, 1);
+            vector<uint8_t> image(64 * 48 * 3);
+
+            sr.clear(Point3(0, 0, 1));
+            sr.setColor(Point3(1, 0, 0));
+            sr.addTriangle(Point3(-0.5, -0.5, 0), Point3(0.5, -0.5, 0), Point3(0, 0.5, 0));
+            TS_ASSERT(sr.getNumberOfTriangles() == 1);
+            sr.render(&image[0]);
+
+            TS_ASSERT(hasColor(image, 64, 32, 24, 255, 0, 0));
+            TS_ASSERT(hasColor(image, 64, 0, 0, 0, 0, 255));
+            TS_ASSERT(hasColor(image, 64, 63, 47, 0, 0, 255));
+            // The tip is at the top of the image.
+            TS_ASSERT(hasColor(image, 64, 32, 14, 255, 0, 0));
+            TS_ASSERT(hasColor(image, 64, 32, 10, 0, 0, 255));
+
+            // The nearer triangle remains visible regardless of the order.
+            sr.clear(Point3(0, 0, 0));
+            sr.setColor(Point3(0, 1, 0));
+            sr.addTriangle(Point3(-1, -1, -0.5), Point3(1, -1, -0.5), Point3(0, 1, -0.5));
+            sr.setColor(Point3(1, 0, 0));
+            sr.addTriangle(Point3(-1, -1, 0.5), Point3(1, -1, 0.5), Point3(0, 1, 0.5));
+            sr.render(&image[0]);
+            TS_ASSERT(hasColor(image, 64, 32, 24, 0, 255, 0));
+
+            // Primitives behind the far plane or in front of the near plane are removed.
+            sr.clear(Point3(0, 0, 0));
+            sr.addTriangle(Point3(-1, -1, 1.5), Point3(1, -1, 1.5), Point3(0, 1, 1.5));
+            sr.addTriangle(Point3(-1, -1, -1.5), Point3(1, -1, -1.5), Point3(0, 1, -1.5));
+            TS_ASSERT(sr.getNumberOfTriangles() == 1);
+            sr.render(&image[0]);
+            TS_ASSERT(hasColor(image, 64, 32, 24, 0, 0, 0));
+        }
+
+        void testNoGapsBetweenAdjacentTriangles() {
+            SoftwareRenderer sr(97, 61, 1);
+            vector<uint8_t> image(97 * 61 * 3);
+
+            // Fan of triangles around an arbitrary center covering the image.
+            sr.clear(Point3(0, 0, 0));
+            sr.setColor(Point3(1, 1, 1));
+            const Point3 center(0.123, -0.0456, 0);
+            const uint32_t SEGMENTS = 37;
+            for (uint32_t i = 0; i < SEGMENTS; i++) {
+                const double a = 2 * cartesian::Constants::PI * i / SEGMENTS;
+                const double b = 2 * cartesian::Constants::PI * (i + 1) / SEGMENTS;
+                sr.addTriangle(center, Point3(3 * cos(a), 3 * sin(a), 0), Point3(3 * cos(b), 3 * sin(b), 0));
+            }
+            sr.render(&image[0]);
+
+            uint32_t gaps = 0;
+            for (uint32_t i = 0; i < image.size(); i++) {
+                gaps += (image[i] != 255) ? 1 : 0;
+            }
+            TS_ASSERT(gaps == 0);
+        }
+
+        void testSharedEdgesAreDrawnOnce() {
+            SoftwareRenderer sr(16, 16, 1);
+            vector<uint8_t> image(16 * 16 * 3);
+
+            // Fan around a pixel center; the horizontal, vertical, and diagonal
+            // edges run through pixel centers. Screen coordinates are used here.
+            const double fan[9][2] = { { 8.5, -0.5 }, { 17.5, -0.5 }, { 17.5, 8.5 }, { 17.5, 17.5 },
+                                       { 8.5, 17.5 }, { -0.5, 17.5 }, { -0.5, 8.5 }, { -0.5, -0.5 }, { 8.5, -0.5 } };
+
+            vector<uint32_t> coverage(16 * 16, 0);
+            for (uint32_t i = 0; i < 8; i++) {
+                const Point3 center(8.5 / 8 - 1, 1 - 8.5 / 8, 0);
+                const Point3 a(fan[i][0] / 8 - 1, 1 - fan[i][1] / 8, 0);
+                const Point3 b(fan[i + 1][0] / 8 - 1, 1 - fan[i + 1][1] / 8, 0);
+
+                // Draw each triangle alone to count how often every pixel is covered.
+                sr.clear(Point3(0, 0, 0));
+                sr.setColor(Point3(1, 1, 1));
+                if ((i % 2) == 0) {
+                    sr.addTriangle(center, a, b);
+                }
+                else {
+                    sr.addTriangle(center, b, a);
+                }
+                sr.render(&image[0]);
+
+                for (uint32_t j = 0; j < coverage.size(); j++) {
+                    coverage[j] += (image[3 * j] == 255) ? 1 : 0;
+                }
+            }
+
+            uint32_t pixelsNotCoveredOnce = 0;
+            for (uint32_t j = 0; j < coverage.size(); j++) {
+                pixelsNotCoveredOnce += (coverage[j] != 1) ? 1 : 0;
+            }
+            TS_ASSERT(pixelsNotCoveredOnce == 0);
+        }
+
+        void testTexture() {
+            SoftwareRendererTestImage texture(2, 2);
+            texture.setPixel(0, 0, 255, 0, 0);
+            texture.setPixel(1, 0, 0, 255, 0);
+            texture.setPixel(0, 1, 0, 0, 255);
+            texture.setPixel(1, 1, 255, 255, 255);
+
+            SoftwareRenderer sr(40, 40, 1);
+            vector<uint8_t> image(40 * 40 * 3);
+
+            sr.clear(Point3(0, 0, 0));
+            sr.setTexture(&texture);
+            sr.addTexturedTriangle(Point3(-1, -1, 0), Point3(0, 0, 0), Point3(1, -1, 0), Point3(1, 0, 0), Point3(1, 1, 0), Point3(1, 1, 0));
+            sr.addTexturedTriangle(Point3(-1, -1, 0), Point3(0, 0, 0), Point3(1, 1, 0), Point3(1, 1, 0), Point3(-1, 1, 0), Point3(0, 1, 0));
+            sr.setTexture(NULL);
+            sr.render(&image[0]);
+
+            // The first texture row is at the bottom of the image like in OpenGL.
+            TS_ASSERT(hasColor(image, 40, 10, 30, 0, 0, 255));
+            TS_ASSERT(hasColor(image, 40, 30, 30, 0, 255, 0));
+            TS_ASSERT(hasColor(image, 40, 10, 10, 255, 0, 0));
+            TS_ASSERT(hasColor(image, 40, 30, 10, 255, 255, 255));
+        }
+
+        void testPerspectiveAndSceneGraph() {
+            SoftwareRenderer sr(64, 48, 2);
+            vector<uint8_t> image(64 * 48 * 3);
+
+            // Box in front of the camera looking along the X-axis.
+            vector<Point3> box;
+            box.push_back(Point3(4, -1, 0));
+            box.push_back(Point3(6, -1, 0));
+            box.push_back(Point3(6, 1, 0));
+            box.push_back(Point3(4, 1, 0));
+
+            TransformGroup root;
+            root.addChild(new opendlv::threeD::models::Polygon(NodeDescriptor(), box, Point3(1, 0, 0), 3));
+            root.addChild(new Line(NodeDescriptor(), Point3(2, -5, 0), Point3(2, 5, 0), Point3(1, 1, 0), 3));
+
+            RenderingConfiguration r;
+            r.setSoftwareRenderer(&sr);
+
+            sr.setPerspective(60, 64.0 / 48.0, 1, 20);
+            sr.clear(Point3(0, 0, 0));
+            sr.loadIdentity();
+            sr.lookAt(Point3(0, 0, 1), Point3(1, 0, 1), Point3(0, 0, 1));
+            root.render(r);
+            sr.render(&image[0]);
+
+            TS_ASSERT(hasColor(image, 64, 32, 20, 255, 0, 0));
+            TS_ASSERT(hasColor(image, 64, 0, 20, 0, 0, 0));
+
+            // The line on the ground is below the box.
+            uint32_t yellow = 0;
+            for (uint32_t y = 24; y < 48; y++) {
+                yellow += hasColor(image, 64, 32, y, 255, 255, 0) ? 1 : 0;
+            }
+            TS_ASSERT(yellow >= 3);
+
+            // Moving the scene graph moves the box out of sight.
+            root.setTranslation(Point3(0, 30, 0));
+            sr.clear(Point3(0, 0, 0));
+            root.render(r);
+            sr.render(&image[0]);
+            TS_ASSERT(hasColor(image, 64, 32, 20, 0, 0, 0));
+        }
+
+        /**
+         * This method creates a scene like Track.scnx: An aerial
+         * image as ground, lane markings, and some obstacles.
+         */
+        TransformGroup* createTrackLikeScene(const core::wrapper::Image *aerialImage) {
+            TransformGroup *root = new TransformGroup();
+            // The aerial image covers 200m x 200m around the origin.
+            const Point3 origin(aerialImage->getWidth() / 2, aerialImage->getHeight() / 2, 0);
+            const Point3 scaling(200.0 / aerialImage->getWidth(), 200.0 / aerialImage->getHeight(), 0);
+            root->addChild(new AerialImage(NodeDescriptor("AerialImage"), aerialImage, origin, scaling, 0));
+
+            const double RADIUS = 60;
+            const uint32_t SEGMENTS = 360;
+            for (uint32_t i = 0; i < SEGMENTS; i++) {
+                const double a = 2 * cartesian::Constants::PI * i / SEGMENTS;
+                const double b = 2 * cartesian::Constants::PI * (i + 1) / SEGMENTS;
+                for (int32_t lane = -1; lane <= 1; lane++) {
+                    const double radius = RADIUS + lane * 2.0;
+                    root->addChild(new Line(NodeDescriptor(), Point3(radius * cos(a), radius * sin(a), 0), Point3(radius * cos(b), radius * sin(b), 0), Point3(1, 1, 1), 5));
+                }
+            }
+
+            for (uint32_t i = 0; i < 40; i++) {
+                const double a = 2 * cartesian::Constants::PI * i / 40;
+                const double x = (RADIUS + 5) * cos(a);
+                const double y = (RADIUS + 5) * sin(a);
+
+                vector<Point3> box;
+                box.push_back(Point3(x - 0.5, y - 0.5, 0));
+                box.push_back(Point3(x + 0.5, y - 0.5, 0));
+                box.push_back(Point3(x + 0.5, y + 0.5, 0));
+                box.push_back(Point3(x - 0.5, y + 0.5, 0));
+                root->addChild(new opendlv::threeD::models::Polygon(NodeDescriptor(), box, Point3(0.8, 0.2, 0.2), 1));
+            }
+            return root;
+        }
+
+        void testSameImageForAnyNumberOfThreads() {
+            SoftwareRendererTestImage aerialImage(256, 256);
+            for (uint32_t y = 0; y < 256; y++) {
+                for (uint32_t x = 0; x < 256; x++) {
+                    aerialImage.setPixel(x, y, static_cast<uint8_t>(x), static_cast<uint8_t>(y), static_cast<uint8_t>(x ^ y));
+                }
+            }
+            TransformGroup *root = createTrackLikeScene(&aerialImage);
+
+            vector<uint8_t> reference;
+            for (uint32_t threads = 1; threads <= 4; threads++) {
+                SoftwareRenderer sr(640, 480, threads);
+                vector<uint8_t> image(640 * 480 * 3);
+
+                RenderingConfiguration r;
+                r.setSoftwareRenderer(&sr);
+                sr.setPerspective(60, 640.0 / 480.0, 1, 20);
+                sr.clear(Point3(0, 0.58, 0.78));
+                sr.loadIdentity();
+                sr.lookAt(Point3(60, 0, 2.8), Point3(60, 15, 0), Point3(0, 0, 1));
+                root->render(r);
+                sr.render(&image[0]);
+
+                if (threads == 1) {
+                    reference = image;
+                }
+                TS_ASSERT(image == reference);
+            }
+
+            delete root;
+        }
+
+        void testSoftwareRendererBenchmark() {
+            SoftwareRendererTestImage aerialImage(1024, 1024);
+            for (uint32_t y = 0; y < 1024; y++) {
+                for (uint32_t x = 0; x < 1024; x++) {
+                    aerialImage.setPixel(x, y, static_cast<uint8_t>(x), static_cast<uint8_t>(y), static_cast<uint8_t>(x ^ y));
+                }
+            }
+            TransformGroup *root = createTrackLikeScene(&aerialImage);
+
+            const uint32_t FRAMES = 100;
+            const uint32_t CORES = max(std::thread::hardware_concurrency(), 1u);
+
+            clog << endl;
+            for (uint32_t threads = 1; threads <= CORES; threads *= 2) {
+                SoftwareRenderer sr(640, 480, threads);
+                vector<uint8_t> image(640 * 480 * 3);
+
+                RenderingConfiguration r;
+                r.setSoftwareRenderer(&sr);
+                sr.setPerspective(60, 640.0 / 480.0, 1, 20);
+
+                const std::chrono::steady_clock::time_point before = std::chrono::steady_clock::now();
+                for (uint32_t i = 0; i < FRAMES; i++) {
+                    // Drive along the track.
+                    const double a = 2 * cartesian::Constants::PI * i / FRAMES;
+                    const Point3 eye(60 * cos(a), 60 * sin(a), 2.8);
+                    const Point3 target(eye.getX() - 15 * sin(a), eye.getY() + 15 * cos(a), 0);
+
+                    sr.clear(Point3(0, 0.58, 0.78));
+                    sr.loadIdentity();
+                    sr.lookAt(eye, target, Point3(0, 0, 1));
+                    root->render(r);
+                    sr.render(&image[0]);
+                }
+                const std::chrono::steady_clock::time_point after = std::chrono::steady_clock::now();
+
+                const double duration = std::chrono::duration_cast<std::chrono::microseconds>(after - before).count() / 1000000.0;
+                clog << "SoftwareRenderer: 640x480, " << threads << " thread(s): " << (FRAMES / duration) << " frames/s." << endl;
+            }
+
+            delete root;
+        }
+};
+
+#endif /*HESPERIA_SOFTWARERENDERERTESTSUITE_H_*/
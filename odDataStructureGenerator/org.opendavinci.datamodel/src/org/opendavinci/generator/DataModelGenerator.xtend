@@ -144,6 +144,12 @@ class DataModelGenerator implements IGenerator {
         return enums
 	}
 
+    /* Lists and maps of primitive types are (de-)serialized using odcore::base::PackedEncoding. */
+	def usesPackedEncoding(Attribute a) {
+		return (a.list != null && a.list.modifier != null && a.list.modifier.equalsIgnoreCase("list") && typeMap.containsKey(a.list.type)) ||
+		       (a.map != null && a.map.modifier != null && a.map.modifier.equalsIgnoreCase("map") && typeMap.containsKey(a.map.primaryType) && typeMap.containsKey(a.map.secondaryType))
+	}
+
     /* This method generates the header file content. */
 	def generateHeaderFileContent(String toplevelIncludeFolder, String generatedHeadersFile, PackageDeclaration pdl, Message msg, HashMap<String, EnumDescription> enums) '''
 /*
@@ -610,6 +616,13 @@ class «msg.message.substring(msg.message.lastIndexOf('.') + 1) /* These lines g
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+«var hasGeneratedPackedEncoding = false»
+«FOR a : msg.attributes /* Lists and maps of primitive types need the packed encoding. */»
+	«IF !hasGeneratedPackedEncoding && usesPackedEncoding(a)»
+#include "opendavinci/odcore/base/PackedEncoding.h"
+		«{hasGeneratedPackedEncoding = true; ""}»
+	«ENDIF»
+«ENDFOR»
 
 «IF msg.superMessage != null && msg.superMessage.length > 0 /* If this message is a derived one, we need to include the supermessage here. */»
 #include "«toplevelIncludeFolder»/«includeDirectoryPrefix + "/" + msg.superMessage.substring(0, msg.superMessage.lastIndexOf('.')).replaceAll("\\.", "/") + "/" + msg.superMessage.substring(msg.superMessage.lastIndexOf('.') + 1)».h"
@@ -1203,23 +1216,29 @@ namespace «s.get(i)» {
 			«ENDIF»
 		«ENDIF»
 		
+		«IF usesPackedEncoding(a)»
+		// Write actual elements using the packed encoding.
+		std::string packedOf«a.list.name.toFirstUpper»;
+		odcore::base::PackedEncoding::encode(m_listOf«a.list.name.toFirstUpper», packedOf«a.list.name.toFirstUpper»);
+		«ELSE»
 		// Write actual elements into a stringstream.
 		std::stringstream sstrOf«a.list.name.toFirstUpper»;
 		for (uint32_t i = 0; i < numberOf«a.list.name.toFirstUpper»; i++) {
-		    sstrOf«a.list.name.toFirstUpper» << m_listOf«a.list.name.toFirstUpper».at(i)«IF typeMap.containsKey(a.list.type) /* primitive types need to be separated by endl. */» << endl«ENDIF»;
+		    sstrOf«a.list.name.toFirstUpper» << m_listOf«a.list.name.toFirstUpper».at(i);
 		}
+		«ENDIF»
 		
 		// Write string of elements.
 		if (numberOf«a.list.name.toFirstUpper» > 0) {
 			«IF a.list.fourbyteid != null»
-				s->write(«a.list.fourbyteid» + «((a.eContainer) as Message).attributes.size», sstrOf«a.list.name.toFirstUpper».str());
+				s->write(«a.list.fourbyteid» + «((a.eContainer) as Message).attributes.size», «IF usesPackedEncoding(a)»packedOf«a.list.name.toFirstUpper»«ELSE»sstrOf«a.list.name.toFirstUpper».str()«ENDIF»);
 			«ELSE»
 				«IF a.list.id != null»
 					s->write(«a.list.id» + «((a.eContainer) as Message).attributes.size»,
-					        sstrOf«a.list.name.toFirstUpper».str());
+					        «IF usesPackedEncoding(a)»packedOf«a.list.name.toFirstUpper»«ELSE»sstrOf«a.list.name.toFirstUpper».str()«ENDIF»);
 				«ELSE»
 					s->write(CRC32 < «generateCharList(a.list.name.toFirstUpper, 0)» >::RESULT,
-					        sstrOf«a.list.name.toFirstUpper».str());
+					        «IF usesPackedEncoding(a)»packedOf«a.list.name.toFirstUpper»«ELSE»sstrOf«a.list.name.toFirstUpper».str()«ENDIF»);
 				«ENDIF»
 			«ENDIF»
 		}
@@ -1239,6 +1258,11 @@ namespace «s.get(i)» {
 				«ENDIF»
 			«ENDIF»
 
+			«IF usesPackedEncoding(a)»
+			// Write actual elements using the packed encoding.
+			std::string packedOf«a.map.name.toFirstUpper»;
+			odcore::base::PackedEncoding::encode(m_mapOf«a.map.name.toFirstUpper», packedOf«a.map.name.toFirstUpper»);
+			«ELSE»
 			// Write actual elements into a stringstream.
 			std::stringstream sstrOf«a.map.name.toFirstUpper»;
 			std::map<«IF typeMap.containsKey(a.map.primaryType)»«typeMap.get(a.map.primaryType)»«ELSE»«a.map.primaryType.replaceAll("\\.", "::")»«ENDIF», «IF typeMap.containsKey(a.map.secondaryType)»«typeMap.get(a.map.secondaryType)»«ELSE»«a.map.secondaryType.replaceAll("\\.", "::")»«ENDIF»>::const_iterator it = m_mapOf«a.map.name.toFirstUpper».begin();
@@ -1246,18 +1270,19 @@ namespace «s.get(i)» {
 			    sstrOf«a.map.name.toFirstUpper» << it->first << "=" << it->second << endl;
 			    it++;
 			}
+			«ENDIF»
 			
 			// Write string of elements.
 			if (numberOf«a.map.name.toFirstUpper» > 0) {
 				«IF a.map.fourbyteid != null»
-					s->write(«a.map.fourbyteid» + «((a.eContainer) as Message).attributes.size», sstrOf«a.map.name.toFirstUpper».str());
+					s->write(«a.map.fourbyteid» + «((a.eContainer) as Message).attributes.size», «IF usesPackedEncoding(a)»packedOf«a.map.name.toFirstUpper»«ELSE»sstrOf«a.map.name.toFirstUpper».str()«ENDIF»);
 				«ELSE»
 					«IF a.map.id != null»
 						s->write(«a.map.id» + «((a.eContainer) as Message).attributes.size»,
-								sstrOf«a.map.name.toFirstUpper».str());
+								«IF usesPackedEncoding(a)»packedOf«a.map.name.toFirstUpper»«ELSE»sstrOf«a.map.name.toFirstUpper».str()«ENDIF»);
 					«ELSE»
 						s->write(CRC32 < «generateCharList(a.map.name.toFirstUpper, 0)» >::RESULT,
-								sstrOf«a.map.name.toFirstUpper».str());
+								«IF usesPackedEncoding(a)»packedOf«a.map.name.toFirstUpper»«ELSE»sstrOf«a.map.name.toFirstUpper».str()«ENDIF»);
 					«ENDIF»
 				«ENDIF»
 			}
@@ -1345,6 +1370,10 @@ namespace «s.get(i)» {
 				«ENDIF»
 			«ENDIF»
 		
+		«IF usesPackedEncoding(a)»
+		    // Read actual elements; elements written by older versions are decoded as well.
+		    odcore::base::PackedEncoding::decode(elements, numberOf«a.list.name.toFirstUpper», m_listOf«a.list.name.toFirstUpper»);
+		«ELSE»
 		    stringstream sstr(elements);
 		
 		    // Read actual elements from stringstream.
@@ -1353,6 +1382,7 @@ namespace «s.get(i)» {
 		        «IF a.list.type.equalsIgnoreCase("string")»getline(sstr, element);«ELSE»sstr >> element;«ENDIF»
 		        m_listOf«a.list.name.toFirstUpper».push_back(element);
 		    }
+		«ENDIF»
 		}
 		«ENDIF»
 		«IF a.map != null && a.map.modifier != null && a.map.modifier.length > 0 && a.map.modifier.equalsIgnoreCase("map")»
@@ -1387,6 +1417,10 @@ namespace «s.get(i)» {
 				«ENDIF»
 			«ENDIF»
 
+			«IF usesPackedEncoding(a)»
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOf«a.map.name.toFirstUpper», m_mapOf«a.map.name.toFirstUpper»);
+			«ELSE»
 			stringstream sstr(elements);
 
 			while (!sstr.eof()) {
@@ -1423,6 +1457,7 @@ namespace «s.get(i)» {
 				// Store key/value pair.
 				putTo_MapOf«a.map.name.toFirstUpper»(_key, _value);
 			}
+			«ENDIF»
 		}
 		«ENDIF»
 		«IF a.fixedarray != null»
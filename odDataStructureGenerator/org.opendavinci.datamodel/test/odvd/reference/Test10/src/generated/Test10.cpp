@@ -13,6 +13,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test10/generated/Test10.h"
@@ -262,16 +263,14 @@
 		s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > > > > > > > > > >  >::RESULT,
 		        numberOfMyStringList);
 		
-		// Write actual elements into a stringstream.
-		std::stringstream sstrOfMyStringList;
-		for (uint32_t i = 0; i < numberOfMyStringList; i++) {
-		    sstrOfMyStringList << m_listOfMyStringList.at(i) << endl;
-		}
+		// Write actual elements using the packed encoding.
+		std::string packedOfMyStringList;
+		odcore::base::PackedEncoding::encode(m_listOfMyStringList, packedOfMyStringList);
 		
 		// Write string of elements.
 		if (numberOfMyStringList > 0) {
 			s->write(CRC32 < CharList<'M', CharList<'y', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > >  >::RESULT,
-			        sstrOfMyStringList.str());
+			        packedOfMyStringList);
 		}
 		// Write number of elements in m_listOfMyPointList.
 		const uint32_t numberOfMyPointList = static_cast<uint32_t>(m_listOfMyPointList.size());
@@ -295,18 +294,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'I', CharList<'n', CharList<'t', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyIntStringMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyIntStringMap;
-			std::map<int32_t, std::string>::const_iterator it = m_mapOfMyIntStringMap.begin();
-			while (it != m_mapOfMyIntStringMap.end()) {
-			    sstrOfMyIntStringMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyIntStringMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyIntStringMap, packedOfMyIntStringMap);
 			
 			// Write string of elements.
 			if (numberOfMyIntStringMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'I', CharList<'n', CharList<'t', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyIntStringMap.str());
+						packedOfMyIntStringMap);
 			}
 		}
 		{
@@ -352,14 +347,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > >  >::RESULT,
 			   elements);
 		
-		    stringstream sstr(elements);
-		
-		    // Read actual elements from stringstream.
-		    for (uint32_t i = 0; i < numberOfMyStringList; i++) {
-		        std::string element;
-		        getline(sstr, element);
-		        m_listOfMyStringList.push_back(element);
-		    }
+		    // Read actual elements; elements written by older versions are decoded as well.
+		    odcore::base::PackedEncoding::decode(elements, numberOfMyStringList, m_listOfMyStringList);
 		}
 		// Clean up the existing list of MyPointList.
 		m_listOfMyPointList.clear();
@@ -398,42 +387,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'I', CharList<'n', CharList<'t', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    int32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    std::string _value;
-		        getline(sstrValue, _value);
-		
-				// Store key/value pair.
-				putTo_MapOfMyIntStringMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyIntStringMap, m_mapOfMyIntStringMap);
 		}
 		// Clean up the existing map of MyIntPointMap.
 		m_mapOfMyIntPointMap.clear();
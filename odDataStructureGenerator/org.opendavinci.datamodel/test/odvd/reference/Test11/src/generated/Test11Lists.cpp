@@ -13,6 +13,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test11/generated/Test11Lists.h"
@@ -379,112 +380,98 @@
 		s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > > > > > > > >  >::RESULT,
 		        numberOfMyBoolList);
 		
-		// Write actual elements into a stringstream.
-		std::stringstream sstrOfMyBoolList;
-		for (uint32_t i = 0; i < numberOfMyBoolList; i++) {
-		    sstrOfMyBoolList << m_listOfMyBoolList.at(i) << endl;
-		}
+		// Write actual elements using the packed encoding.
+		std::string packedOfMyBoolList;
+		odcore::base::PackedEncoding::encode(m_listOfMyBoolList, packedOfMyBoolList);
 		
 		// Write string of elements.
 		if (numberOfMyBoolList > 0) {
 			s->write(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > >  >::RESULT,
-			        sstrOfMyBoolList.str());
+			        packedOfMyBoolList);
 		}
 		// Write number of elements in m_listOfMyCharList.
 		const uint32_t numberOfMyCharList = static_cast<uint32_t>(m_listOfMyCharList.size());
 		s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > > > > > > > >  >::RESULT,
 		        numberOfMyCharList);
 		
-		// Write actual elements into a stringstream.
-		std::stringstream sstrOfMyCharList;
-		for (uint32_t i = 0; i < numberOfMyCharList; i++) {
-		    sstrOfMyCharList << m_listOfMyCharList.at(i) << endl;
-		}
+		// Write actual elements using the packed encoding.
+		std::string packedOfMyCharList;
+		odcore::base::PackedEncoding::encode(m_listOfMyCharList, packedOfMyCharList);
 		
 		// Write string of elements.
 		if (numberOfMyCharList > 0) {
 			s->write(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > >  >::RESULT,
-			        sstrOfMyCharList.str());
+			        packedOfMyCharList);
 		}
 		// Write number of elements in m_listOfMyInt32List.
 		const uint32_t numberOfMyInt32List = static_cast<uint32_t>(m_listOfMyInt32List.size());
 		s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > > > > > > > > >  >::RESULT,
 		        numberOfMyInt32List);
 		
-		// Write actual elements into a stringstream.
-		std::stringstream sstrOfMyInt32List;
-		for (uint32_t i = 0; i < numberOfMyInt32List; i++) {
-		    sstrOfMyInt32List << m_listOfMyInt32List.at(i) << endl;
-		}
+		// Write actual elements using the packed encoding.
+		std::string packedOfMyInt32List;
+		odcore::base::PackedEncoding::encode(m_listOfMyInt32List, packedOfMyInt32List);
 		
 		// Write string of elements.
 		if (numberOfMyInt32List > 0) {
 			s->write(CRC32 < CharList<'M', CharList<'y', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > >  >::RESULT,
-			        sstrOfMyInt32List.str());
+			        packedOfMyInt32List);
 		}
 		// Write number of elements in m_listOfMyUint32List.
 		const uint32_t numberOfMyUint32List = static_cast<uint32_t>(m_listOfMyUint32List.size());
 		s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > > > > > > > > > >  >::RESULT,
 		        numberOfMyUint32List);
 		
-		// Write actual elements into a stringstream.
-		std::stringstream sstrOfMyUint32List;
-		for (uint32_t i = 0; i < numberOfMyUint32List; i++) {
-		    sstrOfMyUint32List << m_listOfMyUint32List.at(i) << endl;
-		}
+		// Write actual elements using the packed encoding.
+		std::string packedOfMyUint32List;
+		odcore::base::PackedEncoding::encode(m_listOfMyUint32List, packedOfMyUint32List);
 		
 		// Write string of elements.
 		if (numberOfMyUint32List > 0) {
 			s->write(CRC32 < CharList<'M', CharList<'y', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > >  >::RESULT,
-			        sstrOfMyUint32List.str());
+			        packedOfMyUint32List);
 		}
 		// Write number of elements in m_listOfMyFloatList.
 		const uint32_t numberOfMyFloatList = static_cast<uint32_t>(m_listOfMyFloatList.size());
 		s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > > > > > > > > >  >::RESULT,
 		        numberOfMyFloatList);
 		
-		// Write actual elements into a stringstream.
-		std::stringstream sstrOfMyFloatList;
-		for (uint32_t i = 0; i < numberOfMyFloatList; i++) {
-		    sstrOfMyFloatList << m_listOfMyFloatList.at(i) << endl;
-		}
+		// Write actual elements using the packed encoding.
+		std::string packedOfMyFloatList;
+		odcore::base::PackedEncoding::encode(m_listOfMyFloatList, packedOfMyFloatList);
 		
 		// Write string of elements.
 		if (numberOfMyFloatList > 0) {
 			s->write(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > >  >::RESULT,
-			        sstrOfMyFloatList.str());
+			        packedOfMyFloatList);
 		}
 		// Write number of elements in m_listOfMyDoubleList.
 		const uint32_t numberOfMyDoubleList = static_cast<uint32_t>(m_listOfMyDoubleList.size());
 		s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > > > > > > > > > >  >::RESULT,
 		        numberOfMyDoubleList);
 		
-		// Write actual elements into a stringstream.
-		std::stringstream sstrOfMyDoubleList;
-		for (uint32_t i = 0; i < numberOfMyDoubleList; i++) {
-		    sstrOfMyDoubleList << m_listOfMyDoubleList.at(i) << endl;
-		}
+		// Write actual elements using the packed encoding.
+		std::string packedOfMyDoubleList;
+		odcore::base::PackedEncoding::encode(m_listOfMyDoubleList, packedOfMyDoubleList);
 		
 		// Write string of elements.
 		if (numberOfMyDoubleList > 0) {
 			s->write(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > >  >::RESULT,
-			        sstrOfMyDoubleList.str());
+			        packedOfMyDoubleList);
 		}
 		// Write number of elements in m_listOfMyStringList.
 		const uint32_t numberOfMyStringList = static_cast<uint32_t>(m_listOfMyStringList.size());
 		s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > > > > > > > > > >  >::RESULT,
 		        numberOfMyStringList);
 		
-		// Write actual elements into a stringstream.
-		std::stringstream sstrOfMyStringList;
-		for (uint32_t i = 0; i < numberOfMyStringList; i++) {
-		    sstrOfMyStringList << m_listOfMyStringList.at(i) << endl;
-		}
+		// Write actual elements using the packed encoding.
+		std::string packedOfMyStringList;
+		odcore::base::PackedEncoding::encode(m_listOfMyStringList, packedOfMyStringList);
 		
 		// Write string of elements.
 		if (numberOfMyStringList > 0) {
 			s->write(CRC32 < CharList<'M', CharList<'y', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > >  >::RESULT,
-			        sstrOfMyStringList.str());
+			        packedOfMyStringList);
 		}
 		return out;
 	}
@@ -509,14 +496,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > >  >::RESULT,
 			   elements);
 		
-		    stringstream sstr(elements);
-		
-		    // Read actual elements from stringstream.
-		    for (uint32_t i = 0; i < numberOfMyBoolList; i++) {
-		        bool element;
-		        sstr >> element;
-		        m_listOfMyBoolList.push_back(element);
-		    }
+		    // Read actual elements; elements written by older versions are decoded as well.
+		    odcore::base::PackedEncoding::decode(elements, numberOfMyBoolList, m_listOfMyBoolList);
 		}
 		// Clean up the existing list of MyCharList.
 		m_listOfMyCharList.clear();
@@ -532,14 +513,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > >  >::RESULT,
 			   elements);
 		
-		    stringstream sstr(elements);
-		
-		    // Read actual elements from stringstream.
-		    for (uint32_t i = 0; i < numberOfMyCharList; i++) {
-		        char element;
-		        sstr >> element;
-		        m_listOfMyCharList.push_back(element);
-		    }
+		    // Read actual elements; elements written by older versions are decoded as well.
+		    odcore::base::PackedEncoding::decode(elements, numberOfMyCharList, m_listOfMyCharList);
 		}
 		// Clean up the existing list of MyInt32List.
 		m_listOfMyInt32List.clear();
@@ -555,14 +530,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > >  >::RESULT,
 			   elements);
 		
-		    stringstream sstr(elements);
-		
-		    // Read actual elements from stringstream.
-		    for (uint32_t i = 0; i < numberOfMyInt32List; i++) {
-		        int32_t element;
-		        sstr >> element;
-		        m_listOfMyInt32List.push_back(element);
-		    }
+		    // Read actual elements; elements written by older versions are decoded as well.
+		    odcore::base::PackedEncoding::decode(elements, numberOfMyInt32List, m_listOfMyInt32List);
 		}
 		// Clean up the existing list of MyUint32List.
 		m_listOfMyUint32List.clear();
@@ -578,14 +547,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > >  >::RESULT,
 			   elements);
 		
-		    stringstream sstr(elements);
-		
-		    // Read actual elements from stringstream.
-		    for (uint32_t i = 0; i < numberOfMyUint32List; i++) {
-		        uint32_t element;
-		        sstr >> element;
-		        m_listOfMyUint32List.push_back(element);
-		    }
+		    // Read actual elements; elements written by older versions are decoded as well.
+		    odcore::base::PackedEncoding::decode(elements, numberOfMyUint32List, m_listOfMyUint32List);
 		}
 		// Clean up the existing list of MyFloatList.
 		m_listOfMyFloatList.clear();
@@ -601,14 +564,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > >  >::RESULT,
 			   elements);
 		
-		    stringstream sstr(elements);
-		
-		    // Read actual elements from stringstream.
-		    for (uint32_t i = 0; i < numberOfMyFloatList; i++) {
-		        float element;
-		        sstr >> element;
-		        m_listOfMyFloatList.push_back(element);
-		    }
+		    // Read actual elements; elements written by older versions are decoded as well.
+		    odcore::base::PackedEncoding::decode(elements, numberOfMyFloatList, m_listOfMyFloatList);
 		}
 		// Clean up the existing list of MyDoubleList.
 		m_listOfMyDoubleList.clear();
@@ -624,14 +581,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > >  >::RESULT,
 			   elements);
 		
-		    stringstream sstr(elements);
-		
-		    // Read actual elements from stringstream.
-		    for (uint32_t i = 0; i < numberOfMyDoubleList; i++) {
-		        double element;
-		        sstr >> element;
-		        m_listOfMyDoubleList.push_back(element);
-		    }
+		    // Read actual elements; elements written by older versions are decoded as well.
+		    odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleList, m_listOfMyDoubleList);
 		}
 		// Clean up the existing list of MyStringList.
 		m_listOfMyStringList.clear();
@@ -647,14 +598,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > >  >::RESULT,
 			   elements);
 		
-		    stringstream sstr(elements);
-		
-		    // Read actual elements from stringstream.
-		    for (uint32_t i = 0; i < numberOfMyStringList; i++) {
-		        std::string element;
-		        getline(sstr, element);
-		        m_listOfMyStringList.push_back(element);
-		    }
+		    // Read actual elements; elements written by older versions are decoded as well.
+		    odcore::base::PackedEncoding::decode(elements, numberOfMyStringList, m_listOfMyStringList);
 		}
 		return in;
 	}
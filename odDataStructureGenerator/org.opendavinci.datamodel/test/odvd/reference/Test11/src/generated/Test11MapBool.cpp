@@ -10,6 +10,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test11/generated/Test11MapBool.h"
@@ -377,18 +378,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyBoolBoolMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolBoolMap;
-			std::map<bool, bool>::const_iterator it = m_mapOfMyBoolBoolMap.begin();
-			while (it != m_mapOfMyBoolBoolMap.end()) {
-			    sstrOfMyBoolBoolMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolBoolMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolBoolMap, packedOfMyBoolBoolMap);
 			
 			// Write string of elements.
 			if (numberOfMyBoolBoolMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyBoolBoolMap.str());
+						packedOfMyBoolBoolMap);
 			}
 		}
 		{
@@ -397,18 +394,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyBoolCharMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolCharMap;
-			std::map<bool, char>::const_iterator it = m_mapOfMyBoolCharMap.begin();
-			while (it != m_mapOfMyBoolCharMap.end()) {
-			    sstrOfMyBoolCharMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolCharMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolCharMap, packedOfMyBoolCharMap);
 			
 			// Write string of elements.
 			if (numberOfMyBoolCharMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyBoolCharMap.str());
+						packedOfMyBoolCharMap);
 			}
 		}
 		{
@@ -417,18 +410,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyBoolInt32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolInt32Map;
-			std::map<bool, int32_t>::const_iterator it = m_mapOfMyBoolInt32Map.begin();
-			while (it != m_mapOfMyBoolInt32Map.end()) {
-			    sstrOfMyBoolInt32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolInt32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolInt32Map, packedOfMyBoolInt32Map);
 			
 			// Write string of elements.
 			if (numberOfMyBoolInt32Map > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyBoolInt32Map.str());
+						packedOfMyBoolInt32Map);
 			}
 		}
 		{
@@ -437,18 +426,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyBoolUint32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolUint32Map;
-			std::map<bool, uint32_t>::const_iterator it = m_mapOfMyBoolUint32Map.begin();
-			while (it != m_mapOfMyBoolUint32Map.end()) {
-			    sstrOfMyBoolUint32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolUint32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolUint32Map, packedOfMyBoolUint32Map);
 			
 			// Write string of elements.
 			if (numberOfMyBoolUint32Map > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyBoolUint32Map.str());
+						packedOfMyBoolUint32Map);
 			}
 		}
 		{
@@ -457,18 +442,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyBoolFloatMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolFloatMap;
-			std::map<bool, float>::const_iterator it = m_mapOfMyBoolFloatMap.begin();
-			while (it != m_mapOfMyBoolFloatMap.end()) {
-			    sstrOfMyBoolFloatMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolFloatMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolFloatMap, packedOfMyBoolFloatMap);
 			
 			// Write string of elements.
 			if (numberOfMyBoolFloatMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyBoolFloatMap.str());
+						packedOfMyBoolFloatMap);
 			}
 		}
 		{
@@ -477,18 +458,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyBoolDoubleMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolDoubleMap;
-			std::map<bool, double>::const_iterator it = m_mapOfMyBoolDoubleMap.begin();
-			while (it != m_mapOfMyBoolDoubleMap.end()) {
-			    sstrOfMyBoolDoubleMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolDoubleMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolDoubleMap, packedOfMyBoolDoubleMap);
 			
 			// Write string of elements.
 			if (numberOfMyBoolDoubleMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyBoolDoubleMap.str());
+						packedOfMyBoolDoubleMap);
 			}
 		}
 		{
@@ -497,18 +474,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyBoolStringMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolStringMap;
-			std::map<bool, std::string>::const_iterator it = m_mapOfMyBoolStringMap.begin();
-			while (it != m_mapOfMyBoolStringMap.end()) {
-			    sstrOfMyBoolStringMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolStringMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolStringMap, packedOfMyBoolStringMap);
 			
 			// Write string of elements.
 			if (numberOfMyBoolStringMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyBoolStringMap.str());
+						packedOfMyBoolStringMap);
 			}
 		}
 		return out;
@@ -534,42 +507,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    bool _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolBoolMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolBoolMap, m_mapOfMyBoolBoolMap);
 		}
 		// Clean up the existing map of MyBoolCharMap.
 		m_mapOfMyBoolCharMap.clear();
@@ -585,42 +524,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    char _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolCharMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolCharMap, m_mapOfMyBoolCharMap);
 		}
 		// Clean up the existing map of MyBoolInt32Map.
 		m_mapOfMyBoolInt32Map.clear();
@@ -636,42 +541,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    int32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolInt32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolInt32Map, m_mapOfMyBoolInt32Map);
 		}
 		// Clean up the existing map of MyBoolUint32Map.
 		m_mapOfMyBoolUint32Map.clear();
@@ -687,42 +558,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    uint32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolUint32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolUint32Map, m_mapOfMyBoolUint32Map);
 		}
 		// Clean up the existing map of MyBoolFloatMap.
 		m_mapOfMyBoolFloatMap.clear();
@@ -738,42 +575,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    float _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolFloatMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolFloatMap, m_mapOfMyBoolFloatMap);
 		}
 		// Clean up the existing map of MyBoolDoubleMap.
 		m_mapOfMyBoolDoubleMap.clear();
@@ -789,42 +592,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    double _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolDoubleMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolDoubleMap, m_mapOfMyBoolDoubleMap);
 		}
 		// Clean up the existing map of MyBoolStringMap.
 		m_mapOfMyBoolStringMap.clear();
@@ -840,42 +609,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    std::string _value;
-		        getline(sstrValue, _value);
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolStringMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolStringMap, m_mapOfMyBoolStringMap);
 		}
 		return in;
 	}
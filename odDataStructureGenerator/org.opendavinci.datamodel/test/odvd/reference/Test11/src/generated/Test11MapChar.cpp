@@ -10,6 +10,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test11/generated/Test11MapChar.h"
@@ -377,18 +378,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyCharBoolMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharBoolMap;
-			std::map<char, bool>::const_iterator it = m_mapOfMyCharBoolMap.begin();
-			while (it != m_mapOfMyCharBoolMap.end()) {
-			    sstrOfMyCharBoolMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharBoolMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharBoolMap, packedOfMyCharBoolMap);
 			
 			// Write string of elements.
 			if (numberOfMyCharBoolMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyCharBoolMap.str());
+						packedOfMyCharBoolMap);
 			}
 		}
 		{
@@ -397,18 +394,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyCharCharMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharCharMap;
-			std::map<char, char>::const_iterator it = m_mapOfMyCharCharMap.begin();
-			while (it != m_mapOfMyCharCharMap.end()) {
-			    sstrOfMyCharCharMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharCharMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharCharMap, packedOfMyCharCharMap);
 			
 			// Write string of elements.
 			if (numberOfMyCharCharMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyCharCharMap.str());
+						packedOfMyCharCharMap);
 			}
 		}
 		{
@@ -417,18 +410,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyCharInt32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharInt32Map;
-			std::map<char, int32_t>::const_iterator it = m_mapOfMyCharInt32Map.begin();
-			while (it != m_mapOfMyCharInt32Map.end()) {
-			    sstrOfMyCharInt32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharInt32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharInt32Map, packedOfMyCharInt32Map);
 			
 			// Write string of elements.
 			if (numberOfMyCharInt32Map > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyCharInt32Map.str());
+						packedOfMyCharInt32Map);
 			}
 		}
 		{
@@ -437,18 +426,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyCharUint32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharUint32Map;
-			std::map<char, uint32_t>::const_iterator it = m_mapOfMyCharUint32Map.begin();
-			while (it != m_mapOfMyCharUint32Map.end()) {
-			    sstrOfMyCharUint32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharUint32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharUint32Map, packedOfMyCharUint32Map);
 			
 			// Write string of elements.
 			if (numberOfMyCharUint32Map > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyCharUint32Map.str());
+						packedOfMyCharUint32Map);
 			}
 		}
 		{
@@ -457,18 +442,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyCharFloatMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharFloatMap;
-			std::map<char, float>::const_iterator it = m_mapOfMyCharFloatMap.begin();
-			while (it != m_mapOfMyCharFloatMap.end()) {
-			    sstrOfMyCharFloatMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharFloatMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharFloatMap, packedOfMyCharFloatMap);
 			
 			// Write string of elements.
 			if (numberOfMyCharFloatMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyCharFloatMap.str());
+						packedOfMyCharFloatMap);
 			}
 		}
 		{
@@ -477,18 +458,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyCharDoubleMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharDoubleMap;
-			std::map<char, double>::const_iterator it = m_mapOfMyCharDoubleMap.begin();
-			while (it != m_mapOfMyCharDoubleMap.end()) {
-			    sstrOfMyCharDoubleMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharDoubleMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharDoubleMap, packedOfMyCharDoubleMap);
 			
 			// Write string of elements.
 			if (numberOfMyCharDoubleMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyCharDoubleMap.str());
+						packedOfMyCharDoubleMap);
 			}
 		}
 		{
@@ -497,18 +474,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyCharStringMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharStringMap;
-			std::map<char, std::string>::const_iterator it = m_mapOfMyCharStringMap.begin();
-			while (it != m_mapOfMyCharStringMap.end()) {
-			    sstrOfMyCharStringMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharStringMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharStringMap, packedOfMyCharStringMap);
 			
 			// Write string of elements.
 			if (numberOfMyCharStringMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyCharStringMap.str());
+						packedOfMyCharStringMap);
 			}
 		}
 		return out;
@@ -534,42 +507,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    bool _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharBoolMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharBoolMap, m_mapOfMyCharBoolMap);
 		}
 		// Clean up the existing map of MyCharCharMap.
 		m_mapOfMyCharCharMap.clear();
@@ -585,42 +524,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    char _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharCharMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharCharMap, m_mapOfMyCharCharMap);
 		}
 		// Clean up the existing map of MyCharInt32Map.
 		m_mapOfMyCharInt32Map.clear();
@@ -636,42 +541,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    int32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharInt32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharInt32Map, m_mapOfMyCharInt32Map);
 		}
 		// Clean up the existing map of MyCharUint32Map.
 		m_mapOfMyCharUint32Map.clear();
@@ -687,42 +558,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    uint32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharUint32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharUint32Map, m_mapOfMyCharUint32Map);
 		}
 		// Clean up the existing map of MyCharFloatMap.
 		m_mapOfMyCharFloatMap.clear();
@@ -738,42 +575,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    float _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharFloatMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharFloatMap, m_mapOfMyCharFloatMap);
 		}
 		// Clean up the existing map of MyCharDoubleMap.
 		m_mapOfMyCharDoubleMap.clear();
@@ -789,42 +592,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    double _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharDoubleMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharDoubleMap, m_mapOfMyCharDoubleMap);
 		}
 		// Clean up the existing map of MyCharStringMap.
 		m_mapOfMyCharStringMap.clear();
@@ -840,42 +609,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    std::string _value;
-		        getline(sstrValue, _value);
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharStringMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharStringMap, m_mapOfMyCharStringMap);
 		}
 		return in;
 	}
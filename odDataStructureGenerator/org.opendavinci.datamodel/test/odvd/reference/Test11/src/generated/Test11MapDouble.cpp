@@ -10,6 +10,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test11/generated/Test11MapDouble.h"
@@ -377,18 +378,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyDoubleBoolMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleBoolMap;
-			std::map<double, bool>::const_iterator it = m_mapOfMyDoubleBoolMap.begin();
-			while (it != m_mapOfMyDoubleBoolMap.end()) {
-			    sstrOfMyDoubleBoolMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleBoolMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleBoolMap, packedOfMyDoubleBoolMap);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleBoolMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyDoubleBoolMap.str());
+						packedOfMyDoubleBoolMap);
 			}
 		}
 		{
@@ -397,18 +394,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyDoubleCharMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleCharMap;
-			std::map<double, char>::const_iterator it = m_mapOfMyDoubleCharMap.begin();
-			while (it != m_mapOfMyDoubleCharMap.end()) {
-			    sstrOfMyDoubleCharMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleCharMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleCharMap, packedOfMyDoubleCharMap);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleCharMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyDoubleCharMap.str());
+						packedOfMyDoubleCharMap);
 			}
 		}
 		{
@@ -417,18 +410,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyDoubleInt32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleInt32Map;
-			std::map<double, int32_t>::const_iterator it = m_mapOfMyDoubleInt32Map.begin();
-			while (it != m_mapOfMyDoubleInt32Map.end()) {
-			    sstrOfMyDoubleInt32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleInt32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleInt32Map, packedOfMyDoubleInt32Map);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleInt32Map > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyDoubleInt32Map.str());
+						packedOfMyDoubleInt32Map);
 			}
 		}
 		{
@@ -437,18 +426,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyDoubleUint32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleUint32Map;
-			std::map<double, uint32_t>::const_iterator it = m_mapOfMyDoubleUint32Map.begin();
-			while (it != m_mapOfMyDoubleUint32Map.end()) {
-			    sstrOfMyDoubleUint32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleUint32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleUint32Map, packedOfMyDoubleUint32Map);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleUint32Map > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyDoubleUint32Map.str());
+						packedOfMyDoubleUint32Map);
 			}
 		}
 		{
@@ -457,18 +442,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyDoubleFloatMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleFloatMap;
-			std::map<double, float>::const_iterator it = m_mapOfMyDoubleFloatMap.begin();
-			while (it != m_mapOfMyDoubleFloatMap.end()) {
-			    sstrOfMyDoubleFloatMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleFloatMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleFloatMap, packedOfMyDoubleFloatMap);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleFloatMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyDoubleFloatMap.str());
+						packedOfMyDoubleFloatMap);
 			}
 		}
 		{
@@ -477,18 +458,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyDoubleDoubleMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleDoubleMap;
-			std::map<double, double>::const_iterator it = m_mapOfMyDoubleDoubleMap.begin();
-			while (it != m_mapOfMyDoubleDoubleMap.end()) {
-			    sstrOfMyDoubleDoubleMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleDoubleMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleDoubleMap, packedOfMyDoubleDoubleMap);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleDoubleMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyDoubleDoubleMap.str());
+						packedOfMyDoubleDoubleMap);
 			}
 		}
 		{
@@ -497,18 +474,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyDoubleStringMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleStringMap;
-			std::map<double, std::string>::const_iterator it = m_mapOfMyDoubleStringMap.begin();
-			while (it != m_mapOfMyDoubleStringMap.end()) {
-			    sstrOfMyDoubleStringMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleStringMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleStringMap, packedOfMyDoubleStringMap);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleStringMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyDoubleStringMap.str());
+						packedOfMyDoubleStringMap);
 			}
 		}
 		return out;
@@ -534,42 +507,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    bool _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleBoolMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleBoolMap, m_mapOfMyDoubleBoolMap);
 		}
 		// Clean up the existing map of MyDoubleCharMap.
 		m_mapOfMyDoubleCharMap.clear();
@@ -585,42 +524,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    char _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleCharMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleCharMap, m_mapOfMyDoubleCharMap);
 		}
 		// Clean up the existing map of MyDoubleInt32Map.
 		m_mapOfMyDoubleInt32Map.clear();
@@ -636,42 +541,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    int32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleInt32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleInt32Map, m_mapOfMyDoubleInt32Map);
 		}
 		// Clean up the existing map of MyDoubleUint32Map.
 		m_mapOfMyDoubleUint32Map.clear();
@@ -687,42 +558,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    uint32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleUint32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleUint32Map, m_mapOfMyDoubleUint32Map);
 		}
 		// Clean up the existing map of MyDoubleFloatMap.
 		m_mapOfMyDoubleFloatMap.clear();
@@ -738,42 +575,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    float _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleFloatMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleFloatMap, m_mapOfMyDoubleFloatMap);
 		}
 		// Clean up the existing map of MyDoubleDoubleMap.
 		m_mapOfMyDoubleDoubleMap.clear();
@@ -789,42 +592,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    double _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleDoubleMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleDoubleMap, m_mapOfMyDoubleDoubleMap);
 		}
 		// Clean up the existing map of MyDoubleStringMap.
 		m_mapOfMyDoubleStringMap.clear();
@@ -840,42 +609,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    std::string _value;
-		        getline(sstrValue, _value);
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleStringMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleStringMap, m_mapOfMyDoubleStringMap);
 		}
 		return in;
 	}
@@ -10,6 +10,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test11/generated/Test11MapFloat.h"
@@ -377,18 +378,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyFloatBoolMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatBoolMap;
-			std::map<float, bool>::const_iterator it = m_mapOfMyFloatBoolMap.begin();
-			while (it != m_mapOfMyFloatBoolMap.end()) {
-			    sstrOfMyFloatBoolMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatBoolMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatBoolMap, packedOfMyFloatBoolMap);
 			
 			// Write string of elements.
 			if (numberOfMyFloatBoolMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyFloatBoolMap.str());
+						packedOfMyFloatBoolMap);
 			}
 		}
 		{
@@ -397,18 +394,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyFloatCharMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatCharMap;
-			std::map<float, char>::const_iterator it = m_mapOfMyFloatCharMap.begin();
-			while (it != m_mapOfMyFloatCharMap.end()) {
-			    sstrOfMyFloatCharMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatCharMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatCharMap, packedOfMyFloatCharMap);
 			
 			// Write string of elements.
 			if (numberOfMyFloatCharMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyFloatCharMap.str());
+						packedOfMyFloatCharMap);
 			}
 		}
 		{
@@ -417,18 +410,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyFloatInt32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatInt32Map;
-			std::map<float, int32_t>::const_iterator it = m_mapOfMyFloatInt32Map.begin();
-			while (it != m_mapOfMyFloatInt32Map.end()) {
-			    sstrOfMyFloatInt32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatInt32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatInt32Map, packedOfMyFloatInt32Map);
 			
 			// Write string of elements.
 			if (numberOfMyFloatInt32Map > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyFloatInt32Map.str());
+						packedOfMyFloatInt32Map);
 			}
 		}
 		{
@@ -437,18 +426,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyFloatUint32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatUint32Map;
-			std::map<float, uint32_t>::const_iterator it = m_mapOfMyFloatUint32Map.begin();
-			while (it != m_mapOfMyFloatUint32Map.end()) {
-			    sstrOfMyFloatUint32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatUint32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatUint32Map, packedOfMyFloatUint32Map);
 			
 			// Write string of elements.
 			if (numberOfMyFloatUint32Map > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyFloatUint32Map.str());
+						packedOfMyFloatUint32Map);
 			}
 		}
 		{
@@ -457,18 +442,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyFloatFloatMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatFloatMap;
-			std::map<float, float>::const_iterator it = m_mapOfMyFloatFloatMap.begin();
-			while (it != m_mapOfMyFloatFloatMap.end()) {
-			    sstrOfMyFloatFloatMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatFloatMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatFloatMap, packedOfMyFloatFloatMap);
 			
 			// Write string of elements.
 			if (numberOfMyFloatFloatMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyFloatFloatMap.str());
+						packedOfMyFloatFloatMap);
 			}
 		}
 		{
@@ -477,18 +458,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyFloatDoubleMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatDoubleMap;
-			std::map<float, double>::const_iterator it = m_mapOfMyFloatDoubleMap.begin();
-			while (it != m_mapOfMyFloatDoubleMap.end()) {
-			    sstrOfMyFloatDoubleMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatDoubleMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatDoubleMap, packedOfMyFloatDoubleMap);
 			
 			// Write string of elements.
 			if (numberOfMyFloatDoubleMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyFloatDoubleMap.str());
+						packedOfMyFloatDoubleMap);
 			}
 		}
 		{
@@ -497,18 +474,14 @@
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyFloatStringMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatStringMap;
-			std::map<float, std::string>::const_iterator it = m_mapOfMyFloatStringMap.begin();
-			while (it != m_mapOfMyFloatStringMap.end()) {
-			    sstrOfMyFloatStringMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatStringMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatStringMap, packedOfMyFloatStringMap);
 			
 			// Write string of elements.
 			if (numberOfMyFloatStringMap > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > >  >::RESULT,
-						sstrOfMyFloatStringMap.str());
+						packedOfMyFloatStringMap);
 			}
 		}
 		return out;
@@ -534,42 +507,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'B', CharList<'o', CharList<'o', CharList<'l', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    bool _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatBoolMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatBoolMap, m_mapOfMyFloatBoolMap);
 		}
 		// Clean up the existing map of MyFloatCharMap.
 		m_mapOfMyFloatCharMap.clear();
@@ -585,42 +524,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'C', CharList<'h', CharList<'a', CharList<'r', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    char _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatCharMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatCharMap, m_mapOfMyFloatCharMap);
 		}
 		// Clean up the existing map of MyFloatInt32Map.
 		m_mapOfMyFloatInt32Map.clear();
@@ -636,42 +541,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'I', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    int32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatInt32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatInt32Map, m_mapOfMyFloatInt32Map);
 		}
 		// Clean up the existing map of MyFloatUint32Map.
 		m_mapOfMyFloatUint32Map.clear();
@@ -687,42 +558,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'U', CharList<'i', CharList<'n', CharList<'t', CharList<'3', CharList<'2', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    uint32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatUint32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatUint32Map, m_mapOfMyFloatUint32Map);
 		}
 		// Clean up the existing map of MyFloatFloatMap.
 		m_mapOfMyFloatFloatMap.clear();
@@ -738,42 +575,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    float _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatFloatMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatFloatMap, m_mapOfMyFloatFloatMap);
 		}
 		// Clean up the existing map of MyFloatDoubleMap.
 		m_mapOfMyFloatDoubleMap.clear();
@@ -789,42 +592,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'D', CharList<'o', CharList<'u', CharList<'b', CharList<'l', CharList<'e', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    double _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatDoubleMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatDoubleMap, m_mapOfMyFloatDoubleMap);
 		}
 		// Clean up the existing map of MyFloatStringMap.
 		m_mapOfMyFloatStringMap.clear();
@@ -840,42 +609,8 @@
 			d->read(CRC32 < CharList<'M', CharList<'y', CharList<'F', CharList<'l', CharList<'o', CharList<'a', CharList<'t', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'M', CharList<'a', CharList<'p', NullType> > > > > > > > > > > > > > > >  >::RESULT,
 			       elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    std::string _value;
-		        getline(sstrValue, _value);
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatStringMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatStringMap, m_mapOfMyFloatStringMap);
 		}
 		return in;
 	}
@@ -10,6 +10,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test12/generated/Test12MapBool.h"
@@ -376,17 +377,13 @@
 			const uint32_t numberOfMyBoolBoolMap = static_cast<uint32_t>(m_mapOfMyBoolBoolMap.size());
 			s->write(1, numberOfMyBoolBoolMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolBoolMap;
-			std::map<bool, bool>::const_iterator it = m_mapOfMyBoolBoolMap.begin();
-			while (it != m_mapOfMyBoolBoolMap.end()) {
-			    sstrOfMyBoolBoolMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolBoolMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolBoolMap, packedOfMyBoolBoolMap);
 			
 			// Write string of elements.
 			if (numberOfMyBoolBoolMap > 0) {
-				s->write(1 + 7, sstrOfMyBoolBoolMap.str());
+				s->write(1 + 7, packedOfMyBoolBoolMap);
 			}
 		}
 		{
@@ -394,17 +391,13 @@
 			const uint32_t numberOfMyBoolCharMap = static_cast<uint32_t>(m_mapOfMyBoolCharMap.size());
 			s->write(2, numberOfMyBoolCharMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolCharMap;
-			std::map<bool, char>::const_iterator it = m_mapOfMyBoolCharMap.begin();
-			while (it != m_mapOfMyBoolCharMap.end()) {
-			    sstrOfMyBoolCharMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolCharMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolCharMap, packedOfMyBoolCharMap);
 			
 			// Write string of elements.
 			if (numberOfMyBoolCharMap > 0) {
-				s->write(2 + 7, sstrOfMyBoolCharMap.str());
+				s->write(2 + 7, packedOfMyBoolCharMap);
 			}
 		}
 		{
@@ -412,17 +405,13 @@
 			const uint32_t numberOfMyBoolInt32Map = static_cast<uint32_t>(m_mapOfMyBoolInt32Map.size());
 			s->write(3, numberOfMyBoolInt32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolInt32Map;
-			std::map<bool, int32_t>::const_iterator it = m_mapOfMyBoolInt32Map.begin();
-			while (it != m_mapOfMyBoolInt32Map.end()) {
-			    sstrOfMyBoolInt32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolInt32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolInt32Map, packedOfMyBoolInt32Map);
 			
 			// Write string of elements.
 			if (numberOfMyBoolInt32Map > 0) {
-				s->write(3 + 7, sstrOfMyBoolInt32Map.str());
+				s->write(3 + 7, packedOfMyBoolInt32Map);
 			}
 		}
 		{
@@ -430,17 +419,13 @@
 			const uint32_t numberOfMyBoolUint32Map = static_cast<uint32_t>(m_mapOfMyBoolUint32Map.size());
 			s->write(4, numberOfMyBoolUint32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolUint32Map;
-			std::map<bool, uint32_t>::const_iterator it = m_mapOfMyBoolUint32Map.begin();
-			while (it != m_mapOfMyBoolUint32Map.end()) {
-			    sstrOfMyBoolUint32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolUint32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolUint32Map, packedOfMyBoolUint32Map);
 			
 			// Write string of elements.
 			if (numberOfMyBoolUint32Map > 0) {
-				s->write(4 + 7, sstrOfMyBoolUint32Map.str());
+				s->write(4 + 7, packedOfMyBoolUint32Map);
 			}
 		}
 		{
@@ -448,17 +433,13 @@
 			const uint32_t numberOfMyBoolFloatMap = static_cast<uint32_t>(m_mapOfMyBoolFloatMap.size());
 			s->write(5, numberOfMyBoolFloatMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolFloatMap;
-			std::map<bool, float>::const_iterator it = m_mapOfMyBoolFloatMap.begin();
-			while (it != m_mapOfMyBoolFloatMap.end()) {
-			    sstrOfMyBoolFloatMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolFloatMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolFloatMap, packedOfMyBoolFloatMap);
 			
 			// Write string of elements.
 			if (numberOfMyBoolFloatMap > 0) {
-				s->write(5 + 7, sstrOfMyBoolFloatMap.str());
+				s->write(5 + 7, packedOfMyBoolFloatMap);
 			}
 		}
 		{
@@ -466,17 +447,13 @@
 			const uint32_t numberOfMyBoolDoubleMap = static_cast<uint32_t>(m_mapOfMyBoolDoubleMap.size());
 			s->write(6, numberOfMyBoolDoubleMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolDoubleMap;
-			std::map<bool, double>::const_iterator it = m_mapOfMyBoolDoubleMap.begin();
-			while (it != m_mapOfMyBoolDoubleMap.end()) {
-			    sstrOfMyBoolDoubleMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolDoubleMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolDoubleMap, packedOfMyBoolDoubleMap);
 			
 			// Write string of elements.
 			if (numberOfMyBoolDoubleMap > 0) {
-				s->write(6 + 7, sstrOfMyBoolDoubleMap.str());
+				s->write(6 + 7, packedOfMyBoolDoubleMap);
 			}
 		}
 		{
@@ -484,17 +461,13 @@
 			const uint32_t numberOfMyBoolStringMap = static_cast<uint32_t>(m_mapOfMyBoolStringMap.size());
 			s->write(7, numberOfMyBoolStringMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyBoolStringMap;
-			std::map<bool, std::string>::const_iterator it = m_mapOfMyBoolStringMap.begin();
-			while (it != m_mapOfMyBoolStringMap.end()) {
-			    sstrOfMyBoolStringMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyBoolStringMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyBoolStringMap, packedOfMyBoolStringMap);
 			
 			// Write string of elements.
 			if (numberOfMyBoolStringMap > 0) {
-				s->write(7 + 7, sstrOfMyBoolStringMap.str());
+				s->write(7 + 7, packedOfMyBoolStringMap);
 			}
 		}
 		return out;
@@ -518,42 +491,8 @@
 		    string elements;
 			d->read(1 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    bool _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolBoolMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolBoolMap, m_mapOfMyBoolBoolMap);
 		}
 		// Clean up the existing map of MyBoolCharMap.
 		m_mapOfMyBoolCharMap.clear();
@@ -567,42 +506,8 @@
 		    string elements;
 			d->read(2 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    char _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolCharMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolCharMap, m_mapOfMyBoolCharMap);
 		}
 		// Clean up the existing map of MyBoolInt32Map.
 		m_mapOfMyBoolInt32Map.clear();
@@ -616,42 +521,8 @@
 		    string elements;
 			d->read(3 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    int32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolInt32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolInt32Map, m_mapOfMyBoolInt32Map);
 		}
 		// Clean up the existing map of MyBoolUint32Map.
 		m_mapOfMyBoolUint32Map.clear();
@@ -665,42 +536,8 @@
 		    string elements;
 			d->read(4 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    uint32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolUint32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolUint32Map, m_mapOfMyBoolUint32Map);
 		}
 		// Clean up the existing map of MyBoolFloatMap.
 		m_mapOfMyBoolFloatMap.clear();
@@ -714,42 +551,8 @@
 		    string elements;
 			d->read(5 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    float _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolFloatMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolFloatMap, m_mapOfMyBoolFloatMap);
 		}
 		// Clean up the existing map of MyBoolDoubleMap.
 		m_mapOfMyBoolDoubleMap.clear();
@@ -763,42 +566,8 @@
 		    string elements;
 			d->read(6 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    double _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolDoubleMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolDoubleMap, m_mapOfMyBoolDoubleMap);
 		}
 		// Clean up the existing map of MyBoolStringMap.
 		m_mapOfMyBoolStringMap.clear();
@@ -812,42 +581,8 @@
 		    string elements;
 			d->read(7 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    bool _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    std::string _value;
-		        getline(sstrValue, _value);
-		
-				// Store key/value pair.
-				putTo_MapOfMyBoolStringMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyBoolStringMap, m_mapOfMyBoolStringMap);
 		}
 		return in;
 	}
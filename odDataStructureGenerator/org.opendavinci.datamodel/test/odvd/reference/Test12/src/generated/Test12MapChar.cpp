@@ -10,6 +10,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test12/generated/Test12MapChar.h"
@@ -376,17 +377,13 @@
 			const uint32_t numberOfMyCharBoolMap = static_cast<uint32_t>(m_mapOfMyCharBoolMap.size());
 			s->write(1, numberOfMyCharBoolMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharBoolMap;
-			std::map<char, bool>::const_iterator it = m_mapOfMyCharBoolMap.begin();
-			while (it != m_mapOfMyCharBoolMap.end()) {
-			    sstrOfMyCharBoolMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharBoolMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharBoolMap, packedOfMyCharBoolMap);
 			
 			// Write string of elements.
 			if (numberOfMyCharBoolMap > 0) {
-				s->write(1 + 7, sstrOfMyCharBoolMap.str());
+				s->write(1 + 7, packedOfMyCharBoolMap);
 			}
 		}
 		{
@@ -394,17 +391,13 @@
 			const uint32_t numberOfMyCharCharMap = static_cast<uint32_t>(m_mapOfMyCharCharMap.size());
 			s->write(2, numberOfMyCharCharMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharCharMap;
-			std::map<char, char>::const_iterator it = m_mapOfMyCharCharMap.begin();
-			while (it != m_mapOfMyCharCharMap.end()) {
-			    sstrOfMyCharCharMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharCharMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharCharMap, packedOfMyCharCharMap);
 			
 			// Write string of elements.
 			if (numberOfMyCharCharMap > 0) {
-				s->write(2 + 7, sstrOfMyCharCharMap.str());
+				s->write(2 + 7, packedOfMyCharCharMap);
 			}
 		}
 		{
@@ -412,17 +405,13 @@
 			const uint32_t numberOfMyCharInt32Map = static_cast<uint32_t>(m_mapOfMyCharInt32Map.size());
 			s->write(3, numberOfMyCharInt32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharInt32Map;
-			std::map<char, int32_t>::const_iterator it = m_mapOfMyCharInt32Map.begin();
-			while (it != m_mapOfMyCharInt32Map.end()) {
-			    sstrOfMyCharInt32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharInt32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharInt32Map, packedOfMyCharInt32Map);
 			
 			// Write string of elements.
 			if (numberOfMyCharInt32Map > 0) {
-				s->write(3 + 7, sstrOfMyCharInt32Map.str());
+				s->write(3 + 7, packedOfMyCharInt32Map);
 			}
 		}
 		{
@@ -430,17 +419,13 @@
 			const uint32_t numberOfMyCharUint32Map = static_cast<uint32_t>(m_mapOfMyCharUint32Map.size());
 			s->write(4, numberOfMyCharUint32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharUint32Map;
-			std::map<char, uint32_t>::const_iterator it = m_mapOfMyCharUint32Map.begin();
-			while (it != m_mapOfMyCharUint32Map.end()) {
-			    sstrOfMyCharUint32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharUint32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharUint32Map, packedOfMyCharUint32Map);
 			
 			// Write string of elements.
 			if (numberOfMyCharUint32Map > 0) {
-				s->write(4 + 7, sstrOfMyCharUint32Map.str());
+				s->write(4 + 7, packedOfMyCharUint32Map);
 			}
 		}
 		{
@@ -448,17 +433,13 @@
 			const uint32_t numberOfMyCharFloatMap = static_cast<uint32_t>(m_mapOfMyCharFloatMap.size());
 			s->write(5, numberOfMyCharFloatMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharFloatMap;
-			std::map<char, float>::const_iterator it = m_mapOfMyCharFloatMap.begin();
-			while (it != m_mapOfMyCharFloatMap.end()) {
-			    sstrOfMyCharFloatMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharFloatMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharFloatMap, packedOfMyCharFloatMap);
 			
 			// Write string of elements.
 			if (numberOfMyCharFloatMap > 0) {
-				s->write(5 + 7, sstrOfMyCharFloatMap.str());
+				s->write(5 + 7, packedOfMyCharFloatMap);
 			}
 		}
 		{
@@ -466,17 +447,13 @@
 			const uint32_t numberOfMyCharDoubleMap = static_cast<uint32_t>(m_mapOfMyCharDoubleMap.size());
 			s->write(6, numberOfMyCharDoubleMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharDoubleMap;
-			std::map<char, double>::const_iterator it = m_mapOfMyCharDoubleMap.begin();
-			while (it != m_mapOfMyCharDoubleMap.end()) {
-			    sstrOfMyCharDoubleMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharDoubleMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharDoubleMap, packedOfMyCharDoubleMap);
 			
 			// Write string of elements.
 			if (numberOfMyCharDoubleMap > 0) {
-				s->write(6 + 7, sstrOfMyCharDoubleMap.str());
+				s->write(6 + 7, packedOfMyCharDoubleMap);
 			}
 		}
 		{
@@ -484,17 +461,13 @@
 			const uint32_t numberOfMyCharStringMap = static_cast<uint32_t>(m_mapOfMyCharStringMap.size());
 			s->write(7, numberOfMyCharStringMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyCharStringMap;
-			std::map<char, std::string>::const_iterator it = m_mapOfMyCharStringMap.begin();
-			while (it != m_mapOfMyCharStringMap.end()) {
-			    sstrOfMyCharStringMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyCharStringMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyCharStringMap, packedOfMyCharStringMap);
 			
 			// Write string of elements.
 			if (numberOfMyCharStringMap > 0) {
-				s->write(7 + 7, sstrOfMyCharStringMap.str());
+				s->write(7 + 7, packedOfMyCharStringMap);
 			}
 		}
 		return out;
@@ -518,42 +491,8 @@
 		    string elements;
 			d->read(1 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    bool _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharBoolMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharBoolMap, m_mapOfMyCharBoolMap);
 		}
 		// Clean up the existing map of MyCharCharMap.
 		m_mapOfMyCharCharMap.clear();
@@ -567,42 +506,8 @@
 		    string elements;
 			d->read(2 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    char _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharCharMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharCharMap, m_mapOfMyCharCharMap);
 		}
 		// Clean up the existing map of MyCharInt32Map.
 		m_mapOfMyCharInt32Map.clear();
@@ -616,42 +521,8 @@
 		    string elements;
 			d->read(3 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    int32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharInt32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharInt32Map, m_mapOfMyCharInt32Map);
 		}
 		// Clean up the existing map of MyCharUint32Map.
 		m_mapOfMyCharUint32Map.clear();
@@ -665,42 +536,8 @@
 		    string elements;
 			d->read(4 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    uint32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharUint32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharUint32Map, m_mapOfMyCharUint32Map);
 		}
 		// Clean up the existing map of MyCharFloatMap.
 		m_mapOfMyCharFloatMap.clear();
@@ -714,42 +551,8 @@
 		    string elements;
 			d->read(5 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    float _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharFloatMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharFloatMap, m_mapOfMyCharFloatMap);
 		}
 		// Clean up the existing map of MyCharDoubleMap.
 		m_mapOfMyCharDoubleMap.clear();
@@ -763,42 +566,8 @@
 		    string elements;
 			d->read(6 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    double _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharDoubleMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharDoubleMap, m_mapOfMyCharDoubleMap);
 		}
 		// Clean up the existing map of MyCharStringMap.
 		m_mapOfMyCharStringMap.clear();
@@ -812,42 +581,8 @@
 		    string elements;
 			d->read(7 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    char _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    std::string _value;
-		        getline(sstrValue, _value);
-		
-				// Store key/value pair.
-				putTo_MapOfMyCharStringMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyCharStringMap, m_mapOfMyCharStringMap);
 		}
 		return in;
 	}
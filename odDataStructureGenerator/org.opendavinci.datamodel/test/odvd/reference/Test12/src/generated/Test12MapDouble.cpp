@@ -10,6 +10,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test12/generated/Test12MapDouble.h"
@@ -376,17 +377,13 @@
 			const uint32_t numberOfMyDoubleBoolMap = static_cast<uint32_t>(m_mapOfMyDoubleBoolMap.size());
 			s->write(1, numberOfMyDoubleBoolMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleBoolMap;
-			std::map<double, bool>::const_iterator it = m_mapOfMyDoubleBoolMap.begin();
-			while (it != m_mapOfMyDoubleBoolMap.end()) {
-			    sstrOfMyDoubleBoolMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleBoolMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleBoolMap, packedOfMyDoubleBoolMap);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleBoolMap > 0) {
-				s->write(1 + 7, sstrOfMyDoubleBoolMap.str());
+				s->write(1 + 7, packedOfMyDoubleBoolMap);
 			}
 		}
 		{
@@ -394,17 +391,13 @@
 			const uint32_t numberOfMyDoubleCharMap = static_cast<uint32_t>(m_mapOfMyDoubleCharMap.size());
 			s->write(2, numberOfMyDoubleCharMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleCharMap;
-			std::map<double, char>::const_iterator it = m_mapOfMyDoubleCharMap.begin();
-			while (it != m_mapOfMyDoubleCharMap.end()) {
-			    sstrOfMyDoubleCharMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleCharMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleCharMap, packedOfMyDoubleCharMap);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleCharMap > 0) {
-				s->write(2 + 7, sstrOfMyDoubleCharMap.str());
+				s->write(2 + 7, packedOfMyDoubleCharMap);
 			}
 		}
 		{
@@ -412,17 +405,13 @@
 			const uint32_t numberOfMyDoubleInt32Map = static_cast<uint32_t>(m_mapOfMyDoubleInt32Map.size());
 			s->write(3, numberOfMyDoubleInt32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleInt32Map;
-			std::map<double, int32_t>::const_iterator it = m_mapOfMyDoubleInt32Map.begin();
-			while (it != m_mapOfMyDoubleInt32Map.end()) {
-			    sstrOfMyDoubleInt32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleInt32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleInt32Map, packedOfMyDoubleInt32Map);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleInt32Map > 0) {
-				s->write(3 + 7, sstrOfMyDoubleInt32Map.str());
+				s->write(3 + 7, packedOfMyDoubleInt32Map);
 			}
 		}
 		{
@@ -430,17 +419,13 @@
 			const uint32_t numberOfMyDoubleUint32Map = static_cast<uint32_t>(m_mapOfMyDoubleUint32Map.size());
 			s->write(4, numberOfMyDoubleUint32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleUint32Map;
-			std::map<double, uint32_t>::const_iterator it = m_mapOfMyDoubleUint32Map.begin();
-			while (it != m_mapOfMyDoubleUint32Map.end()) {
-			    sstrOfMyDoubleUint32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleUint32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleUint32Map, packedOfMyDoubleUint32Map);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleUint32Map > 0) {
-				s->write(4 + 7, sstrOfMyDoubleUint32Map.str());
+				s->write(4 + 7, packedOfMyDoubleUint32Map);
 			}
 		}
 		{
@@ -448,17 +433,13 @@
 			const uint32_t numberOfMyDoubleFloatMap = static_cast<uint32_t>(m_mapOfMyDoubleFloatMap.size());
 			s->write(5, numberOfMyDoubleFloatMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleFloatMap;
-			std::map<double, float>::const_iterator it = m_mapOfMyDoubleFloatMap.begin();
-			while (it != m_mapOfMyDoubleFloatMap.end()) {
-			    sstrOfMyDoubleFloatMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleFloatMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleFloatMap, packedOfMyDoubleFloatMap);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleFloatMap > 0) {
-				s->write(5 + 7, sstrOfMyDoubleFloatMap.str());
+				s->write(5 + 7, packedOfMyDoubleFloatMap);
 			}
 		}
 		{
@@ -466,17 +447,13 @@
 			const uint32_t numberOfMyDoubleDoubleMap = static_cast<uint32_t>(m_mapOfMyDoubleDoubleMap.size());
 			s->write(6, numberOfMyDoubleDoubleMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleDoubleMap;
-			std::map<double, double>::const_iterator it = m_mapOfMyDoubleDoubleMap.begin();
-			while (it != m_mapOfMyDoubleDoubleMap.end()) {
-			    sstrOfMyDoubleDoubleMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleDoubleMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleDoubleMap, packedOfMyDoubleDoubleMap);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleDoubleMap > 0) {
-				s->write(6 + 7, sstrOfMyDoubleDoubleMap.str());
+				s->write(6 + 7, packedOfMyDoubleDoubleMap);
 			}
 		}
 		{
@@ -484,17 +461,13 @@
 			const uint32_t numberOfMyDoubleStringMap = static_cast<uint32_t>(m_mapOfMyDoubleStringMap.size());
 			s->write(7, numberOfMyDoubleStringMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyDoubleStringMap;
-			std::map<double, std::string>::const_iterator it = m_mapOfMyDoubleStringMap.begin();
-			while (it != m_mapOfMyDoubleStringMap.end()) {
-			    sstrOfMyDoubleStringMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyDoubleStringMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyDoubleStringMap, packedOfMyDoubleStringMap);
 			
 			// Write string of elements.
 			if (numberOfMyDoubleStringMap > 0) {
-				s->write(7 + 7, sstrOfMyDoubleStringMap.str());
+				s->write(7 + 7, packedOfMyDoubleStringMap);
 			}
 		}
 		return out;
@@ -518,42 +491,8 @@
 		    string elements;
 			d->read(1 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    bool _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleBoolMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleBoolMap, m_mapOfMyDoubleBoolMap);
 		}
 		// Clean up the existing map of MyDoubleCharMap.
 		m_mapOfMyDoubleCharMap.clear();
@@ -567,42 +506,8 @@
 		    string elements;
 			d->read(2 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    char _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleCharMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleCharMap, m_mapOfMyDoubleCharMap);
 		}
 		// Clean up the existing map of MyDoubleInt32Map.
 		m_mapOfMyDoubleInt32Map.clear();
@@ -616,42 +521,8 @@
 		    string elements;
 			d->read(3 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    int32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleInt32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleInt32Map, m_mapOfMyDoubleInt32Map);
 		}
 		// Clean up the existing map of MyDoubleUint32Map.
 		m_mapOfMyDoubleUint32Map.clear();
@@ -665,42 +536,8 @@
 		    string elements;
 			d->read(4 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    uint32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleUint32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleUint32Map, m_mapOfMyDoubleUint32Map);
 		}
 		// Clean up the existing map of MyDoubleFloatMap.
 		m_mapOfMyDoubleFloatMap.clear();
@@ -714,42 +551,8 @@
 		    string elements;
 			d->read(5 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    float _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleFloatMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleFloatMap, m_mapOfMyDoubleFloatMap);
 		}
 		// Clean up the existing map of MyDoubleDoubleMap.
 		m_mapOfMyDoubleDoubleMap.clear();
@@ -763,42 +566,8 @@
 		    string elements;
 			d->read(6 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    double _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleDoubleMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleDoubleMap, m_mapOfMyDoubleDoubleMap);
 		}
 		// Clean up the existing map of MyDoubleStringMap.
 		m_mapOfMyDoubleStringMap.clear();
@@ -812,42 +581,8 @@
 		    string elements;
 			d->read(7 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    double _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    std::string _value;
-		        getline(sstrValue, _value);
-		
-				// Store key/value pair.
-				putTo_MapOfMyDoubleStringMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyDoubleStringMap, m_mapOfMyDoubleStringMap);
 		}
 		return in;
 	}
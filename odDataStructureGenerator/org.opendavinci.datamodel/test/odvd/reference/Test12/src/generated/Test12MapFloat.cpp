@@ -10,6 +10,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test12/generated/Test12MapFloat.h"
@@ -376,17 +377,13 @@
 			const uint32_t numberOfMyFloatBoolMap = static_cast<uint32_t>(m_mapOfMyFloatBoolMap.size());
 			s->write(1, numberOfMyFloatBoolMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatBoolMap;
-			std::map<float, bool>::const_iterator it = m_mapOfMyFloatBoolMap.begin();
-			while (it != m_mapOfMyFloatBoolMap.end()) {
-			    sstrOfMyFloatBoolMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatBoolMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatBoolMap, packedOfMyFloatBoolMap);
 			
 			// Write string of elements.
 			if (numberOfMyFloatBoolMap > 0) {
-				s->write(1 + 7, sstrOfMyFloatBoolMap.str());
+				s->write(1 + 7, packedOfMyFloatBoolMap);
 			}
 		}
 		{
@@ -394,17 +391,13 @@
 			const uint32_t numberOfMyFloatCharMap = static_cast<uint32_t>(m_mapOfMyFloatCharMap.size());
 			s->write(2, numberOfMyFloatCharMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatCharMap;
-			std::map<float, char>::const_iterator it = m_mapOfMyFloatCharMap.begin();
-			while (it != m_mapOfMyFloatCharMap.end()) {
-			    sstrOfMyFloatCharMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatCharMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatCharMap, packedOfMyFloatCharMap);
 			
 			// Write string of elements.
 			if (numberOfMyFloatCharMap > 0) {
-				s->write(2 + 7, sstrOfMyFloatCharMap.str());
+				s->write(2 + 7, packedOfMyFloatCharMap);
 			}
 		}
 		{
@@ -412,17 +405,13 @@
 			const uint32_t numberOfMyFloatInt32Map = static_cast<uint32_t>(m_mapOfMyFloatInt32Map.size());
 			s->write(3, numberOfMyFloatInt32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatInt32Map;
-			std::map<float, int32_t>::const_iterator it = m_mapOfMyFloatInt32Map.begin();
-			while (it != m_mapOfMyFloatInt32Map.end()) {
-			    sstrOfMyFloatInt32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatInt32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatInt32Map, packedOfMyFloatInt32Map);
 			
 			// Write string of elements.
 			if (numberOfMyFloatInt32Map > 0) {
-				s->write(3 + 7, sstrOfMyFloatInt32Map.str());
+				s->write(3 + 7, packedOfMyFloatInt32Map);
 			}
 		}
 		{
@@ -430,17 +419,13 @@
 			const uint32_t numberOfMyFloatUint32Map = static_cast<uint32_t>(m_mapOfMyFloatUint32Map.size());
 			s->write(4, numberOfMyFloatUint32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatUint32Map;
-			std::map<float, uint32_t>::const_iterator it = m_mapOfMyFloatUint32Map.begin();
-			while (it != m_mapOfMyFloatUint32Map.end()) {
-			    sstrOfMyFloatUint32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatUint32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatUint32Map, packedOfMyFloatUint32Map);
 			
 			// Write string of elements.
 			if (numberOfMyFloatUint32Map > 0) {
-				s->write(4 + 7, sstrOfMyFloatUint32Map.str());
+				s->write(4 + 7, packedOfMyFloatUint32Map);
 			}
 		}
 		{
@@ -448,17 +433,13 @@
 			const uint32_t numberOfMyFloatFloatMap = static_cast<uint32_t>(m_mapOfMyFloatFloatMap.size());
 			s->write(5, numberOfMyFloatFloatMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatFloatMap;
-			std::map<float, float>::const_iterator it = m_mapOfMyFloatFloatMap.begin();
-			while (it != m_mapOfMyFloatFloatMap.end()) {
-			    sstrOfMyFloatFloatMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatFloatMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatFloatMap, packedOfMyFloatFloatMap);
 			
 			// Write string of elements.
 			if (numberOfMyFloatFloatMap > 0) {
-				s->write(5 + 7, sstrOfMyFloatFloatMap.str());
+				s->write(5 + 7, packedOfMyFloatFloatMap);
 			}
 		}
 		{
@@ -466,17 +447,13 @@
 			const uint32_t numberOfMyFloatDoubleMap = static_cast<uint32_t>(m_mapOfMyFloatDoubleMap.size());
 			s->write(6, numberOfMyFloatDoubleMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatDoubleMap;
-			std::map<float, double>::const_iterator it = m_mapOfMyFloatDoubleMap.begin();
-			while (it != m_mapOfMyFloatDoubleMap.end()) {
-			    sstrOfMyFloatDoubleMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatDoubleMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatDoubleMap, packedOfMyFloatDoubleMap);
 			
 			// Write string of elements.
 			if (numberOfMyFloatDoubleMap > 0) {
-				s->write(6 + 7, sstrOfMyFloatDoubleMap.str());
+				s->write(6 + 7, packedOfMyFloatDoubleMap);
 			}
 		}
 		{
@@ -484,17 +461,13 @@
 			const uint32_t numberOfMyFloatStringMap = static_cast<uint32_t>(m_mapOfMyFloatStringMap.size());
 			s->write(7, numberOfMyFloatStringMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyFloatStringMap;
-			std::map<float, std::string>::const_iterator it = m_mapOfMyFloatStringMap.begin();
-			while (it != m_mapOfMyFloatStringMap.end()) {
-			    sstrOfMyFloatStringMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyFloatStringMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyFloatStringMap, packedOfMyFloatStringMap);
 			
 			// Write string of elements.
 			if (numberOfMyFloatStringMap > 0) {
-				s->write(7 + 7, sstrOfMyFloatStringMap.str());
+				s->write(7 + 7, packedOfMyFloatStringMap);
 			}
 		}
 		return out;
@@ -518,42 +491,8 @@
 		    string elements;
 			d->read(1 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    bool _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatBoolMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatBoolMap, m_mapOfMyFloatBoolMap);
 		}
 		// Clean up the existing map of MyFloatCharMap.
 		m_mapOfMyFloatCharMap.clear();
@@ -567,42 +506,8 @@
 		    string elements;
 			d->read(2 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    char _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatCharMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatCharMap, m_mapOfMyFloatCharMap);
 		}
 		// Clean up the existing map of MyFloatInt32Map.
 		m_mapOfMyFloatInt32Map.clear();
@@ -616,42 +521,8 @@
 		    string elements;
 			d->read(3 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    int32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatInt32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatInt32Map, m_mapOfMyFloatInt32Map);
 		}
 		// Clean up the existing map of MyFloatUint32Map.
 		m_mapOfMyFloatUint32Map.clear();
@@ -665,42 +536,8 @@
 		    string elements;
 			d->read(4 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    uint32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatUint32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatUint32Map, m_mapOfMyFloatUint32Map);
 		}
 		// Clean up the existing map of MyFloatFloatMap.
 		m_mapOfMyFloatFloatMap.clear();
@@ -714,42 +551,8 @@
 		    string elements;
 			d->read(5 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    float _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatFloatMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatFloatMap, m_mapOfMyFloatFloatMap);
 		}
 		// Clean up the existing map of MyFloatDoubleMap.
 		m_mapOfMyFloatDoubleMap.clear();
@@ -763,42 +566,8 @@
 		    string elements;
 			d->read(6 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    double _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatDoubleMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatDoubleMap, m_mapOfMyFloatDoubleMap);
 		}
 		// Clean up the existing map of MyFloatStringMap.
 		m_mapOfMyFloatStringMap.clear();
@@ -812,42 +581,8 @@
 		    string elements;
 			d->read(7 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    float _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    std::string _value;
-		        getline(sstrValue, _value);
-		
-				// Store key/value pair.
-				putTo_MapOfMyFloatStringMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyFloatStringMap, m_mapOfMyFloatStringMap);
 		}
 		return in;
 	}
@@ -10,6 +10,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test12/generated/Test12MapInt32.h"
@@ -376,17 +377,13 @@
 			const uint32_t numberOfMyInt32BoolMap = static_cast<uint32_t>(m_mapOfMyInt32BoolMap.size());
 			s->write(1, numberOfMyInt32BoolMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyInt32BoolMap;
-			std::map<int32_t, bool>::const_iterator it = m_mapOfMyInt32BoolMap.begin();
-			while (it != m_mapOfMyInt32BoolMap.end()) {
-			    sstrOfMyInt32BoolMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyInt32BoolMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyInt32BoolMap, packedOfMyInt32BoolMap);
 			
 			// Write string of elements.
 			if (numberOfMyInt32BoolMap > 0) {
-				s->write(1 + 7, sstrOfMyInt32BoolMap.str());
+				s->write(1 + 7, packedOfMyInt32BoolMap);
 			}
 		}
 		{
@@ -394,17 +391,13 @@
 			const uint32_t numberOfMyInt32CharMap = static_cast<uint32_t>(m_mapOfMyInt32CharMap.size());
 			s->write(2, numberOfMyInt32CharMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyInt32CharMap;
-			std::map<int32_t, char>::const_iterator it = m_mapOfMyInt32CharMap.begin();
-			while (it != m_mapOfMyInt32CharMap.end()) {
-			    sstrOfMyInt32CharMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyInt32CharMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyInt32CharMap, packedOfMyInt32CharMap);
 			
 			// Write string of elements.
 			if (numberOfMyInt32CharMap > 0) {
-				s->write(2 + 7, sstrOfMyInt32CharMap.str());
+				s->write(2 + 7, packedOfMyInt32CharMap);
 			}
 		}
 		{
@@ -412,17 +405,13 @@
 			const uint32_t numberOfMyInt32Int32Map = static_cast<uint32_t>(m_mapOfMyInt32Int32Map.size());
 			s->write(3, numberOfMyInt32Int32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyInt32Int32Map;
-			std::map<int32_t, int32_t>::const_iterator it = m_mapOfMyInt32Int32Map.begin();
-			while (it != m_mapOfMyInt32Int32Map.end()) {
-			    sstrOfMyInt32Int32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyInt32Int32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyInt32Int32Map, packedOfMyInt32Int32Map);
 			
 			// Write string of elements.
 			if (numberOfMyInt32Int32Map > 0) {
-				s->write(3 + 7, sstrOfMyInt32Int32Map.str());
+				s->write(3 + 7, packedOfMyInt32Int32Map);
 			}
 		}
 		{
@@ -430,17 +419,13 @@
 			const uint32_t numberOfMyInt32Uint32Map = static_cast<uint32_t>(m_mapOfMyInt32Uint32Map.size());
 			s->write(4, numberOfMyInt32Uint32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyInt32Uint32Map;
-			std::map<int32_t, uint32_t>::const_iterator it = m_mapOfMyInt32Uint32Map.begin();
-			while (it != m_mapOfMyInt32Uint32Map.end()) {
-			    sstrOfMyInt32Uint32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyInt32Uint32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyInt32Uint32Map, packedOfMyInt32Uint32Map);
 			
 			// Write string of elements.
 			if (numberOfMyInt32Uint32Map > 0) {
-				s->write(4 + 7, sstrOfMyInt32Uint32Map.str());
+				s->write(4 + 7, packedOfMyInt32Uint32Map);
 			}
 		}
 		{
@@ -448,17 +433,13 @@
 			const uint32_t numberOfMyInt32FloatMap = static_cast<uint32_t>(m_mapOfMyInt32FloatMap.size());
 			s->write(5, numberOfMyInt32FloatMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyInt32FloatMap;
-			std::map<int32_t, float>::const_iterator it = m_mapOfMyInt32FloatMap.begin();
-			while (it != m_mapOfMyInt32FloatMap.end()) {
-			    sstrOfMyInt32FloatMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyInt32FloatMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyInt32FloatMap, packedOfMyInt32FloatMap);
 			
 			// Write string of elements.
 			if (numberOfMyInt32FloatMap > 0) {
-				s->write(5 + 7, sstrOfMyInt32FloatMap.str());
+				s->write(5 + 7, packedOfMyInt32FloatMap);
 			}
 		}
 		{
@@ -466,17 +447,13 @@
 			const uint32_t numberOfMyInt32DoubleMap = static_cast<uint32_t>(m_mapOfMyInt32DoubleMap.size());
 			s->write(6, numberOfMyInt32DoubleMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyInt32DoubleMap;
-			std::map<int32_t, double>::const_iterator it = m_mapOfMyInt32DoubleMap.begin();
-			while (it != m_mapOfMyInt32DoubleMap.end()) {
-			    sstrOfMyInt32DoubleMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyInt32DoubleMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyInt32DoubleMap, packedOfMyInt32DoubleMap);
 			
 			// Write string of elements.
 			if (numberOfMyInt32DoubleMap > 0) {
-				s->write(6 + 7, sstrOfMyInt32DoubleMap.str());
+				s->write(6 + 7, packedOfMyInt32DoubleMap);
 			}
 		}
 		{
@@ -484,17 +461,13 @@
 			const uint32_t numberOfMyInt32StringMap = static_cast<uint32_t>(m_mapOfMyInt32StringMap.size());
 			s->write(7, numberOfMyInt32StringMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyInt32StringMap;
-			std::map<int32_t, std::string>::const_iterator it = m_mapOfMyInt32StringMap.begin();
-			while (it != m_mapOfMyInt32StringMap.end()) {
-			    sstrOfMyInt32StringMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyInt32StringMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyInt32StringMap, packedOfMyInt32StringMap);
 			
 			// Write string of elements.
 			if (numberOfMyInt32StringMap > 0) {
-				s->write(7 + 7, sstrOfMyInt32StringMap.str());
+				s->write(7 + 7, packedOfMyInt32StringMap);
 			}
 		}
 		return out;
@@ -518,42 +491,8 @@
 		    string elements;
 			d->read(1 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    int32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    bool _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyInt32BoolMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyInt32BoolMap, m_mapOfMyInt32BoolMap);
 		}
 		// Clean up the existing map of MyInt32CharMap.
 		m_mapOfMyInt32CharMap.clear();
@@ -567,42 +506,8 @@
 		    string elements;
 			d->read(2 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    int32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    char _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyInt32CharMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyInt32CharMap, m_mapOfMyInt32CharMap);
 		}
 		// Clean up the existing map of MyInt32Int32Map.
 		m_mapOfMyInt32Int32Map.clear();
@@ -616,42 +521,8 @@
 		    string elements;
 			d->read(3 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    int32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    int32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyInt32Int32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyInt32Int32Map, m_mapOfMyInt32Int32Map);
 		}
 		// Clean up the existing map of MyInt32Uint32Map.
 		m_mapOfMyInt32Uint32Map.clear();
@@ -665,42 +536,8 @@
 		    string elements;
 			d->read(4 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    int32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    uint32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyInt32Uint32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyInt32Uint32Map, m_mapOfMyInt32Uint32Map);
 		}
 		// Clean up the existing map of MyInt32FloatMap.
 		m_mapOfMyInt32FloatMap.clear();
@@ -714,42 +551,8 @@
 		    string elements;
 			d->read(5 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    int32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    float _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyInt32FloatMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyInt32FloatMap, m_mapOfMyInt32FloatMap);
 		}
 		// Clean up the existing map of MyInt32DoubleMap.
 		m_mapOfMyInt32DoubleMap.clear();
@@ -763,42 +566,8 @@
 		    string elements;
 			d->read(6 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    int32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    double _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyInt32DoubleMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyInt32DoubleMap, m_mapOfMyInt32DoubleMap);
 		}
 		// Clean up the existing map of MyInt32StringMap.
 		m_mapOfMyInt32StringMap.clear();
@@ -812,42 +581,8 @@
 		    string elements;
 			d->read(7 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    int32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    std::string _value;
-		        getline(sstrValue, _value);
-		
-				// Store key/value pair.
-				putTo_MapOfMyInt32StringMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyInt32StringMap, m_mapOfMyInt32StringMap);
 		}
 		return in;
 	}
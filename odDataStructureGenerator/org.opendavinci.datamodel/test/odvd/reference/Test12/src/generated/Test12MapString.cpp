@@ -10,6 +10,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test12/generated/Test12MapString.h"
@@ -376,17 +377,13 @@
 			const uint32_t numberOfMyStringBoolMap = static_cast<uint32_t>(m_mapOfMyStringBoolMap.size());
 			s->write(1, numberOfMyStringBoolMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyStringBoolMap;
-			std::map<std::string, bool>::const_iterator it = m_mapOfMyStringBoolMap.begin();
-			while (it != m_mapOfMyStringBoolMap.end()) {
-			    sstrOfMyStringBoolMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyStringBoolMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyStringBoolMap, packedOfMyStringBoolMap);
 			
 			// Write string of elements.
 			if (numberOfMyStringBoolMap > 0) {
-				s->write(1 + 7, sstrOfMyStringBoolMap.str());
+				s->write(1 + 7, packedOfMyStringBoolMap);
 			}
 		}
 		{
@@ -394,17 +391,13 @@
 			const uint32_t numberOfMyStringCharMap = static_cast<uint32_t>(m_mapOfMyStringCharMap.size());
 			s->write(2, numberOfMyStringCharMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyStringCharMap;
-			std::map<std::string, char>::const_iterator it = m_mapOfMyStringCharMap.begin();
-			while (it != m_mapOfMyStringCharMap.end()) {
-			    sstrOfMyStringCharMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyStringCharMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyStringCharMap, packedOfMyStringCharMap);
 			
 			// Write string of elements.
 			if (numberOfMyStringCharMap > 0) {
-				s->write(2 + 7, sstrOfMyStringCharMap.str());
+				s->write(2 + 7, packedOfMyStringCharMap);
 			}
 		}
 		{
@@ -412,17 +405,13 @@
 			const uint32_t numberOfMyStringInt32Map = static_cast<uint32_t>(m_mapOfMyStringInt32Map.size());
 			s->write(3, numberOfMyStringInt32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyStringInt32Map;
-			std::map<std::string, int32_t>::const_iterator it = m_mapOfMyStringInt32Map.begin();
-			while (it != m_mapOfMyStringInt32Map.end()) {
-			    sstrOfMyStringInt32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyStringInt32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyStringInt32Map, packedOfMyStringInt32Map);
 			
 			// Write string of elements.
 			if (numberOfMyStringInt32Map > 0) {
-				s->write(3 + 7, sstrOfMyStringInt32Map.str());
+				s->write(3 + 7, packedOfMyStringInt32Map);
 			}
 		}
 		{
@@ -430,17 +419,13 @@
 			const uint32_t numberOfMyStringUint32Map = static_cast<uint32_t>(m_mapOfMyStringUint32Map.size());
 			s->write(4, numberOfMyStringUint32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyStringUint32Map;
-			std::map<std::string, uint32_t>::const_iterator it = m_mapOfMyStringUint32Map.begin();
-			while (it != m_mapOfMyStringUint32Map.end()) {
-			    sstrOfMyStringUint32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyStringUint32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyStringUint32Map, packedOfMyStringUint32Map);
 			
 			// Write string of elements.
 			if (numberOfMyStringUint32Map > 0) {
-				s->write(4 + 7, sstrOfMyStringUint32Map.str());
+				s->write(4 + 7, packedOfMyStringUint32Map);
 			}
 		}
 		{
@@ -448,17 +433,13 @@
 			const uint32_t numberOfMyStringFloatMap = static_cast<uint32_t>(m_mapOfMyStringFloatMap.size());
 			s->write(5, numberOfMyStringFloatMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyStringFloatMap;
-			std::map<std::string, float>::const_iterator it = m_mapOfMyStringFloatMap.begin();
-			while (it != m_mapOfMyStringFloatMap.end()) {
-			    sstrOfMyStringFloatMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyStringFloatMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyStringFloatMap, packedOfMyStringFloatMap);
 			
 			// Write string of elements.
 			if (numberOfMyStringFloatMap > 0) {
-				s->write(5 + 7, sstrOfMyStringFloatMap.str());
+				s->write(5 + 7, packedOfMyStringFloatMap);
 			}
 		}
 		{
@@ -466,17 +447,13 @@
 			const uint32_t numberOfMyStringDoubleMap = static_cast<uint32_t>(m_mapOfMyStringDoubleMap.size());
 			s->write(6, numberOfMyStringDoubleMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyStringDoubleMap;
-			std::map<std::string, double>::const_iterator it = m_mapOfMyStringDoubleMap.begin();
-			while (it != m_mapOfMyStringDoubleMap.end()) {
-			    sstrOfMyStringDoubleMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyStringDoubleMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyStringDoubleMap, packedOfMyStringDoubleMap);
 			
 			// Write string of elements.
 			if (numberOfMyStringDoubleMap > 0) {
-				s->write(6 + 7, sstrOfMyStringDoubleMap.str());
+				s->write(6 + 7, packedOfMyStringDoubleMap);
 			}
 		}
 		{
@@ -484,17 +461,13 @@
 			const uint32_t numberOfMyStringStringMap = static_cast<uint32_t>(m_mapOfMyStringStringMap.size());
 			s->write(7, numberOfMyStringStringMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyStringStringMap;
-			std::map<std::string, std::string>::const_iterator it = m_mapOfMyStringStringMap.begin();
-			while (it != m_mapOfMyStringStringMap.end()) {
-			    sstrOfMyStringStringMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyStringStringMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyStringStringMap, packedOfMyStringStringMap);
 			
 			// Write string of elements.
 			if (numberOfMyStringStringMap > 0) {
-				s->write(7 + 7, sstrOfMyStringStringMap.str());
+				s->write(7 + 7, packedOfMyStringStringMap);
 			}
 		}
 		return out;
@@ -518,42 +491,8 @@
 		    string elements;
 			d->read(1 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    std::string _key;
-		        getline(sstrKey, _key);
-		
-			    stringstream sstrValue(value);
-			    bool _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyStringBoolMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyStringBoolMap, m_mapOfMyStringBoolMap);
 		}
 		// Clean up the existing map of MyStringCharMap.
 		m_mapOfMyStringCharMap.clear();
@@ -567,42 +506,8 @@
 		    string elements;
 			d->read(2 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    std::string _key;
-		        getline(sstrKey, _key);
-		
-			    stringstream sstrValue(value);
-			    char _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyStringCharMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyStringCharMap, m_mapOfMyStringCharMap);
 		}
 		// Clean up the existing map of MyStringInt32Map.
 		m_mapOfMyStringInt32Map.clear();
@@ -616,42 +521,8 @@
 		    string elements;
 			d->read(3 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    std::string _key;
-		        getline(sstrKey, _key);
-		
-			    stringstream sstrValue(value);
-			    int32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyStringInt32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyStringInt32Map, m_mapOfMyStringInt32Map);
 		}
 		// Clean up the existing map of MyStringUint32Map.
 		m_mapOfMyStringUint32Map.clear();
@@ -665,42 +536,8 @@
 		    string elements;
 			d->read(4 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    std::string _key;
-		        getline(sstrKey, _key);
-		
-			    stringstream sstrValue(value);
-			    uint32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyStringUint32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyStringUint32Map, m_mapOfMyStringUint32Map);
 		}
 		// Clean up the existing map of MyStringFloatMap.
 		m_mapOfMyStringFloatMap.clear();
@@ -714,42 +551,8 @@
 		    string elements;
 			d->read(5 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    std::string _key;
-		        getline(sstrKey, _key);
-		
-			    stringstream sstrValue(value);
-			    float _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyStringFloatMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyStringFloatMap, m_mapOfMyStringFloatMap);
 		}
 		// Clean up the existing map of MyStringDoubleMap.
 		m_mapOfMyStringDoubleMap.clear();
@@ -763,42 +566,8 @@
 		    string elements;
 			d->read(6 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    std::string _key;
-		        getline(sstrKey, _key);
-		
-			    stringstream sstrValue(value);
-			    double _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyStringDoubleMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyStringDoubleMap, m_mapOfMyStringDoubleMap);
 		}
 		// Clean up the existing map of MyStringStringMap.
 		m_mapOfMyStringStringMap.clear();
@@ -812,42 +581,8 @@
 		    string elements;
 			d->read(7 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    std::string _key;
-		        getline(sstrKey, _key);
-		
-			    stringstream sstrValue(value);
-			    std::string _value;
-		        getline(sstrValue, _value);
-		
-				// Store key/value pair.
-				putTo_MapOfMyStringStringMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyStringStringMap, m_mapOfMyStringStringMap);
 		}
 		return in;
 	}
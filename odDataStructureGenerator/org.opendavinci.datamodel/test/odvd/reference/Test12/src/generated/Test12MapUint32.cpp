@@ -10,6 +10,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test12/generated/Test12MapUint32.h"
@@ -376,17 +377,13 @@
 			const uint32_t numberOfMyUint32BoolMap = static_cast<uint32_t>(m_mapOfMyUint32BoolMap.size());
 			s->write(1, numberOfMyUint32BoolMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyUint32BoolMap;
-			std::map<uint32_t, bool>::const_iterator it = m_mapOfMyUint32BoolMap.begin();
-			while (it != m_mapOfMyUint32BoolMap.end()) {
-			    sstrOfMyUint32BoolMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyUint32BoolMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyUint32BoolMap, packedOfMyUint32BoolMap);
 			
 			// Write string of elements.
 			if (numberOfMyUint32BoolMap > 0) {
-				s->write(1 + 7, sstrOfMyUint32BoolMap.str());
+				s->write(1 + 7, packedOfMyUint32BoolMap);
 			}
 		}
 		{
@@ -394,17 +391,13 @@
 			const uint32_t numberOfMyUint32CharMap = static_cast<uint32_t>(m_mapOfMyUint32CharMap.size());
 			s->write(2, numberOfMyUint32CharMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyUint32CharMap;
-			std::map<uint32_t, char>::const_iterator it = m_mapOfMyUint32CharMap.begin();
-			while (it != m_mapOfMyUint32CharMap.end()) {
-			    sstrOfMyUint32CharMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyUint32CharMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyUint32CharMap, packedOfMyUint32CharMap);
 			
 			// Write string of elements.
 			if (numberOfMyUint32CharMap > 0) {
-				s->write(2 + 7, sstrOfMyUint32CharMap.str());
+				s->write(2 + 7, packedOfMyUint32CharMap);
 			}
 		}
 		{
@@ -412,17 +405,13 @@
 			const uint32_t numberOfMyUint32Int32Map = static_cast<uint32_t>(m_mapOfMyUint32Int32Map.size());
 			s->write(3, numberOfMyUint32Int32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyUint32Int32Map;
-			std::map<uint32_t, int32_t>::const_iterator it = m_mapOfMyUint32Int32Map.begin();
-			while (it != m_mapOfMyUint32Int32Map.end()) {
-			    sstrOfMyUint32Int32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyUint32Int32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyUint32Int32Map, packedOfMyUint32Int32Map);
 			
 			// Write string of elements.
 			if (numberOfMyUint32Int32Map > 0) {
-				s->write(3 + 7, sstrOfMyUint32Int32Map.str());
+				s->write(3 + 7, packedOfMyUint32Int32Map);
 			}
 		}
 		{
@@ -430,17 +419,13 @@
 			const uint32_t numberOfMyUint32Uint32Map = static_cast<uint32_t>(m_mapOfMyUint32Uint32Map.size());
 			s->write(4, numberOfMyUint32Uint32Map);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyUint32Uint32Map;
-			std::map<uint32_t, uint32_t>::const_iterator it = m_mapOfMyUint32Uint32Map.begin();
-			while (it != m_mapOfMyUint32Uint32Map.end()) {
-			    sstrOfMyUint32Uint32Map << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyUint32Uint32Map;
+			odcore::base::PackedEncoding::encode(m_mapOfMyUint32Uint32Map, packedOfMyUint32Uint32Map);
 			
 			// Write string of elements.
 			if (numberOfMyUint32Uint32Map > 0) {
-				s->write(4 + 7, sstrOfMyUint32Uint32Map.str());
+				s->write(4 + 7, packedOfMyUint32Uint32Map);
 			}
 		}
 		{
@@ -448,17 +433,13 @@
 			const uint32_t numberOfMyUint32FloatMap = static_cast<uint32_t>(m_mapOfMyUint32FloatMap.size());
 			s->write(5, numberOfMyUint32FloatMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyUint32FloatMap;
-			std::map<uint32_t, float>::const_iterator it = m_mapOfMyUint32FloatMap.begin();
-			while (it != m_mapOfMyUint32FloatMap.end()) {
-			    sstrOfMyUint32FloatMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyUint32FloatMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyUint32FloatMap, packedOfMyUint32FloatMap);
 			
 			// Write string of elements.
 			if (numberOfMyUint32FloatMap > 0) {
-				s->write(5 + 7, sstrOfMyUint32FloatMap.str());
+				s->write(5 + 7, packedOfMyUint32FloatMap);
 			}
 		}
 		{
@@ -466,17 +447,13 @@
 			const uint32_t numberOfMyUint32DoubleMap = static_cast<uint32_t>(m_mapOfMyUint32DoubleMap.size());
 			s->write(6, numberOfMyUint32DoubleMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyUint32DoubleMap;
-			std::map<uint32_t, double>::const_iterator it = m_mapOfMyUint32DoubleMap.begin();
-			while (it != m_mapOfMyUint32DoubleMap.end()) {
-			    sstrOfMyUint32DoubleMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyUint32DoubleMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyUint32DoubleMap, packedOfMyUint32DoubleMap);
 			
 			// Write string of elements.
 			if (numberOfMyUint32DoubleMap > 0) {
-				s->write(6 + 7, sstrOfMyUint32DoubleMap.str());
+				s->write(6 + 7, packedOfMyUint32DoubleMap);
 			}
 		}
 		{
@@ -484,17 +461,13 @@
 			const uint32_t numberOfMyUint32StringMap = static_cast<uint32_t>(m_mapOfMyUint32StringMap.size());
 			s->write(7, numberOfMyUint32StringMap);
 		
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyUint32StringMap;
-			std::map<uint32_t, std::string>::const_iterator it = m_mapOfMyUint32StringMap.begin();
-			while (it != m_mapOfMyUint32StringMap.end()) {
-			    sstrOfMyUint32StringMap << it->first << "=" << it->second << endl;
-			    it++;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyUint32StringMap;
+			odcore::base::PackedEncoding::encode(m_mapOfMyUint32StringMap, packedOfMyUint32StringMap);
 			
 			// Write string of elements.
 			if (numberOfMyUint32StringMap > 0) {
-				s->write(7 + 7, sstrOfMyUint32StringMap.str());
+				s->write(7 + 7, packedOfMyUint32StringMap);
 			}
 		}
 		return out;
@@ -518,42 +491,8 @@
 		    string elements;
 			d->read(1 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    uint32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    bool _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyUint32BoolMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyUint32BoolMap, m_mapOfMyUint32BoolMap);
 		}
 		// Clean up the existing map of MyUint32CharMap.
 		m_mapOfMyUint32CharMap.clear();
@@ -567,42 +506,8 @@
 		    string elements;
 			d->read(2 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    uint32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    char _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyUint32CharMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyUint32CharMap, m_mapOfMyUint32CharMap);
 		}
 		// Clean up the existing map of MyUint32Int32Map.
 		m_mapOfMyUint32Int32Map.clear();
@@ -616,42 +521,8 @@
 		    string elements;
 			d->read(3 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    uint32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    int32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyUint32Int32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyUint32Int32Map, m_mapOfMyUint32Int32Map);
 		}
 		// Clean up the existing map of MyUint32Uint32Map.
 		m_mapOfMyUint32Uint32Map.clear();
@@ -665,42 +536,8 @@
 		    string elements;
 			d->read(4 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    uint32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    uint32_t _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyUint32Uint32Map(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyUint32Uint32Map, m_mapOfMyUint32Uint32Map);
 		}
 		// Clean up the existing map of MyUint32FloatMap.
 		m_mapOfMyUint32FloatMap.clear();
@@ -714,42 +551,8 @@
 		    string elements;
 			d->read(5 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    uint32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    float _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyUint32FloatMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyUint32FloatMap, m_mapOfMyUint32FloatMap);
 		}
 		// Clean up the existing map of MyUint32DoubleMap.
 		m_mapOfMyUint32DoubleMap.clear();
@@ -763,42 +566,8 @@
 		    string elements;
 			d->read(6 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    uint32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    double _value;
-		        sstrValue >> _value;
-		
-				// Store key/value pair.
-				putTo_MapOfMyUint32DoubleMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyUint32DoubleMap, m_mapOfMyUint32DoubleMap);
 		}
 		// Clean up the existing map of MyUint32StringMap.
 		m_mapOfMyUint32StringMap.clear();
@@ -812,42 +581,8 @@
 		    string elements;
 			d->read(7 + 7, elements);
 		
-			stringstream sstr(elements);
-		
-			while (!sstr.eof()) {
-			    string line;
-			    getline(sstr, line);
-		
-			    // Trying to find key-value-pair.
-			    size_t delimiter = line.find_first_of("=");
-		
-			    // Compute length of value-entry by allowing comments right after values.
-			    size_t valueLength = line.length();
-		
-			    // Skip lines with invalid position pointers.
-			    if (! ( (delimiter > 0) && (valueLength > 0) ) ) {
-			        continue;
-			    }
-		
-			    string key = line.substr(0, delimiter);
-			    string value = line.substr(delimiter + 1, valueLength);
-		
-			    // Skip lines with invalid keys or values.
-			    if ( (key.length() == 0) || (value.length() == 0) ) {
-			        continue;
-			    }
-		
-			    stringstream sstrKey(key);
-			    uint32_t _key;
-		        sstrKey >> _key;
-		
-			    stringstream sstrValue(value);
-			    std::string _value;
-		        getline(sstrValue, _value);
-		
-				// Store key/value pair.
-				putTo_MapOfMyUint32StringMap(_key, _value);
-			}
+			// Read actual elements; elements written by older versions are decoded as well.
+			odcore::base::PackedEncoding::decode(elements, numberOfMyUint32StringMap, m_mapOfMyUint32StringMap);
 		}
 		return in;
 	}
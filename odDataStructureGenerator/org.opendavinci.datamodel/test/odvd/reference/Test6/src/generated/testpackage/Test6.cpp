@@ -13,6 +13,7 @@
 #include "opendavinci/odcore/base/Deserializer.h"
 #include "opendavinci/odcore/base/SerializationFactory.h"
 #include "opendavinci/odcore/base/Serializer.h"
+#include "opendavinci/odcore/base/PackedEncoding.h"
 
 
 #include "test6/generated/testpackage/Test6.h"
@@ -245,16 +246,14 @@ namespace testpackage {
 			s->write(CRC32 < CharList<'n', CharList<'u', CharList<'m', CharList<'b', CharList<'e', CharList<'r', CharList<'O', CharList<'f', CharList<'M', CharList<'y', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > > > > > > > > > >  >::RESULT,
 			        numberOfMyStringList);
 			
-			// Write actual elements into a stringstream.
-			std::stringstream sstrOfMyStringList;
-			for (uint32_t i = 0; i < numberOfMyStringList; i++) {
-			    sstrOfMyStringList << m_listOfMyStringList.at(i) << endl;
-			}
+			// Write actual elements using the packed encoding.
+			std::string packedOfMyStringList;
+			odcore::base::PackedEncoding::encode(m_listOfMyStringList, packedOfMyStringList);
 			
 			// Write string of elements.
 			if (numberOfMyStringList > 0) {
 				s->write(CRC32 < CharList<'M', CharList<'y', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > >  >::RESULT,
-				        sstrOfMyStringList.str());
+				        packedOfMyStringList);
 			}
 			return out;
 		}
@@ -293,14 +292,8 @@ namespace testpackage {
 				d->read(CRC32 < CharList<'M', CharList<'y', CharList<'S', CharList<'t', CharList<'r', CharList<'i', CharList<'n', CharList<'g', CharList<'L', CharList<'i', CharList<'s', CharList<'t', NullType> > > > > > > > > > > >  >::RESULT,
 				   elements);
 			
-			    stringstream sstr(elements);
-			
-			    // Read actual elements from stringstream.
-			    for (uint32_t i = 0; i < numberOfMyStringList; i++) {
-			        std::string element;
-			        getline(sstr, element);
-			        m_listOfMyStringList.push_back(element);
-			    }
+			    // Read actual elements; elements written by older versions are decoded as well.
+			    odcore::base::PackedEncoding::decode(elements, numberOfMyStringList, m_listOfMyStringList);
 			}
 			return in;
 		}
@@ -87,6 +87,7 @@ namespace cockpit {
                     void pause();
                     void rewind();
                     void step();
+                    void seek();
 
                     void sendNextContainer();
 
@@ -101,6 +102,8 @@ namespace cockpit {
                     QPushButton *m_rewindBtn;
                     QPushButton *m_stepBtn;
                     QCheckBox *m_autoRewind;
+                    QPushButton *m_seekBtn;
+                    QLineEdit *m_seekTo;
                     QLabel *m_desc;
                     QLabel *m_containerCounterDesc;
                     int32_t m_containerCounter;
@@ -33,7 +33,7 @@
 #include <memory>
 #include "opendavinci/odcore/base/Mutex.h"
 #include "opendavinci/odcore/io/conference/ContainerListener.h"
-#include "opendavinci/odcore/wrapper/SharedMemory.h"
+#include "opendavinci/odcore/data/image/SharedImageChannel.h"
 #include "opendavinci/generated/odcore/data/image/SharedImage.h"
 
 class QImage;
@@ -92,7 +92,8 @@ namespace cockpit {
                 private:
                     mutable odcore::base::Mutex m_sharedImageMemoryMutex;
                     odcore::data::image::SharedImage m_sharedImage;
-                    std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedImageMemory;
+                    std::shared_ptr<odcore::data::image::SharedImageChannel> m_sharedImageChannel;
+                    vector<char> m_frame;
                     QImage *m_drawableImage;
                     QVector<QRgb> m_grayscale;
 
@@ -36,6 +36,7 @@
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
 #include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
 #include "opendavinci/odcore/io/URL.h"
 #include "opendavinci/odcore/io/conference/ContainerConference.h"
 #include "plugins/player/PlayerWidget.h"
@@ -65,6 +66,8 @@ namespace cockpit {
                 m_rewindBtn(NULL),
                 m_stepBtn(NULL),
                 m_autoRewind(NULL),
+                m_seekBtn(NULL),
+                m_seekTo(NULL),
                 m_desc(NULL),
                 m_containerCounterDesc(NULL),
                 m_containerCounter(0),
@@ -113,6 +116,19 @@ namespace cockpit {
                 operations->addWidget(m_stepBtn);
                 operations->addWidget(m_autoRewind);
 
+                // Seeking within the file.
+                m_seekBtn = new QPushButton("Seek", this);
+                m_seekBtn->setEnabled(false);
+                QObject::connect(m_seekBtn, SIGNAL(clicked()), this, SLOT(seek()));
+
+                QLabel *lblSeekTo = new QLabel(tr("Seconds from start:"));
+                m_seekTo = new QLineEdit();
+
+                QHBoxLayout *seeking = new QHBoxLayout();
+                seeking->addWidget(m_seekBtn);
+                seeking->addWidget(lblSeekTo);
+                seeking->addWidget(m_seekTo);
+
                 // Splitting file.
                 m_processBtn = new QPushButton("Split", this);
                 m_processBtn->setEnabled(false);
@@ -136,6 +152,7 @@ namespace cockpit {
                 mainLayout->addWidget(m_desc);
                 mainLayout->addWidget(m_containerCounterDesc);
                 mainLayout->addLayout(operations);
+                mainLayout->addLayout(seeking);
                 mainLayout->addLayout(splitting);
 
                 setLayout(mainLayout);
@@ -183,6 +200,33 @@ namespace cockpit {
                 sendNextContainer();
             }
 
+            void PlayerWidget::seek() {
+                if (m_player != NULL) {
+                    double seconds = 0;
+                    stringstream s_seekTo;
+                    s_seekTo << m_seekTo->text().toStdString();
+                    s_seekTo >> seconds;
+
+                    TimeStamp begin;
+                    TimeStamp end;
+                    if (m_player->getTimeRange(begin, end)) {
+                        const long offset = static_cast<long>(seconds * 1000 * 1000);
+                        TimeStamp target = begin + TimeStamp(static_cast<int32_t>(offset / (1000 * 1000)), static_cast<int32_t>(offset % (1000 * 1000)));
+
+                        if (!m_player->seekTo(target)) {
+                            QMessageBox msgBox;
+                            msgBox.setText("No data found at the specified time.");
+                            msgBox.exec();
+                        }
+                    }
+                    else {
+                        QMessageBox msgBox;
+                        msgBox.setText("No index available for the current recording.");
+                        msgBox.exec();
+                    }
+                }
+            }
+
             void PlayerWidget::sendNextContainer() {
                 if (m_player != NULL) {
                     if (!m_player->hasMoreData() && m_autoRewind->isChecked()) {
@@ -288,6 +332,7 @@ namespace cockpit {
                     m_pauseBtn->setEnabled(false);
                     m_stepBtn->setEnabled(true);
                     m_rewindBtn->setEnabled(false);
+                    m_seekBtn->setEnabled(true);
 
                     m_containerCounter = 0;
                     m_containerCounterTotal = 0;
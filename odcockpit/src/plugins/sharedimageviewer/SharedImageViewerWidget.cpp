@@ -33,7 +33,6 @@
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/data/Container.h"
-#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
 #include "plugins/sharedimageviewer/SharedImageViewerWidget.h"
 #include "opendavinci/generated/odcore/data/image/SharedImage.h"
 
@@ -55,7 +54,8 @@ namespace cockpit {
                 QWidget(prnt),
                 m_sharedImageMemoryMutex(),
                 m_sharedImage(),
-                m_sharedImageMemory(),
+                m_sharedImageChannel(),
+                m_frame(),
                 m_drawableImage(NULL),
                 m_grayscale(),
                 m_list(NULL),
@@ -100,8 +100,9 @@ namespace cockpit {
                         cerr << "Using shared image: " << si.toString() << endl;
                         setWindowTitle(QString::fromStdString(si.toString()));
 
-                        m_sharedImageMemory = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
+                        m_sharedImageChannel = std::shared_ptr<SharedImageChannel>(new SharedImageChannel(si));
                         m_sharedImage = si;
+                        m_frame.resize(si.getWidth() * si.getHeight() * si.getBytesPerPixel());
 
                         // Remove the selection box.
                         m_list->hide();
@@ -132,16 +133,16 @@ namespace cockpit {
             void SharedImageViewerWidget::paintEvent(QPaintEvent * /*evnt*/) {
                 Lock l(m_sharedImageMemoryMutex);
 
-                if ( (m_sharedImageMemory.get()) && (m_sharedImageMemory->isValid()) ) {
-                    m_sharedImageMemory->lock();
-
+                // Copy the newest image to not stall the producer while drawing.
+                if ( (m_sharedImageChannel.get()) && (m_sharedImageChannel->isValid()) && !m_frame.empty() &&
+                     (m_sharedImageChannel->read(&m_frame[0], static_cast<uint32_t>(m_frame.size()))) ) {
                     OPENDAVINCI_CORE_DELETE_POINTER(m_drawableImage);
                     if (m_sharedImage.getBytesPerPixel() == 3) {
-                        m_drawableImage = new QImage((uchar*)(static_cast<char*>(m_sharedImageMemory->getSharedMemory())), m_sharedImage.getWidth(), m_sharedImage.getHeight(), m_sharedImage.getBytesPerPixel() * m_sharedImage.getWidth(), QImage::Format_RGB888);
+                        m_drawableImage = new QImage((uchar*)(&m_frame[0]), m_sharedImage.getWidth(), m_sharedImage.getHeight(), m_sharedImage.getBytesPerPixel() * m_sharedImage.getWidth(), QImage::Format_RGB888);
                         *m_drawableImage = m_drawableImage->rgbSwapped();
                     }
                     else if (m_sharedImage.getBytesPerPixel() == 1) {
-                        m_drawableImage = new QImage((uchar*)(static_cast<char*>(m_sharedImageMemory->getSharedMemory())), m_sharedImage.getWidth(), m_sharedImage.getHeight(), m_sharedImage.getBytesPerPixel() * m_sharedImage.getWidth(), QImage::Format_Indexed8);
+                        m_drawableImage = new QImage((uchar*)(&m_frame[0]), m_sharedImage.getWidth(), m_sharedImage.getHeight(), m_sharedImage.getBytesPerPixel() * m_sharedImage.getWidth(), QImage::Format_Indexed8);
                         m_drawableImage->setColorTable(m_grayscale);
                     }
 
@@ -149,7 +150,6 @@ namespace cockpit {
                         QPainter widgetPainter(this);
                         widgetPainter.drawImage(0, 0, *m_drawableImage);
                     }
-                    m_sharedImageMemory->unlock();
                 }
             }
 
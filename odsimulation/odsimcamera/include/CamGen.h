@@ -126,6 +126,8 @@ class OpenGLGrabber;
 
         private:
             static CamGen* m_singleton;
+            int32_t m_argc;
+            char **m_argv;
             opendlv::data::environment::EgoState m_egoState;
             OpenGLGrabber *m_grabber;
             std::shared_ptr<core::wrapper::Image> m_image;
@@ -22,13 +22,16 @@
 
 #include <memory>
 #include "opendavinci/odcore/base/KeyValueConfiguration.h"
+#include "opendavinci/generated/odcore/data/image/SharedImage.h"
 #include "opendlv/data/camera/ImageGrabberID.h"
 #include "opendlv/io/camera/ImageGrabber.h"
 
 namespace core { namespace wrapper { class Image; } }
-namespace odcore { namespace wrapper { class SharedMemory; } }
+namespace odcore { namespace data { namespace image { class SharedImageChannel; } } }
 namespace opendlv { namespace data { namespace camera { class ImageGrabberCalibration; } } }
 namespace opendlv { namespace data { namespace environment { class EgoState; } } }
+namespace opendlv { namespace data { namespace environment { class Point3; } } }
+namespace opendlv { namespace threeD { class SoftwareRenderer; } }
 namespace opendlv { namespace threeD { class TransformGroup; } }
 
 namespace camgen {
@@ -37,7 +40,10 @@ namespace camgen {
 
     /**
      * This class implements a grabber providing images from
-     * a given OpenGL scene.
+     * a given OpenGL scene. If odsimcamera.renderer is set to
+     * software, the scene is rendered without OpenGL and any
+     * display by a SoftwareRenderer straight into the shared
+     * memory segment.
      */
     class OpenGLGrabber : public opendlv::io::camera::ImageGrabber {
         public:
@@ -83,20 +89,43 @@ namespace camgen {
 
             virtual ~OpenGLGrabber();
 
+            /**
+             * @return true if the images are rendered without OpenGL.
+             */
+            bool isHeadless() const;
+
             virtual void delay();
 
             virtual std::shared_ptr<core::wrapper::Image> getNextImage();
 
+            /**
+             * This method returns the description of the image
+             * published by the last call to getNextImage().
+             *
+             * @return SharedImage to be sent to the consumers.
+             */
+            const odcore::data::image::SharedImage getSharedImage() const;
+
             enum RENDERING m_render;
         private:
             odcore::base::KeyValueConfiguration m_kvc;
             std::shared_ptr<core::wrapper::Image> m_image;
-            std::shared_ptr<odcore::wrapper::SharedMemory> m_sharedMemory;
+            std::shared_ptr<odcore::data::image::SharedImageChannel> m_sharedImageChannel;
+            odcore::data::image::SharedImage m_sharedImage;
             std::shared_ptr<opendlv::threeD::TransformGroup> m_root;
             std::shared_ptr<opendlv::threeD::TransformGroup> m_extrinsicCalibrationRoot;
             std::shared_ptr<opendlv::threeD::TransformGroup> m_intrinsicCalibrationRoot;
+            std::shared_ptr<opendlv::threeD::SoftwareRenderer> m_softwareRenderer;
             opendlv::data::environment::EgoState &m_egoState;
 
+            /**
+             * This method prepares the software renderer for the next
+             * image using the same view as CamGen::display().
+             *
+             * @param background Background color.
+             */
+            void prepareSoftwareRenderer(const opendlv::data::environment::Point3 &background);
+
             /**
              * This method renders the real word.
              */
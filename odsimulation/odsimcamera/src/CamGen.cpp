@@ -20,9 +20,9 @@
 #include <GL/freeglut.h>
 #include <GL/gl.h>
 
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
-#include <ctime>
 #include <iostream>
 
 #include "CamGen.h"
@@ -79,6 +79,8 @@ namespace camgen {
 
     CamGen::CamGen(const int32_t &argc, char **argv) :
         TimeTriggeredConferenceClientModule(argc, argv, "odsimcamera"),
+        m_argc(argc),
+        m_argv(argv),
         m_egoState(),
         m_grabber(NULL),
         m_image(),
@@ -93,9 +95,6 @@ namespace camgen {
         m_mouseButton(0) {
 
         CamGen::m_singleton = this;
-
-        int32_t ac = argc;
-        glutInit(&ac, argv);
     }
 
     CamGen::~CamGen() {
@@ -110,9 +109,6 @@ namespace camgen {
         // Catch system exit.
         atexit(exit_func);
 
-        initGlut();
-        initGL();
-
         // Setup grabber.
         KeyValueConfiguration kvc = getKeyValueConfiguration();
 
@@ -120,11 +116,18 @@ namespace camgen {
         ImageGrabberCalibration calibration;
 
         m_grabber = new OpenGLGrabber(kvc, id, calibration, m_egoState);
+
+        // The software renderer does not need any window.
+        if (!m_grabber->isHeadless()) {
+            initGlut();
+            initGL();
+        }
     }
 
     void CamGen::tearDown() {}
 
     void CamGen::initGlut() {
+        glutInit(&m_argc, m_argv);
         glutInitDisplayMode(GLUT_DEPTH | GLUT_DOUBLE| GLUT_RGB);
         glutInitWindowPosition(50, 50);
         glutInitWindowSize(640, 480);
@@ -144,7 +147,7 @@ namespace camgen {
 
     void CamGen::drawScene() {
         static uint32_t frameCounter = 0;
-        static clock_t start = clock();
+        static std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
 
         Container container = getKeyValueDataStore().get(opendlv::data::environment::EgoState::ID());
         m_egoState = container.getData<opendlv::data::environment::EgoState>();
@@ -155,26 +158,20 @@ namespace camgen {
 
         // Share information about this image.
         if (m_image.get()) {
-            odcore::data::image::SharedImage si;
-            si.setWidth(m_image->getWidth());
-            si.setHeight(m_image->getHeight());
-            // TODO: Refactor me!
-            si.setBytesPerPixel(3);
-            si.setSize(si.getWidth() * si.getHeight() * si.getBytesPerPixel());
-            si.setName("odsimcamera");
+            // The grabber has published the image to its slot already.
+            odcore::data::image::SharedImage si = m_grabber->getSharedImage();
 
             Container c(si);
             getConference().send(c);
         }
 
         if ((frameCounter % 20) == 0) {
-            clock_t end = clock();
-            clock_t duration = end - start;
-            double seconds = (1000.0 * duration) / CLOCKS_PER_SEC;
-            seconds /= 1000.0;
+            // Wall clock time as clock() sums up the time of all threads.
+            const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+            const double seconds = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000000.0;
             cerr << "FPS: " << (frameCounter / seconds) << endl;
             frameCounter = 0;
-            start = clock();
+            start = end;
         }
 
         m_grabber->delay();
@@ -287,15 +284,23 @@ namespace camgen {
 
     odcore::data::dmcp::ModuleExitCodeMessage::ModuleExitCode CamGen::body() {
         while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
-            // Trigger event processing.
-            glutMainLoopEvent();
-
-            // Trigger a repaint event.
-            glutPostRedisplay();
+            if (m_grabber->isHeadless()) {
+                // Render the next image without any window.
+                drawScene();
+            }
+            else {
+                // Trigger event processing.
+                glutMainLoopEvent();
+
+                // Trigger a repaint event.
+                glutPostRedisplay();
+            }
         }
 
-        // Leave glut main loop.
-        glutLeaveMainLoop();
+        if (!m_grabber->isHeadless()) {
+            // Leave glut main loop.
+            glutLeaveMainLoop();
+        }
 
         return odcore::data::dmcp::ModuleExitCodeMessage::OKAY;
     }
@@ -20,6 +20,8 @@
 #include <GL/gl.h>
 #include <GL/glut.h>
 
+#include <algorithm>
+#include <cctype>
 #include <cstring>
 #include <iostream>
 #include <string>
@@ -27,12 +29,15 @@
 #include "opendavinci/odcore/opendavinci.h"
 #include "OpenGLGrabber.h"
 #include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/exceptions/Exceptions.h"
 #include "opendavinci/odcore/io/URL.h"
 #include "opendlv/core/wrapper/ImageFactory.h"
-#include "opendavinci/odcore/wrapper/SharedMemory.h"
-#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+#include "opendavinci/odcore/data/image/SharedImageChannel.h"
 #include "opendlv/scenario/SCNXArchiveFactory.h"
+#include "opendlv/data/environment/EgoState.h"
+#include "opendlv/data/environment/Point3.h"
 #include "opendlv/threeD/RenderingConfiguration.h"
+#include "opendlv/threeD/SoftwareRenderer.h"
 #include "opendlv/threeD/TransformGroup.h"
 #include "opendlv/threeD/decorator/DecoratorFactory.h"
 #include "opendlv/threeD/models/CheckerBoard.h"
@@ -62,12 +67,39 @@ namespace camgen {
             m_render(OpenGLGrabber::WORLD),
             m_kvc(kvc),
             m_image(),
-            m_sharedMemory(),
+            m_sharedImageChannel(),
+            m_sharedImage(),
             m_root(),
             m_extrinsicCalibrationRoot(),
             m_intrinsicCalibrationRoot(),
+            m_softwareRenderer(),
             m_egoState(egoState) {
 
+        // Select the renderer; OpenGL requires a display.
+        string renderer = "opengl";
+        try {
+            renderer = m_kvc.getValue<string>("odsimcamera.renderer");
+            transform(renderer.begin(), renderer.end(), renderer.begin(), ::tolower);
+        }
+        catch (odcore::exceptions::ValueForKeyNotFoundException &) {
+            // Keep OpenGL.
+        }
+
+        if (renderer == "software") {
+            uint32_t numberOfThreads = 0;
+            try {
+                numberOfThreads = m_kvc.getValue<uint32_t>("odsimcamera.renderer.threads");
+            }
+            catch (odcore::exceptions::ValueForKeyNotFoundException &) {
+                // Use all cores.
+            }
+
+            m_softwareRenderer = std::shared_ptr<SoftwareRenderer>(new SoftwareRenderer(640, 480, numberOfThreads));
+            m_softwareRenderer->setPerspective(60, 640.0/480.0, 1, 20);
+
+            cerr << "OpenGLGrabber uses the software renderer with " << m_softwareRenderer->getNumberOfThreads() << " thread(s)." << endl;
+        }
+
         const URL urlOfSCNXFile(m_kvc.getValue<string>("global.scenario"));
         const bool SHOW_GRID = (m_kvc.getValue<uint8_t>("global.showgrid") == 1);
         if (urlOfSCNXFile.isValid()) {
@@ -82,9 +114,16 @@ namespace camgen {
                 m_root->addChild(new Grid(NodeDescriptor("Grid"), 10, 2));
             }
 
-            m_sharedMemory = odcore::wrapper::SharedMemoryFactory::createSharedMemory("odsimcamera", 640 * 480 * 3);
+            odcore::data::image::SharedImage si;
+            si.setName("odsimcamera");
+            si.setWidth(640);
+            si.setHeight(480);
+            si.setBytesPerPixel(3);
+            si.setSize(si.getWidth() * si.getHeight() * si.getBytesPerPixel());
+            m_sharedImageChannel = std::shared_ptr<odcore::data::image::SharedImageChannel>(new odcore::data::image::SharedImageChannel(si, odcore::data::image::SharedImageChannel::DEFAULT_NUMBER_OF_SLOTS));
 
-            m_image = std::shared_ptr<core::wrapper::Image>(core::wrapper::ImageFactory::getInstance().getImage(640, 480, core::wrapper::Image::BGR_24BIT, static_cast<char*>(m_sharedMemory->getSharedMemory())));
+            // The image is rendered into local memory and published afterwards without waiting for any consumer.
+            m_image = std::shared_ptr<core::wrapper::Image>(core::wrapper::ImageFactory::getInstance().getImage(640, 480, core::wrapper::Image::BGR_24BIT));
 
             if (m_image.get()) {
                 cerr << "OpenGLGrabber initialized." << endl;
@@ -105,14 +144,19 @@ namespace camgen {
 
     OpenGLGrabber::~OpenGLGrabber() {}
 
+    bool OpenGLGrabber::isHeadless() const {
+        return (m_softwareRenderer.get() != NULL);
+    }
+
     void OpenGLGrabber::delay() {
-        Thread::usleepFor(1000 * 10);
+        // Without GLUT's event loop, the module's frequency paces the images.
+        if (!isHeadless()) {
+            Thread::usleepFor(1000 * 10);
+        }
     }
 
     std::shared_ptr<core::wrapper::Image> OpenGLGrabber::getNextImage() {
-        if ( (m_sharedMemory.get()) && (m_sharedMemory->isValid()) ) {
-            m_sharedMemory->lock();
-
+        if ( (m_sharedImageChannel.get()) && (m_sharedImageChannel->isValid()) && (m_image.get()) ) {
             // Render the image right before grabbing it.
             switch (m_render) {
                 case  OpenGLGrabber::WORLD:
@@ -126,20 +170,54 @@ namespace camgen {
                 break;
             }
 
-            // TODO Read pixels using BGRA!!!
-            glReadBuffer(GL_BACK);
-            glPixelStorei(GL_PACK_ALIGNMENT, 1);
-            glReadPixels(0, 0, m_image->getWidth(), m_image->getHeight(), GL_BGR, GL_UNSIGNED_BYTE, m_sharedMemory->getSharedMemory());
+            if (isHeadless()) {
+                // Rasterize straight into the next slot of the shared memory;
+                // m_image is only updated if there is no slot available.
+                char *slot = m_sharedImageChannel->beginWrite();
+                if (slot != NULL) {
+                    m_softwareRenderer->render(reinterpret_cast<uint8_t*>(slot));
+                    m_sharedImage = m_sharedImageChannel->endWrite();
+                }
+                else {
+                    m_softwareRenderer->render(reinterpret_cast<uint8_t*>(m_image->getRawData()));
+                    m_sharedImage = m_sharedImageChannel->write(m_image->getRawData(), m_image->getWidth() * m_image->getHeight() * 3);
+                }
+            }
+            else {
+                // TODO Read pixels using BGRA!!!
+                glReadBuffer(GL_BACK);
+                glPixelStorei(GL_PACK_ALIGNMENT, 1);
+                glReadPixels(0, 0, m_image->getWidth(), m_image->getHeight(), GL_BGR, GL_UNSIGNED_BYTE, m_image->getRawData());
 
-            // Flip the image horizontally.
-            m_image->flipHorizontally();
+                // Flip the image horizontally.
+                m_image->flipHorizontally();
 
-            m_sharedMemory->unlock();
+                // Publish the image.
+                m_sharedImage = m_sharedImageChannel->write(m_image->getRawData(), m_image->getWidth() * m_image->getHeight() * 3);
+            }
         }
 
         return m_image;
     }
 
+    const odcore::data::image::SharedImage OpenGLGrabber::getSharedImage() const {
+        return m_sharedImage;
+    }
+
+    void OpenGLGrabber::prepareSoftwareRenderer(const Point3 &background) {
+        m_softwareRenderer->clear(background);
+        m_softwareRenderer->loadIdentity();
+
+        Point3 dir = m_egoState.getRotation();
+        Point3 target(15, 0, 0);
+        target.rotateZ(dir.getAngleXY());
+        target += m_egoState.getPosition();
+
+        m_softwareRenderer->lookAt(Point3(m_egoState.getPosition().getX(), m_egoState.getPosition().getY(), 2.8),
+                                   Point3(target.getX(), target.getY(), 0),
+                                   Point3(0, 0, 1));
+    }
+
     void OpenGLGrabber::renderNextImageFromRealWord() {
 //        cerr << m_egoState.toString() << endl;
 
@@ -162,22 +240,36 @@ namespace camgen {
 //                          0, 0,  -1); // -1 is necessary to rotate the entire model by PI around the y-axis.
 
         RenderingConfiguration r = RenderingConfiguration();
+        if (isHeadless()) {
+            prepareSoftwareRenderer(Point3(0, 0.58, 0.78));
+            r.setSoftwareRenderer(m_softwareRenderer.get());
+        }
         m_root->render(r);
     }
 
     void OpenGLGrabber::renderNextImageFromIntrinsicCalibrationBody() {
-        glClearColor(0.5, 0.5, 0.5, 0);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
         RenderingConfiguration r = RenderingConfiguration();
+        if (isHeadless()) {
+            prepareSoftwareRenderer(Point3(0.5, 0.5, 0.5));
+            r.setSoftwareRenderer(m_softwareRenderer.get());
+        }
+        else {
+            glClearColor(0.5, 0.5, 0.5, 0);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        }
         m_intrinsicCalibrationRoot->render(r);
     }
 
     void OpenGLGrabber::renderNextImageFromExtrinsicCalibrationBody() {
-        glClearColor(0.5, 0.5, 0.5, 0);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-
         RenderingConfiguration r = RenderingConfiguration();
+        if (isHeadless()) {
+            prepareSoftwareRenderer(Point3(0.5, 0.5, 0.5));
+            r.setSoftwareRenderer(m_softwareRenderer.get());
+        }
+        else {
+            glClearColor(0.5, 0.5, 0.5, 0);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        }
         m_extrinsicCalibrationRoot->render(r);
 /*
         double *m_model = new double[16];
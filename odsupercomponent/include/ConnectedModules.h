@@ -65,6 +65,29 @@ class ConnectedModule;
              */
             void pulseShift(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &shift);
 
+            /**
+             * This method parses the value of odsupercomponent.pulsetimeack.parallel:
+             * groups are separated by ';' and the modules within a group by ','.
+             * Names are converted to lower case, blanks are removed, and empty
+             * entries are skipped.
+             *
+             * @param s Value to be parsed.
+             * @return Groups of independent modules.
+             */
+            static vector<vector<string> > parseIndependentModules(const string &s);
+
+            /**
+             * This method sets groups of modules that do not depend on
+             * each other's containers within one execution cycle. The
+             * modules of one group are pulsed concurrently and their
+             * ACKs are awaited with a single deadline; all other modules
+             * are pulsed one after another in alphabetical order. A group
+             * is pulsed at the position of its alphabetically first member.
+             *
+             * @param independentModules Groups of independent modules (lower case names).
+             */
+            void setIndependentModules(const vector<vector<string> > &independentModules);
+
             /**
              * This method sends a pulse to all connected modules and
              * requires an ACK confirmation sent from the respective,
@@ -93,8 +116,19 @@ class ConnectedModule;
             void deleteAllModules();
 
         protected:
+            /**
+             * This method returns the modules to be pulsed in their
+             * order; modules in the same stage are pulsed concurrently.
+             * It must be called while holding m_modulesMutex.
+             *
+             * @param modulesToIgnore Modules that are skipped when sending the pulse signal.
+             * @return Stages of modules.
+             */
+            vector<vector<ConnectedModule*> > getStages(const vector<string> &modulesToIgnore);
+
             odcore::base::Mutex m_modulesMutex;
             map<string, ConnectedModule*> m_modules;
+            vector<vector<string> > m_independentModules;
 
         private:
             ConnectedModules(const ConnectedModule &);
@@ -19,6 +19,7 @@
  */
 
 #include <algorithm>
+#include <sstream>
 
 #include "opendavinci/odcore/opendavinci.h"
 
@@ -29,6 +30,7 @@
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/data/TimeStamp.h"
 #include "opendavinci/odcore/dmcp/connection/ModuleConnection.h"
+#include "opendavinci/odcore/strings/StringToolbox.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleDescriptor.h"
 #include "opendavinci/generated/odcore/data/dmcp/PulseMessage.h"
 
@@ -38,10 +40,12 @@ namespace odsupercomponent {
     using namespace odcore::base;
     using namespace odcore::data;
     using namespace odcore::data::dmcp;
+    using namespace odcore::strings;
 
     ConnectedModules::ConnectedModules() :
         m_modulesMutex(),
-        m_modules()
+        m_modules(),
+        m_independentModules()
     {}
 
     ConnectedModules::~ConnectedModules() {
@@ -96,27 +100,103 @@ namespace odsupercomponent {
         }
     }
 
-    void ConnectedModules::pulse_ack(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield, const vector<string> &modulesToIgnore) {
-        // Unfortunately, we cannot prevent code duplication here (cf. pulse_ack_containers)
-        // as in this case, the dependent client module will NOT send its containers to using
-        // this TCP link but via the regular UDP multicast conference.
+    vector<vector<string> > ConnectedModules::parseIndependentModules(const string &s) {
+        string value = s;
+        transform(value.begin(), value.end(), value.begin(), ::tolower);
+
+        // StringToolbox::split would drop a value without any delimiter
+        // (e.g. a single group); thus, tokenize with getline instead.
+        vector<vector<string> > independentModules;
+        stringstream groups(value);
+        string g;
+        while (getline(groups, g, ';')) {
+            vector<string> group;
+            stringstream modules(g);
+            string module;
+            while (getline(modules, module, ',')) {
+                StringToolbox::trim(module);
+                if (module.size() > 0) {
+                    group.push_back(module);
+                }
+            }
+            if (group.size() > 0) {
+                independentModules.push_back(group);
+            }
+        }
+        return independentModules;
+    }
+
+    void ConnectedModules::setIndependentModules(const vector<vector<string> > &independentModules) {
         Lock l(m_modulesMutex);
-        map<string, ConnectedModule*>::iterator iter;
+        m_independentModules = independentModules;
+    }
+
+    vector<vector<ConnectedModule*> > ConnectedModules::getStages(const vector<string> &modulesToIgnore) {
+        vector<vector<ConnectedModule*> > stages;
+
+        // Stage for each group of independent modules.
+        map<uint32_t, uint32_t> stageForGroup;
 
+        map<string, ConnectedModule*>::iterator iter;
         for (iter = m_modules.begin(); iter != m_modules.end(); ++iter) {
             // Get the module's name.
             string s = iter->first;
             transform(s.begin(), s.end(), s.begin(), ::tolower);
 
             // Check whether we have to skip this module when sending pulses.
-            vector<string>::const_iterator it = find(modulesToIgnore.begin(), modulesToIgnore.end(), s);
-            if (it == modulesToIgnore.end()) {
-                // The following call blocks until the client has confirmed the processing of this pulse.
-                iter->second->getConnection().pulse_ack(pm, timeout);
+            if (find(modulesToIgnore.begin(), modulesToIgnore.end(), s) != modulesToIgnore.end()) {
+                continue;
+            }
+
+            // Independent modules join the stage of their group.
+            bool added = false;
+            for (uint32_t group = 0; (group < m_independentModules.size()) && !added; group++) {
+                if (find(m_independentModules.at(group).begin(), m_independentModules.at(group).end(), s) != m_independentModules.at(group).end()) {
+                    map<uint32_t, uint32_t>::iterator stage = stageForGroup.find(group);
+                    if (stage == stageForGroup.end()) {
+                        stageForGroup[group] = static_cast<uint32_t>(stages.size());
+                        stages.push_back(vector<ConnectedModule*>());
+                        stages.back().push_back(iter->second);
+                    }
+                    else {
+                        stages.at(stage->second).push_back(iter->second);
+                    }
+                    added = true;
+                }
+            }
+
+            // All other modules are pulsed sequentially.
+            if (!added) {
+                stages.push_back(vector<ConnectedModule*>(1, iter->second));
+            }
+        }
 
-                // Allow delivery of packets on OS level.
-                Thread::usleepFor(yield);
+        return stages;
+    }
+
+    void ConnectedModules::pulse_ack(const odcore::data::dmcp::PulseMessage &pm, const uint32_t &timeout, const uint32_t &yield, const vector<string> &modulesToIgnore) {
+        // Unfortunately, we cannot prevent code duplication here (cf. pulse_ack_containers)
+        // as in this case, the dependent client module will NOT send its containers to using
+        // this TCP link but via the regular UDP multicast conference.
+        Lock l(m_modulesMutex);
+        const vector<vector<ConnectedModule*> > stages = getStages(modulesToIgnore);
+
+        vector<vector<ConnectedModule*> >::const_iterator stage;
+        for (stage = stages.begin(); stage != stages.end(); ++stage) {
+            // Pulse all modules of this stage at once.
+            vector<ConnectedModule*>::const_iterator iter;
+            for (iter = stage->begin(); iter != stage->end(); ++iter) {
+                (*iter)->getConnection().sendPulseAck(pm);
             }
+
+            // The following calls block until the clients have confirmed the processing of this pulse.
+            const TimeStamp deadline = TimeStamp() + TimeStamp(static_cast<int32_t>(timeout / 1000), static_cast<int32_t>((timeout % 1000) * 1000));
+            for (iter = stage->begin(); iter != stage->end(); ++iter) {
+                (*iter)->getConnection().waitForPulseAck(deadline);
+            }
+
+            // Allow delivery of packets on OS level.
+            Thread::usleepFor(yield);
         }
     }
 
@@ -127,25 +207,27 @@ namespace odsupercomponent {
         vector<Container> allContainersToBeDeliveredInNextCycle;
 
         Lock l(m_modulesMutex);
-        map<string, ConnectedModule*>::iterator iter;
-
-        for (iter = m_modules.begin(); iter != m_modules.end(); ++iter) {
-            // Get the module's name.
-            string s = iter->first;
-            transform(s.begin(), s.end(), s.begin(), ::tolower);
+        const vector<vector<ConnectedModule*> > stages = getStages(modulesToIgnore);
+
+        vector<vector<ConnectedModule*> >::const_iterator stage;
+        for (stage = stages.begin(); stage != stages.end(); ++stage) {
+            // Pulse all modules of this stage at once.
+            vector<ConnectedModule*>::const_iterator iter;
+            for (iter = stage->begin(); iter != stage->end(); ++iter) {
+                (*iter)->getConnection().sendPulseAckContainers(pm);
+            }
 
-            // Check whether we have to skip this module when sending pulses.
-            vector<string>::const_iterator it = find(modulesToIgnore.begin(), modulesToIgnore.end(), s);
-            if (it == modulesToIgnore.end()) {
-                // The following call blocks until the client has confirmed the processing of this pulse.
-                vector<Container> containersToBeDeliveredInNextCycle = iter->second->getConnection().pulse_ack_containers(pm, timeout);
+            // The following calls block until the clients have confirmed the processing of this pulse.
+            const TimeStamp deadline = TimeStamp() + TimeStamp(static_cast<int32_t>(timeout / 1000), static_cast<int32_t>((timeout % 1000) * 1000));
+            for (iter = stage->begin(); iter != stage->end(); ++iter) {
+                vector<Container> containersToBeDeliveredInNextCycle = (*iter)->getConnection().waitForPulseAckContainers(deadline);
 
                 // Add newly received containers to the overall list.
                 allContainersToBeDeliveredInNextCycle.insert(allContainersToBeDeliveredInNextCycle.end(), containersToBeDeliveredInNextCycle.begin(), containersToBeDeliveredInNextCycle.end());
-
-                // Allow delivery of packets on OS level.
-                Thread::usleepFor(yield);
             }
+
+            // Allow delivery of packets on OS level.
+            Thread::usleepFor(yield);
         }
 
         return allContainersToBeDeliveredInNextCycle;
@@ -45,6 +45,9 @@
 #include "opendavinci/odcore/io/conference/ContainerConference.h"
 #include "opendavinci/odcore/io/conference/ContainerConferenceFactory.h"
 #include "opendavinci/odcore/strings/StringToolbox.h"
+#ifndef WIN32
+    #include "opendavinci/odcore/wrapper/POSIX/POSIXReactor.h"
+#endif
 #include "opendavinci/generated/odcore/data/dmcp/ModuleDescriptor.h"
 #include "opendavinci/generated/odcore/data/dmcp/ModuleStatistic.h"
 
@@ -102,6 +105,16 @@ namespace odsupercomponent {
         // Parse command line arguments.
         parseAdditionalCommandLineParameters(argc, argv);
 
+#ifndef WIN32
+        // Number of threads receiving data from all connected modules.
+        try {
+            odcore::wrapper::POSIX::POSIXReactor::getInstance().setNumberOfThreads(m_configuration.getValue<uint32_t>("global.reactor.threads"));
+        }
+        catch(...) {
+            // If "global.reactor.threads" is not specified, one thread is used.
+        }
+#endif
+
         const uint32_t SERVER_PORT = odcore::data::dmcp::Constants::CONNECTIONSERVER_PORT_BASE + getCID();
         // Listen on all interfaces.
         ServerInformation serverInformation("0.0.0.0", SERVER_PORT, m_managedLevel);
@@ -120,7 +133,10 @@ namespace odsupercomponent {
         m_connectionServer = new connection::Server(serverInformation, m_configurationProvider);
         m_connectionServer->setConnectionHandler(this);
 
-        m_conference = std::shared_ptr<ContainerConference>(ContainerConferenceFactory::getInstance().getContainerConference(getMultiCastGroup()));
+        // Select the conference's transport (e.g. shared memory) before joining; the modules on this host follow this configuration
+        // while the modules on other hosts are reached via UDP multicast through our bridged conference.
+        ContainerConferenceFactory::getInstance().configureTransport(getMultiCastGroup(), m_configuration, "127.0.0.1");
+        m_conference = ContainerConferenceFactory::getInstance().getBridgedContainerConference(getMultiCastGroup());
         m_conference->setContainerListener(this);
 
         CLOG1 << "[odsupercomponent" << (isRealtime() ? " - real time mode" : "") << "]: Ready - managed level " << m_managedLevel << endl;
@@ -270,6 +286,14 @@ namespace odsupercomponent {
                     // If "odsupercomponent.pulsetimeack.exclude" is not specified, just ignore exception.
                 }
 
+                try {
+                    const string s = m_configuration.getValue<string>("odsupercomponent.pulsetimeack.parallel");
+                    m_modules.setIndependentModules(ConnectedModules::parseIndependentModules(s));
+                }
+                catch(...) {
+                    // If "odsupercomponent.pulsetimeack.parallel" is not specified, all modules are pulsed sequentially.
+                }
+
             }
         }
     }
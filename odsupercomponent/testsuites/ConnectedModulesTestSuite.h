@@ -0,0 +1,271 @@
+/**
+ * odsupercomponent - Configuration and monitoring component for
+ *                    distributed software systems
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef CONNECTEDMODULESTESTSUITE_H_
+#define CONNECTEDMODULESTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "opendavinci/odcore/opendavinci.h"
+#include "opendavinci/odcore/base/Condition.h"
+#include "opendavinci/odcore/base/KeyValueConfiguration.h"
+#include "opendavinci/odcore/base/Lock.h"
+#include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/dmcp/ModuleConfigurationProvider.h"
+#include "opendavinci/odcore/dmcp/connection/ModuleConnection.h"
+#include "opendavinci/odcore/io/Connection.h"
+#include "opendavinci/odcore/io/ConnectionAcceptor.h"
+#include "opendavinci/odcore/io/ConnectionAcceptorListener.h"
+#include "opendavinci/odcore/io/conference/ContainerListener.h"
+
+#include "opendavinci/GeneratedHeaders_OpenDaVINCI.h"
+
+#include "../include/ConnectedModule.h"
+#include "../include/ConnectedModules.h"
+
+using namespace std;
+using namespace odcore::base;
+using namespace odcore::data;
+using namespace odcore::data::dmcp;
+using namespace odcore::dmcp;
+using namespace odcore::dmcp::connection;
+using namespace odcore::io;
+using namespace odcore::io::conference;
+using namespace odsupercomponent;
+
+class ConnectedModulesTestConfigurationProvider : public ModuleConfigurationProvider {
+    public:
+        ConnectedModulesTestConfigurationProvider() {}
+
+        virtual ~ConnectedModulesTestConfigurationProvider() {}
+
+        virtual KeyValueConfiguration getConfiguration(const ModuleDescriptor &/*md*/) {
+            return KeyValueConfiguration();
+        }
+};
+
+class ConnectedModulesTestAcceptorListener : public ConnectionAcceptorListener {
+    public:
+        ConnectedModulesTestAcceptorListener() :
+            m_connectionsCondition(),
+            m_connections() {}
+
+        virtual ~ConnectedModulesTestAcceptorListener() {}
+
+        virtual void onNewConnection(std::shared_ptr<Connection> connection) {
+            Lock l(m_connectionsCondition);
+            m_connections.push_back(connection);
+            m_connectionsCondition.wakeAll();
+        }
+
+        std::shared_ptr<Connection> waitForConnection(const uint32_t &index) {
+            Lock l(m_connectionsCondition);
+            while (m_connections.size() <= index) {
+                m_connectionsCondition.waitOnSignal();
+            }
+            return m_connections.at(index);
+        }
+
+    private:
+        Condition m_connectionsCondition;
+        vector<std::shared_ptr<Connection> > m_connections;
+};
+
+/**
+ * Client side of a module: it answers a pulse either with an ACK
+ * carrying one container or not at all (i.e. the module is too slow).
+ */
+class ConnectedModulesTestClient : public ContainerListener {
+    public:
+        ConnectedModulesTestClient(const uint32_t &port, const bool &acknowledge) :
+            m_connection("127.0.0.1", port),
+            m_acknowledge(acknowledge) {
+            m_connection.setContainerListener(this);
+            m_connection.start();
+        }
+
+        virtual ~ConnectedModulesTestClient() {
+            m_connection.setContainerListener(NULL);
+            m_connection.stop();
+        }
+
+        virtual void nextContainer(Container &c) {
+            if (m_acknowledge && (c.getDataType() == PulseMessage::ID())) {
+                PulseAckContainersMessage pac;
+                vector<Container> containers;
+                containers.push_back(Container(TimeStamp()));
+                pac.setListOfContainers(containers);
+
+                Container ack(pac);
+                m_connection.send(ack);
+            }
+        }
+
+    private:
+        Connection m_connection;
+        bool m_acknowledge;
+};
+
+class ConnectedModulesTestModules : public ConnectedModules {
+    public:
+        ConnectedModulesTestModules() :
+            ConnectedModules() {}
+
+        virtual ~ConnectedModulesTestModules() {}
+
+        vector<vector<string> > getStageNames(const vector<string> &modulesToIgnore) {
+            Lock l(m_modulesMutex);
+            const vector<vector<ConnectedModule*> > stages = getStages(modulesToIgnore);
+
+            vector<vector<string> > names;
+            for (uint32_t i = 0; i < stages.size(); i++) {
+                names.push_back(vector<string>());
+                for (uint32_t j = 0; j < stages.at(i).size(); j++) {
+                    map<string, ConnectedModule*>::const_iterator it = m_modules.begin();
+                    while ((it != m_modules.end()) && (it->second != stages.at(i).at(j))) {
+                        ++it;
+                    }
+                    names.back().push_back(it->first);
+                }
+            }
+            return names;
+        }
+};
+
+class ConnectedModulesTest : public CxxTest::TestSuite {
+    public:
+        void testParseIndependentModules() {
+            vector<vector<string> > groups = ConnectedModules::parseIndependentModules("ModuleA,moduleB;moduleC , moduleD;;moduleE,");
+            TS_ASSERT(groups.size() == 3);
+            TS_ASSERT(groups.at(0).size() == 2);
+            TS_ASSERT(groups.at(0).at(0) == "modulea");
+            TS_ASSERT(groups.at(0).at(1) == "moduleb");
+            TS_ASSERT(groups.at(1).size() == 2);
+            TS_ASSERT(groups.at(1).at(0) == "modulec");
+            TS_ASSERT(groups.at(1).at(1) == "moduled");
+            TS_ASSERT(groups.at(2).size() == 1);
+            TS_ASSERT(groups.at(2).at(0) == "modulee");
+
+            // A single group without any ';'.
+            groups = ConnectedModules::parseIndependentModules("a,b");
+            TS_ASSERT(groups.size() == 1);
+            TS_ASSERT(groups.at(0).size() == 2);
+
+            TS_ASSERT(ConnectedModules::parseIndependentModules("").size() == 0);
+        }
+
+        void testStagesKeepOrderOfUnlistedModules() {
+            ConnectedModulesTestModules modules;
+
+            // getStages does not use the connections.
+            const string names[] = { "e", "d", "c", "b", "a" };
+            for (uint32_t i = 0; i < 5; i++) {
+                modules.addModule(ModuleDescriptor(names[i], "", "", 0), new ConnectedModule(std::shared_ptr<ModuleConnection>(), ModuleStateMessage::NOT_RUNNING));
+            }
+
+            // Without groups, all modules are pulsed one after another in alphabetical order.
+            vector<vector<string> > stages = modules.getStageNames(vector<string>());
+            TS_ASSERT(stages.size() == 5);
+            for (uint32_t i = 0; i < stages.size(); i++) {
+                TS_ASSERT(stages.at(i).size() == 1);
+                TS_ASSERT(stages.at(i).at(0) == names[4 - i]);
+            }
+
+            // The group is pulsed at the position of its first member; the others are unchanged.
+            modules.setIndependentModules(ConnectedModules::parseIndependentModules("d,b"));
+            vector<string> modulesToIgnore;
+            modulesToIgnore.push_back("e");
+            stages = modules.getStageNames(modulesToIgnore);
+            TS_ASSERT(stages.size() == 3);
+            TS_ASSERT(stages.at(0).size() == 1);
+            TS_ASSERT(stages.at(0).at(0) == "a");
+            TS_ASSERT(stages.at(1).size() == 2);
+            TS_ASSERT(stages.at(1).at(0) == "b");
+            TS_ASSERT(stages.at(1).at(1) == "d");
+            TS_ASSERT(stages.at(2).size() == 1);
+            TS_ASSERT(stages.at(2).at(0) == "c");
+
+            // Remove the modules without connections before deleting them.
+            for (uint32_t i = 0; i < 5; i++) {
+                ConnectedModule *cm = modules.getModule(ModuleDescriptor(names[i], "", "", 0));
+                modules.removeModule(ModuleDescriptor(names[i], "", "", 0));
+                delete cm;
+            }
+        }
+
+        void testSingleDeadlineForGroup() {
+            const uint32_t PORT = 19100;
+            const uint32_t TIMEOUT = 1000;
+
+            ConnectedModulesTestConfigurationProvider configurationProvider;
+            ConnectedModulesTestAcceptorListener acceptorListener;
+            ConnectionAcceptor acceptor(PORT);
+            acceptor.setConnectionAcceptorListener(&acceptorListener);
+            acceptor.start();
+
+            // Module a answers, modules b and c never do.
+            ConnectedModulesTestClient a(PORT, true);
+            std::shared_ptr<Connection> connectionA = acceptorListener.waitForConnection(0);
+            ConnectedModulesTestClient b(PORT, false);
+            std::shared_ptr<Connection> connectionB = acceptorListener.waitForConnection(1);
+            ConnectedModulesTestClient c(PORT, false);
+            std::shared_ptr<Connection> connectionC = acceptorListener.waitForConnection(2);
+
+            {
+                ConnectedModules modules;
+                modules.addModule(ModuleDescriptor("a", "", "", 0), new ConnectedModule(std::shared_ptr<ModuleConnection>(new ModuleConnection(connectionA, configurationProvider)), ModuleStateMessage::NOT_RUNNING));
+                modules.addModule(ModuleDescriptor("b", "", "", 0), new ConnectedModule(std::shared_ptr<ModuleConnection>(new ModuleConnection(connectionB, configurationProvider)), ModuleStateMessage::NOT_RUNNING));
+                modules.addModule(ModuleDescriptor("c", "", "", 0), new ConnectedModule(std::shared_ptr<ModuleConnection>(new ModuleConnection(connectionC, configurationProvider)), ModuleStateMessage::NOT_RUNNING));
+                modules.setIndependentModules(ConnectedModules::parseIndependentModules("a,b,c"));
+
+                // The timing out modules of one group share a single deadline.
+                PulseMessage pm;
+                TimeStamp before;
+                vector<Container> containers = modules.pulse_ack_containers(pm, TIMEOUT, 0, vector<string>());
+                TimeStamp after;
+
+                const int64_t duration = (after - before).toMicroseconds() / 1000;
+                TS_ASSERT(duration >= (TIMEOUT - 10));
+                TS_ASSERT(duration < (2 * TIMEOUT - 200));
+
+                // The containers from the module that answered are still collected.
+                TS_ASSERT(containers.size() == 1);
+                TS_ASSERT(containers.at(0).getDataType() == TimeStamp::ID());
+
+                // The same applies to pulse_ack.
+                before = TimeStamp();
+                modules.pulse_ack(pm, TIMEOUT, 0, vector<string>());
+                after = TimeStamp();
+                const int64_t durationAck = (after - before).toMicroseconds() / 1000;
+                TS_ASSERT(durationAck >= (TIMEOUT - 10));
+                TS_ASSERT(durationAck < (2 * TIMEOUT - 200));
+            }
+
+            acceptor.stop();
+        }
+};
+
+#endif /*CONNECTEDMODULESTESTSUITE_H_*/
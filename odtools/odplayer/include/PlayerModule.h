@@ -32,8 +32,22 @@ namespace odplayer {
     /**
      * This class can be used to replay previously recorded
      * data using a conference for distribution.
+     *
+     * If odplayer.batched is set, the containers are not sent one
+     * by one with a sleep in between but in bursts of all containers
+     * that are due according to a virtual clock. The virtual clock
+     * advances by the elapsed time divided by odplayer.timeScale;
+     * for a time scale factor of 0, the data is replayed as fast as
+     * possible. If odsupercomponent runs in ML_SIMULATION, its pulses
+     * drive the virtual clock.
      */
     class PlayerModule : public odcore::base::module::TimeTriggeredConferenceClientModule {
+        public:
+            enum BATCHED_REPLAY {
+                MAX_CONTAINERS_PER_BURST = 1000, // Containers per cycle before checking for commands again.
+                MAX_WAITING_TIME = 10000         // Waiting time in us before checking for commands again.
+            };
+
         private:
             /**
              * "Forbidden" copy constructor. Goal: The compiler should warn
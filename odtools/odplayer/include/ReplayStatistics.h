@@ -0,0 +1,125 @@
+/**
+ * odplayer - Tool for playing back recorded data
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe 
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef REPLAYSTATISTICS_H_
+#define REPLAYSTATISTICS_H_
+
+#include <chrono>
+#include <string>
+
+#include "opendavinci/odcore/opendavinci.h"
+
+namespace odcore { namespace data { class Container; } }
+
+namespace odplayer {
+
+    using namespace std;
+
+    /**
+     * This class accumulates the number of containers and bytes
+     * sent during a replay to report the achieved throughput. The
+     * bytes of SharedImages and SharedData include the data copied
+     * into their shared memory segments.
+     *
+     * As the time might be controlled by odsupercomponent, the
+     * throughput is measured in wall clock time.
+     */
+    class ReplayStatistics {
+        private:
+            /**
+             * "Forbidden" copy constructor. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the copy constructor.
+             *
+             * @param obj Reference to an object of this class.
+             */
+            ReplayStatistics(const ReplayStatistics &/*obj*/);
+
+            /**
+             * "Forbidden" assignment operator. Goal: The compiler should warn
+             * already at compile time for unwanted bugs caused by any misuse
+             * of the assignment operator.
+             *
+             * @param obj Reference to an object of this class.
+             * @return Reference to this instance.
+             */
+            ReplayStatistics& operator=(const ReplayStatistics &/*obj*/);
+
+        public:
+            ReplayStatistics();
+
+            virtual ~ReplayStatistics();
+
+            /**
+             * This method accounts for a sent container.
+             *
+             * @param c Container that was sent.
+             */
+            void add(odcore::data::Container &c);
+
+            /**
+             * @return Number of containers sent so far.
+             */
+            uint64_t getNumberOfContainers() const;
+
+            /**
+             * @return Number of bytes sent so far.
+             */
+            uint64_t getNumberOfBytes() const;
+
+            /**
+             * @return Seconds since the last call to report() or since construction.
+             */
+            double getSecondsSinceLastReport() const;
+
+            /**
+             * This method returns the throughput since the last
+             * call to report() and starts a new interval.
+             *
+             * @return Containers/s and MB/s since the last report.
+             */
+            const string report();
+
+            /**
+             * @return Containers, MB, containers/s, and MB/s since construction.
+             */
+            const string reportTotal() const;
+
+            /**
+             * This method formats the throughput.
+             *
+             * @param containers Number of containers.
+             * @param bytes Number of bytes.
+             * @param seconds Duration in seconds.
+             * @return Containers/s and MB/s.
+             */
+            static const string format(const uint64_t &containers, const uint64_t &bytes, const double &seconds);
+
+        private:
+            std::chrono::steady_clock::time_point m_start;
+            std::chrono::steady_clock::time_point m_lastReport;
+            uint64_t m_numberOfContainers;
+            uint64_t m_numberOfBytes;
+            uint64_t m_numberOfContainersAtLastReport;
+            uint64_t m_numberOfBytesAtLastReport;
+    };
+
+} // odplayer
+
+#endif /*REPLAYSTATISTICS_H_*/
@@ -17,17 +17,22 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/Thread.h"
 #include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/odcore/exceptions/Exceptions.h"
 #include "opendavinci/odcore/io/URL.h"
 #include "opendavinci/odtools/player/Player.h"
+#include "opendavinci/generated/odcore/data/dmcp/ServerInformation.h"
 #include "opendavinci/generated/odcore/data/player/PlayerCommand.h"
 
 #include "PlayerModule.h"
+#include "ReplayStatistics.h"
 
 namespace odplayer {
 
@@ -59,8 +64,17 @@ namespace odplayer {
         URL url(getKeyValueConfiguration().getValue<string>("odplayer.input"));
 
         // Read the scaling factor.
-        double timeScale = getKeyValueConfiguration().getValue<double>("odplayer.timeScale");
-        timeScale = (fabs(timeScale) > 1e-5 ? fabs(timeScale) : 1.0);
+        const double TIME_SCALE = fabs(getKeyValueConfiguration().getValue<double>("odplayer.timeScale"));
+        double timeScale = (TIME_SCALE > 1e-5 ? TIME_SCALE : 1.0);
+
+        // Do we have to replay driven by a virtual clock in bursts?
+        bool batched = false;
+        try {
+            batched = (getKeyValueConfiguration().getValue<int>("odplayer.batched") != 0);
+        }
+        catch (odcore::exceptions::ValueForKeyNotFoundException &) {
+            // Replay container by container.
+        }
 
         // Do we have to rewind the stream on EOF?
         bool autoRewind = (getKeyValueConfiguration().getValue<int>("odplayer.autoRewind") != 0);
@@ -90,9 +104,80 @@ namespace odplayer {
         bool playing = (!remoteControl);
         bool doStep = false;
 
+        // In batched mode, the virtual clock tells up to which point in
+        // the recording (relative to its beginning) the containers are due;
+        // a time scale factor of 0 lets the virtual clock run infinitely fast.
+        const bool AS_FAST_AS_POSSIBLE = (TIME_SCALE < 1e-5);
+        const bool PACED_BY_SIMULATION = ( (getServerInformation().getManagedLevel() == odcore::data::dmcp::ServerInformation::ML_SIMULATION) ||
+                                           (getServerInformation().getManagedLevel() == odcore::data::dmcp::ServerInformation::ML_SIMULATION_RT) );
+        ReplayStatistics statistics;
+        double virtualClock = 0;
+        double dueTimeOfNextContainer = 0;
+        bool virtualClockStarted = false;
+        TimeStamp lastCycle;
+
+        if (batched) {
+            CLOG1 << "[" << getName() << "(" << getIdentifier() << ")]: Batched replay " << (AS_FAST_AS_POSSIBLE ? "as fast as possible" : "with time scale factor") << (PACED_BY_SIMULATION ? " paced by odsupercomponent." : ".") << endl;
+        }
+
         // The main loop.
         while (getModuleStateAndWaitForRemainingTimeInTimeslice() == odcore::data::dmcp::ModuleStateMessage::RUNNING) {
-            if (playing) {
+            if (batched) {
+                // Advance the virtual clock by the scaled time of this cycle; while
+                // pausing, the virtual clock stops. In ML_SIMULATION, TimeStamp is
+                // controlled by odsupercomponent and set with the first pulse.
+                const TimeStamp now;
+                if (playing && !AS_FAST_AS_POSSIBLE && virtualClockStarted) {
+                    virtualClock += (now - lastCycle).toMicroseconds() / timeScale;
+                }
+                virtualClockStarted = true;
+                lastCycle = now;
+
+                // Send all containers that are due but not more than MAX_CONTAINERS_PER_BURST
+                // in one cycle to check for new commands in between; a step sends one container.
+                // At the end of the recording, Player would repeat the last container; thus,
+                // stop until the recording is rewound or sought.
+                uint32_t numberOfContainersInBurst = 0;
+                while ( playing &&
+                        (AS_FAST_AS_POSSIBLE || doStep || !(dueTimeOfNextContainer > virtualClock)) &&
+                        (numberOfContainersInBurst < MAX_CONTAINERS_PER_BURST) &&
+                        (!remoteControl || m_playerControl.isEmpty()) &&
+                        player.hasMoreData() ) {
+                    nextContainerToBeSent = player.getNextContainerToBeSent();
+                    dueTimeOfNextContainer += player.getDelay();
+                    numberOfContainersInBurst++;
+
+                    // Nothing is available at the moment.
+                    if (nextContainerToBeSent.getDataType() == Container::UNDEFINEDDATA) {
+                        break;
+                    }
+
+                    if (nextContainerToBeSent.getDataType() != odcore::data::player::PlayerCommand::ID()) {
+                        getConference().send(nextContainerToBeSent);
+                        statistics.add(nextContainerToBeSent);
+                    }
+
+                    if (doStep) {
+                        // Continue from the stepped container after resuming.
+                        virtualClock = dueTimeOfNextContainer;
+                        break;
+                    }
+                }
+
+                // Report the throughput once per second.
+                if (playing && (statistics.getSecondsSinceLastReport() >= 1)) {
+                    // Start the next interval regardless of the verbosity.
+                    const string throughput = statistics.report();
+                    CLOG1 << "[" << getName() << "(" << getIdentifier() << ")]: " << throughput << endl;
+                }
+
+                // Without odsupercomponent pacing, sleep until the next container is due.
+                if (playing && !AS_FAST_AS_POSSIBLE && !PACED_BY_SIMULATION && (dueTimeOfNextContainer > virtualClock)) {
+                    const double WAITING_TIME = (dueTimeOfNextContainer - virtualClock) * timeScale;
+                    Thread::usleepFor(static_cast<long>(min(WAITING_TIME, static_cast<double>(MAX_WAITING_TIME))));
+                }
+            }
+            else if (playing) {
                 // Get container to be sent.
                 nextContainerToBeSent = player.getNextContainerToBeSent();
 
@@ -147,6 +232,14 @@ namespace odplayer {
                         case odcore::data::player::PlayerCommand::REWIND:
                             player.rewind();
                             playing = false;
+                            virtualClock = dueTimeOfNextContainer = 0;
+                            break;
+                        case odcore::data::player::PlayerCommand::SEEK_TO:
+                            // Continue in the current state from the new position.
+                            if (!player.seekTo(pc.getSeekTo())) {
+                                CLOG1 << "[" << getName() << "(" << getIdentifier() << ")]: No data found at or after " << pc.getSeekTo().toString() << endl;
+                            }
+                            virtualClock = dueTimeOfNextContainer = 0;
                             break;
                     }
                 }
@@ -158,6 +251,10 @@ namespace odplayer {
             }
         }
 
+        if (batched) {
+            clog << "[" << getName() << "(" << getIdentifier() << ")]: Replay finished: " << statistics.reportTotal() << endl;
+        }
+
         return odcore::data::dmcp::ModuleExitCodeMessage::OKAY;
     }
 
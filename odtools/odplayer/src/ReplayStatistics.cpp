@@ -0,0 +1,97 @@
+/**
+ * odplayer - Tool for playing back recorded data
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe 
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <iomanip>
+#include <sstream>
+
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/generated/odcore/data/SharedData.h"
+#include "opendavinci/generated/odcore/data/image/SharedImage.h"
+
+#include "ReplayStatistics.h"
+
+namespace odplayer {
+
+    using namespace std;
+    using namespace odcore::data;
+
+    ReplayStatistics::ReplayStatistics() :
+        m_start(std::chrono::steady_clock::now()),
+        m_lastReport(m_start),
+        m_numberOfContainers(0),
+        m_numberOfBytes(0),
+        m_numberOfContainersAtLastReport(0),
+        m_numberOfBytesAtLastReport(0) {}
+
+    ReplayStatistics::~ReplayStatistics() {}
+
+    void ReplayStatistics::add(Container &c) {
+        m_numberOfContainers++;
+        m_numberOfBytes += c.getSizeOfData();
+
+        // The player has copied the payload into the shared memory already.
+        if (c.getDataType() == odcore::data::image::SharedImage::ID()) {
+            m_numberOfBytes += c.getData<odcore::data::image::SharedImage>().getSize();
+        }
+        else if (c.getDataType() == odcore::data::SharedData::ID()) {
+            m_numberOfBytes += c.getData<odcore::data::SharedData>().getSize();
+        }
+    }
+
+    uint64_t ReplayStatistics::getNumberOfContainers() const {
+        return m_numberOfContainers;
+    }
+
+    uint64_t ReplayStatistics::getNumberOfBytes() const {
+        return m_numberOfBytes;
+    }
+
+    double ReplayStatistics::getSecondsSinceLastReport() const {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_lastReport).count() / 1000000.0;
+    }
+
+    const string ReplayStatistics::report() {
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        const double seconds = std::chrono::duration_cast<std::chrono::microseconds>(now - m_lastReport).count() / 1000000.0;
+        const string s = format(m_numberOfContainers - m_numberOfContainersAtLastReport, m_numberOfBytes - m_numberOfBytesAtLastReport, seconds);
+
+        m_lastReport = now;
+        m_numberOfContainersAtLastReport = m_numberOfContainers;
+        m_numberOfBytesAtLastReport = m_numberOfBytes;
+
+        return s;
+    }
+
+    const string ReplayStatistics::reportTotal() const {
+        const double seconds = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count() / 1000000.0;
+
+        stringstream sstr;
+        sstr << m_numberOfContainers << " containers (" << fixed << setprecision(2) << (m_numberOfBytes / (1024.0 * 1024.0)) << " MB) in " << seconds << " s, " << format(m_numberOfContainers, m_numberOfBytes, seconds);
+        return sstr.str();
+    }
+
+    const string ReplayStatistics::format(const uint64_t &containers, const uint64_t &bytes, const double &seconds) {
+        const double s = (seconds > 0) ? seconds : 1e-6;
+
+        stringstream sstr;
+        sstr << fixed << setprecision(1) << (containers / s) << " containers/s, " << setprecision(2) << (bytes / (1024.0 * 1024.0) / s) << " MB/s";
+        return sstr.str();
+    }
+
+} // odplayer
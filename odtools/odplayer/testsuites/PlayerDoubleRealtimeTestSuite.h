@@ -22,6 +22,7 @@
 
 #include "cxxtest/TestSuite.h"
 
+#include <chrono>
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
@@ -120,38 +121,50 @@ class PlayerModuleTest : public CxxTest::TestSuite,
             m_connection = mc;
         }
 
-        void testDoubleRealtimeReplayNoRewind() {
-            // Prepare record file.
+        void writeRecording() {
             fstream fout("PlayerModuleTest.rec", ios::out | ios::binary | ios::trunc);
 
-            // Write data.
-            TimeStamp ts1(0, 0);
-            Container c1(ts1);
-            c1.setReceivedTimeStamp(ts1);
-            fout << c1;
+            // Write one container per second.
+            for (int32_t i = 0; i < 5; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                c.setReceivedTimeStamp(ts);
+                fout << c;
+            }
 
-            TimeStamp ts2(1, 0);
-            Container c2(ts2);
-            c2.setReceivedTimeStamp(ts2);
-            fout << c2;
+            fout.flush();
+            fout.close();
+        }
 
-            TimeStamp ts3(2, 0);
-            Container c3(ts3);
-            c3.setReceivedTimeStamp(ts3);
-            fout << c3;
+        void cleanUp() {
+            delete &(StreamFactory::getInstance());
+
+            UNLINK("PlayerModuleTest.rec");
 
-            TimeStamp ts4(3, 0);
-            Container c4(ts4);
-            c4.setReceivedTimeStamp(ts4);
-            fout << c4;
+            // "Ugly" cleaning up conference.
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            ContainerConferenceFactory *ccf2 = &ccf;
+            OPENDAVINCI_CORE_DELETE_POINTER(ccf2);
+        }
 
-            TimeStamp ts5(4, 0);
-            Container c5(ts5);
-            c5.setReceivedTimeStamp(ts5);
-            fout << c5;
+        void checkOrder(const string &test, vector<Container> &replayed) {
+            TS_ASSERT(replayed.size() == 5);
+            for (uint32_t i = 0; i < replayed.size(); i++) {
+                TimeStamp ts = replayed.at(i).getData<TimeStamp>();
+                TS_ASSERT(ts.toMicroseconds() == TimeStamp(i, 0).toMicroseconds());
+                cerr << test << " - " << (i + 1) << ": " << ts.toMicroseconds() << " == " << TimeStamp(i, 0).toMicroseconds() << endl;
+            }
+        }
 
-            fout.flush();
-            fout.close();
+        /**
+         * This method replays the recording with the given
+         * configuration without managed level.
+         *
+         * @param configuration Specific configuration for odplayer.
+         * @return Replayed containers.
+         */
+        vector<Container> replay(const string &configuration) {
+            writeRecording();
 
             // Setup ContainerConference.
             PlayerModuleTestContainerListener ptcl;
@@ -163,7 +176,7 @@ class PlayerModuleTest : public CxxTest::TestSuite,
             sstr << "odplayer.input = file://PlayerModuleTest.rec" << endl
             << "odplayer.autoRewind = 0" << endl
             << "odplayer.remoteControl = 0" << endl
-            << "odplayer.timeScale = 0.5" << endl
+            << configuration
             << "global.buffer.memorySegmentSize = 1000" << endl
             << "global.buffer.numberOfMemorySegments = 3" << endl;
 
@@ -203,55 +216,146 @@ class PlayerModuleTest : public CxxTest::TestSuite,
 
             pts.stop();
 
-            // Check replayed data:
-            TimeStamp ts;
+            vector<Container> replayed;
+            while (!ptcl.getQueue().isEmpty()) {
+                replayed.push_back(ptcl.getQueue().leave());
+            }
 
-            c1 = ptcl.getQueue().leave();
-            ts = c1.getData<TimeStamp>();
-            TS_ASSERT(ts.toMicroseconds() == ts1.toMicroseconds());
-            cerr << "testDoubleRealtimeReplayNoRewind - 1: " << ts.toMicroseconds() << " == " << ts1.toMicroseconds() << ": " << (ts.toMicroseconds() == ts1.toMicroseconds()) << endl;
+            cleanUp();
 
-            c2 = ptcl.getQueue().leave();
-            ts = c2.getData<TimeStamp>();
-            TS_ASSERT(ts.toMicroseconds() == ts2.toMicroseconds());
-            cerr << "testDoubleRealtimeReplayNoRewind - 2: " << ts.toMicroseconds() << " == " << ts2.toMicroseconds() << ": " << (ts.toMicroseconds() == ts2.toMicroseconds()) << endl;
+            return replayed;
+        }
 
-            c3 = ptcl.getQueue().leave();
-            ts = c3.getData<TimeStamp>();
-            TS_ASSERT(ts.toMicroseconds() == ts3.toMicroseconds());
-            cerr << "testDoubleRealtimeReplayNoRewind - 3: " << ts.toMicroseconds() << " == " << ts3.toMicroseconds() << ": " << (ts.toMicroseconds() == ts3.toMicroseconds()) << endl;
+        void testDoubleRealtimeReplayNoRewind() {
+            vector<Container> replayed = replay("odplayer.timeScale = 0.5\n");
+            checkOrder("testDoubleRealtimeReplayNoRewind", replayed);
 
-            c4 = ptcl.getQueue().leave();
-            ts = c4.getData<TimeStamp>();
-            TS_ASSERT(ts.toMicroseconds() == ts4.toMicroseconds());
-            cerr << "testDoubleRealtimeReplayNoRewind - 4: " << ts.toMicroseconds() << " == " << ts4.toMicroseconds() << ": " << (ts.toMicroseconds() == ts4.toMicroseconds()) << endl;
+            for (uint32_t i = 1; i < replayed.size(); i++) {
+                TimeStamp delta = replayed.at(i).getSentTimeStamp() - replayed.at(i - 1).getSentTimeStamp();
+                TS_ASSERT_DELTA(delta.toMicroseconds() / 1000000.0, 0.5, 1e-1);
+            }
+        }
 
-            c5 = ptcl.getQueue().leave();
-            ts = c5.getData<TimeStamp>();
-            TS_ASSERT(ts.toMicroseconds() == ts5.toMicroseconds());
-            cerr << "testDoubleRealtimeReplayNoRewind - 5: " << ts.toMicroseconds() << " == " << ts5.toMicroseconds() << ": " << (ts.toMicroseconds() == ts5.toMicroseconds()) << endl;
+        void testBatchedDoubleRealtimeReplay() {
+            vector<Container> replayed = replay("odplayer.timeScale = 0.5\nodplayer.batched = 1\n");
+            checkOrder("testBatchedDoubleRealtimeReplay", replayed);
 
-            TimeStamp delta;
-            delta = c2.getSentTimeStamp() - c1.getSentTimeStamp();
-            TS_ASSERT_DELTA(delta.toMicroseconds() / 1000000.0, 0.5, 1e-1);
+            for (uint32_t i = 1; i < replayed.size(); i++) {
+                TimeStamp delta = replayed.at(i).getSentTimeStamp() - replayed.at(i - 1).getSentTimeStamp();
+                TS_ASSERT_DELTA(delta.toMicroseconds() / 1000000.0, 0.5, 1e-1);
+            }
+        }
 
-            delta = c3.getSentTimeStamp() - c2.getSentTimeStamp();
-            TS_ASSERT_DELTA(delta.toMicroseconds() / 1000000.0, 0.5, 1e-1);
+        void testBatchedReplayAsFastAsPossible() {
+            vector<Container> replayed = replay("odplayer.timeScale = 0\nodplayer.batched = 1\n");
+            checkOrder("testBatchedReplayAsFastAsPossible", replayed);
 
-            delta = c4.getSentTimeStamp() - c3.getSentTimeStamp();
-            TS_ASSERT_DELTA(delta.toMicroseconds() / 1000000.0, 0.5, 1e-1);
+            // All containers are sent in one burst regardless of the recorded delays.
+            if (replayed.size() == 5) {
+                TimeStamp delta = replayed.at(4).getSentTimeStamp() - replayed.at(0).getSentTimeStamp();
+                TS_ASSERT(delta.toMicroseconds() < 500 * 1000);
+                cerr << "testBatchedReplayAsFastAsPossible: " << delta.toMicroseconds() << " us for all containers." << endl;
+            }
+        }
 
-            delta = c5.getSentTimeStamp() - c4.getSentTimeStamp();
-            TS_ASSERT_DELTA(delta.toMicroseconds() / 1000000.0, 0.5, 1e-1);
+        void testBatchedReplayPacedBySimulation() {
+            writeRecording();
 
-            delete &(StreamFactory::getInstance());
+            // The recording is rewound to keep odplayer running until it is stopped.
+            stringstream sstr;
+            sstr << "odplayer.input = file://PlayerModuleTest.rec" << endl
+            << "odplayer.autoRewind = 1" << endl
+            << "odplayer.remoteControl = 0" << endl
+            << "odplayer.timeScale = 1" << endl
+            << "odplayer.batched = 1" << endl
+            << "global.buffer.memorySegmentSize = 1000" << endl
+            << "global.buffer.numberOfMemorySegments = 3" << endl;
 
-            UNLINK("PlayerModuleTest.rec");
+            m_configuration = KeyValueConfiguration();
+            m_configuration.readFrom(sstr);
+            m_connection.reset();
 
-            // "Ugly" cleaning up conference.
-            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
-            ContainerConferenceFactory *ccf2 = &ccf;
-            OPENDAVINCI_CORE_DELETE_POINTER(ccf2);
+            // In ML_SIMULATION, the containers are returned with the acknowledged pulses.
+            vector<string> noModulesToIgnore;
+            ServerInformation serverInformation("127.0.0.1", 19000, ServerInformation::ML_SIMULATION);
+            discoverer::Server dmcpDiscovererServer(serverInformation,
+                                                    "225.0.0.100",
+                                                    odcore::data::dmcp::Constants::BROADCAST_PORT_SERVER,
+                                                    odcore::data::dmcp::Constants::BROADCAST_PORT_CLIENT,
+                                                    noModulesToIgnore);
+            dmcpDiscovererServer.startResponding();
+
+            connection::Server dmcpConnectionServer(serverInformation, *this);
+            dmcpConnectionServer.setConnectionHandler(this);
+
+            // Setup player.
+            string argv0("odplayer");
+            string argv1("--cid=100");
+            string argv2("--freq=10");
+            int32_t argc = 3;
+            char **argv;
+            argv = new char*[3];
+            argv[0] = const_cast<char*>(argv0.c_str());
+            argv[1] = const_cast<char*>(argv1.c_str());
+            argv[2] = const_cast<char*>(argv2.c_str());
+
+            PlayerModuleTestService pts(argc, argv);
+
+            // odplayer's clock starts at odsupercomponent's time.
+            const TimeStamp supercomponentTime;
+
+            pts.start();
+
+            // Wait at most 10s.
+            for (uint32_t i = 0; (i < 1000) && !m_connection.get(); i++) {
+                Thread::usleepFor(10000);
+            }
+            TS_ASSERT(m_connection.get() != NULL);
+
+            // TimeStamp is controlled by the pulses in this process; thus, the wall clock is used.
+            vector<Container> replayed;
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            if (m_connection.get()) {
+                m_connection->waitForModuleDescription();
+
+                // Pulses of 100ms; the recording spans 4s.
+                const vector<Container> noContainers;
+                for (uint32_t i = 0; (i < 200) && (replayed.size() < 5); i++) {
+                    // Let odplayer wait for the next pulse like odsupercomponent's yield does.
+                    Thread::usleepFor(10000);
+
+                    PulseMessage pm(supercomponentTime, 100 * 1000, 0, noContainers);
+                    vector<Container> containers = m_connection->pulse_ack_containers(pm, 1000);
+                    for (uint32_t j = 0; j < containers.size(); j++) {
+                        if ( (containers.at(j).getDataType() == TimeStamp::ID()) && (replayed.size() < 5) ) {
+                            replayed.push_back(containers.at(j));
+                        }
+                    }
+                }
+
+                // The module waits for the next pulse to leave its main loop.
+                pts.beforeStop();
+                Thread::usleepFor(10000);
+                PulseMessage pm(supercomponentTime, 100 * 1000, 0, noContainers);
+                m_connection->pulse_ack_containers(pm, 1000);
+            }
+            const double duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() / 1000000.0;
+
+            pts.stop();
+
+            checkOrder("testBatchedReplayPacedBySimulation", replayed);
+
+            // odplayer does not sleep in ML_SIMULATION; the delays are kept in the simulated time.
+            for (uint32_t i = 1; i < replayed.size(); i++) {
+                TimeStamp delta = replayed.at(i).getSentTimeStamp() - replayed.at(i - 1).getSentTimeStamp();
+                TS_ASSERT_DELTA(delta.toMicroseconds() / 1000000.0, 1.0, 1e-1);
+            }
+            TS_ASSERT(duration < 4);
+            cerr << "testBatchedReplayPacedBySimulation: " << duration << " s for 4s of recording." << endl;
+
+            m_connection.reset();
+
+            cleanUp();
         }
 
 };
@@ -368,6 +368,135 @@ class PlayerModuleTest : public CxxTest::TestSuite,
             OPENDAVINCI_CORE_DELETE_POINTER(ccf2);
 #endif /* !FreeBSD and !NetBSD */
         }
+
+        void sendCommand(std::shared_ptr<ContainerConference> conference, const odcore::data::player::PlayerCommand::Command &command) {
+            odcore::data::player::PlayerCommand playerCommand;
+            playerCommand.setCommand(command);
+            Container c(playerCommand);
+            conference->send(c);
+        }
+
+        void waitForContainers(PlayerModuleTestContainerListener &ptcl, const uint32_t &numberOfContainers) {
+            // Wait at most 5s.
+            for (uint32_t i = 0; (i < 500) && (ptcl.getQueue().getSize() < numberOfContainers); i++) {
+                Thread::usleepFor(10000);
+            }
+        }
+
+        void testBatchedReplayRemoteControl() {
+#if !defined(__FreeBSD__) && !defined(__NetBSD__)
+            // Prepare record file.
+            fstream fout("PlayerModuleTest.rec", ios::out | ios::binary | ios::trunc);
+
+            // Write one container per second.
+            for (int32_t i = 0; i < 5; i++) {
+                TimeStamp ts(i, 0);
+                Container c(ts);
+                c.setReceivedTimeStamp(ts);
+                fout << c;
+            }
+
+            fout.flush();
+            fout.close();
+
+            // Setup ContainerConference.
+            PlayerModuleTestContainerListener ptcl;
+            std::shared_ptr<ContainerConference> conference = ContainerConferenceFactory::getInstance().getContainerConference("225.0.0.100");
+            conference->setContainerListener(&ptcl);
+
+            // Setup DMCP.
+            stringstream sstr;
+            sstr << "odplayer.input = file://PlayerModuleTest.rec" << endl
+            << "odplayer.autoRewind = 0" << endl
+            << "odplayer.remoteControl = 1" << endl
+            << "odplayer.timeScale = 1.0" << endl
+            << "odplayer.batched = 1" << endl
+            << "global.buffer.memorySegmentSize = 1000" << endl
+            << "global.buffer.numberOfMemorySegments = 3" << endl;
+
+            m_configuration = KeyValueConfiguration();
+            m_configuration.readFrom(sstr);
+
+            vector<string> noModulesToIgnore;
+            ServerInformation serverInformation("127.0.0.1", 19000, ServerInformation::ML_NONE);
+            discoverer::Server dmcpDiscovererServer(serverInformation,
+                                                    "225.0.0.100",
+                                                    odcore::data::dmcp::Constants::BROADCAST_PORT_SERVER,
+                                                    odcore::data::dmcp::Constants::BROADCAST_PORT_CLIENT,
+                                                    noModulesToIgnore);
+            dmcpDiscovererServer.startResponding();
+
+            connection::Server dmcpConnectionServer(serverInformation, *this);
+            dmcpConnectionServer.setConnectionHandler(this);
+
+            // Setup player.
+            string argv0("odplayer");
+            string argv1("--cid=100");
+            int32_t argc = 2;
+            char **argv;
+            argv = new char*[2];
+            argv[0] = const_cast<char*>(argv0.c_str());
+            argv[1] = const_cast<char*>(argv1.c_str());
+            PlayerModuleTestService pts(argc, argv);
+
+            pts.start();
+
+            // Wait shortly.
+            Thread::usleepFor(10*1000*1000);
+
+            // The first container is due immediately.
+            sendCommand(conference, odcore::data::player::PlayerCommand::PLAY);
+            waitForContainers(ptcl, 1);
+            sendCommand(conference, odcore::data::player::PlayerCommand::PAUSE);
+
+            TS_ASSERT(ptcl.getQueue().getSize() == 1);
+            Container c = ptcl.getQueue().leave();
+            TS_ASSERT(c.getData<TimeStamp>().toMicroseconds() == TimeStamp(0, 0).toMicroseconds());
+
+            // The virtual clock stops while pausing.
+            Thread::usleepFor(2*1000*1000);
+            TS_ASSERT(ptcl.getQueue().getSize() == 0);
+
+            // Every step sends exactly one container without waiting for its delay.
+            for (int32_t i = 1; i < 3; i++) {
+                const TimeStamp before;
+                sendCommand(conference, odcore::data::player::PlayerCommand::STEP_FORWARD);
+                waitForContainers(ptcl, 1);
+                TS_ASSERT(ptcl.getQueue().getSize() == 1);
+                c = ptcl.getQueue().leave();
+                TS_ASSERT(c.getData<TimeStamp>().toMicroseconds() == TimeStamp(i, 0).toMicroseconds());
+                TS_ASSERT((c.getSentTimeStamp() - before).toMicroseconds() < 500 * 1000);
+            }
+
+            // The player pauses after a step.
+            Thread::usleepFor(2*1000*1000);
+            TS_ASSERT(ptcl.getQueue().getSize() == 0);
+
+            // Resuming continues with the next container.
+            sendCommand(conference, odcore::data::player::PlayerCommand::PLAY);
+            waitForContainers(ptcl, 2);
+            TS_ASSERT(ptcl.getQueue().getSize() == 2);
+            c = ptcl.getQueue().leave();
+            TS_ASSERT(c.getData<TimeStamp>().toMicroseconds() == TimeStamp(3, 0).toMicroseconds());
+            c = ptcl.getQueue().leave();
+            TS_ASSERT(c.getData<TimeStamp>().toMicroseconds() == TimeStamp(4, 0).toMicroseconds());
+
+            // The last container is not repeated at the end of the recording.
+            Thread::usleepFor(2*1000*1000);
+            TS_ASSERT(ptcl.getQueue().getSize() == 0);
+
+            pts.stop();
+
+            delete &(StreamFactory::getInstance());
+
+            UNLINK("PlayerModuleTest.rec");
+
+            // "Ugly" cleaning up conference.
+            ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
+            ContainerConferenceFactory *ccf2 = &ccf;
+            OPENDAVINCI_CORE_DELETE_POINTER(ccf2);
+#endif /* !FreeBSD and !NetBSD */
+        }
 };
 
 #endif /*PLAYERTESTSUITE_H_*/
@@ -0,0 +1,91 @@
+/**
+ * odplayer - Tool for playing back recorded data
+ * Copyright (C) 2008 - 2015 Christian Berger, Bernhard Rumpe 
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef REPLAYSTATISTICSTESTSUITE_H_
+#define REPLAYSTATISTICSTESTSUITE_H_
+
+#include "cxxtest/TestSuite.h"
+
+#include <string>
+
+#include "opendavinci/odcore/data/Container.h"
+#include "opendavinci/odcore/data/TimeStamp.h"
+#include "opendavinci/generated/odcore/data/SharedData.h"
+#include "opendavinci/generated/odcore/data/image/SharedImage.h"
+
+#include "../include/ReplayStatistics.h"
+
+using namespace std;
+using namespace odplayer;
+using namespace odcore::data;
+
+class ReplayStatisticsTest : public CxxTest::TestSuite {
+    public:
+        void testCountsContainersAndBytes() {
+            ReplayStatistics statistics;
+            TS_ASSERT(statistics.getNumberOfContainers() == 0);
+            TS_ASSERT(statistics.getNumberOfBytes() == 0);
+
+            Container c1(TimeStamp(1, 2));
+            statistics.add(c1);
+            TS_ASSERT(statistics.getNumberOfContainers() == 1);
+            TS_ASSERT(statistics.getNumberOfBytes() == c1.getSizeOfData());
+
+            // The data in the shared memory segments is accounted as well.
+            SharedData sd("ReplayStatisticsTest", 1000);
+            Container c2(sd);
+            statistics.add(c2);
+            TS_ASSERT(statistics.getNumberOfContainers() == 2);
+            TS_ASSERT(statistics.getNumberOfBytes() == c1.getSizeOfData() + c2.getSizeOfData() + 1000);
+
+            odcore::data::image::SharedImage si;
+            si.setSize(640 * 480 * 3);
+            Container c3(si);
+            statistics.add(c3);
+            TS_ASSERT(statistics.getNumberOfContainers() == 3);
+            TS_ASSERT(statistics.getNumberOfBytes() == c1.getSizeOfData() + c2.getSizeOfData() + 1000 + c3.getSizeOfData() + 640 * 480 * 3);
+        }
+
+        void testFormat() {
+            TS_ASSERT(ReplayStatistics::format(10, 2 * 1024 * 1024, 2.0) == "5.0 containers/s, 1.00 MB/s");
+            TS_ASSERT(ReplayStatistics::format(0, 0, 1.0) == "0.0 containers/s, 0.00 MB/s");
+
+            // An empty interval must not divide by zero.
+            TS_ASSERT(ReplayStatistics::format(1, 0, 0) == "1000000.0 containers/s, 0.00 MB/s");
+        }
+
+        void testReportStartsNewInterval() {
+            ReplayStatistics statistics;
+            Container c(TimeStamp(1, 2));
+            statistics.add(c);
+            statistics.add(c);
+
+            statistics.report();
+            TS_ASSERT(statistics.getSecondsSinceLastReport() < 1);
+
+            // Nothing was sent since the last report.
+            TS_ASSERT(statistics.report().find("0.0 containers/s, 0.00 MB/s") == 0);
+
+            // The totals are kept.
+            TS_ASSERT(statistics.getNumberOfContainers() == 2);
+            TS_ASSERT(statistics.reportTotal().find("2 containers (") == 0);
+        }
+};
+
+#endif /*REPLAYSTATISTICSTESTSUITE_H_*/
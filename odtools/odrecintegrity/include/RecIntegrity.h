@@ -20,10 +20,14 @@
 #ifndef RECINTEGRITY_H_
 #define RECINTEGRITY_H_
 
+#include <string>
+
 #include "opendavinci/odcore/opendavinci.h"
 
 namespace odrecintegrity {
 
+    using namespace std;
+
     /**
      * This class can be used to inspect the integrity of recorded data.
      */
@@ -61,6 +65,15 @@ namespace odrecintegrity {
              * @return 0 if specified file is integer, 1 if the file is not integer, and 255 if the file could not be opened.
              */
             int32_t run(const int32_t &argc, char **argv);
+
+            /**
+             * This method creates the index (.idx file) for an existing
+             * recording to allow seeking during replay.
+             *
+             * @param recording Recording (.rec file) to be indexed.
+             * @return 0 if the index was created and 255 if the files could not be opened.
+             */
+            int32_t buildIndex(const string &recording);
     };
 
 } // odrecintegrity
@@ -27,6 +27,8 @@
 #include "opendavinci/generated/odcore/data/SharedData.h"
 #include "opendavinci/generated/odcore/data/image/SharedImage.h"
 #include "opendavinci/generated/odcore/data/SharedPointCloud.h"
+#include "opendavinci/odtools/player/RecordingReader.h"
+#include "opendavinci/odtools/recorder/RecordingIndex.h"
 
 namespace odrecintegrity {
 
@@ -34,6 +36,8 @@ namespace odrecintegrity {
     using namespace odcore;
     using namespace odcore::base;
     using namespace odcore::data;
+    using namespace odtools::player;
+    using namespace odtools::recorder;
 
     RecIntegrity::RecIntegrity() {}
 
@@ -46,28 +50,32 @@ namespace odrecintegrity {
 
         RETURN_CODE retVal = CORRECT;
 
-        if (argc == 2) {
+        if ( (argc == 3) && (string(argv[1]) == "--index") ) {
+            retVal = ((buildIndex(argv[2]) == CORRECT) ? CORRECT : FILE_COULD_NOT_BE_OPENED);
+        }
+        else if (argc == 2) {
             const string FILENAME(argv[1]);
-            fstream fin;
-            fin.open(FILENAME.c_str(), ios_base::in|ios_base::binary);
+            // The file is mapped into memory if possible.
+            RecordingReader reader(FILENAME);
 
-            if (fin.good()) {
+            if (reader.isValid()) {
                 // Determine file size.
-                fin.seekg(0, fin.end);
-                int32_t length = fin.tellg();
-                fin.seekg(0, fin.beg);
+                reader.seek(-1);
+                int64_t length = reader.getPosition();
+                reader.seek(0);
 
                 int32_t oldPercentage = -1;
                 bool fileNotCorrupt = true;
                 uint32_t numberOfSharedImages = 0;
                 uint32_t numberOfSharedData = 0;
                 uint32_t numberOfSharedPointCloud = 0;
-                while (fin.good()) {
+                bool hasMoreData = true;
+                while (hasMoreData) {
                     Container c;
-                    fin >> c;
+                    hasMoreData = reader.read(c);
 
-                    if (fin.gcount() > 0) {
-                        int32_t currPos = fin.tellg();
+                    if (hasMoreData) {
+                        int64_t currPos = reader.getPosition();
 
                         fileNotCorrupt &= (c.getDataType() != Container::UNDEFINEDDATA) && (currPos > 0);
 
@@ -80,7 +88,7 @@ namespace odrecintegrity {
                                 lengthToSkip = si.getWidth() * si.getHeight() * si.getBytesPerPixel();
                             }
 
-                            fin.seekg(currPos + lengthToSkip);
+                            reader.skipPayload(lengthToSkip);
                             cout << "[RecIntegrity]: Found SharedImage '" << si.getName() << "' (" << lengthToSkip << " bytes)" << endl;
                             numberOfSharedImages++;
                         }
@@ -89,7 +97,7 @@ namespace odrecintegrity {
 
                             uint32_t lengthToSkip = sd.getSize();
 
-                            fin.seekg(currPos + lengthToSkip);
+                            reader.skipPayload(lengthToSkip);
                             cout << "[RecIntegrity]: Found SharedData '" << sd.getName() << "' (" << lengthToSkip << " bytes)" << endl;
                             numberOfSharedData++;
                         }
@@ -98,7 +106,7 @@ namespace odrecintegrity {
 
                             uint32_t lengthToSkip = spc.getSize();
 
-                            fin.seekg(currPos + lengthToSkip);
+                            reader.skipPayload(lengthToSkip);
                             cout << "[RecIntegrity]: Found SharedPointCloud '" << spc.getName() << "' (" << lengthToSkip << " bytes)" << endl;
                             numberOfSharedPointCloud++;
                         }
@@ -126,5 +134,26 @@ namespace odrecintegrity {
         return retVal;
     }
 
+    int32_t RecIntegrity::buildIndex(const string &recording) {
+        RecordingIndex index;
+        if (!RecordingIndex::build(recording, index)) {
+            cout << "[RecIntegrity]: Could not open '" << recording << "'." << endl;
+            return 255;
+        }
+
+        const string FILENAME = RecordingIndex::getFileName(recording);
+        fstream fout;
+        fout.open(FILENAME.c_str(), ios_base::out|ios_base::binary|ios_base::trunc);
+        if (!fout.good()) {
+            cout << "[RecIntegrity]: Could not create '" << FILENAME << "'." << endl;
+            return 255;
+        }
+
+        index.writeTo(fout);
+        cout << "[RecIntegrity]: Created index '" << FILENAME << "' with " << index.getNumberOfEntries() << " entries." << endl;
+
+        return 0;
+    }
+
 } // odrecintegrity
 
@@ -17,10 +17,12 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <iostream>
 #include <string>
 
 #include "RecorderModule.h"
 #include "opendavinci/odcore/base/Thread.h"
+#include "opendavinci/odcore/base/module/AbstractCIDModule.h"
 #include "opendavinci/odtools/recorder/Recorder.h"
 #include "opendavinci/odtools/recorder/SharedDataListener.h"
 #include "opendavinci/generated/odcore/data/recorder/RecorderCommand.h"
@@ -63,8 +65,26 @@ namespace odrecorder {
         // Dump shared images and shared data?
         const bool DUMP_SHARED_DATA = getKeyValueConfiguration().getValue<uint32_t>("odrecorder.dumpshareddata") == 1;
 
+        // Maximum number of bytes waiting to be written before containers are dropped.
+        uint32_t highWaterMark = RecordingWriter::DEFAULT_HIGH_WATER_MARK;
+        try {
+            highWaterMark = getKeyValueConfiguration().getValue<uint32_t>("odrecorder.highWaterMark");
+        }
+        catch(...) {
+            CLOG1 << "[odrecorder]: Value for 'odrecorder.highWaterMark' not found in configuration, using " << highWaterMark << " as default." << endl;
+        }
+
+        // Write the recording as compressed blocks?
+        bool compression = false;
+        try {
+            compression = (getKeyValueConfiguration().getValue<uint32_t>("odrecorder.compression") == 1);
+        }
+        catch(...) {
+            CLOG1 << "[odrecorder]: Value for 'odrecorder.compression' not found in configuration, writing uncompressed recording." << endl;
+        }
+
         // Actual "recording" interface.
-        Recorder r(recorderOutputURL, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING, DUMP_SHARED_DATA);
+        Recorder r(recorderOutputURL, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING, DUMP_SHARED_DATA, highWaterMark, compression);
 
         // Connect recorder's FIFOQueue to record all containers except for shared images/shared data.
         addDataStoreFor(r.getFIFO());
@@ -90,6 +110,9 @@ namespace odrecorder {
                 }
             }
 
+            // Report dropped containers to supercomponent.
+            setNumberOfDroppedContainers(r.getNumberOfDroppedContainers());
+
             // Check for remote control.
             if (remoteControl) {
                 Container container = kvds.get(odcore::data::recorder::RecorderCommand::ID());
@@ -211,6 +211,7 @@ class RecorderTest : public CxxTest::TestSuite,
             fin.close();
 
             UNLINK("RecorderTest2.rec");
+            UNLINK("RecorderTest2.rec.idx");
 
             // "Ugly" cleaning up conference.
             ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
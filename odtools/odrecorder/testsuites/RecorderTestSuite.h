@@ -204,6 +204,7 @@ class RecorderTest : public CxxTest::TestSuite,
             TS_ASSERT(fin.good());
             fin.close();
             UNLINK("RecorderTest.rec");
+            UNLINK("RecorderTest.rec.idx");
 
             // "Ugly" cleaning up conference.
             ContainerConferenceFactory &ccf = ContainerConferenceFactory::getInstance();
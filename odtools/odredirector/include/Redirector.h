@@ -83,6 +83,7 @@ namespace odredirector {
             bool m_fromstdin;
             bool m_tostdout;
             int32_t m_jpegQuality;
+            uint32_t m_jpegThreads;
             map<string, std::shared_ptr<odcore::wrapper::SharedMemory> > m_mapOfSharedMemories;
     };
 
@@ -20,10 +20,17 @@
 #ifndef STDOUT_PUMP_H_
 #define STDOUT_PUMP_H_
 
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "opendavinci/odcore/opendavinci.h"
 #include "opendavinci/odcore/base/AbstractDataStore.h"
+#include "opendavinci/odcore/wrapper/jpg/ParallelJPGEncoder.h"
 
 namespace odcore { namespace data { class Container; } }
+namespace odcore { namespace data { namespace image { class SharedImageChannel; } } }
 
 namespace odredirector {
 
@@ -56,8 +63,9 @@ namespace odredirector {
              * Constructor.
              *
              * @param jpegQuality Compression quality for SharedImages.
+             * @param jpegThreads Number of threads to compress SharedImages (0 = number of cores).
              */
-            StdoutPump(const int32_t &jpegQuality);
+            StdoutPump(const int32_t &jpegQuality, const uint32_t &jpegThreads);
 
             virtual ~StdoutPump();
 
@@ -71,6 +79,14 @@ namespace odredirector {
 
         private:
             int32_t m_jpegQuality;
+            odcore::wrapper::jpg::ParallelJPGEncoder m_encoder;
+
+            // Channels are attached once per image name.
+            std::map<std::string, std::shared_ptr<odcore::data::image::SharedImageChannel> > m_sharedImageChannels;
+
+            // Buffers are reused for all images.
+            std::vector<unsigned char> m_frame;
+            std::vector<unsigned char> m_compressedData;
     };
 
 } // odredirector
@@ -47,6 +47,7 @@ namespace odredirector {
         m_fromstdin(false),
         m_tostdout(false),
         m_jpegQuality(15),
+        m_jpegThreads(0),
         m_mapOfSharedMemories() {
         // Parse command line arguments.
         parseAdditionalCommandLineParameters(argc, argv);
@@ -61,12 +62,14 @@ namespace odredirector {
         cmdParser.addCommandLineArgument("fromstdin");
         cmdParser.addCommandLineArgument("tostdout");
         cmdParser.addCommandLineArgument("jpegquality");
+        cmdParser.addCommandLineArgument("jpegthreads");
 
         cmdParser.parse(argc, argv);
 
         CommandLineArgument cmdArgumentFROMSTDIN = cmdParser.getCommandLineArgument("fromstdin");
         CommandLineArgument cmdArgumentTOSTDOUT = cmdParser.getCommandLineArgument("tostdout");
         CommandLineArgument cmdArgumentJPEGQUALITY = cmdParser.getCommandLineArgument("jpegquality");
+        CommandLineArgument cmdArgumentJPEGTHREADS = cmdParser.getCommandLineArgument("jpegthreads");
 
         if (cmdArgumentFROMSTDIN.isSet()) {
             m_fromstdin = cmdArgumentFROMSTDIN.getValue<int>() == 1;
@@ -84,6 +87,10 @@ namespace odredirector {
                 m_jpegQuality = 15;
             }
         }
+
+        if (cmdArgumentJPEGTHREADS.isSet()) {
+            m_jpegThreads = cmdArgumentJPEGTHREADS.getValue<uint32_t>();
+        }
     }
 
     void Redirector::setUp() {}
@@ -96,7 +103,7 @@ namespace odredirector {
         cout.sync_with_stdio(true);
 
         // Create a stdout pump.
-        StdoutPump stdoutPump(m_jpegQuality);
+        StdoutPump stdoutPump(m_jpegQuality, m_jpegThreads);
 
         if (m_tostdout) {
             // ...that is called automagically whenever we receive data from the UDP multicast session.
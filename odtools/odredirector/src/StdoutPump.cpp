@@ -17,19 +17,16 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
-#include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <vector>
 
 #include "opendavinci/odcore/opendavinci.h"
 #include <memory>
-#include "opendavinci/odcore/base/Lock.h"
 #include "opendavinci/odcore/base/Serializable.h"
 #include "opendavinci/odcore/data/Container.h"
 #include "opendavinci/odcore/data/image/CompressedImage.h"
-#include "opendavinci/odcore/wrapper/jpg/JPG.h"
-#include "opendavinci/odcore/wrapper/SharedMemory.h"
-#include "opendavinci/odcore/wrapper/SharedMemoryFactory.h"
+#include "opendavinci/odcore/data/image/SharedImageChannel.h"
 #include "opendavinci/generated/odcore/data/image/SharedImage.h"
 
 #include "StdoutPump.h"
@@ -41,8 +38,12 @@ namespace odredirector {
     using namespace odcore::base;
     using namespace odcore::data;
 
-    StdoutPump::StdoutPump(const int32_t &jpegQuality) :
-        m_jpegQuality(jpegQuality) {}
+    StdoutPump::StdoutPump(const int32_t &jpegQuality, const uint32_t &jpegThreads) :
+        m_jpegQuality(jpegQuality),
+        m_encoder(jpegThreads),
+        m_sharedImageChannels(),
+        m_frame(),
+        m_compressedData() {}
 
     StdoutPump::~StdoutPump() {}
 
@@ -54,23 +55,32 @@ namespace odredirector {
             if ( (1 == si.getBytesPerPixel()) || 
                  (3 == si.getBytesPerPixel()) ) {
                 bool retVal = false;
-                int compressedSize = si.getWidth() * si.getHeight() * si.getBytesPerPixel();
-                void *buffer = ::malloc(compressedSize);
-                if (buffer != NULL) {
-                    // As we are transforming a SharedImage into a CompressedImage, attached to the shared memory segment.
-                    std::shared_ptr<odcore::wrapper::SharedMemory> memory = odcore::wrapper::SharedMemoryFactory::attachToSharedMemory(si.getName());
-                    if (memory->isValid()) {
-                        Lock l(memory);
-                        retVal = odcore::wrapper::jpg::JPG::compress(buffer, compressedSize, si.getWidth(), si.getHeight(), si.getBytesPerPixel(), static_cast<const unsigned char*>(memory->getSharedMemory()), m_jpegQuality);
+                const uint32_t size = si.getWidth() * si.getHeight() * si.getBytesPerPixel();
+                if (m_frame.size() < size) {
+                    m_frame.resize(size);
+                    m_compressedData.resize(size);
+                }
+                int compressedSize = static_cast<int>(size);
+                if (size > 0) {
+                    // As we are transforming a SharedImage into a CompressedImage, attach to the shared memory segment
+                    // and compress a copy of the image to not stall the producer during compression.
+                    std::shared_ptr<odcore::data::image::SharedImageChannel> &channel = m_sharedImageChannels[si.getName()];
+                    if (!channel.get()) {
+                        channel = std::shared_ptr<odcore::data::image::SharedImageChannel>(new odcore::data::image::SharedImageChannel(si));
+                    }
+                    if (!channel->isValid()) {
+                        // Try to attach again with the next image.
+                        m_sharedImageChannels.erase(si.getName());
+                    }
+                    else if (channel->read(reinterpret_cast<char*>(&m_frame[0]), size)) {
+                        retVal = m_encoder.compress(&m_compressedData[0], compressedSize, si.getWidth(), si.getHeight(), si.getBytesPerPixel(), &m_frame[0], m_jpegQuality);
                     }
-
                 }
-                // Check if the size of the compressed image fits in a UDP packet.
-                const int32_t MAX_SIZE_UDP_PAYLOAD = 65000;
-                if ( retVal && (compressedSize < MAX_SIZE_UDP_PAYLOAD) ) {
+                // Large compressed images are split into fragments by the conference.
+                if (retVal) {
                     // Create the CompressedImage data structure.
                     odcore::data::image::CompressedImage ci(si.getName(), si.getWidth(), si.getHeight(), si.getBytesPerPixel(), compressedSize);
-                    ::memcpy(ci.getRawData(), buffer, compressedSize);
+                    ::memcpy(ci.getRawData(), &m_compressedData[0], compressedSize);
 
                     // Write the CompressedImage container to STDOUT.
                     odcore::data::Container c(ci);
@@ -78,14 +88,9 @@ namespace odredirector {
                     c.setReceivedTimeStamp(container.getReceivedTimeStamp());
                     std::cout << c;
                 }
-                if (compressedSize >= MAX_SIZE_UDP_PAYLOAD) {
-                    cerr << "[odredirector]: Warning! Compressed image too large (" << compressedSize << " bytes) to fit in a UDP packet. Image skipped." << std::endl;
-                }
                 if (!retVal) {
                     cerr << "[odredirector]: Warning! Failed to compress image. Image skipped." << std::endl;
                 }
-                // Free pointer to compressed data.
-                OPENDAVINCI_CORE_FREE_POINTER(buffer);
             }
             else {
                 cerr << "[odredirector]: Warning! Color space not supported. Image skipped." << std::endl;
@@ -75,7 +75,9 @@ namespace odsplit {
         private:
             string m_source;
             string m_range;
+            string m_destination;
             int32_t m_memorySegmentSize;
+            bool m_compression;
     };
 
 } // odsplit
@@ -35,7 +35,9 @@ namespace odsplit {
     Split::Split() :
         m_source(),
         m_range(),
-        m_memorySegmentSize(0) {}
+        m_destination(),
+        m_memorySegmentSize(0),
+        m_compression(false) {}
 
     Split::~Split() {}
 
@@ -44,12 +46,16 @@ namespace odsplit {
         cmdParser.addCommandLineArgument("source");
         cmdParser.addCommandLineArgument("range");
         cmdParser.addCommandLineArgument("memorysegmentsize");
+        cmdParser.addCommandLineArgument("compress");
+        cmdParser.addCommandLineArgument("destination");
 
         cmdParser.parse(argc, argv);
 
         CommandLineArgument cmdArgumentSOURCE = cmdParser.getCommandLineArgument("source");
         CommandLineArgument cmdArgumentRANGE = cmdParser.getCommandLineArgument("range");
         CommandLineArgument cmdArgumentMEMORYSEGMENTSIZE = cmdParser.getCommandLineArgument("memorysegmentsize");
+        CommandLineArgument cmdArgumentCOMPRESS = cmdParser.getCommandLineArgument("compress");
+        CommandLineArgument cmdArgumentDESTINATION = cmdParser.getCommandLineArgument("destination");
 
         if (cmdArgumentSOURCE.isSet()) {
             m_source = cmdArgumentSOURCE.getValue<string>();
@@ -65,6 +71,15 @@ namespace odsplit {
             m_memorySegmentSize = cmdArgumentMEMORYSEGMENTSIZE.getValue<int32_t>();
         }
 
+        if (cmdArgumentCOMPRESS.isSet()) {
+            m_compression = (cmdArgumentCOMPRESS.getValue<int32_t>() == 1);
+        }
+
+        if (cmdArgumentDESTINATION.isSet()) {
+            m_destination = cmdArgumentDESTINATION.getValue<string>();
+            odcore::strings::StringToolbox::trim(m_destination);
+        }
+
         const int32_t MINIMUM_MEMORY_SEGMENT_SIZE = 640*480*1;
         if (m_memorySegmentSize < MINIMUM_MEMORY_SEGMENT_SIZE) {
             cerr << "[odsplit] Specified memorySegmentSize is too small, using " << MINIMUM_MEMORY_SEGMENT_SIZE << " bytes." << endl;
@@ -96,12 +111,23 @@ namespace odsplit {
 
             if (start < end) {
                 Splitter s;
-                s.process(m_source, m_memorySegmentSize, start, end);
+                if (m_destination.empty()) {
+                    s.process(m_source, m_memorySegmentSize, start, end, m_compression);
+                }
+                else {
+                    s.process(m_source, m_destination, m_memorySegmentSize, start, end, m_compression);
+                }
             }
             else {
                 retVal = END_SMALLER_THAN_START;
             }
         }
+        else if (m_compression) {
+            // Convert the entire recording to the block compressed format.
+            const string destination = (m_destination.empty() ? (m_source + "_compressed.rec") : m_destination);
+            Splitter s;
+            s.process(m_source, destination, m_memorySegmentSize, m_compression);
+        }
 
         return retVal;
     }
@@ -40,6 +40,7 @@
 #include "opendavinci/GeneratedHeaders_OpenDaVINCI.h"
 
 #include "opendavinci/odtools/player/Player.h"
+#include "opendavinci/odtools/player/RecordingReader.h"
 #include "opendavinci/odtools/recorder/Recorder.h"
 
 // Include local header files.
@@ -210,6 +211,67 @@ class SplitTest : public CxxTest::TestSuite {
             // Run the split.
             TS_ASSERT(split.run(argc, argv) == 1);
         }
+
+        void testSplitCompress() {
+            // Prepare the data that would be available from commandline.
+            string argv0("odsplit");
+            string argv1("--source=A.rec");
+            string argv2("--compress=1");
+            string argv3("--memorysegmentsize=1000");
+            int32_t argc = 4;
+            char **argv;
+            argv = new char*[4];
+            argv[0] = const_cast<char*>(argv0.c_str());
+            argv[1] = const_cast<char*>(argv1.c_str());
+            argv[2] = const_cast<char*>(argv2.c_str());
+            argv[3] = const_cast<char*>(argv3.c_str());
+
+            // Create an instance of split.
+            Split split;
+
+            // Convert the entire recording.
+            TS_ASSERT(split.run(argc, argv) == 0);
+
+            RecordingReader reader("A.rec_compressed.rec");
+            TS_ASSERT(reader.isCompressed());
+
+            // Stop playback at EOF.
+            const bool AUTO_REWIND = false;
+            // Run player in synchronous mode.
+            const bool THREADING = false;
+            // Construct player.
+            string file("file://A.rec_compressed.rec");
+            Player player(file, AUTO_REWIND, MEMORY_SEGMENT_SIZE, NUMBER_OF_SEGMENTS, THREADING);
+
+            int32_t timeStamps = 0;
+            int32_t sharedMemorySegments = 0;
+            const uint32_t MAX_ITERATIONS = 1000;
+            uint32_t i = 0;
+
+            while (player.hasMoreData() && (i < MAX_ITERATIONS)) {
+                i++;
+                // Get container to be sent.
+                Container nextContainer = player.getNextContainerToBeSent();
+
+                if (nextContainer.getDataType() == TimeStamp::ID()) {
+                    TimeStamp ts = nextContainer.getData<TimeStamp>();
+                    TS_ASSERT(ts.getSeconds() == timeStamps);
+                    timeStamps++;
+                }
+                else if (nextContainer.getDataType() == odcore::data::SharedData::ID()) {
+                    sharedMemorySegments++;
+                }
+            }
+
+            // All containers and shared memory segments are converted.
+            TS_ASSERT(timeStamps == 200);
+            TS_ASSERT(sharedMemorySegments == 200);
+
+            // Clean up temporarily created files.
+            UNLINK("A.rec_compressed.rec");
+            UNLINK("A.rec_compressed.rec.mem");
+            UNLINK("A.rec_compressed.rec.idx");
+        }
 };
 
 #endif /*SPLITTESTSUITE_H_*/